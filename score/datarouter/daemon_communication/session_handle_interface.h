@@ -14,6 +14,8 @@
 #ifndef SCORE_DATAROUTER_DAEMON_COMMUNICATION_SESSION_HANDLE_INTERFACE_H
 #define SCORE_DATAROUTER_DAEMON_COMMUNICATION_SESSION_HANDLE_INTERFACE_H
 
+#include <cstdint>
+
 namespace score
 {
 namespace platform
@@ -27,6 +29,8 @@ class ISessionHandle
 {
   public:
     virtual bool AcquireRequest() const = 0;
+    /// \brief Tells the client the slot of the shared-memory pool block created for it.
+    virtual bool GrantPoolBlock(const std::uint32_t slot) const = 0;
     virtual ~ISessionHandle() = default;
 };
 
@@ -25,6 +25,7 @@ class SessionHandleMock : public score::platform::internal::daemon::ISessionHand
 {
   public:
     MOCK_METHOD(bool, AcquireRequest, (), (const, override));
+    MOCK_METHOD(bool, GrantPoolBlock, (const std::uint32_t slot), (const, override));
 };
 
 }  // namespace score::platform::internal::daemon::mock
@@ -22,7 +22,9 @@
 #include "score/overload.hpp"
 
 #include <algorithm>
+#include <functional>
 #include <iostream>
+#include <numeric>
 #include <sstream>
 
 namespace score
@@ -42,6 +44,39 @@ namespace
 /// kTicksWithoutAcquireWhileNoWrites polling intervals.
 constexpr std::uint8_t kTicksWithoutAcquireWhileNoWrites = 10UL;
 
+/// Value of block_being_written_ until the first acquire response is received.
+constexpr std::uint64_t kNoBlockBeingWritten = std::numeric_limits<std::uint64_t>::max();
+
+/// Value of pending_acquisition_ while no acquire response awaits its tick.
+constexpr std::uint64_t kNoPendingAcquisition = std::numeric_limits<std::uint64_t>::max();
+
+/// pending_acquisition_ keeps the pool requests of an acquire response above the acquired buffer.
+constexpr std::uint32_t kRequestedPoolBlocksShift{32U};
+constexpr std::uint32_t kReturnedPoolBlocksShift{40U};
+
+std::uint64_t PackAcquisition(const score::mw::log::detail::ReadAcquireResult& acq) noexcept
+{
+    return static_cast<std::uint64_t>(acq.acquired_buffer) |
+           (static_cast<std::uint64_t>(acq.requested_pool_blocks) << kRequestedPoolBlocksShift) |
+           (static_cast<std::uint64_t>(acq.returned_pool_blocks) << kReturnedPoolBlocksShift);
+}
+
+score::mw::log::detail::ReadAcquireResult UnpackAcquisition(const std::uint64_t pending_acquisition) noexcept
+{
+    score::mw::log::detail::ReadAcquireResult acq{};
+    acq.acquired_buffer = static_cast<std::uint32_t>(pending_acquisition);
+    acq.requested_pool_blocks = static_cast<std::uint8_t>(pending_acquisition >> kRequestedPoolBlocksShift);
+    acq.returned_pool_blocks = static_cast<std::uint8_t>(pending_acquisition >> kReturnedPoolBlocksShift);
+    return acq;
+}
+
+/// Number of bytes of records a session reads per tick. The rest of a larger block is read by the following ticks, so
+/// that a client with a full buffer does not hold a worker while the buffers of other clients fill up.
+constexpr std::uint64_t kMaxBytesReadPerTick = 256UL * 1024UL;
+
+/// Number of entries read ahead of the stage thread in pipelined mode, before the reading tick waits for it.
+constexpr std::size_t kPipelineQueueCapacity = 1024U;
+
 template <typename T>
 score::mw::log::LogStream& operator<<(score::mw::log::LogStream& log_stream, const std::optional<T>& data) noexcept
 {
@@ -76,8 +111,18 @@ std::string QuotaValueAsString(double quota) noexcept
     return ss.str();
 }
 
-DataRouter::DataRouter(score::mw::log::Logger& logger, std::unique_ptr<ILogParserFactory> log_parser_factory)
-    : stats_logger_(logger), log_parser_factory_(std::move(log_parser_factory))
+DataRouter::DataRouter(score::mw::log::Logger& logger,
+                       std::unique_ptr<ILogParserFactory> log_parser_factory,
+                       const double overall_quota_k_bps,
+                       const std::size_t pipeline_stage_count,
+                       const ThreadPlacements* const thread_placements)
+    : stats_logger_(logger),
+      log_parser_factory_(std::move(log_parser_factory)),
+      throughput_budget_(overall_quota_k_bps),
+      thread_placements_(thread_placements),
+      pipeline_stages_(pipeline_stage_count > 0U
+                           ? std::make_unique<PipelineStages>(pipeline_stage_count, thread_placements)
+                           : nullptr)
 {
 }
 
@@ -158,8 +203,9 @@ std::unique_ptr<DataRouter::SourceSession> DataRouter::NewSourceSessionImpl(
 
 bool DataRouter::SourceSession::Tick()
 {
-    if (local_subscriber_data_.lock()->detach_on_closed_processed)
+    if (detach_on_closed_processed_.load(std::memory_order_relaxed))
     {
+        tick_activity_ = MessagePassingServer::TickActivity::kIdle;
         return false;
     }
 
@@ -169,137 +215,154 @@ bool DataRouter::SourceSession::Tick()
 
     uint64_t message_count_local = 0;
     uint64_t number_of_bytes_in_buffer = 0;
-    std::chrono::microseconds transport_delay_local = std::chrono::microseconds::zero();
     auto start = score::os::HighResolutionSteadyClock::now();
 
-    ProcessAndRouteLogMessages(message_count_local,
-                               transport_delay_local,
-                               number_of_bytes_in_buffer,
-                               acquire_finalized,
-                               needs_fast_reschedule);
+    ProcessAndRouteLogMessages(
+        message_count_local, number_of_bytes_in_buffer, acquire_finalized, needs_fast_reschedule);
+
+    UpdateAndLogStats(number_of_bytes_in_buffer, start);
 
-    UpdateAndLogStats(message_count_local, number_of_bytes_in_buffer, transport_delay_local, start);
+    if (reader_->IsReadPending())
+    {
+        tick_activity_ = MessagePassingServer::TickActivity::kYielded;
+    }
+    else if (needs_fast_reschedule)
+    {
+        tick_activity_ = MessagePassingServer::TickActivity::kPending;
+    }
+    else if ((message_count_local > 0U) || (number_of_bytes_in_buffer > 0U))
+    {
+        tick_activity_ = MessagePassingServer::TickActivity::kActive;
+    }
+    else
+    {
+        tick_activity_ = MessagePassingServer::TickActivity::kIdle;
+    }
 
     // NOTE: keep historical external API: tick() returns false.
-    // Scheduler/tests rely on this; internal reschedule hint is tracked via needs_fast_reschedule.
+    // Scheduler/tests rely on this; the reschedule hint is reported via GetTickActivity().
     return false;
 }
 
 bool DataRouter::SourceSession::TryFinalizeAcquisition(bool& needs_fast_reschedule)
 {
-    std::optional<score::mw::log::detail::ReadAcquireResult> data_acquired_local;
-
-    data_acquired_local = command_data_.lock()->data_acquired;
-
-    if (data_acquired_local.has_value())
+    const std::uint64_t acquired_block = pending_acquisition_.load(std::memory_order_acquire);
+    if (acquired_block == kNoPendingAcquisition)
     {
-        if (reader_->IsBlockReleasedByWriters(data_acquired_local.value().acquired_buffer))
-        {
-            std::ignore = reader_->NotifyAcquisitionSetReader(data_acquired_local.value());
-            command_data_.lock()->data_acquired = std::nullopt;
+        return false;
+    }
 
-            return true;
-        }
-        else
-        {
-            needs_fast_reschedule = true;
-        }
+    const auto data_acquired = UnpackAcquisition(acquired_block);
+    if (!reader_->IsBlockReleasedByWriters(data_acquired.acquired_buffer))
+    {
+        needs_fast_reschedule = true;
+        return false;
     }
 
-    return false;
+    std::ignore = reader_->NotifyAcquisitionSetReader(data_acquired);
+    const auto pool_block_grant = reader_->TakePoolBlockGrant();
+    if (pool_block_grant.has_value())
+    {
+        GrantPoolBlock(pool_block_grant.value());
+    }
+    block_expected_to_be_next_ = GetExpectedNextAcquiredBlockId(data_acquired);
+    // an acquire response received in the meantime stays pending for the next tick
+    std::uint64_t expected_block = acquired_block;
+    std::ignore = pending_acquisition_.compare_exchange_strong(
+        expected_block, kNoPendingAcquisition, std::memory_order_relaxed);
+    return true;
 }
 
 void DataRouter::SourceSession::ProcessAndRouteLogMessages(uint64_t& message_count_local,
-                                                           std::chrono::microseconds& transport_delay_local,
                                                            uint64_t& number_of_bytes_in_buffer,
                                                            bool acquire_finalized_in_this_tick,
                                                            bool& needs_fast_reschedule)
 {
     const auto current_timestamp = std::chrono::steady_clock::now();
 
+    stats_.time_between_to_calls =
+        std::chrono::duration_cast<std::chrono::microseconds>(current_timestamp - last_call_timestamp_);
+    last_call_timestamp_ = current_timestamp;
+
+    if (pipeline_queue_ == nullptr)
     {
-        auto locked_data = local_subscriber_data_.lock();
-        locked_data->time_between_to_calls =
-            std::chrono::duration_cast<std::chrono::microseconds>(current_timestamp - locked_data->last_call_timestamp);
-        locked_data->last_call_timestamp = current_timestamp;
+        StartRecordBatch(current_timestamp);
     }
 
-    bool quota_limit_exceeded = stats_data_.lock()->quota_overlimit_detected;
-
     score::mw::log::detail::TypeRegistrationCallback on_new_type =
         [this](const score::mw::log::detail::TypeRegistration& registration) noexcept {
-            parser_->AddIncomingType(registration);
+            RouteTypeRegistration(registration);
         };
 
     score::mw::log::detail::NewRecordCallback on_new_record =
-        [this, &message_count_local, &transport_delay_local, quota_limit_exceeded](
-            const score::mw::log::detail::SharedMemoryRecord& record) noexcept {
-            if (quota_limit_exceeded)
-            {
-                return;
-            }
-
-            auto record_received_timestamp = score::mw::log::detail::TimePoint::clock::now();
-            parser_->ParseSharedMemoryRecord(record);
+        [this, &message_count_local](const score::mw::log::detail::SharedMemoryRecord& record) noexcept {
             ++message_count_local;
-
-            transport_delay_local = std::max(transport_delay_local,
-                                             std::chrono::duration_cast<std::chrono::microseconds>(
-                                                 record_received_timestamp - record.header.time_stamp));
+            RouteRecord(record);
         };
 
-    bool detach_needed = false;
-    const auto number_of_bytes_in_buffer_result = reader_->Read(on_new_type, on_new_record);
+    const auto number_of_bytes_in_buffer_result =
+        reader_->ReadBounded(on_new_type, on_new_record, kMaxBytesReadPerTick);
     if (number_of_bytes_in_buffer_result.has_value())
     {
         number_of_bytes_in_buffer = number_of_bytes_in_buffer_result.value();
     }
+    // the rest of a larger block is read by the next ticks, no new block is requested before
+    const bool read_pending = reader_->IsReadPending();
 
-    detach_needed = command_data_.lock()->command_detach_on_closed;
+    const bool detach_needed = command_detach_on_closed_.load(std::memory_order_acquire);
 
     if (detach_needed)
     {
-        local_subscriber_data_.lock()->detach_on_closed_processed = true;
+        detach_on_closed_processed_.store(true, std::memory_order_release);
         ProcessDetachedLogs(number_of_bytes_in_buffer);
     }
 
-    bool enabled_logging = local_subscriber_data_.lock()->enabled_logging_at_server;
+    if (pipeline_queue_ == nullptr)
+    {
+        FinishRecordBatch();
+    }
+    else
+    {
+        pipeline_stages_->Notify(pipeline_stage_, *this);
+    }
+
+    const bool enabled_logging = enabled_logging_at_server_.load(std::memory_order_relaxed);
 
+    if (acquire_finalized_in_this_tick)
     {
-        auto cmd = command_data_.lock();
-        if (acquire_finalized_in_this_tick)
+        acquire_requested_ = false;
+        ticks_without_write_ = 0;
+    }
+    else if (!acquire_requested_ && enabled_logging && !detach_needed && !read_pending)
+    {
+        if (!IsPipelineDrained())
         {
-            cmd->acquire_requested = false;
-            cmd->ticks_without_write = 0;
+            // the next acquisition lets the writers reuse the block the pipeline still refers to
+            needs_fast_reschedule = true;
         }
-        else if (!cmd->acquire_requested && enabled_logging && !detach_needed)
+        else if (block_expected_to_be_next_.has_value())
         {
-            if (cmd->block_expected_to_be_next.has_value())
+            const auto peek_bytes = reader_->PeekNumberOfBytesAcquiredInBuffer(block_expected_to_be_next_.value());
+
+            if ((peek_bytes.has_value() && peek_bytes.value() > 0) ||
+                (ticks_without_write_ > kTicksWithoutAcquireWhileNoWrites))
             {
-                const auto peek_bytes =
-                    reader_->PeekNumberOfBytesAcquiredInBuffer(cmd->block_expected_to_be_next.value());
-
-                if ((peek_bytes.has_value() && peek_bytes.value() > 0) ||
-                    (cmd->ticks_without_write > kTicksWithoutAcquireWhileNoWrites))
-                {
-                    cmd->acquire_requested = RequestAcquire();
-                    needs_fast_reschedule = cmd->acquire_requested;
-                }
-                else
-                {
-                    auto& ticks = cmd->ticks_without_write;
-                    ++ticks;
-                }
+                acquire_requested_ = RequestAcquire();
+                needs_fast_reschedule = acquire_requested_;
             }
             else
             {
-                cmd->acquire_requested = RequestAcquire();
-                needs_fast_reschedule = cmd->acquire_requested;
+                ++ticks_without_write_;
             }
         }
+        else
+        {
+            acquire_requested_ = RequestAcquire();
+            needs_fast_reschedule = acquire_requested_;
+        }
     }
 
-    local_subscriber_data_.lock()->time_to_process_records =
+    stats_.time_to_process_records =
         std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - current_timestamp);
 }
 
@@ -307,10 +370,10 @@ void DataRouter::SourceSession::ProcessDetachedLogs(uint64_t& number_of_bytes_in
 {
     const auto number_of_bytes_in_buffer_result_detached = reader_->ReadDetached(
         [this](const auto& registration) noexcept {
-            parser_->AddIncomingType(registration);
+            RouteTypeRegistration(registration);
         },
         [this](const auto& record) noexcept {
-            parser_->ParseSharedMemoryRecord(record);
+            RouteRecord(record);
         });
 
     if (number_of_bytes_in_buffer_result_detached.has_value())
@@ -318,48 +381,180 @@ void DataRouter::SourceSession::ProcessDetachedLogs(uint64_t& number_of_bytes_in
         number_of_bytes_in_buffer = number_of_bytes_in_buffer_result_detached.value();
     }
 
-    std::string name = stats_data_.lock()->name;
-    stats_logger_.LogError() << name << ": detached logs processed: " << number_of_bytes_in_buffer_result_detached;
+    stats_logger_.LogError() << name_ << ": detached logs processed: " << number_of_bytes_in_buffer_result_detached;
 }
 
-void DataRouter::SourceSession::UpdateAndLogStats(uint64_t message_count_local,
-                                                  uint64_t number_of_bytes_in_buffer,
-                                                  std::chrono::microseconds transport_delay_local,
-                                                  score::os::HighResolutionSteadyClock::time_point start)
+void DataRouter::SourceSession::RouteTypeRegistration(const score::mw::log::detail::TypeRegistration& registration)
 {
+    if (pipeline_queue_ == nullptr)
     {
-        auto stats = stats_data_.lock();
+        parser_->AddIncomingType(registration);
+        return;
+    }
+    PushToPipeline(PipelineEntry{true, registration, {}});
+}
+
+void DataRouter::SourceSession::RouteRecord(const score::mw::log::detail::SharedMemoryRecord& record)
+{
+    if (pipeline_queue_ == nullptr)
+    {
+        ProcessRecord(record);
+        return;
+    }
+    PushToPipeline(PipelineEntry{false, {}, record});
+}
+
+void DataRouter::SourceSession::PushToPipeline(const PipelineEntry& entry)
+{
+    // back pressure: the reader sleeps until the stage drained the queue, as the entries refer to the acquired block
+    while (!pipeline_queue_->TryPush(entry))
+    {
+        if (!pipeline_stages_->WaitForDrain(pipeline_stage_, *this))
+        {
+            return;  // LCOV_EXCL_LINE: the stage threads only exit with the router
+        }
+    }
+    ++pipeline_pushed_;
+}
+
+bool DataRouter::SourceSession::IsPipelineDrained() const
+{
+    return pipeline_processed_.load(std::memory_order_acquire) == pipeline_pushed_;
+}
+
+void DataRouter::SourceSession::Drain()
+{
+    StartRecordBatch(std::chrono::steady_clock::now());
 
-        const auto message_count_dropped_new = reader_->GetNumberOfDropsWithBufferFull();
-        const auto size_dropped_new = reader_->GetSizeOfDropsWithBufferFull();
-        if (message_count_dropped_new != stats->message_count_dropped)
+    uint64_t processed = pipeline_processed_.load(std::memory_order_relaxed);
+    PipelineEntry entry{};
+    while (pipeline_queue_->TryPop(entry))
+    {
+        if (entry.is_type_registration)
         {
-            stats_logger_.LogError() << stats->name << ": message drop detected: "
-                                     << message_count_dropped_new - stats->message_count_dropped << " messages, "
-                                     << size_dropped_new - stats->size_dropped << " bytes lost due to buffer full!";
-            stats->message_count_dropped = message_count_dropped_new;
-            stats->size_dropped = size_dropped_new;
+            parser_->AddIncomingType(entry.type_registration);
         }
+        else
+        {
+            ProcessRecord(entry.record);
+        }
+        ++processed;
+    }
+
+    FinishRecordBatch();
+    record_stats_snapshot_.Publish(record_stats_);
+    pipeline_processed_.store(processed, std::memory_order_release);
+}
+
+void DataRouter::SourceSession::StartRecordBatch(const std::chrono::steady_clock::time_point now)
+{
+    quota_bucket_.Refill(now);
+    budget_grant_ = router_.throughput_budget_.Acquire(budget_share_, now);
+    budget_batch_grant_ = budget_grant_;
+    budget_batch_used_ = false;
+
+    // the transport delay is a maximum per statistics interval, started over when the output moved to the next one
+    const auto stats_interval = stats_interval_.load(std::memory_order_relaxed);
+    if (stats_interval != record_stats_.stats_interval)
+    {
+        record_stats_.stats_interval = stats_interval;
+        record_stats_.transport_delay = std::chrono::microseconds::zero();
+    }
+}
+
+void DataRouter::SourceSession::ProcessRecord(const score::mw::log::detail::SharedMemoryRecord& record)
+{
+    const auto record_size = score::mw::log::detail::GetDataSizeAsLength(record.payload);
+    const bool budget_enforced = !router_.throughput_budget_.IsUnlimited();
+
+    // the severity is only needed, and thus only looked up, while the quota or the overall budget is enforced
+    std::optional<score::mw::log::LogLevel> log_level{};
+    if (!quota_bucket_.IsUnlimited() || budget_enforced)
+    {
+        log_level = parser_->GetLogLevel(record);
+    }
+
+    // the quota of the client is checked first, so that the records it sheds do not use up the overall budget
+    if (!quota_bucket_.IsUnlimited() && !quota_bucket_.TryConsume(record_size, log_level))
+    {
+        return;
+    }
 
-        const auto message_count_dropped_invalid_size_new = reader_->GetNumberOfDropsWithInvalidSize();
-        if (message_count_dropped_invalid_size_new != stats->message_count_dropped_invalid_size)
+    // sessions shedding records for the overall budget still compete for it
+    budget_batch_used_ = true;
+    if (budget_enforced)
+    {
+        // like the quota, the overall budget keeps a reserve of the grant for the more severe levels
+        const double reserve =
+            budget_batch_grant_ * GetShedReserveFraction(log_level.value_or(score::mw::log::LogLevel::kInfo));
+        if ((budget_grant_ - static_cast<double>(record_size)) < reserve)
         {
-            stats_logger_.LogError() << stats->name << ": message drop detected: "
-                                     << message_count_dropped_invalid_size_new -
-                                            stats->message_count_dropped_invalid_size
-                                     << " messages lost due to invalid size!";
-            stats->message_count_dropped_invalid_size = message_count_dropped_invalid_size_new;
+            ++record_stats_.budget_shed_count;
+            return;
         }
+        budget_grant_ -= static_cast<double>(record_size);
+    }
+
+    auto record_received_timestamp = score::mw::log::detail::TimePoint::clock::now();
+    parser_->ParseSharedMemoryRecord(record);
+    ++record_stats_.message_count;
+
+    record_stats_.transport_delay =
+        std::max(record_stats_.transport_delay,
+                 std::chrono::duration_cast<std::chrono::microseconds>(record_received_timestamp -
+                                                                       record.header.time_stamp));
+}
+
+void DataRouter::SourceSession::FinishRecordBatch()
+{
+    const auto shed_counts = quota_bucket_.TakeShedCounts();
+    std::transform(shed_counts.cbegin(),
+                   shed_counts.cend(),
+                   record_stats_.quota_shed_counts.cbegin(),
+                   record_stats_.quota_shed_counts.begin(),
+                   std::plus<>{});
+
+    router_.throughput_budget_.Release(
+        budget_share_, budget_grant_, budget_batch_used_, std::chrono::steady_clock::now());
+}
 
-        stats->message_count += message_count_local;
-        stats->totalsize += number_of_bytes_in_buffer;
-        stats->max_bytes_in_buffer = std::max(stats->max_bytes_in_buffer, number_of_bytes_in_buffer);
-        stats->transport_delay = std::max(stats->transport_delay, transport_delay_local);
-        stats->time_spent_reading +=
-            std::chrono::duration_cast<std::chrono::microseconds>(score::platform::TimestampT::clock::now() - start);
+void DataRouter::SourceSession::UpdateAndLogStats(uint64_t number_of_bytes_in_buffer,
+                                                  score::os::HighResolutionSteadyClock::time_point start)
+{
+    const auto message_count_dropped_new = reader_->GetNumberOfDropsWithBufferFull();
+    const auto size_dropped_new = reader_->GetSizeOfDropsWithBufferFull();
+    if (message_count_dropped_new != stats_.message_count_dropped)
+    {
+        stats_logger_.LogError() << name_ << ": message drop detected: "
+                                 << message_count_dropped_new - stats_.message_count_dropped << " messages, "
+                                 << size_dropped_new - size_dropped_ << " bytes lost due to buffer full!";
+        stats_.message_count_dropped = message_count_dropped_new;
+        size_dropped_ = size_dropped_new;
     }
 
-    CheckAndSetQuotaEnforcement();
+    const auto message_count_dropped_invalid_size_new = reader_->GetNumberOfDropsWithInvalidSize();
+    if (message_count_dropped_invalid_size_new != message_count_dropped_invalid_size_)
+    {
+        stats_logger_.LogError() << name_ << ": message drop detected: "
+                                 << message_count_dropped_invalid_size_new - message_count_dropped_invalid_size_
+                                 << " messages lost due to invalid size!";
+        message_count_dropped_invalid_size_ = message_count_dropped_invalid_size_new;
+    }
+
+    // in pipelined mode, the records are processed by the stage thread, which publishes their statistics
+    const RecordStats record_stats = (pipeline_queue_ == nullptr) ? record_stats_ : record_stats_snapshot_.Read();
+    stats_.message_count = record_stats.message_count;
+    stats_.quota_shed_counts = record_stats.quota_shed_counts;
+    stats_.budget_shed_count = record_stats.budget_shed_count;
+    stats_.transport_delay = record_stats.transport_delay;
+    stats_.stats_interval = record_stats.stats_interval;
+
+    stats_.totalsize += number_of_bytes_in_buffer;
+    stats_.max_bytes_in_buffer = std::max(stats_.max_bytes_in_buffer, number_of_bytes_in_buffer);
+    stats_.time_spent_reading +=
+        std::chrono::duration_cast<std::chrono::microseconds>(score::platform::TimestampT::clock::now() - start);
+
+    stats_snapshot_.Publish(stats_);
 }
 
 DataRouter::SourceSession::SourceSession(DataRouter& router,
@@ -373,34 +568,60 @@ DataRouter::SourceSession::SourceSession(DataRouter& router,
                                          std::unique_ptr<score::platform::internal::ILogParser> parser)
     : UnixDomainServer::ISession{},
       MessagePassingServer::ISession{},
-      local_subscriber_data_(LocalSubscriberData{}),
-      command_data_(CommandData{}),
-      stats_data_(StatsData{}),
       router_(router),
       reader_(std::move(reader)),
       parser_(std::move(parser)),
       handle_(std::move(handle)),
-      stats_logger_(stats_logger)
+      stats_logger_(stats_logger),
+      name_(name),
+      quota_k_bps_(quota),
+      quota_enforcement_enabled_(quota_enforcement_enabled),
+      last_call_timestamp_(std::chrono::steady_clock::now()),
+      acquire_requested_(false),
+      ticks_without_write_(0U),
+      block_expected_to_be_next_(std::nullopt),
+      size_dropped_(0U),
+      message_count_dropped_invalid_size_(0U),
+      stats_(),
+      tick_activity_(MessagePassingServer::TickActivity::kIdle),
+      pipeline_pushed_(0U),
+      quota_bucket_(std::numeric_limits<double>::max()),
+      budget_share_(0U),
+      budget_grant_(0.0),
+      budget_batch_grant_(0.0),
+      budget_batch_used_(false),
+      record_stats_(),
+      pipeline_stages_(router.pipeline_stages_.get()),
+      pipeline_stage_((pipeline_stages_ != nullptr) ? pipeline_stages_->AssignStage() : 0U),
+      pipeline_queue_((pipeline_stages_ != nullptr)
+                          ? std::make_unique<SpscRingQueue<PipelineEntry>>(kPipelineQueueCapacity)
+                          : nullptr),
+      pipeline_processed_(0U),
+      record_stats_snapshot_(),
+      enabled_logging_at_server_(is_dlt_enabled),
+      command_detach_on_closed_(false),
+      detach_on_closed_processed_(false),
+      pending_acquisition_(kNoPendingAcquisition),
+      block_being_written_(kNoBlockBeingWritten),
+      stats_snapshot_(),
+      stats_interval_(0U),
+      stats_shown_(),
+      stats_interval_start_(last_call_timestamp_)
 {
-    local_subscriber_data_.lock()->enabled_logging_at_server = is_dlt_enabled;
+    if (name_ == "DR")
     {
-        auto stats = stats_data_.lock();
-        stats->quota_k_bps = quota;
-        stats->quota_enforcement_enabled = quota_enforcement_enabled;
-        stats->name = name;
+        constexpr double kNewQuotaValue = std::numeric_limits<double>::max();
+        stats_logger_.LogInfo() << "Override quota value for Datarouter (to be unlimited). Old value: "
+                                << QuotaValueAsString(quota_k_bps_)
+                                << ", new value: " << QuotaValueAsString(kNewQuotaValue);
+        quota_k_bps_ = kNewQuotaValue;
     }
-
+    if (quota_enforcement_enabled_)
     {
-        auto stats = stats_data_.lock();
-        if (stats->name == "DR")
-        {
-            constexpr double kNewQuotaValue = std::numeric_limits<double>::max();
-            stats_logger_.LogInfo() << "Override quota value for Datarouter (to be unlimited). Old value: "
-                                    << QuotaValueAsString(stats->quota_k_bps)
-                                    << ", new value: " << QuotaValueAsString(kNewQuotaValue);
-            stats->quota_k_bps = kNewQuotaValue;
-        }
+        quota_bucket_ = QuotaTokenBucket{quota_k_bps_};
     }
+    // the quota weights the share of the overall budget, also when it is not enforced per source
+    budget_share_ = router_.throughput_budget_.Register(quota_k_bps_);
 }
 
 DataRouter::SourceSession::~SourceSession()
@@ -409,72 +630,43 @@ DataRouter::SourceSession::~SourceSession()
         std::lock_guard<std::mutex> lock(router_.subscriber_mutex_);
         std::ignore = router_.sources_.erase(this);
     }
+    router_.throughput_budget_.Unregister(budget_share_);
 
-    stats_logger_.LogInfo() << "Cleaning up source session for " << stats_data_.lock()->name;
-}
-
-void DataRouter::SourceSession::CheckAndSetQuotaEnforcement()
-{
-    auto stats = stats_data_.lock();
-    if (!stats->quota_overlimit_detected && stats->quota_enforcement_enabled)
+    if (pipeline_queue_ != nullptr)
     {
-        const auto time_now = std::chrono::steady_clock::now();
-        const auto tstat_in_msec =
-            std::chrono::duration_cast<std::chrono::milliseconds>(time_now - stats->start).count();
-
-        if (tstat_in_msec == 0)
-        {
-            stats_logger_.LogError()
-                << stats->name
-                << ": time duration is 0. Data rate could not be calculated. Quota enforcement is not applied.";
-            return;
-        }
-
-        const auto rate_k_bps =
-            static_cast<double>(stats->totalsize) * 1000. / 1024. / static_cast<double>(tstat_in_msec);
-
-        stats_logger_.LogInfo() << stats->name << "quota status. rate: " << rate_k_bps
-                                << ", quota_KBps_: " << QuotaValueAsString(stats->quota_k_bps)
-                                << ", totalsize_: " << stats->totalsize << ", tstat_in_msec: " << tstat_in_msec;
-
-        if (rate_k_bps > stats->quota_k_bps)
-        {
-            stats_logger_.LogError() << stats->name
-                                     << ": exceeded the quota. quota enforcement set. rate: " << rate_k_bps
-                                     << ", quota_KBps: " << QuotaValueAsString(stats->quota_k_bps);
-            stats->quota_overlimit_detected = true;
-        }
+        // the entries still queued refer to the shared memory, which is unmapped together with the reader
+        pipeline_stages_->RemoveLane(pipeline_stage_, *this);
+        Drain();
     }
+
+    stats_logger_.LogInfo() << "Cleaning up source session for " << name_;
 }
 
 void DataRouter::SourceSession::ShowStats()
 {
-    uint64_t message_count{0};
-    uint64_t totalsize{0};
-    double quota_k_bps{0.0};
-    bool quota_enforcement_enabled{false};
-    bool quota_overlimit_detected{false};
-    std::chrono::microseconds time_spent_reading{};
-    std::chrono::microseconds transport_delay{};
-    uint64_t message_count_dropped{0};
-    uint64_t count_acquire_requests{0};
-    uint64_t max_bytes_in_buffer{0};
-    std::string name;
-
-    {
-        auto stats = stats_data_.lock();
-        message_count = stats->message_count;
-        totalsize = stats->totalsize;
-        quota_k_bps = stats->quota_k_bps;
-        quota_enforcement_enabled = stats->quota_enforcement_enabled;
-        quota_overlimit_detected = stats->quota_overlimit_detected;
-        time_spent_reading = stats->time_spent_reading;
-        transport_delay = stats->transport_delay;
-        message_count_dropped = stats->message_count_dropped;
-        count_acquire_requests = stats->count_acquire_requests;
-        max_bytes_in_buffer = stats->max_bytes_in_buffer;
-        name = stats->name;
-    }
+    const StatsData stats = stats_snapshot_.Read();
+    // ticks from now on report their transport delay for the next interval
+    const auto stats_interval = stats_interval_.fetch_add(1U, std::memory_order_relaxed);
+
+    const uint64_t message_count = stats.message_count - stats_shown_.message_count;
+    const uint64_t totalsize = stats.totalsize - stats_shown_.totalsize;
+    const uint64_t budget_shed_count = stats.budget_shed_count - stats_shown_.budget_shed_count;
+    const auto time_spent_reading = stats.time_spent_reading - stats_shown_.time_spent_reading;
+    const auto transport_delay =
+        (stats.stats_interval == stats_interval) ? stats.transport_delay : std::chrono::microseconds::zero();
+    QuotaTokenBucket::ShedCounts quota_shed_counts{};
+    std::transform(stats.quota_shed_counts.cbegin(),
+                   stats.quota_shed_counts.cend(),
+                   stats_shown_.quota_shed_counts.cbegin(),
+                   quota_shed_counts.begin(),
+                   std::minus<>{});
+    const uint64_t message_count_dropped = stats.message_count_dropped;
+    const uint64_t count_acquire_requests = stats.count_acquire_requests;
+    const uint64_t max_bytes_in_buffer = stats.max_bytes_in_buffer;
+    const std::string& name = name_;
+    const double quota_k_bps = quota_k_bps_;
+    const bool quota_enforcement_enabled = quota_enforcement_enabled_;
+    stats_shown_ = stats;
 
     const auto buffer_size_kb = reader_->GetRingBufferSizeBytes() / 1024U / 2U;
     auto buffer_watermark_kb = max_bytes_in_buffer / 1024U;
@@ -487,34 +679,23 @@ void DataRouter::SourceSession::ShowStats()
     const auto buffer_watermark_percent =
         (buffer_size_kb != 0U) ? std::to_string((100U * buffer_watermark_kb) / buffer_size_kb) : std::string{"n.a."};
 
-    auto last_start = std::chrono::steady_clock::time_point{};
-    auto current_time = std::chrono::steady_clock::now();
-    {
-        auto stats = stats_data_.lock();
-        last_start = stats->start;
-        stats->start = current_time;
-        stats->message_count = 0;
-        stats->totalsize = 0;
-        stats->time_spent_reading = std::chrono::microseconds::zero();
-        stats->transport_delay = std::chrono::microseconds::zero();
-        if (stats->quota_overlimit_detected)
-        {
-            stats->quota_overlimit_detected = false;
-        }
-    }
+    const auto last_start = stats_interval_start_;
+    const auto current_time = std::chrono::steady_clock::now();
+    stats_interval_start_ = current_time;
+
+    const auto quota_shed_total =
+        std::accumulate(quota_shed_counts.cbegin(), quota_shed_counts.cend(), std::uint64_t{0U});
 
     auto tstat_in_msec = std::chrono::duration_cast<std::chrono::milliseconds>(current_time - last_start);
     auto rate_k_bps = static_cast<double>(totalsize) * 1000. / 1024. / static_cast<double>(tstat_in_msec.count());
 
-    auto [time_between_calls, time_to_process] = [this]() noexcept {
-        auto subs_data = local_subscriber_data_.lock();
-        return std::make_pair(subs_data->time_between_to_calls.count(), subs_data->time_to_process_records.count());
-    }();
+    const auto time_between_calls = stats.time_between_to_calls.count();
+    const auto time_to_process = stats.time_to_process_records.count();
 
     stats_logger_.LogInfo() << name << ": count " << message_count << ", size " << totalsize
                             << " B, rate: " << rate_k_bps << " KBps"
                             << ", quota rate: " << QuotaValueAsString(quota_k_bps)
-                            << ", quota enforcement: " << quota_overlimit_detected
+                            << ", quota shed: " << quota_shed_total << ", overall budget shed: " << budget_shed_count
                             << ", read_time:" << time_spent_reading.count() << " us"
                             << ", transp_delay:" << transport_delay.count() << " us"
                             << ", time_between_to_calls_us:" << time_between_calls << " us"
@@ -529,9 +710,16 @@ void DataRouter::SourceSession::ShowStats()
         stats_logger_.LogError() << name << ": exceeded the quota of " << QuotaValueAsString(quota_k_bps)
                                  << "KBps, rate " << rate_k_bps << " KBps";
     }
-    if (quota_overlimit_detected)
+    if (quota_shed_total > 0U)
     {
-        stats_logger_.LogInfo() << name << ": clear quota enforcement";
+        using score::mw::log::LogLevel;
+        const auto shed = [&quota_shed_counts](const LogLevel level) {
+            return quota_shed_counts.at(static_cast<std::size_t>(level));
+        };
+        stats_logger_.LogWarn() << name << ": records shed to keep the quota: fatal " << shed(LogLevel::kFatal)
+                                << ", error " << shed(LogLevel::kError) << ", warn " << shed(LogLevel::kWarn)
+                                << ", info " << shed(LogLevel::kInfo) << ", debug " << shed(LogLevel::kDebug)
+                                << ", verbose " << shed(LogLevel::kVerbose);
     }
 }
 
@@ -551,24 +739,61 @@ bool DataRouter::SourceSession::RequestAcquire()
 
     if (acquire_result)
     {
-        auto stats = stats_data_.lock();
-        auto& count_ref = stats->count_acquire_requests;
-        ++count_ref;
+        ++stats_.count_acquire_requests;
     }
 
     return acquire_result;
 }
 
+void DataRouter::SourceSession::GrantPoolBlock(const std::uint32_t slot)
+{
+    score::cpp::visit(score::cpp::overload(
+                   [](UnixDomainServer::SessionHandle&) {
+                       // readers of unix domain sessions do not grant pool blocks
+                   },
+                   [slot](score::cpp::pmr::unique_ptr<score::platform::internal::daemon::ISessionHandle>& handle) {
+                       std::ignore = handle->GrantPoolBlock(slot);
+                   }),
+               handle_);
+}
+
 void DataRouter::SourceSession::OnAcquireResponse(const score::mw::log::detail::ReadAcquireResult& acq)
 {
-    auto cmd = command_data_.lock();
-    cmd->data_acquired = acq;
-    cmd->block_expected_to_be_next = GetExpectedNextAcquiredBlockId(acq);
+    block_being_written_.store(GetExpectedNextAcquiredBlockId(acq), std::memory_order_relaxed);
+    pending_acquisition_.store(PackAcquisition(acq), std::memory_order_release);
+}
+
+std::optional<std::int32_t> DataRouter::SourceSession::GetMemoryNode() const
+{
+    if ((router_.thread_placements_ == nullptr) || !router_.thread_placements_->IsSessionsOnBufferNodeEnabled())
+    {
+        return std::nullopt;
+    }
+    return GetMemoryNodeOfAddress(reader_->GetSharedMemoryAddress());
+}
+
+double DataRouter::SourceSession::GetFillRatio() const
+{
+    const std::uint64_t block_id = block_being_written_.load(std::memory_order_relaxed);
+    if (block_id == kNoBlockBeingWritten)
+    {
+        return 0.0;
+    }
+
+    // the ring buffer is split into two linear blocks; the acquired index is a lock-free read of the shared memory
+    // and may exceed the block size, as writers reserve space before checking that it fits
+    const auto block_size = reader_->GetRingBufferSizeBytes() / 2U;
+    const auto acquired_bytes = reader_->PeekNumberOfBytesAcquiredInBuffer(static_cast<std::uint32_t>(block_id));
+    if ((block_size == 0U) || !acquired_bytes.has_value())
+    {
+        return 0.0;
+    }
+    return std::min(static_cast<double>(acquired_bytes.value()) / static_cast<double>(block_size), 1.0);
 }
 
 void DataRouter::SourceSession::OnClosedByPeer()
 {
-    command_data_.lock()->command_detach_on_closed = true;
+    command_detach_on_closed_.store(true, std::memory_order_release);
 }
 
 }  // namespace datarouter
@@ -20,14 +20,23 @@
 #include "score/mw/log/detail/data_router/shared_memory/reader_factory.h"
 #include "score/mw/log/detail/data_router/shared_memory/shared_memory_reader.h"
 #include "score/datarouter/daemon_communication/session_handle_interface.h"
+#include "score/datarouter/datarouter/pipeline_stages.h"
+#include "score/datarouter/datarouter/thread_placement.h"
+#include "score/datarouter/datarouter/quota_token_bucket.h"
+#include "score/datarouter/datarouter/seqlock.h"
+#include "score/datarouter/datarouter/spsc_ring_queue.h"
+#include "score/datarouter/datarouter/throughput_budget.h"
 #include "unix_domain/unix_domain_server.h"
 
-#include "score/concurrency/synchronized.h"
 #include "score/mw/log/logger.h"
 
 #include "score/variant.hpp"
 
+#include <atomic>
+#include <limits>
 #include <memory>
+#include <optional>
+#include <string>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
@@ -44,45 +53,36 @@ using internal::ILogParserFactory;
 using internal::MessagePassingServer;
 using internal::UnixDomainServer;
 
-template <typename T, typename Mutex = std::mutex>
-using Synchronized = score::concurrency::Synchronized<T, Mutex>;
-
 std::string QuotaValueAsString(double quota) noexcept;
 
-struct LocalSubscriberData
-{
-    std::chrono::microseconds time_between_to_calls{std::chrono::microseconds::zero()};
-    std::chrono::microseconds time_to_process_records{std::chrono::microseconds::zero()};
-    std::chrono::steady_clock::time_point last_call_timestamp{std::chrono::steady_clock::now()};
-    bool detach_on_closed_processed{false};
-    bool enabled_logging_at_server{false};
-};
-
-struct CommandData
-{
-    bool command_detach_on_closed{false};
-    bool acquire_requested{false};
-    uint8_t ticks_without_write{0};
-    std::optional<std::uint32_t> block_expected_to_be_next{std::nullopt};
-    std::optional<score::mw::log::detail::ReadAcquireResult> data_acquired{std::nullopt};
-};
-
+/// Statistics of a source session, published by the worker thread ticking it.
+/// The counters accumulate since the session start; the statistics output reports their increase per interval.
 struct StatsData
 {
     uint64_t message_count{0};
     uint64_t message_count_dropped{0};
-    uint64_t size_dropped{0};
-    uint64_t message_count_dropped_invalid_size{0};
     uint64_t max_bytes_in_buffer{0};
     uint64_t totalsize{0};
-    double quota_k_bps{0.0};
-    bool quota_enforcement_enabled{false};
-    bool quota_overlimit_detected{false};
+    QuotaTokenBucket::ShedCounts quota_shed_counts{};
+    uint64_t budget_shed_count{0};
+    uint64_t count_acquire_requests{0};
     std::chrono::microseconds time_spent_reading{std::chrono::microseconds::zero()};
+    /// Maximum within the statistics interval stats_interval.
     std::chrono::microseconds transport_delay{std::chrono::microseconds::zero()};
-    std::chrono::steady_clock::time_point start{std::chrono::steady_clock::now()};
-    std::string name;
-    uint64_t count_acquire_requests{0};
+    uint64_t stats_interval{0};
+    std::chrono::microseconds time_between_to_calls{std::chrono::microseconds::zero()};
+    std::chrono::microseconds time_to_process_records{std::chrono::microseconds::zero()};
+};
+
+/// Statistics of the records parsed and routed for a source session, accumulated since the session start.
+struct RecordStats
+{
+    uint64_t message_count{0};
+    QuotaTokenBucket::ShedCounts quota_shed_counts{};
+    uint64_t budget_shed_count{0};
+    /// Maximum within the statistics interval stats_interval.
+    std::chrono::microseconds transport_delay{std::chrono::microseconds::zero()};
+    uint64_t stats_interval{0};
 };
 
 class DataRouter
@@ -94,7 +94,16 @@ class DataRouter
     using SessionHandleVariant = score::cpp::variant<UnixDomainServer::SessionHandle,
                                               score::cpp::pmr::unique_ptr<score::platform::internal::daemon::ISessionHandle>>;
 
-    explicit DataRouter(score::mw::log::Logger& logger, std::unique_ptr<ILogParserFactory> log_parser_factory = nullptr);
+    /// overall_quota_k_bps limits the sum of the data routed for all sources, weighted by their quotas;
+    /// std::numeric_limits<double>::max() disables the limit.
+    /// pipeline_stage_count > 0 enables the pipelined mode: the records read from the shared memory are parsed and
+    /// routed by that many stage threads, while the next records are read.
+    /// thread_placements, if given, places the stage threads and shall outlive the data router.
+    explicit DataRouter(score::mw::log::Logger& logger,
+                        std::unique_ptr<ILogParserFactory> log_parser_factory = nullptr,
+                        double overall_quota_k_bps = std::numeric_limits<double>::max(),
+                        std::size_t pipeline_stage_count = 0U,
+                        const ThreadPlacements* thread_placements = nullptr);
 
     MessagingSessionPtr NewSourceSession(
         int fd,
@@ -113,7 +122,7 @@ class DataRouter
         std::lock_guard<std::mutex> lock(subscriber_mutex_);
         for (const auto& source_session : sources_)
         {
-            // No need for the extra lock - synchronization is handled by the Synchronized<T> wrapper
+            // No need for the extra lock - the flag is atomic
             source_session->SetLoggingClientEnabled(enable_logging_client);
         }
     }
@@ -129,8 +138,10 @@ class DataRouter
      * public visibility everything used by Datarouter directly, because outside Datarouter it is visible as
      * MessagePassingServer::ISession / UnixDomainServer::ISession
      */
-    // NOLINTNEXTLINE(fuchsia-multiple-inheritance) - Both base classes are pure interfaces
-    class SourceSession : public UnixDomainServer::ISession, public MessagePassingServer::ISession
+    // NOLINTNEXTLINE(fuchsia-multiple-inheritance) - All base classes are pure interfaces
+    class SourceSession : public UnixDomainServer::ISession,
+                          public MessagePassingServer::ISession,
+                          public PipelineStages::ILane
     {
       public:
         SourceSession(DataRouter& router,
@@ -150,7 +161,7 @@ class DataRouter
 
         void SetLoggingClientEnabled(bool enable)
         {
-            local_subscriber_data_.lock()->enabled_logging_at_server = enable;
+            enabled_logging_at_server_.store(enable, std::memory_order_relaxed);
         }
         ~SourceSession();
 
@@ -160,39 +171,105 @@ class DataRouter
       private:
         bool IsSourceClosed() override
         {
-            return local_subscriber_data_.lock()->detach_on_closed_processed;
+            return detach_on_closed_processed_.load(std::memory_order_acquire);
         }
 
         bool Tick() override;
 
+        MessagePassingServer::TickActivity GetTickActivity() const override
+        {
+            return tick_activity_;
+        }
+
+        double GetFillRatio() const override;
+
+        std::optional<std::int32_t> GetMemoryNode() const override;
+
+        /// Entry of the acquired block, passed from the reading tick to the stage thread in pipelined mode.
+        struct PipelineEntry
+        {
+            bool is_type_registration{false};
+            score::mw::log::detail::TypeRegistration type_registration{};
+            score::mw::log::detail::SharedMemoryRecord record{};
+        };
+
         bool TryFinalizeAcquisition(bool& needs_fast_reschedule);
         void ProcessAndRouteLogMessages(uint64_t& message_count_local,
-                                        std::chrono::microseconds& transport_delay_local,
                                         uint64_t& number_of_bytes_in_buffer,
                                         bool acquire_finalized_in_this_tick,
                                         bool& needs_fast_reschedule);
-        void UpdateAndLogStats(uint64_t message_count_local,
-                               uint64_t number_of_bytes_in_buffer,
-                               std::chrono::microseconds transport_delay_local,
+        void UpdateAndLogStats(uint64_t number_of_bytes_in_buffer,
                                score::os::HighResolutionSteadyClock::time_point start);
         void ProcessDetachedLogs(uint64_t& number_of_bytes_in_buffer);
 
+        // parse the entries read right away, or hand them over to the stage thread in pipelined mode
+        void RouteTypeRegistration(const score::mw::log::detail::TypeRegistration& registration);
+        void RouteRecord(const score::mw::log::detail::SharedMemoryRecord& record);
+        void PushToPipeline(const PipelineEntry& entry);
+        bool IsPipelineDrained() const;
+        void Drain() override;
+
+        // run by the thread parsing the records: the tick, or the stage thread in pipelined mode
+        void StartRecordBatch(std::chrono::steady_clock::time_point now);
+        void ProcessRecord(const score::mw::log::detail::SharedMemoryRecord& record);
+        void FinishRecordBatch();
+
         void OnAcquireResponse(const score::mw::log::detail::ReadAcquireResult& acq) override;
 
         void OnClosedByPeer() override;
 
-        void CheckAndSetQuotaEnforcement();
         bool RequestAcquire();
-
-        Synchronized<LocalSubscriberData> local_subscriber_data_;
-        Synchronized<CommandData> command_data_;
-        Synchronized<StatsData> stats_data_;
+        // tells the client about a pool block its reader created upon the last acquire response
+        void GrantPoolBlock(const std::uint32_t slot);
 
         DataRouter& router_;
         std::unique_ptr<score::mw::log::detail::ISharedMemoryReader> reader_;
         std::unique_ptr<score::platform::internal::ILogParser> parser_;
         SessionHandleVariant handle_;
         score::mw::log::Logger& stats_logger_;
+        // set by the constructor only
+        std::string name_;
+        double quota_k_bps_;
+        bool quota_enforcement_enabled_;
+        // written and read by the worker thread running the tick, one at a time, so they need no synchronization
+        std::chrono::steady_clock::time_point last_call_timestamp_;
+        bool acquire_requested_;
+        std::uint8_t ticks_without_write_;
+        std::optional<std::uint32_t> block_expected_to_be_next_;
+        uint64_t size_dropped_;
+        uint64_t message_count_dropped_invalid_size_;
+        StatsData stats_;
+        MessagePassingServer::TickActivity tick_activity_;
+        uint64_t pipeline_pushed_;
+        // used by the thread parsing the records
+        QuotaTokenBucket quota_bucket_;
+        ThroughputBudget::ShareId budget_share_;
+        // left of the overall budget granted for the current record batch, and the whole grant
+        double budget_grant_;
+        double budget_batch_grant_;
+        bool budget_batch_used_;
+        RecordStats record_stats_;
+        // pipelined mode only: the queue of the entries read, and the stage thread draining it
+        PipelineStages* pipeline_stages_;
+        PipelineStages::StageIndex pipeline_stage_;
+        std::unique_ptr<SpscRingQueue<PipelineEntry>> pipeline_queue_;
+        std::atomic<std::uint64_t> pipeline_processed_;
+        Seqlock<RecordStats> record_stats_snapshot_;
+        // shared with the threads configuring, closing and scheduling the session
+        std::atomic<bool> enabled_logging_at_server_;
+        std::atomic<bool> command_detach_on_closed_;
+        std::atomic<bool> detach_on_closed_processed_;
+        // block acquired by the last acquire response together with its pool requests, until the tick hands it over
+        // to the reader; this is the single sequencing point between the message passing server and the tick
+        std::atomic<std::uint64_t> pending_acquisition_;
+        // block the client currently writes to, as known from the last acquire response; read by the scheduler
+        std::atomic<std::uint64_t> block_being_written_;
+        // stats_ as of the end of the last tick, and the interval the statistics output currently reports
+        Seqlock<StatsData> stats_snapshot_;
+        std::atomic<std::uint64_t> stats_interval_;
+        // used by the statistics output only
+        StatsData stats_shown_;
+        std::chrono::steady_clock::time_point stats_interval_start_;
 
       public:
         void ShowStats();
@@ -215,6 +292,10 @@ class DataRouter
 
     std::unordered_set<SourceSession*> sources_;
     std::unique_ptr<ILogParserFactory> log_parser_factory_;
+    ThroughputBudget throughput_budget_;
+    const ThreadPlacements* thread_placements_;
+    // shall outlive the source sessions, which are owned by the message passing server
+    std::unique_ptr<PipelineStages> pipeline_stages_;
 
     std::mutex subscriber_mutex_;
 };
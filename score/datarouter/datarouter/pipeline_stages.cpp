@@ -0,0 +1,157 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include "score/datarouter/datarouter/pipeline_stages.h"
+
+#include "score/os/pthread.h"
+
+#include <algorithm>
+#include <iostream>
+#include <string>
+#include <tuple>
+
+namespace score
+{
+namespace platform
+{
+namespace datarouter
+{
+
+PipelineStages::PipelineStages(const std::size_t number_of_stages, const ThreadPlacements* const thread_placements)
+    : stages_{}, lanes_mutex_{}, next_stage_{0U}
+{
+    const std::size_t stage_count = std::max(number_of_stages, std::size_t{1U});
+    stages_.reserve(stage_count);
+    for (std::size_t stage_index = 0U; stage_index < stage_count; ++stage_index)
+    {
+        auto& stage = *stages_.emplace_back(std::make_unique<Stage>());
+        stage.thread = std::thread([this, &stage]() {
+            RunStageThread(stage);
+        });
+
+        const std::string thread_name = "dr_stage_" + std::to_string(stage_index);
+        auto ret_pthread = score::os::Pthread::instance().setname_np(stage.thread.native_handle(), thread_name.c_str());
+        if (!ret_pthread.has_value())
+        {
+            std::cerr << "setname_np: " << ret_pthread.error() << std::endl;
+        }
+        if (thread_placements != nullptr)
+        {
+            thread_placements->Apply(stage.thread.native_handle(), thread_name);
+        }
+    }
+}
+
+/*
+Deviation from Rule A15-5-1:
+- All user-provided class destructors, deallocation functions, move constructors,
+- move assignment operators and swap functions shall not exit with an exception.
+Justification:
+- join() could throw exception only if something goes wrong on OS level, which could only happen on system shutdown
+*/
+// coverity[autosar_cpp14_a15_5_1_violation] see above
+PipelineStages::~PipelineStages() noexcept
+{
+    for (auto& stage : stages_)
+    {
+        {
+            std::lock_guard<std::mutex> lock(stage->mutex);
+            stage->exit = true;
+        }
+        stage->condition.notify_all();
+    }
+    for (auto& stage : stages_)
+    {
+        if (stage->thread.joinable())
+        {
+            stage->thread.join();
+        }
+    }
+}
+
+PipelineStages::StageIndex PipelineStages::AssignStage()
+{
+    std::lock_guard<std::mutex> lock(lanes_mutex_);
+    const StageIndex stage_index = next_stage_;
+    next_stage_ = (next_stage_ + 1U) % stages_.size();
+    return stage_index;
+}
+
+void PipelineStages::Notify(const StageIndex stage_index, ILane& lane)
+{
+    Stage& stage = *stages_.at(stage_index);
+    {
+        std::lock_guard<std::mutex> lock(stage.mutex);
+        // a lane scheduled already drains the new entries as well
+        if (std::find(stage.ready.cbegin(), stage.ready.cend(), &lane) != stage.ready.cend())
+        {
+            return;
+        }
+        stage.ready.push_back(&lane);
+    }
+    stage.condition.notify_all();
+}
+
+bool PipelineStages::WaitForDrain(const StageIndex stage_index, ILane& lane)
+{
+    Notify(stage_index, lane);
+    Stage& stage = *stages_.at(stage_index);
+    std::unique_lock<std::mutex> lock(stage.mutex);
+    // the stage thread notifies after each drain, the lane is drained once neither scheduled nor draining
+    stage.condition.wait(lock, [&stage, &lane]() {
+        return stage.exit || ((stage.draining != &lane) &&
+                              (std::find(stage.ready.cbegin(), stage.ready.cend(), &lane) == stage.ready.cend()));
+    });
+    return !stage.exit;
+}
+
+void PipelineStages::RemoveLane(const StageIndex stage_index, ILane& lane)
+{
+    Stage& stage = *stages_.at(stage_index);
+    std::unique_lock<std::mutex> lock(stage.mutex);
+    const auto removed = std::remove(stage.ready.begin(), stage.ready.end(), &lane);
+    std::ignore = stage.ready.erase(removed, stage.ready.end());
+    stage.condition.wait(lock, [&stage, &lane]() {
+        return stage.draining != &lane;
+    });
+}
+
+void PipelineStages::RunStageThread(Stage& stage)
+{
+    std::unique_lock<std::mutex> lock(stage.mutex);
+    while (true)
+    {
+        stage.condition.wait(lock, [&stage]() {
+            return stage.exit || !stage.ready.empty();
+        });
+        if (stage.ready.empty())
+        {
+            break;
+        }
+
+        // unscheduled before draining, so that entries queued meanwhile schedule the lane again
+        ILane* const lane = stage.ready.front();
+        stage.ready.pop_front();
+        stage.draining = lane;
+        lock.unlock();
+        lane->Drain();
+        lock.lock();
+        stage.draining = nullptr;
+        // wake up a RemoveLane() or WaitForDrain() waiting for this lane
+        stage.condition.notify_all();
+    }
+}
+
+}  // namespace datarouter
+}  // namespace platform
+}  // namespace score
@@ -0,0 +1,102 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#ifndef SCORE_DATAROUTER_DATAROUTER_PIPELINE_STAGES_H
+#define SCORE_DATAROUTER_DATAROUTER_PIPELINE_STAGES_H
+
+#include "score/datarouter/datarouter/thread_placement.h"
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace score
+{
+namespace platform
+{
+namespace datarouter
+{
+
+/// Threads running the parse and route stage of source sessions in pipelined mode.
+///
+/// Every session feeds its records through a lane, typically a single producer single consumer queue filled by the
+/// thread reading the shared memory. Lanes are spread over the stage threads round robin, and each lane is drained
+/// by its stage thread only, so the queue has a single consumer and the entries of a lane are processed in order.
+class PipelineStages
+{
+  public:
+    class ILane
+    {
+      public:
+        /// Processes the entries queued so far. Called by one stage thread at a time.
+        virtual void Drain() = 0;
+
+        virtual ~ILane() = default;
+    };
+
+    using StageIndex = std::size_t;
+
+    /// Stage threads are named "dr_stage_<index>" and placed accordingly, if placements are given.
+    explicit PipelineStages(std::size_t number_of_stages, const ThreadPlacements* thread_placements = nullptr);
+    ~PipelineStages() noexcept;
+
+    PipelineStages(const PipelineStages&) = delete;
+    PipelineStages& operator=(const PipelineStages&) = delete;
+    PipelineStages(PipelineStages&&) = delete;
+    PipelineStages& operator=(PipelineStages&&) = delete;
+
+    /// Assigns a stage thread to a new lane. The returned index is passed to Notify() and RemoveLane().
+    StageIndex AssignStage();
+
+    /// Schedules the lane to be drained by its stage thread after new entries were queued.
+    void Notify(StageIndex stage_index, ILane& lane);
+
+    /// Schedules the lane and blocks until its stage thread drained it, for producers waiting for space in the lane.
+    /// Returns false if the stage threads are exiting, thus the lane may not be drained anymore.
+    bool WaitForDrain(StageIndex stage_index, ILane& lane);
+
+    /// Unschedules the lane and waits until its stage thread no longer drains it.
+    void RemoveLane(StageIndex stage_index, ILane& lane);
+
+    std::size_t GetNumberOfStages() const noexcept
+    {
+        return stages_.size();
+    }
+
+  private:
+    struct Stage
+    {
+        std::mutex mutex{};
+        std::condition_variable condition{};
+        std::deque<ILane*> ready{};
+        ILane* draining{nullptr};
+        bool exit{false};
+        std::thread thread{};
+    };
+
+    void RunStageThread(Stage& stage);
+
+    std::vector<std::unique_ptr<Stage>> stages_;
+    std::mutex lanes_mutex_;
+    StageIndex next_stage_;
+};
+
+}  // namespace datarouter
+}  // namespace platform
+}  // namespace score
+
+#endif  // SCORE_DATAROUTER_DATAROUTER_PIPELINE_STAGES_H
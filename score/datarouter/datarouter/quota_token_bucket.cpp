@@ -0,0 +1,109 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include "score/datarouter/datarouter/quota_token_bucket.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace score
+{
+namespace platform
+{
+namespace datarouter
+{
+
+namespace
+{
+// The bucket holds the quota of this duration, which bounds the burst a client may log after being silent.
+constexpr double kBurstDurationSeconds = 1.0;
+
+}  // namespace
+
+double GetShedReserveFraction(const score::mw::log::LogLevel log_level) noexcept
+{
+    switch (log_level)
+    {
+        case score::mw::log::LogLevel::kWarn:
+            return 0.125;
+        case score::mw::log::LogLevel::kInfo:
+            return 0.25;
+        case score::mw::log::LogLevel::kDebug:
+            return 0.375;
+        case score::mw::log::LogLevel::kVerbose:
+            return 0.5;
+        case score::mw::log::LogLevel::kOff:
+        case score::mw::log::LogLevel::kFatal:
+        case score::mw::log::LogLevel::kError:
+        default:
+            return 0.0;
+    }
+}
+
+QuotaTokenBucket::QuotaTokenBucket(const double quota_k_bps, const Clock::time_point now) noexcept
+    : bytes_per_second_{0.0},
+      capacity_{0.0},
+      tokens_{0.0},
+      last_refill_{now},
+      shed_counts_{},
+      unlimited_{!(quota_k_bps < std::numeric_limits<double>::max())}
+{
+    if (!unlimited_)
+    {
+        bytes_per_second_ = std::max(quota_k_bps, 0.0) * 1024.0;
+        capacity_ = bytes_per_second_ * kBurstDurationSeconds;
+        tokens_ = capacity_;
+    }
+}
+
+void QuotaTokenBucket::Refill(const Clock::time_point now) noexcept
+{
+    if (unlimited_ || (now <= last_refill_))
+    {
+        return;
+    }
+    const std::chrono::duration<double> elapsed = now - last_refill_;
+    tokens_ = std::min(capacity_, tokens_ + (elapsed.count() * bytes_per_second_));
+    last_refill_ = now;
+}
+
+bool QuotaTokenBucket::TryConsume(const std::uint64_t size,
+                                  const std::optional<score::mw::log::LogLevel> log_level) noexcept
+{
+    if (unlimited_)
+    {
+        return true;
+    }
+
+    const auto level = log_level.value_or(score::mw::log::LogLevel::kInfo);
+    const double remaining = tokens_ - static_cast<double>(size);
+    if (remaining < (capacity_ * GetShedReserveFraction(level)))
+    {
+        const auto index = std::min(static_cast<std::size_t>(level), shed_counts_.size() - 1U);
+        ++shed_counts_[index];
+        return false;
+    }
+    tokens_ = remaining;
+    return true;
+}
+
+QuotaTokenBucket::ShedCounts QuotaTokenBucket::TakeShedCounts() noexcept
+{
+    const ShedCounts shed_counts = shed_counts_;
+    shed_counts_ = {};
+    return shed_counts;
+}
+
+}  // namespace datarouter
+}  // namespace platform
+}  // namespace score
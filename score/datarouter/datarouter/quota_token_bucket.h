@@ -0,0 +1,85 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#ifndef SCORE_DATAROUTER_DATAROUTER_QUOTA_TOKEN_BUCKET_H
+#define SCORE_DATAROUTER_DATAROUTER_QUOTA_TOKEN_BUCKET_H
+
+#include "score/mw/log/log_level.h"
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <optional>
+
+namespace score
+{
+namespace platform
+{
+namespace datarouter
+{
+
+/// Part of a budget reserved for the levels more severe than the given one, records of this level may only use the
+/// rest. Shared by the quota of a client and the overall throughput budget, so both shed verbose records first.
+double GetShedReserveFraction(score::mw::log::LogLevel log_level) noexcept;
+
+/// Token bucket enforcing the data rate quota of a single logging client.
+///
+/// The bucket is refilled continuously with the quota rate and holds at most one second worth of data.
+/// Records consume tokens according to their size. When the bucket runs low, records are shed by severity:
+/// each level may only use the tokens above a reserve kept for the more severe levels, so verbose and debug
+/// records are dropped first and errors last, instead of blocking the whole client until the quota is reset.
+///
+/// Not thread-safe, it is used by the worker thread ticking the session.
+class QuotaTokenBucket
+{
+  public:
+    using Clock = std::chrono::steady_clock;
+    /// Indexed by the value of score::mw::log::LogLevel.
+    using ShedCounts = std::array<std::uint64_t, 7U>;
+
+    /// A quota of std::numeric_limits<double>::max() (or above) disables the enforcement.
+    explicit QuotaTokenBucket(double quota_k_bps, Clock::time_point now = Clock::now()) noexcept;
+
+    void Refill(Clock::time_point now) noexcept;
+
+    /// Returns false if the record shall be shed; the tokens are consumed otherwise.
+    /// Records of unknown severity are treated as kInfo.
+    bool TryConsume(std::uint64_t size, std::optional<score::mw::log::LogLevel> log_level) noexcept;
+
+    /// Returns the number of records shed per level since the last call.
+    ShedCounts TakeShedCounts() noexcept;
+
+    double GetTokens() const noexcept
+    {
+        return tokens_;
+    }
+
+    bool IsUnlimited() const noexcept
+    {
+        return unlimited_;
+    }
+
+  private:
+    double bytes_per_second_;
+    double capacity_;
+    double tokens_;
+    Clock::time_point last_refill_;
+    ShedCounts shed_counts_;
+    bool unlimited_;
+};
+
+}  // namespace datarouter
+}  // namespace platform
+}  // namespace score
+
+#endif  // SCORE_DATAROUTER_DATAROUTER_QUOTA_TOKEN_BUCKET_H
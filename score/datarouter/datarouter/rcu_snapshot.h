@@ -0,0 +1,115 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#ifndef SCORE_DATAROUTER_DATAROUTER_RCU_SNAPSHOT_H
+#define SCORE_DATAROUTER_DATAROUTER_RCU_SNAPSHOT_H
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <tuple>
+
+namespace score
+{
+namespace platform
+{
+namespace datarouter
+{
+
+/// Publishes immutable snapshots of a value, read far more often than replaced, to any number of readers.
+///
+/// Readers never block and never take a lock: they pin the current snapshot by counting themselves on its slot.
+/// Publish() fills the other slot and switches to it, after waiting for the readers still pinning that slot from
+/// before the previous switch. Thus at most two snapshots exist, and a reader shall release its Pin() soon.
+/// Publish() shall only be called by one thread at a time.
+template <typename T>
+class RcuSnapshot
+{
+  public:
+    class Pin
+    {
+      public:
+        Pin(const Pin&) = delete;
+        Pin& operator=(const Pin&) = delete;
+        Pin(Pin&&) = delete;
+        Pin& operator=(Pin&&) = delete;
+
+        ~Pin() noexcept
+        {
+            readers_.fetch_sub(1U, std::memory_order_release);
+        }
+
+        const T& Get() const noexcept
+        {
+            return value_;
+        }
+
+        const T* operator->() const noexcept
+        {
+            return &value_;
+        }
+
+      private:
+        friend class RcuSnapshot;
+
+        Pin(const T& value, std::atomic<std::uint32_t>& readers) noexcept : value_{value}, readers_{readers} {}
+
+        const T& value_;
+        std::atomic<std::uint32_t>& readers_;
+    };
+
+    explicit RcuSnapshot(std::unique_ptr<const T> initial = std::make_unique<const T>()) noexcept
+        : slots_{std::move(initial), nullptr}, readers_{}, current_{0U}
+    {
+    }
+
+    /// Pins the snapshot published last. Guaranteed copy elision lets the Pin be returned without moving it.
+    Pin Read() const noexcept
+    {
+        while (true)
+        {
+            const auto slot = current_.load(std::memory_order_seq_cst);
+            std::ignore = readers_.at(slot).fetch_add(1U, std::memory_order_seq_cst);
+            // Publish() either sees this reader, or it switched the slot before and the reader retries
+            if (current_.load(std::memory_order_seq_cst) == slot)
+            {
+                return Pin{*slots_.at(slot), readers_.at(slot)};
+            }
+            std::ignore = readers_.at(slot).fetch_sub(1U, std::memory_order_release);
+        }
+    }
+
+    void Publish(std::unique_ptr<const T> value) noexcept
+    {
+        const auto next = 1U - current_.load(std::memory_order_relaxed);
+        while (readers_.at(next).load(std::memory_order_seq_cst) != 0U)
+        {
+            std::this_thread::yield();
+        }
+        slots_.at(next) = std::move(value);
+        current_.store(next, std::memory_order_seq_cst);
+    }
+
+  private:
+    std::array<std::unique_ptr<const T>, 2U> slots_;
+    mutable std::array<std::atomic<std::uint32_t>, 2U> readers_;
+    std::atomic<std::uint32_t> current_;
+};
+
+}  // namespace datarouter
+}  // namespace platform
+}  // namespace score
+
+#endif  // SCORE_DATAROUTER_DATAROUTER_RCU_SNAPSHOT_H
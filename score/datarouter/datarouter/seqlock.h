@@ -0,0 +1,96 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#ifndef SCORE_DATAROUTER_DATAROUTER_SEQLOCK_H
+#define SCORE_DATAROUTER_DATAROUTER_SEQLOCK_H
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <tuple>
+#include <type_traits>
+
+namespace score
+{
+namespace platform
+{
+namespace datarouter
+{
+
+/// Publishes snapshots of a trivially copyable value from a single writer thread to any number of readers.
+///
+/// Neither side blocks the other: the writer never waits, and a reader retries only if a publication overlapped
+/// its read. The value is stored in relaxed atomic words, so concurrent reads are not data races.
+/// Publish() shall only be called by one thread at a time.
+template <typename T>
+class Seqlock
+{
+    static_assert(std::is_trivially_copyable<T>::value, "Seqlock requires a trivially copyable type");
+
+  public:
+    Seqlock() noexcept : Seqlock(T{}) {}
+
+    explicit Seqlock(const T& value) noexcept : sequence_{0U}, words_{}
+    {
+        Publish(value);
+    }
+
+    void Publish(const T& value) noexcept
+    {
+        std::array<std::uint64_t, kWordCount> words{};
+        std::ignore = std::memcpy(words.data(), &value, sizeof(T));
+
+        const auto sequence = sequence_.load(std::memory_order_relaxed);
+        sequence_.store(sequence + 1U, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        for (std::size_t i = 0U; i < kWordCount; ++i)
+        {
+            words_.at(i).store(words.at(i), std::memory_order_relaxed);
+        }
+        sequence_.store(sequence + 2U, std::memory_order_release);
+    }
+
+    T Read() const noexcept
+    {
+        std::array<std::uint64_t, kWordCount> words{};
+        std::uint64_t sequence_before{0U};
+        std::uint64_t sequence_after{0U};
+        do
+        {
+            sequence_before = sequence_.load(std::memory_order_acquire);
+            for (std::size_t i = 0U; i < kWordCount; ++i)
+            {
+                words.at(i) = words_.at(i).load(std::memory_order_relaxed);
+            }
+            std::atomic_thread_fence(std::memory_order_acquire);
+            sequence_after = sequence_.load(std::memory_order_relaxed);
+        } while (((sequence_before % 2U) != 0U) || (sequence_before != sequence_after));
+
+        T value{};
+        std::ignore = std::memcpy(static_cast<void*>(&value), words.data(), sizeof(T));
+        return value;
+    }
+
+  private:
+    static constexpr std::size_t kWordCount = (sizeof(T) + sizeof(std::uint64_t) - 1U) / sizeof(std::uint64_t);
+
+    std::atomic<std::uint64_t> sequence_;
+    std::array<std::atomic<std::uint64_t>, kWordCount> words_;
+};
+
+}  // namespace datarouter
+}  // namespace platform
+}  // namespace score
+
+#endif  // SCORE_DATAROUTER_DATAROUTER_SEQLOCK_H
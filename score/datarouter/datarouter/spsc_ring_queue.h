@@ -0,0 +1,100 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#ifndef SCORE_DATAROUTER_DATAROUTER_SPSC_RING_QUEUE_H
+#define SCORE_DATAROUTER_DATAROUTER_SPSC_RING_QUEUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+namespace score
+{
+namespace platform
+{
+namespace datarouter
+{
+
+/// Bounded lock-free queue between a single producer thread and a single consumer thread.
+///
+/// The roles may move between threads, as long as each hand-over is synchronized by other means. The capacity is
+/// rounded up to a power of two.
+template <typename T>
+class SpscRingQueue
+{
+    static_assert(std::is_nothrow_copy_assignable<T>::value, "SpscRingQueue requires a nothrow copyable type");
+
+  public:
+    explicit SpscRingQueue(const std::size_t capacity) : slots_(RoundUpToPowerOfTwo(capacity)), head_{0U}, tail_{0U}
+    {
+    }
+
+    /// Producer side. Returns false if the queue is full.
+    bool TryPush(const T& value) noexcept
+    {
+        const auto tail = tail_.load(std::memory_order_relaxed);
+        if ((tail - head_.load(std::memory_order_acquire)) == slots_.size())
+        {
+            return false;
+        }
+        slots_[tail & (slots_.size() - 1U)] = value;
+        tail_.store(tail + 1U, std::memory_order_release);
+        return true;
+    }
+
+    /// Consumer side. Returns false if the queue is empty.
+    bool TryPop(T& value) noexcept
+    {
+        const auto head = head_.load(std::memory_order_relaxed);
+        if (head == tail_.load(std::memory_order_acquire))
+        {
+            return false;
+        }
+        value = slots_[head & (slots_.size() - 1U)];
+        head_.store(head + 1U, std::memory_order_release);
+        return true;
+    }
+
+    bool IsEmpty() const noexcept
+    {
+        return head_.load(std::memory_order_acquire) == tail_.load(std::memory_order_acquire);
+    }
+
+    std::size_t GetCapacity() const noexcept
+    {
+        return slots_.size();
+    }
+
+  private:
+    static std::size_t RoundUpToPowerOfTwo(const std::size_t capacity) noexcept
+    {
+        std::size_t rounded{1U};
+        while (rounded < capacity)
+        {
+            rounded *= 2U;
+        }
+        return rounded;
+    }
+
+    // the indices only grow and wrap around together with std::size_t, which is a multiple of the capacity
+    std::vector<T> slots_;
+    alignas(64) std::atomic<std::size_t> head_;
+    alignas(64) std::atomic<std::size_t> tail_;
+};
+
+}  // namespace datarouter
+}  // namespace platform
+}  // namespace score
+
+#endif  // SCORE_DATAROUTER_DATAROUTER_SPSC_RING_QUEUE_H
@@ -0,0 +1,258 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include "score/datarouter/datarouter/thread_placement.h"
+
+#include <sched.h>
+
+#include <algorithm>
+#include <cctype>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <sstream>
+#include <tuple>
+#include <utility>
+
+/*
+    Deviation from Rule A16-0-1:
+    - Rule A16-0-1 (required, implementation, automated)
+    The pre-processor shall only be used for unconditional and conditional file
+    inclusion and include guards, and using the following directives: (1) #ifndef,
+    #ifdef, (3) #if, (4) #if defined, (5) #elif, (6) #else, (7) #define, (8) #endif, (9)
+    #include.
+    Justification:
+    - CPU affinity and memory nodes are only available through Linux specific interfaces.
+*/
+// coverity[autosar_cpp14_a16_0_1_violation]
+#if defined(__linux__)
+#include <linux/mempolicy.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+// coverity[autosar_cpp14_a16_0_1_violation] see above
+#endif
+
+namespace score
+{
+namespace platform
+{
+namespace datarouter
+{
+
+namespace
+{
+
+/// Upper bound of CPU numbers accepted in CPU lists, well above the CPU_SETSIZE of common platforms.
+constexpr std::uint32_t kMaxCpuNumber{4096U};
+
+std::vector<std::uint32_t> GetCpusOfMemoryNode(const std::int32_t node)
+{
+    std::ifstream cpu_list_file("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist");
+    std::string cpu_list{};
+    if (!cpu_list_file.is_open() || !std::getline(cpu_list_file, cpu_list))
+    {
+        std::cerr << "ThreadPlacements: no CPUs found for memory node " << node << std::endl;
+        return {};
+    }
+    return ParseCpuList(cpu_list);
+}
+
+void SetAffinity(const pthread_t thread, const std::string& thread_name, const std::vector<std::uint32_t>& cpus)
+{
+// coverity[autosar_cpp14_a16_0_1_violation] see above
+#if defined(__linux__)
+    cpu_set_t cpu_set{};
+    CPU_ZERO(&cpu_set);
+    for (const auto cpu : cpus)
+    {
+        if (cpu < static_cast<std::uint32_t>(CPU_SETSIZE))
+        {
+            CPU_SET(cpu, &cpu_set);
+        }
+    }
+    const auto result = pthread_setaffinity_np(thread, sizeof(cpu_set), &cpu_set);
+    if (result != 0)
+    {
+        std::cerr << "ThreadPlacements: pthread_setaffinity_np() failed for " << thread_name << ": " << result
+                  << std::endl;
+    }
+// coverity[autosar_cpp14_a16_0_1_violation] see above
+#else
+    std::ignore = thread;
+    std::ignore = cpus;
+    std::cerr << "ThreadPlacements: CPU affinity is not supported on this platform, ignored for " << thread_name
+              << std::endl;
+// coverity[autosar_cpp14_a16_0_1_violation] see above
+#endif
+}
+
+}  // namespace
+
+ThreadPlacements::ThreadPlacements(ThreadPlacementConfig config, score::os::Pthread& pthread) noexcept
+    : config_{std::move(config)}, pthread_{pthread}
+{
+}
+
+const ThreadPlacement* ThreadPlacements::Find(const std::string& thread_name) const
+{
+    const auto by_name = config_.threads.find(thread_name);
+    if (by_name != config_.threads.end())
+    {
+        return &by_name->second;
+    }
+
+    const auto separator = thread_name.find_last_of('_');
+    if ((separator == std::string::npos) || (separator + 1U == thread_name.size()))
+    {
+        return nullptr;
+    }
+    for (auto index = separator + 1U; index < thread_name.size(); ++index)
+    {
+        if (std::isdigit(static_cast<unsigned char>(thread_name[index])) == 0)
+        {
+            return nullptr;
+        }
+    }
+    const auto by_role = config_.threads.find(thread_name.substr(0U, separator));
+    return (by_role != config_.threads.end()) ? &by_role->second : nullptr;
+}
+
+void ThreadPlacements::Apply(const pthread_t thread, const std::string& thread_name) const
+{
+    const ThreadPlacement* const placement = Find(thread_name);
+    if (placement == nullptr)
+    {
+        return;
+    }
+
+    std::vector<std::uint32_t> cpus = placement->cpus;
+    if (placement->numa_node.has_value())
+    {
+        const auto node = placement->numa_node.value();
+        cpus = NarrowCpusToMemoryNode(cpus, GetCpusOfMemoryNode(node));
+        if (cpus.empty() && !placement->cpus.empty())
+        {
+            std::cerr << "ThreadPlacements: none of the CPUs of " << thread_name << " belongs to memory node " << node
+                      << ", the affinity is left unchanged" << std::endl;
+        }
+    }
+    if (!cpus.empty())
+    {
+        SetAffinity(thread, thread_name, cpus);
+    }
+
+    if (placement->policy.has_value())
+    {
+        sched_param sched_params{};
+        sched_params.sched_priority = placement->priority;
+        const auto result = pthread_.pthread_setschedparam(thread, placement->policy.value(), &sched_params);
+        if (!result.has_value())
+        {
+            std::cerr << "ThreadPlacements: pthread_setschedparam() failed for " << thread_name << ": "
+                      << result.error() << std::endl;
+        }
+    }
+}
+
+std::optional<std::int32_t> ThreadPlacements::GetMemoryNode(const std::string& thread_name) const
+{
+    const ThreadPlacement* const placement = Find(thread_name);
+    return (placement != nullptr) ? placement->numa_node : std::nullopt;
+}
+
+std::vector<std::uint32_t> ParseCpuList(const std::string& cpu_list)
+{
+    std::vector<std::uint32_t> cpus{};
+    std::istringstream stream(cpu_list);
+    std::string range{};
+    while (std::getline(stream, range, ','))
+    {
+        std::uint32_t first{0U};
+        std::uint32_t last{0U};
+        char dash{'\0'};
+        std::istringstream range_stream(range);
+        if (!(range_stream >> first))
+        {
+            return {};
+        }
+        last = first;
+        if ((range_stream >> dash) && ((dash != '-') || !(range_stream >> last) || (last < first)))
+        {
+            return {};
+        }
+        if (last >= kMaxCpuNumber)
+        {
+            return {};
+        }
+        for (auto cpu = first; cpu <= last; ++cpu)
+        {
+            cpus.push_back(cpu);
+        }
+    }
+    return cpus;
+}
+
+std::vector<std::uint32_t> NarrowCpusToMemoryNode(const std::vector<std::uint32_t>& cpus,
+                                                  const std::vector<std::uint32_t>& node_cpus)
+{
+    if (cpus.empty())
+    {
+        return node_cpus;
+    }
+    std::vector<std::uint32_t> narrowed{};
+    std::copy_if(cpus.cbegin(), cpus.cend(), std::back_inserter(narrowed), [&node_cpus](const std::uint32_t cpu) {
+        return std::find(node_cpus.cbegin(), node_cpus.cend(), cpu) != node_cpus.cend();
+    });
+    return narrowed;
+}
+
+std::optional<std::int32_t> ParseSchedulingPolicy(const std::string& policy_name)
+{
+    if (policy_name == "SCHED_FIFO")
+    {
+        return SCHED_FIFO;
+    }
+    if (policy_name == "SCHED_RR")
+    {
+        return SCHED_RR;
+    }
+    if (policy_name == "SCHED_OTHER")
+    {
+        return SCHED_OTHER;
+    }
+    return std::nullopt;
+}
+
+std::optional<std::int32_t> GetMemoryNodeOfAddress(const void* const address) noexcept
+{
+// coverity[autosar_cpp14_a16_0_1_violation] see above
+#if defined(__linux__)
+    int node{-1};
+    // NOLINTNEXTLINE(score-banned-function): get_mempolicy() has no wrapper, it only queries the node of the page
+    const auto result = syscall(SYS_get_mempolicy, &node, nullptr, 0UL, address, MPOL_F_NODE | MPOL_F_ADDR);
+    if ((result != 0) || (node < 0))
+    {
+        return std::nullopt;
+    }
+    return static_cast<std::int32_t>(node);
+// coverity[autosar_cpp14_a16_0_1_violation] see above
+#else
+    std::ignore = address;
+    return std::nullopt;
+// coverity[autosar_cpp14_a16_0_1_violation] see above
+#endif
+}
+
+}  // namespace datarouter
+}  // namespace platform
+}  // namespace score
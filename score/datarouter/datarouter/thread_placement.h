@@ -0,0 +1,93 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#ifndef SCORE_DATAROUTER_DATAROUTER_THREAD_PLACEMENT_H
+#define SCORE_DATAROUTER_DATAROUTER_THREAD_PLACEMENT_H
+
+#include "score/os/pthread.h"
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace score
+{
+namespace platform
+{
+namespace datarouter
+{
+
+/// CPU affinity and scheduling of a datarouter thread. Unset parts are left as inherited from the process.
+struct ThreadPlacement
+{
+    std::vector<std::uint32_t> cpus{};        ///< CPUs the thread may run on, narrowed to those of numa_node if set
+    std::optional<std::int32_t> numa_node{};  ///< memory node whose CPUs the thread may run on
+    std::optional<std::int32_t> policy{};     ///< SCHED_FIFO, SCHED_RR or SCHED_OTHER
+    std::int32_t priority{0};                 ///< priority for the policy
+};
+
+struct ThreadPlacementConfig
+{
+    /// Placements by thread name, e.g. "mp_worker_1", or by role applying to all threads of it, e.g. "mp_worker".
+    std::unordered_map<std::string, ThreadPlacement> threads{};
+    /// Lets each client session be ticked by a worker placed on the memory node of its buffer.
+    bool sessions_on_buffer_node{false};
+};
+
+/// Applies the configured placements to the threads of the datarouter.
+class ThreadPlacements
+{
+  public:
+    explicit ThreadPlacements(ThreadPlacementConfig config = {},
+                              score::os::Pthread& pthread = score::os::Pthread::instance()) noexcept;
+
+    /// Applies the placement configured for the thread name, or else for its role, i.e. the name without a trailing
+    /// "_<index>". Failures are reported, the thread keeps running with the settings that could not be changed.
+    void Apply(pthread_t thread, const std::string& thread_name) const;
+
+    /// Memory node the named thread is placed on, if any.
+    std::optional<std::int32_t> GetMemoryNode(const std::string& thread_name) const;
+
+    bool IsSessionsOnBufferNodeEnabled() const noexcept
+    {
+        return config_.sessions_on_buffer_node;
+    }
+
+  private:
+    const ThreadPlacement* Find(const std::string& thread_name) const;
+
+    ThreadPlacementConfig config_;
+    score::os::Pthread& pthread_;
+};
+
+/// Parses a CPU list like "0-3,8", as used by sysfs. Returns an empty list for malformed input.
+std::vector<std::uint32_t> ParseCpuList(const std::string& cpu_list);
+
+/// CPUs of the list that belong to the memory node, in the order of the list. An empty list selects all CPUs of the
+/// node.
+std::vector<std::uint32_t> NarrowCpusToMemoryNode(const std::vector<std::uint32_t>& cpus,
+                                                  const std::vector<std::uint32_t>& node_cpus);
+
+/// Parses "SCHED_FIFO", "SCHED_RR" or "SCHED_OTHER".
+std::optional<std::int32_t> ParseSchedulingPolicy(const std::string& policy_name);
+
+/// Memory node holding the page at the address, if the platform reports it.
+std::optional<std::int32_t> GetMemoryNodeOfAddress(const void* address) noexcept;
+
+}  // namespace datarouter
+}  // namespace platform
+}  // namespace score
+
+#endif  // SCORE_DATAROUTER_DATAROUTER_THREAD_PLACEMENT_H
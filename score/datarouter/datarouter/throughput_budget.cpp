@@ -0,0 +1,247 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include "score/datarouter/datarouter/throughput_budget.h"
+
+#include <algorithm>
+#include <iostream>
+#include <limits>
+
+namespace score
+{
+namespace platform
+{
+namespace datarouter
+{
+
+namespace
+{
+// The budget holds the overall rate of this duration, which bounds the burst after a silent period.
+constexpr double kBurstDurationSeconds = 1.0;
+// Sessions which did not route any data for this duration do not receive credit anymore.
+constexpr std::chrono::seconds kActivityWindow{1};
+// Lower bound of the weight, so that sessions with a zero quota still get a minimal share.
+constexpr double kMinWeightKBps = 1.0;
+// Minimal time between two refills, which bounds the scans over all shares.
+constexpr std::chrono::milliseconds kRefillInterval{1};
+}  // namespace
+
+ThroughputBudget::ThroughputBudget(const double overall_k_bps, const Clock::time_point now)
+    : mutex_{},
+      chunks_{},
+      owned_chunks_{},
+      free_share_ids_{},
+      next_share_id_{0U},
+      bytes_per_second_{0.0},
+      capacity_{0.0},
+      pool_{0.0},
+      active_weight_{0.0},
+      last_refill_{now},
+      next_refill_{(now + kRefillInterval).time_since_epoch().count()},
+      unlimited_{!(overall_k_bps < std::numeric_limits<double>::max())}
+{
+    if (!unlimited_)
+    {
+        bytes_per_second_ = std::max(overall_k_bps, 0.0) * 1024.0;
+        capacity_ = bytes_per_second_ * kBurstDurationSeconds;
+    }
+}
+
+ThroughputBudget::ShareId ThroughputBudget::Register(const double weight_k_bps, const Clock::time_point now)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    ShareId share_id = next_share_id_;
+    if (!free_share_ids_.empty())
+    {
+        share_id = free_share_ids_.back();
+        free_share_ids_.pop_back();
+    }
+    else if ((share_id / kSharesPerChunk) < kMaxChunks)
+    {
+        ++next_share_id_;
+        auto& chunk = chunks_[share_id / kSharesPerChunk];
+        if (chunk.load(std::memory_order_relaxed) == nullptr)
+        {
+            chunk.store(owned_chunks_.emplace_back(std::make_unique<Chunk>()).get(), std::memory_order_release);
+        }
+    }
+    else
+    {
+        // LCOV_EXCL_START: more sessions than shares, the session is not granted any budget
+        std::cerr << "ThroughputBudget: no share left for another session" << std::endl;
+        return share_id;
+        // LCOV_EXCL_STOP
+    }
+
+    const double overall_k_bps = bytes_per_second_ / 1024.0;
+    Share& share = *FindShare(share_id);
+    share.weight = std::max(std::min(weight_k_bps, overall_k_bps), kMinWeightKBps);
+    share.credit.store(0.0, std::memory_order_relaxed);
+    share.last_active.store(now.time_since_epoch().count(), std::memory_order_relaxed);
+    share.registered.store(true, std::memory_order_release);
+    return share_id;
+}
+
+void ThroughputBudget::Unregister(const ShareId share_id)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    Share* const share = FindShare(share_id);
+    if ((share != nullptr) && share->registered.load(std::memory_order_relaxed))
+    {
+        share->registered.store(false, std::memory_order_relaxed);
+        AddToPool(share->credit.exchange(0.0, std::memory_order_relaxed));
+        free_share_ids_.push_back(share_id);
+    }
+}
+
+double ThroughputBudget::Acquire(const ShareId share_id, const Clock::time_point now)
+{
+    if (unlimited_)
+    {
+        return std::numeric_limits<double>::max();
+    }
+
+    RefillIfDue(now);
+
+    Share* const share = FindShare(share_id);
+    if ((share == nullptr) || !share->registered.load(std::memory_order_acquire))
+    {
+        return 0.0;
+    }
+
+    // a session becoming active again competes for the pool with the active ones
+    double active_weight = active_weight_.load(std::memory_order_relaxed);
+    if (!IsActive(*share, now))
+    {
+        active_weight += share->weight;
+    }
+    const double ratio = std::min(share->weight / active_weight, 1.0);
+    double pool = pool_.load(std::memory_order_relaxed);
+    double from_pool = pool * ratio;
+    while (!pool_.compare_exchange_weak(pool, pool - from_pool, std::memory_order_relaxed))
+    {
+        from_pool = pool * ratio;
+    }
+
+    return share->credit.exchange(0.0, std::memory_order_relaxed) + from_pool;
+}
+
+void ThroughputBudget::Release(const ShareId share_id,
+                               const double unused_bytes,
+                               const bool consumed,
+                               const Clock::time_point now)
+{
+    if (unlimited_)
+    {
+        return;
+    }
+
+    AddToPool(std::max(unused_bytes, 0.0));
+    Share* const share = FindShare(share_id);
+    if ((share != nullptr) && consumed)
+    {
+        share->last_active.store(now.time_since_epoch().count(), std::memory_order_relaxed);
+    }
+}
+
+ThroughputBudget::Share* ThroughputBudget::FindShare(const ShareId share_id) const noexcept
+{
+    if ((share_id / kSharesPerChunk) >= kMaxChunks)
+    {
+        return nullptr;
+    }
+    Chunk* const chunk = chunks_[share_id / kSharesPerChunk].load(std::memory_order_acquire);
+    if (chunk == nullptr)
+    {
+        return nullptr;
+    }
+    return &chunk->shares[share_id % kSharesPerChunk];
+}
+
+bool ThroughputBudget::IsActive(const Share& share, const Clock::time_point now) const noexcept
+{
+    const Clock::time_point last_active{Clock::duration{share.last_active.load(std::memory_order_relaxed)}};
+    return (now - last_active) < kActivityWindow;
+}
+
+void ThroughputBudget::AddToPool(const double bytes) noexcept
+{
+    double pool = pool_.load(std::memory_order_relaxed);
+    while (!pool_.compare_exchange_weak(pool, std::min(capacity_, pool + bytes), std::memory_order_relaxed))
+    {
+    }
+}
+
+void ThroughputBudget::RefillIfDue(const Clock::time_point now) noexcept
+{
+    if (now.time_since_epoch().count() < next_refill_.load(std::memory_order_relaxed))
+    {
+        return;
+    }
+    // a single worker refills, the other ones continue with the credit of the last refill
+    std::unique_lock<std::mutex> lock(mutex_, std::try_to_lock);
+    if (lock.owns_lock())
+    {
+        RefillWhileLocked(now);
+    }
+}
+
+void ThroughputBudget::RefillWhileLocked(const Clock::time_point now) noexcept
+{
+    if (now <= last_refill_)
+    {
+        return;
+    }
+    const std::chrono::duration<double> elapsed = now - last_refill_;
+    last_refill_ = now;
+    next_refill_.store((now + kRefillInterval).time_since_epoch().count(), std::memory_order_relaxed);
+    const double added = elapsed.count() * bytes_per_second_;
+    double overflow = added;
+
+    double active_weight = 0.0;
+    for (ShareId share_id = 0U; share_id < next_share_id_; ++share_id)
+    {
+        const Share& share = *FindShare(share_id);
+        if (share.registered.load(std::memory_order_relaxed) && IsActive(share, now))
+        {
+            active_weight += share.weight;
+        }
+    }
+    active_weight_.store(active_weight, std::memory_order_relaxed);
+
+    if (active_weight > 0.0)
+    {
+        for (ShareId share_id = 0U; share_id < next_share_id_; ++share_id)
+        {
+            Share& share = *FindShare(share_id);
+            if (!share.registered.load(std::memory_order_relaxed) || !IsActive(share, now))
+            {
+                continue;
+            }
+            // credit above the share of the capacity overflows to the pool
+            const double ratio = share.weight / active_weight;
+            double credit = share.credit.load(std::memory_order_relaxed);
+            double refilled = std::min(credit + (added * ratio), capacity_ * ratio);
+            while (!share.credit.compare_exchange_weak(credit, refilled, std::memory_order_relaxed))
+            {
+                refilled = std::min(credit + (added * ratio), capacity_ * ratio);
+            }
+            overflow -= refilled - credit;
+        }
+    }
+    AddToPool(std::max(overflow, 0.0));
+}
+
+}  // namespace datarouter
+}  // namespace platform
+}  // namespace score
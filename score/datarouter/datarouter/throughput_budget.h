@@ -0,0 +1,110 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#ifndef SCORE_DATAROUTER_DATAROUTER_THROUGHPUT_BUDGET_H
+#define SCORE_DATAROUTER_DATAROUTER_THROUGHPUT_BUDGET_H
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace score
+{
+namespace platform
+{
+namespace datarouter
+{
+
+/// Overall throughput budget shared by all source sessions.
+///
+/// The budget starts empty, is refilled with the overall rate and distributed to the recently active sessions, weighted by
+/// their quota. Each session may accumulate at most its share of one second worth of budget; the rest, as well as
+/// the budget granted but not used during a tick, goes to a common pool, from which every session receives its
+/// weighted share on top of its own credit. Thus the unused share of idle sessions is redistributed to busy ones,
+/// while the routed data never exceeds the overall rate, apart from bursts after silent periods, which are bounded
+/// by two seconds worth of data (the pool plus the credits).
+///
+/// Thread-safe, as sessions are ticked by several workers. Acquire() and Release() do not lock: the credits and the
+/// pool are atomics, and the refill is amortized, the first call after the refill interval takes the lock and
+/// distributes the budget added since the last refill to the active sessions.
+class ThroughputBudget
+{
+  public:
+    using Clock = std::chrono::steady_clock;
+    using ShareId = std::uint32_t;
+
+    /// A budget of std::numeric_limits<double>::max() (or above) disables the enforcement.
+    explicit ThroughputBudget(double overall_k_bps, Clock::time_point now = Clock::now());
+
+    bool IsUnlimited() const noexcept
+    {
+        return unlimited_;
+    }
+
+    /// The weight is clamped to the overall budget, so that unlimited sessions do not starve the others.
+    ShareId Register(double weight_k_bps, Clock::time_point now = Clock::now());
+    void Unregister(ShareId share_id);
+
+    /// Returns the number of bytes the session may route until the matching Release().
+    double Acquire(ShareId share_id, Clock::time_point now);
+
+    /// Returns the unused part of the last grant to the common pool.
+    void Release(ShareId share_id, double unused_bytes, bool consumed, Clock::time_point now);
+
+  private:
+    struct Share
+    {
+        std::atomic<bool> registered{false};
+        double weight{0.0};  // written with the lock held, before registered is set
+        std::atomic<double> credit{0.0};
+        std::atomic<Clock::rep> last_active{0};
+    };
+
+    // shares are allocated in chunks which are never moved, so that they are looked up without locking
+    static constexpr std::size_t kSharesPerChunk{64U};
+    static constexpr std::size_t kMaxChunks{256U};
+
+    struct Chunk
+    {
+        std::array<Share, kSharesPerChunk> shares{};
+    };
+
+    Share* FindShare(ShareId share_id) const noexcept;
+    bool IsActive(const Share& share, Clock::time_point now) const noexcept;
+    void AddToPool(double bytes) noexcept;
+    void RefillIfDue(Clock::time_point now) noexcept;
+    void RefillWhileLocked(Clock::time_point now) noexcept;
+
+    std::mutex mutex_;  // serializes registration and refill
+    std::array<std::atomic<Chunk*>, kMaxChunks> chunks_;
+    std::vector<std::unique_ptr<Chunk>> owned_chunks_;
+    std::vector<ShareId> free_share_ids_;
+    ShareId next_share_id_;
+    double bytes_per_second_;
+    double capacity_;
+    std::atomic<double> pool_;
+    std::atomic<double> active_weight_;  // as of the last refill
+    Clock::time_point last_refill_;
+    std::atomic<Clock::rep> next_refill_;
+    bool unlimited_;
+};
+
+}  // namespace datarouter
+}  // namespace platform
+}  // namespace score
+
+#endif  // SCORE_DATAROUTER_DATAROUTER_THROUGHPUT_BUDGET_H
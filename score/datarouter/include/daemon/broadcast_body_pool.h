@@ -0,0 +1,94 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#ifndef SCORE_DATAROUTER_INCLUDE_DAEMON_BROADCAST_BODY_POOL_H
+#define SCORE_DATAROUTER_INCLUDE_DAEMON_BROADCAST_BODY_POOL_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace score
+{
+namespace logging
+{
+namespace dltserver
+{
+
+/// Storage of the bodies of messages encoded once for the several channels they are routed to.
+///
+/// Bodies are allocated from blocks. Each channel referencing a body holds its block until the datagram referencing
+/// the body was sent, and a block is reused once released by all its holders. Thus the pool is only locked to
+/// allocate a body, and never waits for the channels to flush.
+class BroadcastBodyPool
+{
+  public:
+    class Block
+    {
+      public:
+        Block(BroadcastBodyPool& pool, std::size_t size);
+
+        /// Holds the block for a datagram referencing one of its bodies.
+        void Hold() noexcept;
+        /// Releases the block, the last holder returns it to the pool.
+        void Release() noexcept;
+
+      private:
+        friend class BroadcastBodyPool;
+
+        BroadcastBodyPool& pool_;
+        std::vector<char> data_;
+        std::size_t used_;
+        std::atomic<std::uint32_t> holders_;
+    };
+
+    /// A body, and its block held for the caller, who releases it once the body is handed over to the channels.
+    struct Body
+    {
+        char* data;
+        Block* block;
+    };
+
+    explicit BroadcastBodyPool(std::size_t block_size);
+
+    BroadcastBodyPool(const BroadcastBodyPool&) = delete;
+    BroadcastBodyPool& operator=(const BroadcastBodyPool&) = delete;
+    BroadcastBodyPool(BroadcastBodyPool&&) = delete;
+    BroadcastBodyPool& operator=(BroadcastBodyPool&&) = delete;
+    ~BroadcastBodyPool() = default;
+
+    /// The size shall not exceed the block size.
+    Body Allocate(std::size_t size);
+
+    /// Number of blocks allocated so far, which grows only while all blocks are held.
+    std::size_t GetBlockCount() const;
+
+  private:
+    void Recycle(Block& block);
+
+    mutable std::mutex mutex_;
+    const std::size_t block_size_;
+    std::vector<std::unique_ptr<Block>> blocks_;
+    std::vector<Block*> free_blocks_;
+    // the block bodies are allocated from, held by the pool until it is full
+    Block* current_;
+};
+
+}  // namespace dltserver
+}  // namespace logging
+}  // namespace score
+
+#endif  // SCORE_DATAROUTER_INCLUDE_DAEMON_BROADCAST_BODY_POOL_H
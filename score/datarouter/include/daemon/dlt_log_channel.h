@@ -14,17 +14,29 @@
 #ifndef SCORE_DATAROUTER_INCLUDE_DAEMON_DLT_LOG_CHANNEL_H
 #define SCORE_DATAROUTER_INCLUDE_DAEMON_DLT_LOG_CHANNEL_H
 
+#include "daemon/broadcast_body_pool.h"
+#include "daemon/dlt_log_server_config.h"
 #include "daemon/dltserver_common.h"
 #include "daemon/udp_stream_output.h"
+#include "daemon/udp_submission_ring.h"
 #include "dlt/dlt_headers.h"
+#include "score/datarouter/datarouter/spsc_ring_queue.h"
 #include "score/mw/log/configuration/nvmsgdescriptor.h"
 #include "score/mw/log/log_level.h"
 
 #include <score/string_view.hpp>
 
 #include <algorithm>
+#include <array>
 #include <atomic>
+#include <condition_variable>
+#include <iterator>
+#include <memory>
 #include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <tuple>
 #include <unordered_map>
 #include <vector>
 
@@ -35,6 +47,21 @@ namespace logging
 namespace dltserver
 {
 
+/// A message encoded once for all the channels it is routed to. The channels reference its body, i.e. the message
+/// without the DltChannelHeader, which each channel constructs with its ECU id and message counter.
+struct DltEncodedMessage
+{
+    score::cpp::span<const char> body;
+    uint32_t tmsp;
+    mw::log::LogLevel log_level;
+    bool verbose;
+    // for the statistics: the message id of a non-verbose message and the size of the payload in the body
+    uint32_t msgid;
+    size_t payload_size;
+    // the block of the body, held by the channels while a datagram references it, if allocated from a pool
+    BroadcastBodyPool::Block* block{nullptr};
+};
+
 class DltLogChannel
 {
   public:
@@ -45,7 +72,8 @@ class DltLogChannel
                   const uint16_t src_port,
                   const char* dst_addr,
                   const uint16_t dst_port,
-                  const char* multicast_interface)
+                  const char* multicast_interface,
+                  const ChannelTransportConfig& transport = {})
         : channel_name(channel_id),
           ecu(ecu_id),
           channel_threshold(threshold),
@@ -54,17 +82,43 @@ class DltLogChannel
           mcnt_(0),
           count_verbose_messages_in_buffer_(0),
           count_nonverbose_messages_in_buffer_(0),
-          prebuf_data_{},
-          io_vec_{},
-          mmsg_hdr_array_{},
+          vector_count_(std::max(transport.vector_count, std::size_t{1U})),
+          max_payload_(transport.mtu - (kIpv4HeaderWithoutOptions + kUdpHeader)),
+          datagram_capacity_(max_payload_),
+          segmentation_offload_(false),
+          sender_queue_depth_(transport.sender_queue_depth),
+          use_submission_ring_(transport.io_uring),
+          batches_{},
+          batch_{nullptr},
           prebuf_size_(0),
-          prebuf_is_verbose_(false),
+          referenced_size_(0),
+          io_vec_count_(0),
+          prebuf_run_start_(0),
+          segment_start_(0),
+          segment_size_(0),
+          segment_count_(0),
+          network_trace_stream_(0),
+          held_blocks_{},
           srcport_(src_port),
           bind_result_{},
           verbose_(),
+          sender_{},
+          submission_{},
+          sender_statistics_{},
           non_verbose_()
     {
         bind_result_ = out_.Bind(src_addr, src_port);
+        if (transport.send_buffer_size.has_value())
+        {
+            // a failure is reported by the output, the channel keeps the default buffer size
+            std::ignore = out_.SetSendBufferSize(transport.send_buffer_size.value());
+        }
+        if (transport.segmentation_offload && out_.EnableSegmentationOffload(vector_count_).has_value())
+        {
+            segmentation_offload_ = true;
+            datagram_capacity_ = std::min(kMaxDatagramPayload, max_payload_ * kMaxSegmentCount);
+        }
+        AllocateDatagrams();
     }
 
     DltLogChannel(const std::string& channel_id,
@@ -74,30 +128,23 @@ class DltLogChannel
                   const uint16_t src_port,
                   const char* dst_addr,
                   const uint16_t dst_port,
-                  const char* multicast_interface)
-        : channel_name(DltidT(channel_id)),
-          ecu(DltidT(ecu_id)),
-          channel_threshold(threshold),
-          mutex_{},
-          out_(dst_addr, dst_port, multicast_interface),
-          mcnt_(0),
-          count_verbose_messages_in_buffer_(0),
-          count_nonverbose_messages_in_buffer_(0),
-          prebuf_data_{},
-          io_vec_{},
-          mmsg_hdr_array_{},
-          prebuf_size_(0),
-          prebuf_is_verbose_(false),
-          srcport_(src_port),
-          bind_result_{},
-          verbose_(),
-          non_verbose_()
+                  const char* multicast_interface,
+                  const ChannelTransportConfig& transport = {})
+        : DltLogChannel(DltidT(channel_id),
+                        threshold,
+                        DltidT(ecu_id),
+                        src_addr,
+                        src_port,
+                        dst_addr,
+                        dst_port,
+                        multicast_interface,
+                        transport)
     {
-        bind_result_ = out_.Bind(src_addr, src_port);
     }
 
-    ~DltLogChannel() = default;
+    ~DltLogChannel() noexcept;
     DltLogChannel(const DltLogChannel&) = delete;
+    /// Shall only be called before the sender thread is started.
     DltLogChannel(DltLogChannel&& from) noexcept
         : channel_name(from.channel_name),
           ecu(from.ecu),
@@ -107,24 +154,74 @@ class DltLogChannel
           mcnt_(0),
           count_verbose_messages_in_buffer_(0),
           count_nonverbose_messages_in_buffer_(0),
-          prebuf_data_{},
-          io_vec_{},
-          mmsg_hdr_array_{},
+          vector_count_(from.vector_count_),
+          max_payload_(from.max_payload_),
+          datagram_capacity_(from.datagram_capacity_),
+          segmentation_offload_(from.segmentation_offload_),
+          sender_queue_depth_(from.sender_queue_depth_),
+          use_submission_ring_(from.use_submission_ring_),
+          // the buffers are taken over, but not the messages pending in them
+          batches_(std::move(from.batches_)),
+          batch_(from.batch_),
           prebuf_size_(0),
-          prebuf_is_verbose_(false),
+          referenced_size_(0),
+          io_vec_count_(0),
+          prebuf_run_start_(0),
+          segment_start_(0),
+          segment_size_(0),
+          segment_count_(0),
+          network_trace_stream_(0),
+          held_blocks_{},
           srcport_(from.srcport_),
           bind_result_(from.bind_result_),
           verbose_(),
+          sender_{},
+          submission_{},
+          sender_statistics_{},
           non_verbose_()
     {
     }
 
+    /// Statistics of the queue handing complete batches of datagrams over to the sender thread or submission ring.
+    struct SenderQueueStatistics
+    {
+        size_t depth;           ///< batches waiting to be sent or being sent, or submitted and not completed
+        size_t high_watermark;  ///< largest depth since the statistics were shown
+        uint64_t handed_over_batches;
+        uint64_t dropped_batches;
+        uint64_t dropped_datagrams;
+        uint64_t dropped_messages;
+    };
+
+    /// Starts the sender thread if the transport of the channel configures a sender queue, and returns its handle.
+    /// From then on the routing threads only hand complete batches of datagrams over to the sender thread, which sends
+    /// them, so that they keep routing while the socket blocks. If the network stalls until the queue is full, the
+    /// newest batch is dropped. The channel shall not be moved afterwards.
+    std::optional<pthread_t> StartSender(const std::string& thread_name);
+
+    /// Submits the complete batches of datagrams through the ring instead, if the transport of the channel configures
+    /// io_uring, then a batch is reused once all its datagrams completed. Without a free batch, the ring is submitted
+    /// to reap the completions before the newest batch is dropped. Returns false otherwise, and with segmentation
+    /// offload, which is only sent by sendmmsg(). The ring shall notify all completions before the channel is
+    /// destroyed, and the channel shall not be moved afterwards.
+    bool AttachSubmissionRing(IUdpSubmissionRing& ring);
+
+    SenderQueueStatistics GetSenderQueueStatistics();
+
     void SendNonVerbose(const score::mw::log::config::NvMsgDescriptor& desc,
                         uint32_t tmsp,
                         const void* data,
                         size_t size);
     void SendVerbose(const uint32_t tmsp,
                      const score::mw::log::detail::log_entry_deserialization::LogEntryDeserializationReflection& entry);
+    /// Sends a message encoded once for several channels. Its datagram references the body instead of holding a
+    /// copy, thus the body shall stay unchanged until the channel is flushed. Batches handed over hold a copy.
+    void SendEncoded(const DltEncodedMessage& message);
+    /// Largest body sent with SendEncoded(). Bodies too large for the datagrams of the channel are sent on their own.
+    static constexpr size_t GetMaxEncodedBodySize() noexcept
+    {
+        return kMaxDatagramPayload - sizeof(score::platform::internal::DltChannelHeader);
+    }
     //  FT stands for 'file transfer'
     void SendFtVerbose(score::cpp::span<const std::uint8_t> data,
                        const mw::log::LogLevel loglevel,
@@ -133,12 +230,22 @@ class DltLogChannel
                        uint8_t nor,
                        uint32_t tmsp);
 
+    /// Counts a verbose message dropped by the threshold of the channel before it was deserialized.
+    void CountPrefilteredVerbose() noexcept
+    {
+        std::ignore = verbose_.prefiltered_count.fetch_add(1U, std::memory_order_relaxed);
+    }
+
     template <typename Logger>
     void ShowStats(Logger& stat_logger)
     {
         std::lock_guard<std::mutex> lock(mutex_);
         ShowAndClearStatsDlt(verbose_, stat_logger, channel_name);
         ShowAndClearStatsNonVerbose(non_verbose_, stat_logger, channel_name);
+        if (HandsBatchesOver())
+        {
+            ShowAndClearStatsSenderQueue(stat_logger, channel_name);
+        }
     }
 
     void Flush();
@@ -151,22 +258,70 @@ class DltLogChannel
   private:
     static constexpr uint32_t kIpv4HeaderWithoutOptions = 20UL;
     static constexpr uint32_t kUdpHeader = 8UL;
-    static constexpr uint32_t kMtu = 1500UL;
-    static constexpr uint32_t kUdpMaxPayload = kMtu - (kIpv4HeaderWithoutOptions + kUdpHeader);
+    static constexpr uint32_t kIpv4MaxPacketSize = 65535UL;
+    static constexpr size_t kMaxDatagramPayload = kIpv4MaxPacketSize - (kIpv4HeaderWithoutOptions + kUdpHeader);
+    // UDP_MAX_SEGMENTS of the kernel and UIO_MAXIOV, which limit a datagram segmented by the kernel
+    static constexpr size_t kMaxSegmentCount = 64UL;
+    static constexpr size_t kMaxIoVecCount = 1024UL;
+    static constexpr size_t kMaxNetworkTraceSegment =
+        kMaxDatagramPayload - sizeof(score::platform::internal::DltNetworkTraceSegmentHeader);
     static constexpr uint16_t kBandwidthDenominator = 10 /* show_stats() cycle_time */ * 1024 /* KiBytes */;
 
     std::mutex mutex_;
     UdpStreamOutput out_;
     uint8_t mcnt_;
-    uint8_t count_verbose_messages_in_buffer_;
-    uint8_t count_nonverbose_messages_in_buffer_;
-    static constexpr auto kVectorCount = 4UL;
+    // the datagrams pending to be sent mix verbose and non-verbose messages, a failed send is counted for each type
+    uint32_t count_verbose_messages_in_buffer_;
+    uint32_t count_nonverbose_messages_in_buffer_;
+    // a datagram consists of runs of messages written to its prebuf and of the message bodies referenced between them
+    static constexpr auto kDatagramIoVecCount = 32UL;
     uint32_t vector_index_ = 0UL;
-    std::array<std::array<char, kUdpMaxPayload>, kVectorCount> prebuf_data_;
-    std::array<iovec, kVectorCount> io_vec_;
-    std::array<mmsghdr, kVectorCount> mmsg_hdr_array_;
+    // the number of datagrams sent at once, the largest payload of a datagram after segmentation and before
+    const size_t vector_count_;
+    const size_t max_payload_;
+    size_t datagram_capacity_;
+    // Messages are not split between segments, so a datagram only grows while its segments have the size of the first
+    // one. Repeated messages of the same size fill up to kMaxSegmentCount segments, while messages of mixed sizes
+    // mostly complete the datagram after two segments, and gain less from the offload.
+    bool segmentation_offload_;
+    const size_t sender_queue_depth_;
+    const bool use_submission_ring_;
+
+    /// The datagrams sent by one sendmmsg() call and the buffers they are constructed in.
+    struct DatagramBatch final : public IUdpSubmissionRing::Completion
+    {
+        std::vector<std::vector<char>> prebuf_data;
+        std::vector<std::vector<iovec>> io_vec;
+        std::vector<mmsghdr> mmsg_hdr_array;
+        std::vector<std::uint16_t> segment_sizes;
+        // set when the batch is complete, to attribute a failed send to the types of its messages
+        size_t datagram_count;
+        uint32_t verbose_count;
+        uint32_t non_verbose_count;
+        // with a submission ring: the datagrams not completed yet and the errno of a failed one, written by the
+        // thread reaping the completions until the batch is released
+        DltLogChannel* channel;
+        size_t pending;
+        std::int32_t send_error;
+
+        void OnSent(const std::int32_t result) noexcept override;
+    };
+    // the batch the datagrams are constructed in, one of batches_, which are owned by the channel
+    std::vector<std::unique_ptr<DatagramBatch>> batches_;
+    DatagramBatch* batch_;
     size_t prebuf_size_;
-    bool prebuf_is_verbose_;
+    // bytes referenced by the current datagram, the iovecs it completed so far and the start of its current run
+    size_t referenced_size_;
+    size_t io_vec_count_;
+    size_t prebuf_run_start_;
+    // with segmentation offload: the start of the current segment, the size of all others and their count
+    size_t segment_start_;
+    size_t segment_size_;
+    size_t segment_count_;
+    // the handle of the next segmented network trace
+    uint32_t network_trace_stream_;
+    // the blocks of the bodies referenced by the batch, released once it was sent
+    std::vector<BroadcastBodyPool::Block*> held_blocks_;
     // Statistics variables
     int srcport_;
     score::cpp::expected_blank<score::os::Error> bind_result_;  // Save result for later error reporting
@@ -178,54 +333,145 @@ class DltLogChannel
         uint64_t stats_msgcnt{};
         uint64_t stats_totalsize{};
         uint64_t send_failures_count{};
-        std::unordered_map<std::string, std::uint64_t> send_errno_count{};
+        // counted without locking the mutex, as prefiltered messages are never handed to the channel
+        std::atomic<uint64_t> prefiltered_count{};
+        // keyed by the OS error code, as rendering the error text for every failed send would allocate
+        std::unordered_map<std::int32_t, std::uint64_t> send_errno_count{};
     };
     DltLogChannelStatistics verbose_;
 
     void FlushUnprotected();
 
+    /// The batch a channel without a sender thread sends from. StartSender() allocates those queued to the sender.
+    void AllocateDatagrams()
+    {
+        batches_.push_back(MakeBatch());
+        batch_ = batches_.back().get();
+        held_blocks_.reserve(vector_count_);
+    }
+
+    std::unique_ptr<DatagramBatch> MakeBatch() const
+    {
+        auto batch = std::make_unique<DatagramBatch>();
+        batch->prebuf_data.assign(vector_count_, std::vector<char>(datagram_capacity_));
+        batch->io_vec.assign(vector_count_,
+                             std::vector<iovec>(segmentation_offload_ ? kMaxIoVecCount : kDatagramIoVecCount));
+        batch->mmsg_hdr_array.assign(vector_count_, mmsghdr{});
+        batch->segment_sizes.assign(vector_count_, 0U);
+        batch->datagram_count = 0U;
+        batch->verbose_count = 0U;
+        batch->non_verbose_count = 0U;
+        batch->channel = nullptr;
+        batch->pending = 0U;
+        batch->send_error = 0;
+        return batch;
+    }
+
+    char* GetPrebufEnd() noexcept
+    {
+        return std::next(batch_->prebuf_data.at(vector_index_).data(), static_cast<std::ptrdiff_t>(prebuf_size_));
+    }
+
+    /// Whether a message fits into the current datagram, or its current segment, including the iovecs it completes.
+    bool FitsDatagram(const size_t full_size, const size_t io_vec_count) const noexcept
+    {
+        const size_t segment_limit = (segment_size_ > 0U) ? segment_size_ : max_payload_;
+        return ((prebuf_size_ + referenced_size_ - segment_start_ + full_size) <= segment_limit) &&
+               ((io_vec_count_ + io_vec_count) <= batch_->io_vec.at(vector_index_).size());
+    }
+
+    /// Continues the datagram with a new segment. The kernel cuts a datagram into segments of the size of the first
+    /// one, thus a segment can only follow one of that size, and a shorter segment completes the datagram.
+    bool StartSegment(const size_t full_size) noexcept
+    {
+        if (!segmentation_offload_)
+        {
+            return false;
+        }
+        const size_t datagram_size = prebuf_size_ + referenced_size_;
+        const size_t segment = datagram_size - segment_start_;
+        if (segment_size_ == 0U)
+        {
+            segment_size_ = segment;
+        }
+        if ((segment != segment_size_) || (full_size > segment_size_) || ((segment_count_ + 2U) > kMaxSegmentCount) ||
+            ((datagram_size + segment_size_) > datagram_capacity_))
+        {
+            return false;
+        }
+        ++segment_count_;
+        segment_start_ = datagram_size;
+        return true;
+    }
+
+    /// Makes room for a message in the current datagram, in a new segment of it, or else completes the datagram.
+    void ReserveDatagram(const size_t full_size, const size_t io_vec_count)
+    {
+        if (FitsDatagram(full_size, io_vec_count))
+        {
+            return;
+        }
+        if (StartSegment(full_size) && FitsDatagram(full_size, io_vec_count))
+        {
+            return;
+        }
+        SendUdp();
+    }
+
+    void CompletePrebufRun() noexcept
+    {
+        if (prebuf_size_ > prebuf_run_start_)
+        {
+            auto& io_vec = batch_->io_vec.at(vector_index_).at(io_vec_count_);
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-union-access) cannot change due to qnx struct
+            io_vec.iov_base =
+                std::next(batch_->prebuf_data.at(vector_index_).data(), static_cast<std::ptrdiff_t>(prebuf_run_start_));
+            io_vec.iov_len = prebuf_size_ - prebuf_run_start_;
+            ++io_vec_count_;
+            prebuf_run_start_ = prebuf_size_;
+        }
+    }
+
     inline void SendUdp(bool flush = false)
     {
         if (prebuf_size_ > 0)
         {
             // array.at() won't throw the exception that we do boundary check below
-            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-union-access) cannot change due to qnx struct
-            io_vec_.at(vector_index_).iov_base = prebuf_data_.at(vector_index_).data();
-            io_vec_.at(vector_index_).iov_len = prebuf_size_;
-
-            mmsg_hdr_array_.at(vector_index_).msg_hdr.msg_iov = &io_vec_.at(vector_index_);
-            mmsg_hdr_array_.at(vector_index_).msg_hdr.msg_iovlen = 1;
+            CompletePrebufRun();
+            auto& msg_hdr = batch_->mmsg_hdr_array.at(vector_index_).msg_hdr;
+            msg_hdr.msg_iov = batch_->io_vec.at(vector_index_).data();
+            msg_hdr.msg_iovlen = static_cast<decltype(mmsghdr::msg_hdr.msg_iovlen)>(io_vec_count_);
+            // only a datagram of several segments is segmented by the kernel
+            batch_->segment_sizes.at(vector_index_) =
+                (segment_count_ > 0U) ? static_cast<std::uint16_t>(segment_size_) : 0U;
 
             vector_index_++;
             prebuf_size_ = 0;
+            referenced_size_ = 0;
+            io_vec_count_ = 0;
+            prebuf_run_start_ = 0;
+            segment_start_ = 0;
+            segment_size_ = 0;
+            segment_count_ = 0;
         }
 
-        if ((flush && vector_index_ > 0) || vector_index_ >= kVectorCount)
+        if ((flush && vector_index_ > 0) || vector_index_ >= vector_count_)
         {
-            score::cpp::span<mmsghdr> mmsg_span(mmsg_hdr_array_.data(), vector_index_);
-            const auto send_result = out_.Send(mmsg_span);
-            if (send_result.has_value() == false)
+            batch_->datagram_count = vector_index_;
+            batch_->verbose_count = count_verbose_messages_in_buffer_;
+            batch_->non_verbose_count = count_nonverbose_messages_in_buffer_;
+            if (!HandsBatchesOver())
             {
-                if (count_verbose_messages_in_buffer_ > 0)
+                const auto send_result = SendBatch(*batch_);
+                if (send_result.has_value() == false)
                 {
-                    ++verbose_.send_failures_count;
-                    /*
-                        Deviation from Rule M5-2-10:
-                        - Rule M5-2-10 (required, implementation, automated)
-                        The increment (++) and decrement ( ) operators shall not be mixed with
-                        other operators in an expression.
-                        Justification:
-                        - Since there are no other operations besides increment, it is quite clear what is happening.
-                    */
-                    // coverity[autosar_cpp14_m5_2_10_violation]
-                    ++verbose_.send_errno_count[send_result.error().ToString()];
-                }
-                if (count_nonverbose_messages_in_buffer_ > 0)
-                {
-                    ++non_verbose_.send_failures_count;
-                    // coverity[autosar_cpp14_m5_2_10_violation] see above.
-                    ++non_verbose_.send_errno_count[send_result.error().ToString()];
+                    CountSendFailure(send_result.error(), *batch_);
                 }
+                ReleaseHeldBlocks();
+            }
+            else
+            {
+                QueueBatch();
             }
             vector_index_ = 0;
             count_verbose_messages_in_buffer_ = 0;
@@ -233,8 +479,121 @@ class DltLogChannel
         }
     }
 
+    void ReleaseHeldBlocks() noexcept
+    {
+        for (auto* const block : held_blocks_)
+        {
+            block->Release();
+        }
+        held_blocks_.clear();
+    }
+
+    score::cpp::expected<std::int32_t, score::os::Error> SendBatch(DatagramBatch& batch)
+    {
+        score::cpp::span<mmsghdr> mmsg_span(batch.mmsg_hdr_array.data(), batch.datagram_count);
+        return segmentation_offload_
+                   ? out_.Send(mmsg_span,
+                               score::cpp::span<const std::uint16_t>(batch.segment_sizes.data(), batch.datagram_count))
+                   : out_.Send(mmsg_span);
+    }
+
+    void CountSendFailure(const score::os::Error& error, const DatagramBatch& batch)
+    {
+        if (batch.verbose_count > 0)
+        {
+            ++verbose_.send_failures_count;
+            /*
+                Deviation from Rule M5-2-10:
+                - Rule M5-2-10 (required, implementation, automated)
+                The increment (++) and decrement ( ) operators shall not be mixed with
+                other operators in an expression.
+                Justification:
+                - Since there are no other operations besides increment, it is quite clear what is happening.
+            */
+            // coverity[autosar_cpp14_m5_2_10_violation]
+            ++verbose_.send_errno_count[error.GetOsDependentErrorCode()];
+        }
+        if (batch.non_verbose_count > 0)
+        {
+            ++non_verbose_.send_failures_count;
+            // coverity[autosar_cpp14_m5_2_10_violation] see above.
+            ++non_verbose_.send_errno_count[error.GetOsDependentErrorCode()];
+        }
+    }
+
+    /// Sends a message of a header and a payload that does not fit the datagrams of the channel. Once batches are
+    /// handed over, it is sent in order with them, from a datagram of its own holding a copy of the message.
+    void SendSingleUnprotected(const iovec* io_vec, const size_t io_vec_count, const bool verbose);
+
+    /// Sends a payload too large for a single UDP datagram as segmented network trace: a start message carrying the
+    /// trace header, i.e. what precedes the payload in the original message, the segments and an end message.
+    void SendSegmentedUnprotected(const score::cpp::span<const char> trace_header,
+                                  const score::cpp::span<const char> payload,
+                                  const DltidT app_id,
+                                  const DltidT ctx_id,
+                                  const uint32_t tmsp,
+                                  const bool verbose);
+
+    bool HandsBatchesOver() const noexcept
+    {
+        return (sender_ != nullptr) || (submission_ != nullptr);
+    }
+
+    /// Hands the complete batch over to the sender thread or submission ring and continues with a free one, or drops
+    /// it if none is free.
+    void QueueBatch();
+    bool TakeFreeBatch(DatagramBatch*& batch);
+    /// Returns a batch to the free ones of a submission ring, once its last datagram completed.
+    void ReleaseBatch(DatagramBatch& batch) noexcept;
+    size_t GetHandOverDepth() const noexcept;
+    void RunSender();
+    void StopSender() noexcept;
+
+    /// The thread sending the batches handed over through the ready queue, and returning them through the free queue.
+    /// Both queues have a single producer, as the routing threads only hand batches over while holding mutex_.
+    struct Sender
+    {
+        explicit Sender(const size_t queue_depth)
+            : ready_batches{queue_depth},
+              free_batches{queue_depth},
+              depth{0U},
+              mutex{},
+              condition{},
+              exit{false},
+              thread{}
+        {
+        }
+
+        score::platform::datarouter::SpscRingQueue<DatagramBatch*> ready_batches;
+        score::platform::datarouter::SpscRingQueue<DatagramBatch*> free_batches;
+        std::atomic<size_t> depth;
+        std::mutex mutex;
+        std::condition_variable condition;
+        bool exit;
+        std::thread thread;
+    };
+    std::unique_ptr<Sender> sender_;
+
+    /// The batches handed over to the submission ring, freed by the completion of their last datagram.
+    struct Submission
+    {
+        explicit Submission(IUdpSubmissionRing& submission_ring)
+            : ring{submission_ring}, mutex{}, free_batches{}, depth{0U}
+        {
+        }
+
+        IUdpSubmissionRing& ring;
+        // only guards the free batches, as the thread reaping the completions may hold the mutex of another channel
+        std::mutex mutex;
+        std::vector<DatagramBatch*> free_batches;
+        std::atomic<size_t> depth;
+    };
+    std::unique_ptr<Submission> submission_;
+    SenderQueueStatistics sender_statistics_;
+
     struct DltLogChannelNonVerboseStatistics : public DltLogChannelStatistics
     {
+        // entries are kept across statistics intervals, so that sending a message does not allocate an entry again
         std::unordered_map<uint32_t, size_t> message_id_data_stats;
     };
     DltLogChannelNonVerboseStatistics non_verbose_;
@@ -256,10 +615,15 @@ class DltLogChannel
         {
             for (const auto& error_item : statistics.send_errno_count)
             {
-                log_stream << ", failed to send " << error_item.second << " times due to \"" << error_item.first
-                           << "\"";
+                log_stream << ", failed to send " << error_item.second << " times due to \""
+                           << score::os::Error::createFromErrno(error_item.first).ToString() << "\"";
             }
         }
+        const auto prefiltered_count = statistics.prefiltered_count.exchange(0U, std::memory_order_relaxed);
+        if (prefiltered_count > 0U)
+        {
+            log_stream << ", prefiltered: count " << prefiltered_count;
+        }
         if (bind_result_.has_value() == false)
         {
             log_stream << ", failed to bind: " << bind_result_.error().ToString();
@@ -272,6 +636,22 @@ class DltLogChannel
         return;
     }
 
+    template <typename Logger>
+    void ShowAndClearStatsSenderQueue(Logger& stat_logger, DltidT channel_id)
+    {
+        const auto depth = GetHandOverDepth();
+        auto log_stream{stat_logger.LogInfo()};
+        log_stream << "sender queue of the channel:" << channel_id.Data() << ": depth " << depth << " of "
+                   << (batches_.size() - 1U) << ", high watermark " << sender_statistics_.high_watermark
+                   << ", handed over " << sender_statistics_.handed_over_batches << " batches, dropped "
+                   << sender_statistics_.dropped_messages << " messages in " << sender_statistics_.dropped_datagrams
+                   << " datagrams of " << sender_statistics_.dropped_batches << " batches";
+
+        //  Cleanup:
+        sender_statistics_ = SenderQueueStatistics{};
+        sender_statistics_.high_watermark = depth;
+    }
+
     template <typename Logger>
     void ShowAndClearStatsNonVerbose(DltLogChannelNonVerboseStatistics& statistics,
                                      Logger& stat_logger,
@@ -279,8 +659,13 @@ class DltLogChannel
     {
         ShowAndClearStatsDlt(statistics, stat_logger, channel_id, "non-verbose");
 
-        std::vector<std::pair<uint32_t, size_t>> dlt_non_verbose_diagnostics(begin(statistics.message_id_data_stats),
-                                                                             end(statistics.message_id_data_stats));
+        std::vector<std::pair<uint32_t, size_t>> dlt_non_verbose_diagnostics{};
+        std::copy_if(begin(statistics.message_id_data_stats),
+                     end(statistics.message_id_data_stats),
+                     std::back_inserter(dlt_non_verbose_diagnostics),
+                     [](const auto& elem) {
+                         return elem.second > 0U;
+                     });
         std::sort(begin(dlt_non_verbose_diagnostics),
                   end(dlt_non_verbose_diagnostics),
                   [](const auto& elem1, const auto& elem2) {
@@ -296,7 +681,10 @@ class DltLogChannel
             });
 
         //  Cleanup:
-        statistics.message_id_data_stats.clear();
+        for (auto& elem : statistics.message_id_data_stats)
+        {
+            elem.second = 0U;
+        }
         return;
     }
 };
@@ -18,6 +18,8 @@
 #include "daemon/diagnostic_job_handler.h"
 #include "daemon/diagnostic_job_parser.h"
 #include "daemon/dlt_log_server_config.h"
+#include "daemon/routing_cache.h"
+#include "daemon/udp_submission_ring.h"
 #include "daemon/verbose_dlt.h"
 #include "i_session.h"
 #include "logparser/logparser.h"
@@ -27,11 +29,14 @@
 
 #include "score/mw/log/configuration/nvconfig.h"
 #include "score/mw/log/log_level.h"
+#include "score/datarouter/datarouter/rcu_snapshot.h"
 #include "score/datarouter/include/daemon/log_sender.h"
 
 #include <atomic>
 #include <bitset>
+#include <cstdint>
 #include <functional>
+#include <memory>
 #include <mutex>
 #include <optional>
 #include <unordered_map>
@@ -77,13 +82,17 @@ class DltLogServer : score::platform::datarouter::DltNonverboseHandlerType::IOut
           default_threshold_{},
           message_thresholds_{},
           channel_assignments_{},
+          routing_table_{},
+          routing_generation_{0U},
           throughput_overall_{0},
           throughput_apps_{},
           static_config_{std::move(static_config)},
+          broadcast_bodies_{kBroadcastBlockSize},
           channels_{},
           default_channel_{},
           coredump_channel_{std::nullopt},
           channel_nums_{},
+          submission_ring_{},
           nvhandler_{*this},
           vhandler_{*this},
           fthandler_{*this},
@@ -93,6 +102,7 @@ class DltLogServer : score::platform::datarouter::DltNonverboseHandlerType::IOut
           parser_(parser ? std::move(parser) : std::make_unique<DiagnosticJobParser>())
     {
         InitLogChannels();
+        PublishRoutingTable();
         SysedrFactoryType sysedr_factory;
         sysedr_handler_ = sysedr_factory.CreateSysedrHandler();
     }
@@ -130,6 +140,11 @@ class DltLogServer : score::platform::datarouter::DltNonverboseHandlerType::IOut
         {
             channel.Flush();
         }
+        // the flushes of all channels are submitted at once, failed messages are counted by their channels
+        if (submission_ring_ != nullptr)
+        {
+            std::ignore = submission_ring_->Submit();
+        }
     }
 
     double GetQuota(std::string name)
@@ -139,11 +154,32 @@ class DltLogServer : score::platform::datarouter::DltNonverboseHandlerType::IOut
         return quota == throughput_apps_.end() ? 1.0 : quota->second;
     }
 
+    double GetThroughputOverall()
+    {
+        std::lock_guard<std::mutex> lock(config_mutex_);
+        return throughput_overall_;
+    }
+
     bool GetQuotaEnforcementEnabled() const
     {
         return static_config_.quota_enforcement_enabled;
     }
 
+    const score::platform::datarouter::ThreadPlacementConfig& GetThreadPlacementConfig() const
+    {
+        return static_config_.thread_placement;
+    }
+
+    std::uint32_t GetMessagePassingWorkerCount() const
+    {
+        return static_config_.message_passing_worker_count;
+    }
+
+    /// Attaches the channels configured for io_uring to a submission ring shared by them, where available, and starts
+    /// the sender threads of the other channels configured with a sender queue, named "dlt_tx_<channel index>".
+    /// Returns the number of channels handing their batches over. Shall be called before any message is routed.
+    size_t StartChannelSenders(const score::platform::datarouter::ThreadPlacements* thread_placements = nullptr);
+
     SessionPtr NewConfigSession(score::platform::datarouter::ConfigSessionHandleType handle)
     {
         return score::platform::datarouter::DynamicConfigurationHandlerFactoryType().CreateConfigSession(
@@ -167,6 +203,13 @@ class DltLogServer : score::platform::datarouter::DltNonverboseHandlerType::IOut
         {
             dltlogchannel.ShowStats(stats_logger);
         }
+        if (submission_ring_ != nullptr)
+        {
+            const auto statistics = submission_ring_->GetStatistics();
+            stats_logger.LogInfo() << "io_uring: " << statistics.submitted_messages << " messages submitted by "
+                                   << statistics.enter_calls << " calls, " << statistics.completed_messages
+                                   << " completed";
+        }
     }
     // LCOV_EXCL_STOP
 
@@ -207,18 +250,70 @@ class DltLogServer : score::platform::datarouter::DltNonverboseHandlerType::IOut
 
     using ChannelmaskT = std::bitset<32>;
 
+    static constexpr std::size_t kBroadcastBlockSize{64UL * 1024UL};
+
+    /// The filtering configuration compiled for routing. Immutable once published.
+    struct RoutingTable
+    {
+        struct Rule
+        {
+            std::optional<LoglevelT> threshold{};
+            std::optional<ChannelmaskT> channels{};
+            // the wildcard fallbacks are merged in already, which is the case for all but wildcard keys
+            bool resolved{false};
+        };
+
+        /// The threshold and the channels of the messages of the context, valid for the generation of the table.
+        CachedRoute Resolve(const DltidT app_id, const DltidT ctx_id) const noexcept;
+
+        std::uint64_t generation{0U};
+        bool filtering_enabled{false};
+        LoglevelT default_threshold{};
+        std::unordered_map<KeyT, Rule, KeyHash> rules{};
+    };
+
     template <typename F>
     void FilterAndCall(DltidT app_id, DltidT ctx_id, mw::log::LogLevel log_level, F f)
     {
-        ChannelmaskT assigned;
+        CachedRoute route{};
         {
-            std::lock_guard<std::mutex> lock(config_mutex_);
-            if (!IsAcceptedByFiltering(app_id, ctx_id, log_level))
-            {
-                return;
-            }
-            assigned = AssignedToChannels(app_id, ctx_id);
+            const auto routing_table = routing_table_.Read();
+            route = routing_table->Resolve(app_id, ctx_id);
         }
+        CallRouted(route, log_level, f);
+    }
+
+    /// Like the overload above, resolving the route only if the memoized one is outdated.
+    template <typename F>
+    void FilterAndCall(CachedRoute& route, DltidT app_id, DltidT ctx_id, mw::log::LogLevel log_level, F f)
+    {
+        RefreshRoute(route, app_id, ctx_id);
+        CallRouted(route, log_level, f);
+    }
+
+    void RefreshRoute(CachedRoute& route, DltidT app_id, DltidT ctx_id) const noexcept
+    {
+        if (route.generation != routing_generation_.load(std::memory_order_acquire))
+        {
+            const auto routing_table = routing_table_.Read();
+            route = routing_table->Resolve(app_id, ctx_id);
+        }
+    }
+
+    template <typename F>
+    void CallRouted(const CachedRoute& route, mw::log::LogLevel log_level, F f)
+    {
+        if (route.threshold.has_value() && (log_level > route.threshold.value()))
+        {
+            return;
+        }
+        ForEachRoutedChannel(route, f);
+    }
+
+    template <typename F>
+    void ForEachRoutedChannel(const CachedRoute& route, F f)
+    {
+        const ChannelmaskT assigned = route.channels;
         if (assigned.none())
         {
             f(channels_[default_channel_]);
@@ -235,6 +330,34 @@ class DltLogServer : score::platform::datarouter::DltNonverboseHandlerType::IOut
         }
     }
 
+    /// Like CallRouted(), encoding a message routed to several channels only once. The channels reference its body,
+    /// see DltLogChannel::SendEncoded(), instead of each constructing a copy of the message.
+    template <typename Encode, typename F>
+    void CallRoutedEncodingOnce(const CachedRoute& route,
+                                DltEncodedMessage message,
+                                const std::size_t body_size,
+                                Encode encode,
+                                F f)
+    {
+        if (route.threshold.has_value() && (message.log_level > route.threshold.value()))
+        {
+            return;
+        }
+        if ((route.channels.count() < 2U) || (body_size > DltLogChannel::GetMaxEncodedBodySize()))
+        {
+            ForEachRoutedChannel(route, f);
+            return;
+        }
+        const auto body = broadcast_bodies_.Allocate(body_size);
+        encode(body.data);
+        message.body = score::cpp::span<const char>{body.data, body_size};
+        message.block = body.block;
+        ForEachRoutedChannel(route, [this, &message](DltLogChannel& c) {
+            log_sender_->SendEncoded(message, c);
+        });
+        body.block->Release();
+    }
+
     inline std::optional<uint8_t> GetCoredumpChannel() const
     {
         // Read coredump_channel_ under config_mutex_ to avoid data race with InitLogChannels
@@ -265,21 +388,7 @@ class DltLogServer : score::platform::datarouter::DltNonverboseHandlerType::IOut
     }
 
     // should be called under the mutex
-    bool IsAcceptedByFiltering(const DltidT app_id, const DltidT ctx_id, const mw::log::LogLevel log_level)
-    {
-        if (!filtering_enabled_)
-        {
-            return true;
-        }
-        const auto threshold = FindInKeyMap(message_thresholds_, app_id, ctx_id).value_or(default_threshold_);
-        return log_level <= threshold;
-    }
-
-    // should be called under the mutex
-    ChannelmaskT AssignedToChannels(DltidT app_id, DltidT ctx_id)
-    {
-        return FindInKeyMap(channel_assignments_, app_id, ctx_id).value_or(ChannelmaskT{});
-    }
+    void PublishRoutingTable();
 
     mutable std::mutex config_mutex_;
 
@@ -289,16 +398,26 @@ class DltLogServer : score::platform::datarouter::DltNonverboseHandlerType::IOut
     LoglevelT default_threshold_;
     std::unordered_map<KeyT, LoglevelT, KeyHash> message_thresholds_;
     std::unordered_map<KeyT, ChannelmaskT, KeyHash> channel_assignments_;
+    // compiled from the members above whenever they change, read by FilterAndCall() without locking
+    score::platform::datarouter::RcuSnapshot<RoutingTable> routing_table_;
+    // generation of the routing table published last, invalidating the routes memoized before
+    std::atomic<std::uint64_t> routing_generation_;
 
     double throughput_overall_;
     std::unordered_map<DltidT, double> throughput_apps_;
 
     StaticConfig static_config_;
 
+    // bodies of the messages routed to several channels, encoded once and referenced by the channels until sent,
+    // destroyed after the channels releasing them
+    BroadcastBodyPool broadcast_bodies_;
+
     std::vector<DltLogChannel> channels_;
     size_t default_channel_;
     std::optional<uint8_t> coredump_channel_;
     std::unordered_map<DltidT, size_t> channel_nums_;
+    // shared by the channels configured for io_uring, destroyed first as it completes their batches in flight
+    std::unique_ptr<UdpSubmissionRing> submission_ring_;
 
     score::platform::datarouter::DltNonverboseHandlerType nvhandler_;
     DltVerboseHandler vhandler_;
@@ -317,9 +436,22 @@ class DltLogServer : score::platform::datarouter::DltNonverboseHandlerType::IOut
                         uint32_t tmsp,
                         const void* data,
                         size_t size) override final;
+    void SendNonVerbose(const score::mw::log::config::NvMsgDescriptor& desc,
+                        uint32_t tmsp,
+                        const void* data,
+                        size_t size,
+                        CachedRoute& route) override final;
     void SendVerbose(
         uint32_t tmsp,
         const score::mw::log::detail::log_entry_deserialization::LogEntryDeserializationReflection& entry) override final;
+    void SendVerbose(
+        uint32_t tmsp,
+        const score::mw::log::detail::log_entry_deserialization::LogEntryDeserializationReflection& entry,
+        CachedRoute& route) override final;
+    bool PrefilterVerbose(CachedRoute& route,
+                          DltidT app_id,
+                          DltidT ctx_id,
+                          mw::log::LogLevel log_level) override final;
     void SendFtVerbose(score::cpp::span<const std::uint8_t> data,
                        mw::log::LogLevel loglevel,
                        DltidT app_id,
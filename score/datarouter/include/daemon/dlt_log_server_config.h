@@ -15,8 +15,12 @@
 #define SCORE_DATAROUTER_INCLUDE_DAEMON_DLT_LOG_SERVER_CONFIG_H
 
 #include "daemon/dltserver_common.h"
+#include "score/datarouter/datarouter/thread_placement.h"
 #include "score/mw/log/log_level.h"
 
+#include <cstddef>
+#include <cstdint>
+#include <optional>
 #include <unordered_map>
 #include <vector>
 
@@ -29,6 +33,26 @@ namespace dltserver
 
 using LoglevelT = mw::log::LogLevel;
 
+/// How a channel batches its messages into datagrams and hands them to the socket.
+struct ChannelTransportConfig
+{
+    /// Number of datagrams sent with one sendmmsg() call.
+    std::size_t vector_count = 4U;
+    /// MTU of the link, e.g. 9000 for jumbo frames. The datagrams are sized not to be fragmented.
+    std::uint32_t mtu = 1500U;
+    /// SO_SNDBUF of the socket, the default of UdpStreamOutput if empty.
+    std::optional<std::int32_t> send_buffer_size;
+    /// Lets the kernel split a datagram into several of the MTU (UDP GSO, Linux only). Gains the most for messages of
+    /// the same size, as the segments of a datagram shall have the same size.
+    bool segmentation_offload = false;
+    /// Batches of datagrams that may wait for the sender thread of the channel. With 0 the channel has no sender
+    /// thread, the datagrams are sent by the threads routing the messages.
+    std::size_t sender_queue_depth = 0U;
+    /// Submits the batches through the io_uring shared by all channels, instead of sending them. Then the sender
+    /// queue depth limits the batches in flight. Falls back to sending where io_uring is not available.
+    bool io_uring = false;
+};
+
 struct StaticConfig
 {
     struct ChannelDescription
@@ -41,6 +65,8 @@ struct StaticConfig
 
         LoglevelT channel_threshold = LoglevelT::kOff;
         std::string multicast_interface;
+
+        ChannelTransportConfig transport;
     };
 
     struct ThroughputQuotas
@@ -60,6 +86,10 @@ struct StaticConfig
 
     ThroughputQuotas throughput;
     bool quota_enforcement_enabled;
+
+    score::platform::datarouter::ThreadPlacementConfig thread_placement;
+    /// Message passing workers draining the client buffers. With 0 there is one per core, up to a built-in limit.
+    std::uint32_t message_passing_worker_count = 0U;
 };
 
 struct PersistentConfig
@@ -40,6 +40,7 @@ class ILogSender
         uint32_t tmsp,
         const score::mw::log::detail::log_entry_deserialization::LogEntryDeserializationReflection& entry,
         DltLogChannel& c) = 0;
+    virtual void SendEncoded(const DltEncodedMessage& message, DltLogChannel& c) = 0;
     virtual void SendFTVerbose(score::cpp::span<const std::uint8_t> data,
                                mw::log::LogLevel loglevel,
                                DltidT app_id,
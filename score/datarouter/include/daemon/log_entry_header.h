@@ -0,0 +1,47 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#ifndef SCORE_DATAROUTER_INCLUDE_DAEMON_LOG_ENTRY_HEADER_H
+#define SCORE_DATAROUTER_INCLUDE_DAEMON_LOG_ENTRY_HEADER_H
+
+#include "dlt/dltid.h"
+#include "router/data_router_types.h"
+#include "score/mw/log/log_level.h"
+
+#include <optional>
+
+namespace score
+{
+namespace logging
+{
+namespace dltserver
+{
+
+/// The fields of a verbose message its routing depends on.
+struct LogEntryHeader
+{
+    score::platform::DltidT app_id;
+    score::platform::DltidT ctx_id;
+    mw::log::LogLevel log_level;
+};
+
+/// Reads the routing fields of a serialized LogEntry without deserializing it. The fields precede the payload at fixed
+/// offsets, which are located once by deserializing probes, so that they follow the serialization format.
+/// Returns std::nullopt if the offsets could not be located or the record is too short to hold the fields.
+std::optional<LogEntryHeader> PeekLogEntryHeader(const char* data, score::platform::BufsizeT size);
+
+}  // namespace dltserver
+}  // namespace logging
+}  // namespace score
+
+#endif  // SCORE_DATAROUTER_INCLUDE_DAEMON_LOG_ENTRY_HEADER_H
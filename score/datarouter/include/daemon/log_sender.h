@@ -44,6 +44,10 @@ class LogSender : public ILogSender
     {
         c.SendVerbose(tmsp, entry);
     }
+    void SendEncoded(const DltEncodedMessage& message, DltLogChannel& c) override
+    {
+        c.SendEncoded(message);
+    }
     void SendFTVerbose(score::cpp::span<const std::uint8_t> data,
                        mw::log::LogLevel loglevel,
                        DltidT app_id,
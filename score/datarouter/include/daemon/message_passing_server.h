@@ -24,17 +24,22 @@
 #include "score/mw/log/detail/logging_identifier.h"
 
 #include "score/datarouter/daemon_communication/session_handle_interface.h"
+#include "score/datarouter/datarouter/thread_placement.h"
 #include <score/jthread.hpp>
 
 #include "score/concurrency/interruptible_wait.h"
 #include <score/stop_token.hpp>
+#include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <functional>
+#include <memory>
 #include <mutex>
 #include <optional>
 #include <queue>
 #include <thread>
 #include <unordered_map>
+#include <vector>
 
 namespace score
 {
@@ -55,16 +60,31 @@ class IMessagePassingServerSessionWrapper
 /// QNX message passing server for handling logging client connections.
 ///
 /// Manages multiple client sessions and processes their log data asynchronously.
-/// Uses a single worker thread to read from client shared memory buffers and route
+/// Uses a pool of worker threads to read from client shared memory buffers and route
 /// log messages through the DataRouter pipeline.
 ///
 /// Threading model:
 /// - Dispatch thread: Created by QnxDispatchEngine; receives connection requests and
 ///   messages via QNX message passing (dispatch_block loop in QnxDispatchEngine::RunOnThread)
-/// - Worker thread: Processes session tick events to read shared memory and route logs
+/// - Worker threads: Process session tick events to read shared memory and route logs.
+///   The first worker additionally schedules the periodic ticks of all sessions.
 ///
-/// Each client session is scheduled on the worker thread via a work queue to avoid
+/// Each client session is scheduled on a worker thread via a work queue to avoid
 /// blocking the dispatch thread during potentially slow shared memory operations.
+/// Every worker owns a run queue; a session is always enqueued to the same queue (selected by pid),
+/// and idle workers steal from the queues of busy ones, so a slow session does not delay the others.
+/// Each run queue has its own lock, so popping and stealing do not contend on the server lock, which guards the
+/// session states and the deadlines only.
+/// A session is enqueued at most once and never while running, thus it is never ticked concurrently.
+/// Within a run queue, the most urgent session is ticked first: urgency is the fill level of the client buffer
+/// plus an aging term growing with the time spent in the queue, so buffers close to dropping messages are drained
+/// first, while sessions with empty buffers still get their turn. As all entries of a queue age alike, the urgency
+/// is computed once when the tick is queued, and the run queue is a heap ordered by it.
+///
+/// Besides event-driven ticks (connect, acquire response), each session has a deadline for its next tick,
+/// derived from the activity it reported for the last one: sessions waiting for an acquisition are revisited
+/// within microseconds with exponential backoff, idle sessions progressively less often.
+/// A single idle worker sleeps until the earliest deadline and moves due sessions to the run queues.
 class MessagePassingServer : public IMessagePassingServerSessionWrapper
 {
   public:
@@ -79,6 +99,7 @@ class MessagePassingServer : public IMessagePassingServerSessionWrapper
         }
 
         bool AcquireRequest() const override;
+        bool GrantPoolBlock(const std::uint32_t slot) const override;
 
       private:
         score::cpp::pmr::unique_ptr<score::message_passing::IClientConnection> sender_;
@@ -87,6 +108,15 @@ class MessagePassingServer : public IMessagePassingServerSessionWrapper
         mutable std::optional<score::message_passing::IClientConnection::State> sender_state_;
     };
 
+    /// Activity of a session during its last tick, used to schedule the next one.
+    enum class TickActivity : std::uint8_t
+    {
+        kIdle,     ///< nothing to read and nothing in flight
+        kActive,   ///< data was read
+        kPending,  ///< acquisition in flight, the next tick is expected to make progress soon
+        kYielded,  ///< stopped at its read budget, continues once the other due sessions had their turn
+    };
+
     class ISession
     {
       public:
@@ -94,6 +124,23 @@ class MessagePassingServer : public IMessagePassingServerSessionWrapper
         virtual void OnAcquireResponse(const score::mw::log::detail::ReadAcquireResult&) = 0;
         virtual void OnClosedByPeer() = 0;
         virtual bool IsSourceClosed() = 0;
+        /// Called after each Tick() on the same worker thread.
+        /// Sessions not providing the hint are ticked with the fixed default interval.
+        virtual TickActivity GetTickActivity() const
+        {
+            return TickActivity::kActive;
+        }
+        /// Fill level of the client buffer in the range [0, 1], used to drain the fullest buffers first.
+        /// Called when a tick of the session is queued, with the server lock held, thus it shall not block.
+        virtual double GetFillRatio() const
+        {
+            return 0.0;
+        }
+        /// Memory node holding the client buffer, to let a worker placed on that node tick the session.
+        virtual std::optional<std::int32_t> GetMemoryNode() const
+        {
+            return std::nullopt;
+        }
         virtual ~ISession() = default;
     };
 
@@ -104,7 +151,9 @@ class MessagePassingServer : public IMessagePassingServerSessionWrapper
 
     explicit MessagePassingServer(SessionFactory factory,
                                   std::shared_ptr<score::message_passing::IServerFactory> server_factory = nullptr,
-                                  std::shared_ptr<score::message_passing::IClientFactory> client_factory = nullptr);
+                                  std::shared_ptr<score::message_passing::IClientFactory> client_factory = nullptr,
+                                  std::size_t worker_count = 1U,
+                                  const score::platform::datarouter::ThreadPlacements* thread_placements = nullptr);
     ~MessagePassingServer() noexcept;
 
     // for unit test only. to keep rest of functions in private
@@ -123,15 +172,19 @@ class MessagePassingServer : public IMessagePassingServerSessionWrapper
     {
         SessionWrapper(IMessagePassingServerSessionWrapper* server_instance,
                        pid_t process_id,
-                       std::unique_ptr<ISession> session_instance)
+                       std::unique_ptr<ISession> session_instance,
+                       std::size_t home_worker_index = 0U)
             : server(server_instance),
               pid(process_id),
               session(std::move(session_instance)),
+              home_worker(home_worker_index),
               enqueued(false),
               running(false),
               to_delete(false),
               closed_by_peer(false),
-              to_force_finish(false)
+              to_force_finish(false),
+              tick_delay(std::chrono::microseconds::zero()),
+              scheduled_tick()
         {
         }
 
@@ -149,6 +202,8 @@ class MessagePassingServer : public IMessagePassingServerSessionWrapper
         }
 
         bool TickAtWorkerThread() const;
+        TickActivity GetTickActivity() const;
+        double GetFillRatio() const;
         void NotifyClosedByPeer() const;
 
         void SetRunningWhileLocked();
@@ -164,18 +219,71 @@ class MessagePassingServer : public IMessagePassingServerSessionWrapper
         IMessagePassingServerSessionWrapper* server;
         pid_t pid;
         std::unique_ptr<ISession> session;
+        std::size_t home_worker;  // index of the work queue the session returns to
 
         bool enqueued;
         bool running;
         bool to_delete;
         bool closed_by_peer;
         bool to_force_finish;
+
+        std::chrono::microseconds tick_delay;  // delay used to schedule the last deadline
+        TimestampT scheduled_tick;             // deadline of the valid entry in tick_deadlines_, if any
     };
 
+    struct ScheduledTick
+    {
+        TimestampT deadline;
+        pid_t pid;
+
+        bool operator>(const ScheduledTick& other) const
+        {
+            return deadline > other.deadline;
+        }
+    };
+
+    struct QueuedTick
+    {
+        pid_t pid;
+        // urgency less the aging shared by all entries queued before, thus it keeps their order while queued
+        double priority;
+
+        bool operator<(const QueuedTick& other) const
+        {
+            return priority < other.priority;
+        }
+    };
+
+    /// Run queue of a worker, guarded by its own mutex; ticks are pushed with the server lock held as well.
+    struct RunQueue
+    {
+        std::mutex mutex{};
+        std::vector<QueuedTick> ticks{};     // heap of the most urgent tick
+        std::atomic<std::size_t> size{0U};  // to skip empty queues without taking their lock
+    };
+
+    static std::chrono::microseconds GetNextTickDelay(TickActivity activity, std::chrono::microseconds previous_delay);
+    static double GetTickUrgency(double fill_ratio, std::chrono::microseconds waiting_time);
+    static std::string GetWorkerThreadName(std::size_t worker_index);
+    static std::size_t SelectHomeWorker(pid_t pid,
+                                        std::optional<std::int32_t> memory_node,
+                                        const std::vector<std::optional<std::int32_t>>& worker_memory_nodes);
+
     void FinishPreviousSessionWhileLocked(std::unordered_map<pid_t, MessagePassingServer::SessionWrapper>::iterator it,
                                           std::unique_lock<std::mutex>& lock);
     void EnqueueTickWhileLocked(pid_t pid) override;
-    void RunWorkerThread();
+    void RunWorkerThread(std::size_t worker_index);
+    RunQueue& GetWorkQueueWhileLocked(pid_t pid);
+    double GetTickPriorityWhileLocked(pid_t pid, TimestampT now) const;
+    void ForceFinishWhileLocked(SessionWrapper& wrapper);
+    bool HasWorkWhileLocked() const;
+    std::optional<pid_t> PopWork(std::size_t worker_index);
+    void TickSessionWhileLocked(pid_t pid, std::unique_lock<std::mutex>& lock);
+    void WaitForWorkWhileLocked(std::unique_lock<std::mutex>& lock);
+    void ScheduleTickWhileLocked(SessionWrapper& wrapper, TickActivity activity, TimestampT now);
+    void EnqueueDueTicks(TimestampT now);
+    void EnqueueDueTicksWhileLocked(TimestampT now);
+    void UpdateEarliestDeadlineWhileLocked();
 
     SessionFactory factory_;
 
@@ -184,10 +292,17 @@ class MessagePassingServer : public IMessagePassingServerSessionWrapper
     std::mutex mutex_;
     score::cpp::stop_source stop_source_;
     TimestampT connection_timeout_;
-    score::cpp::jthread worker_thread_;
-    std::condition_variable worker_cond_;  // to wake up worker thread
+    std::vector<score::cpp::jthread> worker_threads_;
+    std::condition_variable worker_cond_;  // to wake up worker threads
     std::unordered_map<pid_t, SessionWrapper> pid_session_map_;
-    std::queue<pid_t> work_queue_;
+    TimestampT start_time_;                                         // origin of the aging of queued ticks
+    std::vector<std::unique_ptr<RunQueue>> work_queues_;            // one per worker thread
+    std::vector<std::optional<std::int32_t>> worker_memory_nodes_;  // memory node each worker is placed on, if any
+    std::size_t idle_workers_;                                      // workers waiting on worker_cond_
+    std::priority_queue<ScheduledTick, std::vector<ScheduledTick>, std::greater<ScheduledTick>> tick_deadlines_;
+    std::atomic<TimestampT::rep> earliest_deadline_;  // of tick_deadlines_, checked by busy workers without locking
+    std::condition_variable timer_cond_;  // to wake up the worker waiting for the earliest deadline
+    bool timer_waiting_;
     std::atomic<bool> workers_exit_;
     std::condition_variable server_cond_;  // to wake up server thread
     bool session_finishing_;
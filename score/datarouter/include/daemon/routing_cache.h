@@ -0,0 +1,95 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#ifndef SCORE_DATAROUTER_INCLUDE_DAEMON_ROUTING_CACHE_H
+#define SCORE_DATAROUTER_INCLUDE_DAEMON_ROUTING_CACHE_H
+
+#include "daemon/dltserver_common.h"
+
+#include "score/mw/log/log_level.h"
+
+#include <array>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+namespace score
+{
+namespace logging
+{
+namespace dltserver
+{
+
+/// A routing decision of the DltLogServer memoized by a handler.
+/// It is valid while its generation is the generation of the current filtering configuration.
+struct CachedRoute
+{
+    /// Zero for a route never resolved, as the DltLogServer counts its generations from one.
+    std::uint64_t generation{0U};
+    /// Messages more severe than the threshold are filtered out, nullopt if they are not filtered.
+    std::optional<mw::log::LogLevel> threshold{};
+    /// Channels the messages are routed to, none for the default channel.
+    std::bitset<32> channels{};
+};
+
+/// The route of a non-verbose type, whose app id and ctx id are given by its NvMsgDescriptor.
+class NonVerboseRoutingState : public LogParser::HandlerState
+{
+  public:
+    CachedRoute& GetRoute() noexcept
+    {
+        return route_;
+    }
+
+  private:
+    CachedRoute route_{};
+};
+
+/// The routes of the contexts verbose messages of a session were logged from, direct-mapped by their ids.
+/// An application typically logs from a few contexts only, which are routed without a lookup thereby.
+class VerboseRoutingState : public LogParser::HandlerState
+{
+  public:
+    /// Returns the route of the context, a route never resolved if its slot held another context.
+    CachedRoute& GetRoute(const DltidT app_id, const DltidT ctx_id) noexcept
+    {
+        const auto hash = static_cast<std::uint32_t>(app_id.GetHash()) ^
+                          (static_cast<std::uint32_t>(ctx_id.GetHash()) * kHashMultiplier);
+        auto& entry = entries_[static_cast<std::size_t>(hash) % kNumberOfEntries];
+        if (!(entry.app_id == app_id) || !(entry.ctx_id == ctx_id))
+        {
+            entry = Entry{app_id, ctx_id, CachedRoute{}};
+        }
+        return entry.route;
+    }
+
+  private:
+    static constexpr std::size_t kNumberOfEntries{16U};
+    static constexpr std::uint32_t kHashMultiplier{0x9e3779b9U};
+
+    struct Entry
+    {
+        DltidT app_id{};
+        DltidT ctx_id{};
+        CachedRoute route{};
+    };
+
+    std::array<Entry, kNumberOfEntries> entries_{};
+};
+
+}  // namespace dltserver
+}  // namespace logging
+}  // namespace score
+
+#endif  // SCORE_DATAROUTER_INCLUDE_DAEMON_ROUTING_CACHE_H
@@ -103,7 +103,12 @@ class SocketServer
         const score::mw::log::NvConfig& nv_config,
         const pid_t client_pid,
         const score::mw::log::detail::ConnectMessageFromClient& conn,
-        score::cpp::pmr::unique_ptr<score::platform::internal::daemon::ISessionHandle> handle);
+        score::cpp::pmr::unique_ptr<score::platform::internal::daemon::ISessionHandle> handle,
+        score::mw::log::detail::SharedMemoryPool* shared_memory_pool = nullptr);
+
+    /// \brief Announces the shared-memory pool logging clients borrow linear buffers from.
+    /// Returns empty if the pool could not be announced; clients then only use their own buffers.
+    static score::cpp::optional<score::mw::log::detail::SharedMemoryPool> CreateSharedMemoryPool();
 
     static score::mw::log::NvConfig LoadNvConfig(
         score::mw::log::Logger& stats_logger,
@@ -16,6 +16,7 @@
 
 #include "score/os/pthread.h"
 #include "score/os/socket_impl.h"
+#include "score/datarouter/include/daemon/udp_submission_ring.h"
 #include "score/datarouter/network/vlan.h"
 
 #include <arpa/inet.h>
@@ -24,7 +25,10 @@
 
 #include <pthread.h>
 #include <errno.h>
+#include <array>
+#include <cstdint>
 #include <memory>
+#include <vector>
 
 namespace score
 {
@@ -51,16 +55,41 @@ class UdpStreamOutput
 
     score::cpp::expected_blank<score::os::Error> Bind(const char* src_addr = nullptr, uint16_t src_port = 0) noexcept;
 
+    /// Replaces the default SO_SNDBUF of 64 KiB, e.g. to queue the bursts of fast links.
+    score::cpp::expected_blank<score::os::Error> SetSendBufferSize(const std::int32_t size) noexcept;
+
+    /// Enables sending messages segmented by the kernel (UDP GSO) with Send(mmsg, segment_sizes), for up to
+    /// max_messages messages per call. Fails where the kernel does not support UDP_SEGMENT, e.g. on QNX.
+    score::cpp::expected_blank<score::os::Error> EnableSegmentationOffload(const std::size_t max_messages);
+
     score::cpp::expected<std::int32_t, score::os::Error> Send(score::cpp::span<mmsghdr> mmsg) noexcept;
 
+    /// Sends the messages, the kernel splits each message with a non-zero segment size into datagrams of that size.
+    /// All of them but the last one have that size. Requires EnableSegmentationOffload().
+    score::cpp::expected<std::int32_t, score::os::Error> Send(score::cpp::span<mmsghdr> mmsg,
+                                                        score::cpp::span<const std::uint16_t> segment_sizes) noexcept;
+
     // Used to send single big message:
     score::cpp::expected<std::int64_t, score::os::Error> Send(const iovec* iovec_tab, const size_t size) noexcept;
 
+    /// Queues the messages to be sent through the ring, all of them or none. Unlike Send(), the messages and their
+    /// buffers shall stay unchanged until the ring notifies the completion. Without segmentation offload.
+    score::cpp::expected_blank<score::os::Error> Queue(IUdpSubmissionRing& ring,
+                                                       score::cpp::span<mmsghdr> mmsg,
+                                                       IUdpSubmissionRing::Completion& completion) noexcept;
+
   private:
+    // the control message carrying the segment size of a message
+    struct alignas(cmsghdr) SegmentControl
+    {
+        std::array<char, CMSG_SPACE(sizeof(std::uint16_t))> data;
+    };
+
     int socket_;
     struct sockaddr_in dst_;
     std::unique_ptr<score::os::Pthread> pthread_;
     std::unique_ptr<score::os::Socket> socket_instance_;
+    std::vector<SegmentControl> segment_controls_;
 };
 
 }  // namespace dltserver
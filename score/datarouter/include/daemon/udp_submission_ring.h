@@ -0,0 +1,128 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#ifndef SCORE_DATAROUTER_INCLUDE_DAEMON_UDP_SUBMISSION_RING_H
+#define SCORE_DATAROUTER_INCLUDE_DAEMON_UDP_SUBMISSION_RING_H
+
+#include "score/os/errno.h"
+
+#include <score/expected.hpp>
+#include <score/span.hpp>
+
+#include <sys/socket.h>
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+
+namespace score
+{
+namespace logging
+{
+namespace dltserver
+{
+
+/// Sends the messages queued by several UDP outputs with one system call, and reports their completions later.
+class IUdpSubmissionRing
+{
+  public:
+    /// Notified once per message queued with it, by the thread reaping the completion.
+    class Completion
+    {
+      public:
+        /// The number of bytes sent, or the negated errno. Shall neither block nor lock a mutex held while queueing.
+        virtual void OnSent(const std::int32_t result) noexcept = 0;
+
+      protected:
+        Completion() = default;
+        ~Completion() = default;
+        Completion(const Completion&) = default;
+        Completion& operator=(const Completion&) = default;
+        Completion(Completion&&) noexcept = default;
+        Completion& operator=(Completion&&) noexcept = default;
+    };
+
+    IUdpSubmissionRing() = default;
+    virtual ~IUdpSubmissionRing() = default;
+    IUdpSubmissionRing(const IUdpSubmissionRing&) = delete;
+    IUdpSubmissionRing& operator=(const IUdpSubmissionRing&) = delete;
+    IUdpSubmissionRing(IUdpSubmissionRing&&) = delete;
+    IUdpSubmissionRing& operator=(IUdpSubmissionRing&&) = delete;
+
+    /// Queues sendmsg() of all the messages on the socket, or none of them. The messages and their buffers shall stay
+    /// unchanged until their completions are notified.
+    virtual score::cpp::expected_blank<score::os::Error> Queue(const std::int32_t socket,
+                                                               score::cpp::span<mmsghdr> messages,
+                                                               Completion& completion) noexcept = 0;
+
+    /// Submits the messages queued so far and notifies the completions reaped since. Returns the number submitted.
+    virtual score::cpp::expected<std::uint32_t, score::os::Error> Submit() noexcept = 0;
+};
+
+/// Submission ring of Linux io_uring. The messages are only submitted when the ring is half full, when it runs out of
+/// space, or with Submit(), so that the flushes of all channels are submitted with one io_uring_enter() call. The
+/// completions are reaped on the way, by the thread submitting.
+///
+/// Available where the build enables the io_uring output and the kernel supports it, see Create().
+class UdpSubmissionRing final : public IUdpSubmissionRing
+{
+  public:
+    struct Statistics
+    {
+        std::uint64_t enter_calls;
+        std::uint64_t submitted_messages;
+        std::uint64_t completed_messages;
+    };
+
+    /// Sets up a ring for the given number of messages in flight, e.g. the datagrams of a few batches of all channels.
+    static score::cpp::expected<std::unique_ptr<UdpSubmissionRing>, score::os::Error> Create(
+        const std::uint32_t entries);
+
+    /// Waits for the messages in flight, thus the completions are notified before the ring is gone.
+    ~UdpSubmissionRing() noexcept override;
+    UdpSubmissionRing(const UdpSubmissionRing&) = delete;
+    UdpSubmissionRing& operator=(const UdpSubmissionRing&) = delete;
+    UdpSubmissionRing(UdpSubmissionRing&&) = delete;
+    UdpSubmissionRing& operator=(UdpSubmissionRing&&) = delete;
+
+    score::cpp::expected_blank<score::os::Error> Queue(const std::int32_t socket,
+                                                       score::cpp::span<mmsghdr> messages,
+                                                       Completion& completion) noexcept override;
+
+    score::cpp::expected<std::uint32_t, score::os::Error> Submit() noexcept override;
+
+    Statistics GetStatistics();
+
+  private:
+    // the shared memory of the ring, only known to the Linux implementation
+    struct Mapping;
+
+    explicit UdpSubmissionRing(std::unique_ptr<Mapping> mapping) noexcept;
+
+    /// Submits the queued messages, waiting for at least wait_count completions, and notifies the completions reaped.
+    score::cpp::expected<std::uint32_t, score::os::Error> SubmitAndReap(const std::uint32_t wait_count) noexcept;
+    void Reap() noexcept;
+    std::uint32_t GetFreeEntries() const noexcept;
+
+    std::unique_ptr<Mapping> mapping_;
+    std::mutex mutex_;
+    std::uint32_t queued_;
+    std::uint32_t in_flight_;
+    Statistics statistics_;
+};
+
+}  // namespace dltserver
+}  // namespace logging
+}  // namespace score
+
+#endif  // SCORE_DATAROUTER_INCLUDE_DAEMON_UDP_SUBMISSION_RING_H
@@ -19,7 +19,10 @@
 #include "score/mw/log/logger.h"
 
 #include "daemon/dlt_log_channel.h"
+#include "score/datarouter/include/daemon/log_entry_header.h"
+#include "daemon/routing_cache.h"
 
+#include <optional>
 #include <vector>
 
 namespace score
@@ -38,6 +41,17 @@ class DltVerboseHandler : public LogParser::TypeHandler
         virtual void SendVerbose(
             uint32_t tmsp,
             const score::mw::log::detail::log_entry_deserialization::LogEntryDeserializationReflection& entry) = 0;
+        /// Like the overload above, reusing the route memoized for the context of the entry while it is valid.
+        virtual void SendVerbose(
+            uint32_t tmsp,
+            const score::mw::log::detail::log_entry_deserialization::LogEntryDeserializationReflection& entry,
+            CachedRoute& route) = 0;
+        /// Tells whether a message of the context and the log level passes the filtering and the threshold of any
+        /// of its channels, refreshing the memoized route. Rejected messages are counted by their channels.
+        virtual bool PrefilterVerbose(CachedRoute& route,
+                                      DltidT app_id,
+                                      DltidT ctx_id,
+                                      mw::log::LogLevel log_level) = 0;
         virtual bool IsOutputEnabled() const noexcept = 0;
 
       protected:
@@ -49,6 +63,14 @@ class DltVerboseHandler : public LogParser::TypeHandler
     }
     virtual void Handle(TimestampT timestamp, const char* data, BufsizeT size) override;
 
+    /// Keeps the routes of the contexts logged from in the session. Messages are prefiltered on their header with
+    /// these routes, so that messages no channel sends are not deserialized.
+    std::unique_ptr<LogParser::HandlerState> CreateState(const TypeInfo& type_info) override;
+    void HandleWithState(LogParser::HandlerState* state,
+                         TimestampT timestamp,
+                         const char* data,
+                         BufsizeT size) override;
+
   private:
     score::mw::log::Logger& logger_;
     IOutput& output_;
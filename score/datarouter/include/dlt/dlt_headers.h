@@ -18,6 +18,8 @@
 #include "score/mw/log/detail/common/log_entry_deserialize.h"
 #include "score/mw/log/detail/log_entry.h"
 
+#include <array>
+
 namespace score
 {
 namespace platform
@@ -50,6 +52,74 @@ typedef struct
     DltExtendedHeader ext;
 } PACKED DltVerboseHeader;
 
+// the headers constructed by each channel for a message whose remainder is encoded once for all channels
+typedef struct
+{
+    DltStandardHeader std;
+    DltStandardHeaderExtra stde;
+} PACKED DltChannelHeader;
+
+// the arguments of the messages of a segmented network trace, which carries a payload too large for a single message
+typedef struct
+{
+    uint32_t type_info;
+    uint16_t length;
+    std::array<char, 5U> tag;
+} PACKED DltNetworkTraceTag;
+
+typedef struct
+{
+    uint32_t type_info;
+    uint32_t value;
+} PACKED DltUint32Argument;
+
+typedef struct
+{
+    uint32_t type_info;
+    uint16_t value;
+} PACKED DltUint16Argument;
+
+typedef struct
+{
+    uint32_t type_info;
+    uint16_t length;
+} PACKED DltRawArgumentHeader;
+
+// "NWST", the stream handle and the trace header, which is followed by DltNetworkTraceStartTail
+typedef struct
+{
+    DltVerboseHeader header;
+    DltNetworkTraceTag tag;
+    DltUint32Argument stream;
+    DltRawArgumentHeader trace_header;
+} PACKED DltNetworkTraceStartHead;
+
+// the size of the payload, the number of segments and the size of a segment
+typedef struct
+{
+    DltUint32Argument payload_size;
+    DltUint16Argument segment_count;
+    DltUint16Argument segment_size;
+} PACKED DltNetworkTraceStartTail;
+
+// "NWCH", the stream handle, the sequence number and the data of the segment, which follows the header
+typedef struct
+{
+    DltVerboseHeader header;
+    DltNetworkTraceTag tag;
+    DltUint32Argument stream;
+    DltUint16Argument sequence;
+    DltRawArgumentHeader data;
+} PACKED DltNetworkTraceSegmentHeader;
+
+// "NWEN" and the stream handle
+typedef struct
+{
+    DltVerboseHeader header;
+    DltNetworkTraceTag tag;
+    DltUint32Argument stream;
+} PACKED DltNetworkTraceEnd;
+
 DISABLE_WARNING_POP
 
 inline void ConstructDltStorageHeader(DltStorageHeader& storagehdr, uint32_t secs, int32_t microsecs)
@@ -202,6 +272,138 @@ inline void ConstructNonVerbosePacket(char* dlt_message,
     std::copy_n(static_cast<const char*>(data), size, std::next(dlt_message, constructed_header_size));
 }
 
+inline std::size_t GetVerboseBodySize(
+    const score::mw::log::detail::log_entry_deserialization::LogEntryDeserializationReflection& entry)
+{
+    const auto data_size = static_cast<size_t>(entry.GetPayload().size());
+    return sizeof(DltExtendedHeader) + std::min(data_size, kDltMessageSize - sizeof(DltVerboseHeader));
+}
+
+/// Constructs a verbose message without its DltChannelHeader, i.e. the extended header and the payload.
+/// The body shall hold GetVerboseBodySize(entry) bytes.
+inline void ConstructVerboseBody(
+    char* body,
+    const score::mw::log::detail::log_entry_deserialization::LogEntryDeserializationReflection& entry)
+{
+    // autosar_cpp14_m5_2_8_violation : No harm from casting void pointer
+    // coverity[autosar_cpp14_m5_2_8_violation]
+    auto& ext = *static_cast<DltExtendedHeader*>(static_cast<void*>(body));
+    ConstructDltExtendedHeader(ext,
+                               entry.log_level,
+                               static_cast<uint8_t>(entry.num_of_args),
+                               platform::DltidT{entry.app_id},
+                               platform::DltidT{entry.ctx_id});
+    std::copy_n(static_cast<const char*>(static_cast<const void*>(entry.GetPayload().data())),
+                GetVerboseBodySize(entry) - sizeof(DltExtendedHeader),
+                std::next(body, static_cast<std::ptrdiff_t>(sizeof(DltExtendedHeader))));
+}
+
+/// Constructs a non-verbose message without its DltChannelHeader, i.e. the message id and the payload.
+/// The body shall hold sizeof(msgid) + size bytes.
+inline void ConstructNonVerboseBody(char* body, const void* data, size_t size, uint32_t msgid)
+{
+    std::copy_n(static_cast<const char*>(static_cast<const void*>(&msgid)), sizeof(msgid), body);
+    std::copy_n(static_cast<const char*>(data), size, std::next(body, static_cast<std::ptrdiff_t>(sizeof(msgid))));
+}
+
+inline void ConstructNetworkTraceHeader(DltVerboseHeader& header,
+                                        size_t msg_size,
+                                        uint8_t nor,
+                                        DltidT ecu,
+                                        uint8_t mcnt,
+                                        uint32_t tmsp,
+                                        DltidT app_id,
+                                        DltidT ctx_id)
+{
+    ConstructDltStandardHeader(header.std, msg_size, mcnt, true);
+    ConstructDltStandardHeaderExtra(header.stde, ecu, tmsp);
+    ConstructDltExtendedHeader(header.ext, mw::log::LogLevel::kOff, nor, app_id, ctx_id);
+    header.ext.msin = static_cast<uint8_t>((DLT_TYPE_NW_TRACE << DLT_MSIN_MSTP_SHIFT) |
+                                           (DLT_NW_TRACE_IPC << DLT_MSIN_MTIN_SHIFT) | (DLT_MSIN_VERB));
+}
+
+inline DltNetworkTraceTag MakeNetworkTraceTag(const std::array<char, 5U>& tag)
+{
+    return DltNetworkTraceTag{DLT_TYPE_INFO_STRG | DLT_SCOD_UTF8, static_cast<uint16_t>(tag.size()), tag};
+}
+
+/// Constructs the start message of a segmented network trace without the trace header, which follows the returned
+/// head and precedes the returned tail. The trace header shall be shorter than 64 KiB.
+inline void ConstructNetworkTraceStart(DltNetworkTraceStartHead& head,
+                                       DltNetworkTraceStartTail& tail,
+                                       size_t trace_header_size,
+                                       uint32_t stream,
+                                       uint32_t payload_size,
+                                       uint16_t segment_count,
+                                       uint16_t segment_size,
+                                       DltidT ecu,
+                                       uint8_t mcnt,
+                                       uint32_t tmsp,
+                                       DltidT app_id,
+                                       DltidT ctx_id)
+{
+    constexpr uint8_t kNor = 6U;
+    ConstructNetworkTraceHeader(head.header,
+                                sizeof(head) + trace_header_size + sizeof(tail),
+                                kNor,
+                                ecu,
+                                mcnt,
+                                tmsp,
+                                app_id,
+                                ctx_id);
+    head.tag = MakeNetworkTraceTag({'N', 'W', 'S', 'T', 0});
+    head.stream = DltUint32Argument{DLT_TYPE_INFO_UINT | DLT_TYLE_32BIT, stream};
+    head.trace_header = DltRawArgumentHeader{DLT_TYPE_INFO_RAWD, static_cast<uint16_t>(trace_header_size)};
+    tail.payload_size = DltUint32Argument{DLT_TYPE_INFO_UINT | DLT_TYLE_32BIT, payload_size};
+    tail.segment_count = DltUint16Argument{DLT_TYPE_INFO_UINT | DLT_TYLE_16BIT, segment_count};
+    tail.segment_size = DltUint16Argument{DLT_TYPE_INFO_UINT | DLT_TYLE_16BIT, segment_size};
+}
+
+/// Constructs the header of a segment of a segmented network trace, the data of the segment follows it.
+inline void ConstructNetworkTraceSegmentHeader(DltNetworkTraceSegmentHeader& hdr,
+                                               uint32_t stream,
+                                               uint16_t sequence,
+                                               uint16_t data_size,
+                                               DltidT ecu,
+                                               uint8_t mcnt,
+                                               uint32_t tmsp,
+                                               DltidT app_id,
+                                               DltidT ctx_id)
+{
+    constexpr uint8_t kNor = 4U;
+    ConstructNetworkTraceHeader(hdr.header, sizeof(hdr) + data_size, kNor, ecu, mcnt, tmsp, app_id, ctx_id);
+    hdr.tag = MakeNetworkTraceTag({'N', 'W', 'C', 'H', 0});
+    hdr.stream = DltUint32Argument{DLT_TYPE_INFO_UINT | DLT_TYLE_32BIT, stream};
+    hdr.sequence = DltUint16Argument{DLT_TYPE_INFO_UINT | DLT_TYLE_16BIT, sequence};
+    hdr.data = DltRawArgumentHeader{DLT_TYPE_INFO_RAWD, data_size};
+}
+
+inline void ConstructNetworkTraceEnd(DltNetworkTraceEnd& hdr,
+                                     uint32_t stream,
+                                     DltidT ecu,
+                                     uint8_t mcnt,
+                                     uint32_t tmsp,
+                                     DltidT app_id,
+                                     DltidT ctx_id)
+{
+    constexpr uint8_t kNor = 2U;
+    ConstructNetworkTraceHeader(hdr.header, sizeof(hdr), kNor, ecu, mcnt, tmsp, app_id, ctx_id);
+    hdr.tag = MakeNetworkTraceTag({'N', 'W', 'E', 'N', 0});
+    hdr.stream = DltUint32Argument{DLT_TYPE_INFO_UINT | DLT_TYLE_32BIT, stream};
+}
+
+inline uint32_t ConstructChannelHeader(DltChannelHeader& hdr,
+                                       size_t body_size,
+                                       bool verbose,
+                                       DltidT ecu,
+                                       uint8_t mcnt,
+                                       uint32_t tmsp)
+{
+    ConstructDltStandardHeader(hdr.std, (sizeof(DltChannelHeader) + body_size), mcnt, verbose);
+    ConstructDltStandardHeaderExtra(hdr.stde, ecu, tmsp);
+    return sizeof(DltChannelHeader);
+}
+
 }  // namespace internal
 }  // namespace platform
 }  // namespace score
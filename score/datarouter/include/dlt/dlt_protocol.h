@@ -97,7 +97,8 @@
  * Definitions of msbi parameter in extended header.
  */
 
-/* see file dlt_user.h */
+/* see file dlt_user.h, the network trace types used by the daemon: */
+#define DLT_NW_TRACE_IPC 0x01 /**< Inter-Process-Communication */
 
 /*
  * Definitions of msci parameter in extended header.
@@ -18,6 +18,10 @@
 #include "router/data_router_types.h"
 
 #include "score/mw/log/detail/data_router/shared_memory/shared_memory_reader.h"
+#include "score/mw/log/log_level.h"
+
+#include <memory>
+#include <optional>
 
 namespace score
 {
@@ -37,12 +41,19 @@ namespace platform
 
 using TimestampT = score::os::HighResolutionSteadyClock::time_point;
 
+namespace internal
+{
+struct TypeDescriptor;
+}
+
+/// A type as registered by a session: the descriptor shared by all sessions registering the type, and the identifiers
+/// of the registering session.
 struct TypeInfo
 {
+    /// The nv_msg_desc of the descriptor, read by the handlers per record.
     const score::mw::log::config::NvMsgDescriptor* nv_msg_desc{nullptr};
     BufsizeT id{};
-    std::string params{};
-    std::string type_name{};
+    std::shared_ptr<const internal::TypeDescriptor> descriptor{};
     DltidT ecu_id{};
     DltidT app_id{};
 };
@@ -53,10 +64,31 @@ namespace internal
 class ILogParser
 {
   public:
+    /// State a handler keeps per registered type in the parser of a session, e.g. decisions it derived from the
+    /// type once instead of per record. As the parser, it is only accessed by the thread parsing the session.
+    class HandlerState
+    {
+      public:
+        virtual ~HandlerState() = default;
+    };
+
     class TypeHandler
     {
       public:
         virtual void Handle(TimestampT timestamp, const char* data, BufsizeT size) = 0;
+
+        /// Creates the state kept for a newly registered type, nullptr if the handler keeps none.
+        virtual std::unique_ptr<HandlerState> CreateState(const TypeInfo& /*type_info*/)
+        {
+            return nullptr;
+        }
+
+        /// Handles a record with the state created for its type. Handlers without state need not override it.
+        virtual void HandleWithState(HandlerState* /*state*/, TimestampT timestamp, const char* data, BufsizeT size)
+        {
+            Handle(timestamp, data, size);
+        }
+
         virtual ~TypeHandler() = default;
     };
 
@@ -65,6 +97,22 @@ class ILogParser
       public:
         virtual void Handle(const TypeInfo& type_info, TimestampT timestamp, const char* data, BufsizeT size) = 0;
 
+        /// Creates the state kept for a newly registered type, nullptr if the handler keeps none.
+        virtual std::unique_ptr<HandlerState> CreateState(const TypeInfo& /*type_info*/)
+        {
+            return nullptr;
+        }
+
+        /// Handles a record with the state created for its type. Handlers without state need not override it.
+        virtual void HandleWithState(const TypeInfo& type_info,
+                                     HandlerState* /*state*/,
+                                     TimestampT timestamp,
+                                     const char* data,
+                                     BufsizeT size)
+        {
+            Handle(type_info, timestamp, data, size);
+        }
+
         virtual ~AnyHandler() = default;
     };
 
@@ -81,6 +129,11 @@ class ILogParser
 
     virtual void Parse(TimestampT timestamp, const char* data, BufsizeT size) = 0;
     virtual void ParseSharedMemoryRecord(const score::mw::log::detail::SharedMemoryRecord& record) = 0;
+
+    /// Returns the severity of the record without passing it to any handler,
+    /// std::nullopt if its type is unknown or carries no severity.
+    virtual std::optional<score::mw::log::LogLevel> GetLogLevel(
+        const score::mw::log::detail::SharedMemoryRecord& record) const = 0;
 };
 
 }  // namespace internal
@@ -15,7 +15,11 @@
 #define SCORE_DATAROUTER_INCLUDE_LOGPARSER_LOGPARSER_H
 
 #include "logparser/i_logparser.h"
+#include "logparser/type_descriptor_cache.h"
 
+#include <cstddef>
+#include <memory>
+#include <string_view>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
@@ -58,9 +62,12 @@ class LogParser : public ILogParser
   public:
     using HandleRequestMap = std::unordered_multimap<std::string, TypeHandler*>;
 
+    /// \param type_descriptor_cache Cache shared with other parsers, created with the same nv_config.
+    /// A parser without a shared cache resolves its registrations through a cache of its own.
     explicit LogParser(const score::mw::log::INvConfig& nv_config,
                        std::vector<AnyHandler*> global_handlers = {},
-                       HandleRequestMap handle_request_map = {});
+                       HandleRequestMap handle_request_map = {},
+                       std::shared_ptr<TypeDescriptorCache> type_descriptor_cache = nullptr);
     ~LogParser() = default;
 
     void AddIncomingType(const BufsizeT map_index, const std::string& params) override;
@@ -68,29 +75,65 @@ class LogParser : public ILogParser
 
     void Parse(TimestampT timestamp, const char* data, BufsizeT size) override;
     void ParseSharedMemoryRecord(const score::mw::log::detail::SharedMemoryRecord& record) override;
+    std::optional<score::mw::log::LogLevel> GetLogLevel(
+        const score::mw::log::detail::SharedMemoryRecord& record) const override;
 
   private:
+    /// Type identifiers below this bound are looked up by index, the others fall back to index_parser_map_.
+    /// The shared memory writers assign identifiers in ascending order starting from a small value.
+    static constexpr BufsizeT kDenseIndexLimit{4096U};
+
+    void RegisterType(const BufsizeT map_index, const std::string_view params);
+
     class IndexParser
     {
       public:
-        TypeInfo info;
+        explicit IndexParser(TypeInfo info, const std::vector<AnyHandler*>& global_handlers);
+
+        const TypeInfo& GetInfo() const noexcept
+        {
+            return info_;
+        }
 
-        explicit IndexParser(TypeInfo type_info) : info{type_info}, handlers_{} {}
+        const TypeDescriptor& GetDescriptor() const noexcept
+        {
+            return *info_.descriptor;
+        }
 
         void AddHandler(TypeHandler* handler);
 
-        void Parse(const TimestampT timestamp, const char* const data, const BufsizeT size);
+        /// Calls the handlers of the type, then the global handlers, in the order they were added.
+        /// The handlers may update the states they keep for the type.
+        void Parse(const TimestampT timestamp, const char* const data, const BufsizeT size) const;
 
       private:
-        std::vector<TypeHandler*> handlers_;
+        /// Either a handler of the type or a global one, so a record is dispatched by a single loop.
+        struct Handler
+        {
+            TypeHandler* type_handler;
+            AnyHandler* any_handler;
+            std::unique_ptr<HandlerState> state;
+        };
+
+        /// The registration of the session, passed to the handlers. Holds the descriptor shared with the cache.
+        TypeInfo info_;
+        std::vector<Handler> handlers_;
+        std::size_t number_of_type_handlers_;
     };
 
+    const IndexParser* FindIndexParser(const BufsizeT map_index) const noexcept;
+
     const HandleRequestMap handle_request_map_;
 
+    /// Declared before the parsers, which hold descriptors of the cache.
+    const std::shared_ptr<TypeDescriptorCache> type_descriptor_cache_;
+
+    /// Owns the parsers. References to its elements stay valid on rehashing.
     std::unordered_map<BufsizeT, IndexParser> index_parser_map_;
+    /// Parsers of the identifiers below kDenseIndexLimit by identifier, nullptr for unknown ones.
+    std::vector<const IndexParser*> dense_index_parsers_;
 
     const std::vector<AnyHandler*> global_handlers_;
-    const score::mw::log::INvConfig& nv_config_;
 };
 
 }  // namespace internal
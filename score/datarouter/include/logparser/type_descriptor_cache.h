@@ -0,0 +1,102 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#ifndef SCORE_DATAROUTER_INCLUDE_LOGPARSER_TYPE_DESCRIPTOR_CACHE_H
+#define SCORE_DATAROUTER_INCLUDE_LOGPARSER_TYPE_DESCRIPTOR_CACHE_H
+
+#include "logparser/i_logparser.h"
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace score
+{
+namespace platform
+{
+namespace internal
+{
+
+/// The part of a type registration that does not depend on the registering client, resolved against the NvConfig.
+/// Immutable once interned.
+struct TypeDescriptor
+{
+    /// The registration data following the client's ECU and application identifiers, i.e. the length prefixed type
+    /// name and the optional payload format description. Identifies the descriptor in the cache.
+    std::string layout;
+    std::string type_name;
+    const score::mw::log::config::NvMsgDescriptor* nv_msg_desc;
+
+    // verbose log entries carry their severity in the payload, the other types in their nv_msg_desc
+    bool is_log_entry;
+};
+
+/// Interns the type descriptors resolved from type registrations, so that the parsers of all sessions share one
+/// descriptor per type instead of each parsing and resolving their own copy.
+///
+/// Descriptors are keyed by the type name and payload description of the registration. The type identifier, ECU and
+/// application identifiers stay with the parser of the registering session, so any client registering a type,
+/// e.g. a process restarting, resolves it from the cache.
+/// A descriptor no parser holds anymore is kept for the grace period, so that a client restarting within it does not
+/// resolve its types again. Unused descriptors are dropped while interning, at most once per grace period.
+/// All methods are thread safe.
+class TypeDescriptorCache
+{
+  public:
+    static constexpr std::chrono::steady_clock::duration kDefaultGracePeriod{std::chrono::seconds{10}};
+
+    explicit TypeDescriptorCache(const score::mw::log::INvConfig& nv_config,
+                                 const std::chrono::steady_clock::duration grace_period = kDefaultGracePeriod) noexcept;
+    ~TypeDescriptorCache() = default;
+
+    TypeDescriptorCache(const TypeDescriptorCache&) = delete;
+    TypeDescriptorCache& operator=(const TypeDescriptorCache&) = delete;
+    TypeDescriptorCache(TypeDescriptorCache&&) = delete;
+    TypeDescriptorCache& operator=(TypeDescriptorCache&&) = delete;
+
+    /// Returns the descriptor of the registration, resolving it if it is not interned yet.
+    /// Returns nullptr for malformed registration data, thus the ECU and application identifiers of registrations
+    /// with a descriptor can be read without further checks.
+    std::shared_ptr<const TypeDescriptor> Intern(const std::string_view params);
+
+    /// Number of descriptors currently interned, including the unused ones within their grace period.
+    std::size_t GetSize() const;
+
+  private:
+    struct Entry
+    {
+        std::shared_ptr<const TypeDescriptor> descriptor;
+        /// Time the cache was first found to hold the only reference, the epoch while parsers hold it.
+        std::chrono::steady_clock::time_point unused_since;
+    };
+
+    void DropUnused(const std::chrono::steady_clock::time_point now);
+
+    const score::mw::log::INvConfig& nv_config_;
+    const std::chrono::steady_clock::duration grace_period_;
+
+    mutable std::mutex mutex_;
+    /// Keys reference the layout of their descriptor.
+    std::unordered_map<std::string_view, Entry> entries_;
+    std::chrono::steady_clock::time_point next_drop_;
+};
+
+}  // namespace internal
+}  // namespace platform
+}  // namespace score
+
+#endif  // SCORE_DATAROUTER_INCLUDE_LOGPARSER_TYPE_DESCRIPTOR_CACHE_H
@@ -147,6 +147,12 @@ class UnixDomainServer
         server_thread_.join();
     }
 
+    /// Handle of the thread running the server routine, e.g. to place it on dedicated CPUs.
+    pthread_t GetServerThreadHandle() noexcept
+    {
+        return server_thread_.native_handle();
+    }
+
     class UnixDomainServerTest;
 
   private:
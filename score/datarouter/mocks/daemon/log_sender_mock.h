@@ -44,6 +44,7 @@ class LogSenderMock : public ILogSender
                  const score::mw::log::detail::log_entry_deserialization::LogEntryDeserializationReflection& entry,
                  DltLogChannel& c),
                 (override));
+    MOCK_METHOD(void, SendEncoded, (const DltEncodedMessage& message, DltLogChannel& c), (override));
     MOCK_METHOD(void,
                 SendFTVerbose,
                 (score::cpp::span<const std::uint8_t> data,
@@ -19,6 +19,7 @@
 #include <sys/socket.h>
 
 #include "daemon/dltserver_common.h"
+#include "daemon/udp_submission_ring.h"
 #include "score/os/socket.h"
 
 #include <score/span.hpp>
@@ -51,8 +52,21 @@ class UdpStreamOutput
         MOCK_METHOD(void, Destruct, (UdpStreamOutput*));
 
         MOCK_METHOD(score::cpp::expected_blank<score::os::Error>, Bind, (UdpStreamOutput*, const char*, uint16_t));
+        MOCK_METHOD(score::cpp::expected_blank<score::os::Error>, SetSendBufferSize, (UdpStreamOutput*, std::int32_t));
+        MOCK_METHOD(score::cpp::expected_blank<score::os::Error>,
+                    EnableSegmentationOffload,
+                    (UdpStreamOutput*, std::size_t));
         MOCK_METHOD((score::cpp::expected<std::int64_t, score::os::Error>), Send, (UdpStreamOutput*, const iovec*, size_t));
         MOCK_METHOD((score::cpp::expected<std::int32_t, score::os::Error>), Send, (UdpStreamOutput*, score::cpp::span<mmsghdr>));
+        MOCK_METHOD((score::cpp::expected<std::int32_t, score::os::Error>),
+                    Send,
+                    (UdpStreamOutput*, score::cpp::span<mmsghdr>, score::cpp::span<const std::uint16_t>));
+        MOCK_METHOD(score::cpp::expected_blank<score::os::Error>,
+                    Queue,
+                    (UdpStreamOutput*,
+                     IUdpSubmissionRing&,
+                     score::cpp::span<mmsghdr>,
+                     IUdpSubmissionRing::Completion&));
     };
 
     UdpStreamOutput(const char* dst_addr, uint16_t dst_port, const char* multicast_interface)
@@ -72,6 +86,14 @@ class UdpStreamOutput
     {
         return Tester::Instance()->Bind(this, src_addr, src_port);
     }
+    score::cpp::expected_blank<score::os::Error> SetSendBufferSize(const std::int32_t size)
+    {
+        return Tester::Instance()->SetSendBufferSize(this, size);
+    }
+    score::cpp::expected_blank<score::os::Error> EnableSegmentationOffload(const std::size_t max_messages)
+    {
+        return Tester::Instance()->EnableSegmentationOffload(this, max_messages);
+    }
     score::cpp::expected<std::int64_t, score::os::Error> Send(const iovec* data, size_t size)
     {
         return Tester::Instance()->Send(this, data, size);
@@ -80,6 +102,17 @@ class UdpStreamOutput
     {
         return Tester::Instance()->Send(this, mmsg_span);
     }
+    score::cpp::expected<std::int32_t, score::os::Error> Send(score::cpp::span<mmsghdr> mmsg_span,
+                                                        score::cpp::span<const std::uint16_t> segment_sizes)
+    {
+        return Tester::Instance()->Send(this, mmsg_span, segment_sizes);
+    }
+    score::cpp::expected_blank<score::os::Error> Queue(IUdpSubmissionRing& ring,
+                                                       score::cpp::span<mmsghdr> mmsg_span,
+                                                       IUdpSubmissionRing::Completion& completion)
+    {
+        return Tester::Instance()->Queue(this, ring, mmsg_span, completion);
+    }
 };
 
 }  // namespace mock
@@ -39,6 +39,10 @@ class LogParserMock : public ILogParser
 
     MOCK_METHOD(void, Parse, (TimestampT timestamp, const char* data, BufsizeT size), (override));
     MOCK_METHOD(void, ParseSharedMemoryRecord, (const score::mw::log::detail::SharedMemoryRecord& record), (override));
+    MOCK_METHOD(std::optional<score::mw::log::LogLevel>,
+                GetLogLevel,
+                (const score::mw::log::detail::SharedMemoryRecord& record),
+                (const, override));
 };
 
 }  // namespace internal
@@ -0,0 +1,99 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include "daemon/broadcast_body_pool.h"
+
+#include <iterator>
+
+namespace score
+{
+namespace logging
+{
+namespace dltserver
+{
+
+BroadcastBodyPool::Block::Block(BroadcastBodyPool& pool, const std::size_t size)
+    : pool_{pool}, data_(size), used_{0U}, holders_{0U}
+{
+}
+
+void BroadcastBodyPool::Block::Hold() noexcept
+{
+    holders_.fetch_add(1U, std::memory_order_relaxed);
+}
+
+void BroadcastBodyPool::Block::Release() noexcept
+{
+    // the sends referencing the block happen before it is reused
+    if (holders_.fetch_sub(1U, std::memory_order_acq_rel) == 1U)
+    {
+        pool_.Recycle(*this);
+    }
+}
+
+BroadcastBodyPool::BroadcastBodyPool(const std::size_t block_size)
+    : mutex_{}, block_size_{block_size}, blocks_{}, free_blocks_{}, current_{nullptr}
+{
+}
+
+BroadcastBodyPool::Body BroadcastBodyPool::Allocate(const std::size_t size)
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    Block* full_block = nullptr;
+    if ((current_ == nullptr) || ((current_->used_ + size) > block_size_))
+    {
+        full_block = current_;
+        if (free_blocks_.empty())
+        {
+            // all blocks are held, the pool grows until they are recycled as fast as they are filled
+            current_ = blocks_.emplace_back(std::make_unique<Block>(*this, block_size_)).get();
+            // recycling never allocates
+            free_blocks_.reserve(blocks_.size());
+        }
+        else
+        {
+            current_ = free_blocks_.back();
+            free_blocks_.pop_back();
+        }
+        current_->used_ = 0U;
+        current_->holders_.store(1U, std::memory_order_relaxed);
+    }
+    char* const data = std::next(current_->data_.data(), static_cast<std::ptrdiff_t>(current_->used_));
+    current_->used_ += size;
+    current_->Hold();
+    Block* const block = current_;
+    lock.unlock();
+
+    // released without the lock, as the last holder recycles the block
+    if (full_block != nullptr)
+    {
+        full_block->Release();
+    }
+    return Body{data, block};
+}
+
+std::size_t BroadcastBodyPool::GetBlockCount() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return blocks_.size();
+}
+
+void BroadcastBodyPool::Recycle(Block& block)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    free_blocks_.push_back(&block);
+}
+
+}  // namespace dltserver
+}  // namespace logging
+}  // namespace score
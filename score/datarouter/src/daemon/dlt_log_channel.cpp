@@ -13,6 +13,12 @@
 
 #include "daemon/dlt_log_channel.h"
 
+#include "score/os/pthread.h"
+
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+#include <limits>
 #include <thread>
 
 namespace score
@@ -40,39 +46,14 @@ void DltLogChannel::SendNonVerbose(const score::mw::log::config::NvMsgDescriptor
     }
     std::lock_guard<std::mutex> lock(mutex_);
     ++non_verbose_.stats_msgcnt;
-    ++count_nonverbose_messages_in_buffer_;
     non_verbose_.stats_totalsize += size;
     non_verbose_.message_id_data_stats[desc.GetIdMsgDescriptor()] += size;
 
     size_t full_size = sizeof(score::platform::internal::DltNvHeaderWithMsgid) + size;
-    if (prebuf_is_verbose_)  // flush if DLT type changes
-    {
-        SendUdp();  // store, flush only if full
-        prebuf_is_verbose_ = false;
-    }
-
-    if (prebuf_size_ + full_size <= kUdpMaxPayload)  // add to current buffer as it fits
+    ReserveDatagram(full_size, 1U);
+    if (FitsDatagram(full_size, 1U))  // add to current buffer as it fits, whichever type its messages have
     {
-        // Use .at() to avoid "non-constant subscript" warning generated from clang
-        auto& buffer = prebuf_data_.at(vector_index_);
-
-        // Use iterator arithmetic (not pointer arithmetic) to solve warning generated from clang
-        auto* it = buffer.begin();
-        if (prebuf_size_ > std::numeric_limits<decltype(prebuf_data_)::value_type::difference_type>::max())
-        {
-            // This check ensures that `prebuf_size_` can be safely converted to a signed type
-            // without overflow. However, under normal operating conditions, `prebuf_size_`
-            // is constrained by system limits and is derived from predefined buffer sizes or
-            // message lengths. Due to these constraints, it is unlikely that this condition
-            // will be triggered in practice, making it difficult or impractical to cover in tests.
-            // LCOV_EXCL_START
-            std::cerr << "prebuf_size_ is too large for signed conversion.\n";
-            return;
-            // LCOV_EXCL_STOP
-        }
-        std::advance(it, static_cast<decltype(prebuf_data_)::value_type::difference_type>(prebuf_size_));
-        auto* dest = std::addressof(*it);
-
+        ++count_nonverbose_messages_in_buffer_;
         /*
             Deviation from Rule M5-2-10:
             - Rule M5-2-10 (required, implementation, automated)
@@ -83,52 +64,44 @@ void DltLogChannel::SendNonVerbose(const score::mw::log::config::NvMsgDescriptor
         */
         // coverity[autosar_cpp14_m5_2_10_violation]
         score::platform::internal::ConstructNonVerbosePacket(
-            dest, data, size, desc.GetIdMsgDescriptor(), ecu, mcnt_++, tmsp);
+            GetPrebufEnd(), data, size, desc.GetIdMsgDescriptor(), ecu, mcnt_++, tmsp);
 
         prebuf_size_ += full_size;
     }
-    else  // doesn't fit in current buffer
+    else if (full_size > kMaxDatagramPayload)
     {
-        SendUdp();
-        if (full_size < kUdpMaxPayload)  //  fits in our prebuf
-        {
-            // Use .at() to avoid "non-constant subscript" warning generated from clang
-            auto& buffer = prebuf_data_.at(vector_index_);
-            auto* dest = buffer.data();
+        FlushUnprotected();
 
-            // coverity[autosar_cpp14_m5_2_10_violation]
-            score::platform::internal::ConstructNonVerbosePacket(
-                dest, data, size, desc.GetIdMsgDescriptor(), ecu, mcnt_++, tmsp);
+        //  e.g. taken from the large payload arena of a client, the message id is the header of the network trace
+        const auto msgid = desc.GetIdMsgDescriptor();
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) the message id is sent byte by byte
+        const score::cpp::span<const char> trace_header{reinterpret_cast<const char*>(&msgid), sizeof(msgid)};
+        SendSegmentedUnprotected(trace_header,
+                                 score::cpp::span<const char>{static_cast<const char*>(data), size},
+                                 DltidT{desc.GetAppId()},
+                                 DltidT{desc.GetCtxId()},
+                                 tmsp,
+                                 false);
+    }
+    else  //  single msg is bigger than a datagram, so prepare it and send using alternative API
+    {
+        FlushUnprotected();
 
-            prebuf_size_ += full_size;
-        }
-        else  //  single msg is bigger than the prebuf, so prepare it and send using alternative API
-        {
-            FlushUnprotected();
-
-            static constexpr auto kVectorStackCount = 2UL;
-            std::array<iovec, kVectorStackCount> io_vec{};
-            score::platform::internal::DltNvHeaderWithMsgid header;
-            // coverity[autosar_cpp14_m5_2_10_violation]
-            const auto header_size = score::platform::internal::ConstructNonVerboseHeader(
-                header, size, desc.GetIdMsgDescriptor(), ecu, mcnt_++, tmsp);
-            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-union-access) iovec is unchangable, It's (POSIX standard)
-            io_vec[0].iov_base = static_cast<void*>(&header);
-            io_vec[0].iov_len = header_size;
-            // NOLINTBEGIN(cppcoreguidelines-pro-type-union-access) iovec is unchangable, It's (POSIX standard)
-            // const_cast is necessary since data is a const void*
-            // coverity[autosar_cpp14_a5_2_3_violation]
-            io_vec[1].iov_base = const_cast<void*>(data);
-            // NOLINTEND(cppcoreguidelines-pro-type-union-access)
-            io_vec[1].iov_len = size;
-            const auto send_result = out_.Send(io_vec.data(), kVectorStackCount);
-            if (send_result.has_value() == false)
-            {
-                ++non_verbose_.send_failures_count;
-                auto& val = non_verbose_.send_errno_count[send_result.error().ToString()];
-                ++val;
-            }
-        }
+        std::array<iovec, 2U> io_vec{};
+        score::platform::internal::DltNvHeaderWithMsgid header;
+        // coverity[autosar_cpp14_m5_2_10_violation]
+        const auto header_size = score::platform::internal::ConstructNonVerboseHeader(
+            header, size, desc.GetIdMsgDescriptor(), ecu, mcnt_++, tmsp);
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-union-access) iovec is unchangable, It's (POSIX standard)
+        io_vec[0].iov_base = static_cast<void*>(&header);
+        io_vec[0].iov_len = header_size;
+        // NOLINTBEGIN(cppcoreguidelines-pro-type-union-access) iovec is unchangable, It's (POSIX standard)
+        // const_cast is necessary since data is a const void*
+        // coverity[autosar_cpp14_a5_2_3_violation]
+        io_vec[1].iov_base = const_cast<void*>(data);
+        // NOLINTEND(cppcoreguidelines-pro-type-union-access)
+        io_vec[1].iov_len = size;
+        SendSingleUnprotected(io_vec.data(), io_vec.size(), false);
     }
 }
 
@@ -142,86 +115,136 @@ void DltLogChannel::SendVerbose(
     }
     std::lock_guard<std::mutex> lock(mutex_);
     ++verbose_.stats_msgcnt;
-    ++count_verbose_messages_in_buffer_;
     const auto data_size = static_cast<std::uint32_t>(entry.GetPayload().size());
 
     const size_t full_size = sizeof(score::platform::internal::DltVerboseHeader) + data_size;
     verbose_.stats_totalsize += data_size;
 
-    if (!prebuf_is_verbose_)  //  check and flush if DLT type changes
+    ReserveDatagram(full_size, 1U);
+    if (FitsDatagram(full_size, 1U))
     {
-        SendUdp();
-        prebuf_is_verbose_ = true;
+        ++count_verbose_messages_in_buffer_;
+        // coverity[autosar_cpp14_m5_2_10_violation]
+        score::platform::internal::ConstructVerbosePacket(GetPrebufEnd(), entry, ecu, mcnt_++, tmsp);
+
+        prebuf_size_ += full_size;
     }
-    if (prebuf_size_ + full_size <= kUdpMaxPayload)
+    else if (full_size > kMaxDatagramPayload)
     {
-        // Use .at() to avoid "non-constant subscript" warning generated from clang
-        auto& buffer = prebuf_data_.at(vector_index_);
+        FlushUnprotected();
 
-        // Use iterator arithmetic (not pointer arithmetic) to solve warning generated from clang
-        auto* it = buffer.begin();
-        if (prebuf_size_ > std::numeric_limits<decltype(prebuf_data_)::value_type::difference_type>::max())
-        {
-            // This check ensures that `prebuf_size_` can be safely converted to a signed type
-            // without overflow. However, under normal operating conditions, `prebuf_size_`
-            // is constrained by system limits and is derived from predefined buffer sizes or
-            // message lengths. Due to these constraints, it is unlikely that this condition
-            // will be triggered in practice, making it difficult or impractical to cover in tests.
-            // LCOV_EXCL_START
-            std::cerr << "prebuf_size_ is too large for signed conversion.\n";
-            return;
-            // LCOV_EXCL_STOP
-        }
-        std::advance(it, static_cast<decltype(prebuf_data_)::value_type::difference_type>(prebuf_size_));
-        auto* dest = std::addressof(*it);
+        //  the extended header, which precedes the arguments in the message, is the header of the network trace
+        score::platform::internal::DltVerboseHeader header;
+        std::ignore = score::platform::internal::ConstructVerboseHeader(header, entry, ecu, 0U, tmsp);
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) the header is sent byte by byte
+        const score::cpp::span<const char> trace_header{reinterpret_cast<const char*>(&header.ext), sizeof(header.ext)};
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) the payload is sent byte by byte
+        const score::cpp::span<const char> payload{reinterpret_cast<const char*>(entry.GetPayload().data()),
+                                                   static_cast<std::size_t>(entry.GetPayload().size())};
+        SendSegmentedUnprotected(trace_header, payload, DltidT{entry.app_id}, DltidT{entry.ctx_id}, tmsp, true);
+    }
+    else  //  message does not fit into a datagram
+    {
+        FlushUnprotected();
 
+        //  Send big message using alternative API, both for construction and sending:
+        std::array<iovec, 2U> io_vec{};
+        score::platform::internal::DltVerboseHeader header;
         // coverity[autosar_cpp14_m5_2_10_violation]
-        score::platform::internal::ConstructVerbosePacket(dest, entry, ecu, mcnt_++, tmsp);
+        const auto header_size = score::platform::internal::ConstructVerboseHeader(header, entry, ecu, mcnt_++, tmsp);
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-union-access) iovec is unchangable, It's (POSIX standard)
+        io_vec[0].iov_base = static_cast<void*>(&header);
+        io_vec[0].iov_len = header_size;
+        // NOLINTBEGIN(cppcoreguidelines-pro-type-union-access) iovec is unchangable, It's (POSIX standard)
+        // const_cast is necessary since entry.GetPayload().data() is a const void*
+        // coverity[autosar_cpp14_a5_2_3_violation]
+        io_vec[1].iov_base = const_cast<void*>(static_cast<const void*>(entry.GetPayload().data()));
+        // NOLINTEND(cppcoreguidelines-pro-type-union-access)
+        io_vec[1].iov_len = static_cast<std::size_t>(entry.GetPayload().size());
+        SendSingleUnprotected(io_vec.data(), io_vec.size(), true);
+    }
+}
 
-        prebuf_size_ += full_size;
+void DltLogChannel::SendEncoded(const DltEncodedMessage& message)
+{
+    if (message.log_level > channel_threshold.load(std::memory_order_relaxed))
+    {
+        return;
     }
-    else  //  message does not fit into the buffer
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (message.verbose)
     {
-        SendUdp();
+        ++verbose_.stats_msgcnt;
+        verbose_.stats_totalsize += message.payload_size;
+    }
+    else
+    {
+        ++non_verbose_.stats_msgcnt;
+        non_verbose_.stats_totalsize += message.payload_size;
+        non_verbose_.message_id_data_stats[message.msgid] += message.payload_size;
+    }
 
-        if (full_size < kUdpMaxPayload)  //  just add it into the buffer if it is less than the buffer size
+    const size_t full_size = sizeof(score::platform::internal::DltChannelHeader) + message.body.size();
+    // the header completes the current run and the body is referenced behind it, unless the batch is handed over and
+    // sent after the body was released
+    const bool reference_body = !HandsBatchesOver();
+    const size_t io_vec_count = reference_body ? 2U : 1U;
+    ReserveDatagram(full_size, io_vec_count);
+    if (FitsDatagram(full_size, io_vec_count))
+    {
+        auto& count_in_buffer =
+            message.verbose ? count_verbose_messages_in_buffer_ : count_nonverbose_messages_in_buffer_;
+        ++count_in_buffer;
+        // autosar_cpp14_m5_2_8_violation : No harm from casting void pointer
+        // coverity[autosar_cpp14_m5_2_8_violation]
+        auto& header = *static_cast<score::platform::internal::DltChannelHeader*>(static_cast<void*>(GetPrebufEnd()));
+        // coverity[autosar_cpp14_m5_2_10_violation]
+        prebuf_size_ += score::platform::internal::ConstructChannelHeader(
+            header, message.body.size(), message.verbose, ecu, mcnt_++, message.tmsp);
+        if (!reference_body)
         {
-            // Use .at() to avoid "non-constant subscript" warning generated from clang
-            auto& buffer = prebuf_data_.at(vector_index_);
-            auto* dest = buffer.data();
-            // coverity[autosar_cpp14_m5_2_10_violation]
-            score::platform::internal::ConstructVerbosePacket(dest, entry, ecu, mcnt_++, tmsp);
-
-            prebuf_size_ += full_size;
+            // NOLINTNEXTLINE(score-banned-function) copy of the encoded body
+            std::memcpy(GetPrebufEnd(), message.body.data(), message.body.size());
+            prebuf_size_ += message.body.size();
+            return;
         }
-        else
+        CompletePrebufRun();
+
+        auto& io_vec = batch_->io_vec.at(vector_index_).at(io_vec_count_);
+        // NOLINTBEGIN(cppcoreguidelines-pro-type-union-access) iovec is unchangable, It's (POSIX standard)
+        // const_cast is necessary since the body is const, it is only read by the send
+        // coverity[autosar_cpp14_a5_2_3_violation]
+        io_vec.iov_base = const_cast<char*>(message.body.data());
+        // NOLINTEND(cppcoreguidelines-pro-type-union-access)
+        io_vec.iov_len = message.body.size();
+        ++io_vec_count_;
+        referenced_size_ += message.body.size();
+        // consecutive bodies mostly share their block, which is held once for all of them
+        if ((message.block != nullptr) && (held_blocks_.empty() || (held_blocks_.back() != message.block)))
         {
-            FlushUnprotected();
-
-            //  Send big message using alternative API, both for construction and sending:
-            static constexpr auto kVectorStackCount = 2UL;
-            std::array<iovec, kVectorStackCount> io_vec{};
-            score::platform::internal::DltVerboseHeader header;
-            // coverity[autosar_cpp14_m5_2_10_violation]
-            const auto header_size = score::platform::internal::ConstructVerboseHeader(header, entry, ecu, mcnt_++, tmsp);
-            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-union-access) iovec is unchangable, It's (POSIX standard)
-            io_vec[0].iov_base = static_cast<void*>(&header);
-            io_vec[0].iov_len = header_size;
-            // NOLINTBEGIN(cppcoreguidelines-pro-type-union-access) iovec is unchangable, It's (POSIX standard)
-            // const_cast is necessary since entry.GetPayload().data() is a const void*
-            // coverity[autosar_cpp14_a5_2_3_violation]
-            io_vec[1].iov_base = const_cast<void*>(static_cast<const void*>(entry.GetPayload().data()));
-            // NOLINTEND(cppcoreguidelines-pro-type-union-access)
-            io_vec[1].iov_len = static_cast<std::size_t>(entry.GetPayload().size());
-            const auto send_result = out_.Send(io_vec.data(), kVectorStackCount);
-            if (send_result.has_value() == false)
-            {
-                ++verbose_.send_failures_count;
-                auto& val = verbose_.send_errno_count[send_result.error().ToString()];
-                ++val;
-            }
+            message.block->Hold();
+            held_blocks_.push_back(message.block);
         }
     }
+    else  //  message does not fit into a datagram of this channel
+    {
+        FlushUnprotected();
+
+        std::array<iovec, 2U> io_vec{};
+        score::platform::internal::DltChannelHeader header;
+        // coverity[autosar_cpp14_m5_2_10_violation]
+        const auto header_size = score::platform::internal::ConstructChannelHeader(
+            header, message.body.size(), message.verbose, ecu, mcnt_++, message.tmsp);
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-union-access) iovec is unchangable, It's (POSIX standard)
+        io_vec[0].iov_base = static_cast<void*>(&header);
+        io_vec[0].iov_len = header_size;
+        // NOLINTBEGIN(cppcoreguidelines-pro-type-union-access) iovec is unchangable, It's (POSIX standard)
+        // coverity[autosar_cpp14_a5_2_3_violation]
+        io_vec[1].iov_base = const_cast<char*>(message.body.data());
+        // NOLINTEND(cppcoreguidelines-pro-type-union-access)
+        io_vec[1].iov_len = message.body.size();
+        SendSingleUnprotected(io_vec.data(), io_vec.size(), message.verbose);
+    }
 }
 
 void DltLogChannel::SendFtVerbose(score::cpp::span<const std::uint8_t> data,
@@ -248,8 +271,7 @@ void DltLogChannel::SendFtVerbose(score::cpp::span<const std::uint8_t> data,
     score::platform::internal::ConstructDltStandardHeaderExtra(hdr.stde, ecu, tmsp);
     score::platform::internal::ConstructDltExtendedHeader(hdr.ext, loglevel, nor, app_id, ctx_id);
 
-    static constexpr auto kVectorStackCount = 2UL;
-    std::array<iovec, kVectorStackCount> io_vec{};
+    std::array<iovec, 2U> io_vec{};
     // NOLINTNEXTLINE(cppcoreguidelines-pro-type-union-access) iovec is unchangable, It's (POSIX standard)
     io_vec[0].iov_base = static_cast<void*>(&hdr);
     io_vec[0].iov_len = sizeof(hdr);
@@ -263,17 +285,359 @@ void DltLogChannel::SendFtVerbose(score::cpp::span<const std::uint8_t> data,
     {  //  lock scope
         std::lock_guard<std::mutex> lock(mutex_);
         FlushUnprotected();
-        const auto send_result = out_.Send(io_vec.data(), kVectorStackCount);
+        SendSingleUnprotected(io_vec.data(), io_vec.size(), true);
+        ++verbose_.stats_msgcnt;
+        verbose_.stats_totalsize += data_size + sizeof(hdr);
+    }
+    start = std::chrono::system_clock::now();
+}
+
+void DltLogChannel::SendSingleUnprotected(const iovec* const io_vec, const size_t io_vec_count, const bool verbose)
+{
+    const score::cpp::span<const iovec> parts{io_vec, io_vec_count};
+    if (!HandsBatchesOver())
+    {
+        const auto send_result = out_.Send(io_vec, io_vec_count);
         if (send_result.has_value() == false)
         {
-            ++verbose_.send_failures_count;
-            auto& val = verbose_.send_errno_count[send_result.error().ToString()];
+            auto& statistics = verbose ? verbose_ : static_cast<DltLogChannelStatistics&>(non_verbose_);
+            ++statistics.send_failures_count;
+            auto& val = statistics.send_errno_count[send_result.error().GetOsDependentErrorCode()];
             ++val;
         }
-        ++verbose_.stats_msgcnt;
-        verbose_.stats_totalsize += data_size + sizeof(hdr);
+        return;
     }
-    start = std::chrono::system_clock::now();
+
+    SendUdp();  // completes the current datagram, if any
+    auto& prebuf = batch_->prebuf_data.at(vector_index_);
+    size_t full_size = 0U;
+    for (const auto& part : parts)
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-union-access) iovec is unchangable, It's (POSIX standard)
+        full_size += part.iov_len;
+    }
+    if (prebuf.size() < full_size)
+    {
+        // kept for the next large message constructed in this datagram
+        prebuf.resize(full_size);
+    }
+    for (const auto& part : parts)
+    {
+        // NOLINTBEGIN(cppcoreguidelines-pro-type-union-access) iovec is unchangable, It's (POSIX standard)
+        // NOLINTNEXTLINE(score-banned-function) copy of the message
+        std::memcpy(GetPrebufEnd(), part.iov_base, part.iov_len);
+        prebuf_size_ += part.iov_len;
+        // NOLINTEND(cppcoreguidelines-pro-type-union-access)
+    }
+    auto& count_in_buffer = verbose ? count_verbose_messages_in_buffer_ : count_nonverbose_messages_in_buffer_;
+    ++count_in_buffer;
+    SendUdp();
+}
+
+void DltLogChannel::SendSegmentedUnprotected(const score::cpp::span<const char> trace_header,
+                                             const score::cpp::span<const char> payload,
+                                             const DltidT app_id,
+                                             const DltidT ctx_id,
+                                             const uint32_t tmsp,
+                                             const bool verbose)
+{
+    const auto payload_size = static_cast<size_t>(payload.size());
+    const size_t segment_count = (payload_size + kMaxNetworkTraceSegment - 1U) / kMaxNetworkTraceSegment;
+    // the network trace limits the number of segments, thus a payload of more than 4 GiB
+    if (segment_count > std::numeric_limits<uint16_t>::max())
+    {
+        auto& statistics = verbose ? verbose_ : static_cast<DltLogChannelStatistics&>(non_verbose_);
+        ++statistics.send_failures_count;
+        ++statistics.send_errno_count[EMSGSIZE];
+        return;
+    }
+    const uint32_t stream = network_trace_stream_++;
+
+    score::platform::internal::DltNetworkTraceStartHead head;
+    score::platform::internal::DltNetworkTraceStartTail tail;
+    // coverity[autosar_cpp14_m5_2_10_violation]
+    score::platform::internal::ConstructNetworkTraceStart(head,
+                                                         tail,
+                                                         static_cast<size_t>(trace_header.size()),
+                                                         stream,
+                                                         static_cast<uint32_t>(payload_size),
+                                                         static_cast<uint16_t>(segment_count),
+                                                         static_cast<uint16_t>(kMaxNetworkTraceSegment),
+                                                         ecu,
+                                                         mcnt_++,
+                                                         tmsp,
+                                                         app_id,
+                                                         ctx_id);
+    // NOLINTBEGIN(cppcoreguidelines-pro-type-union-access) iovec is unchangable, It's (POSIX standard)
+    // const_cast is necessary since the header is const, it is only read by the send
+    // coverity[autosar_cpp14_a5_2_3_violation]
+    const std::array<iovec, 3U> start{iovec{&head, sizeof(head)},
+                                      iovec{const_cast<char*>(trace_header.data()), trace_header.size()},
+                                      iovec{&tail, sizeof(tail)}};
+    // NOLINTEND(cppcoreguidelines-pro-type-union-access)
+    SendSingleUnprotected(start.data(), start.size(), verbose);
+
+    for (size_t sequence = 0U; sequence < segment_count; ++sequence)
+    {
+        const size_t offset = sequence * kMaxNetworkTraceSegment;
+        const size_t segment_size = std::min(kMaxNetworkTraceSegment, payload_size - offset);
+        score::platform::internal::DltNetworkTraceSegmentHeader header;
+        // coverity[autosar_cpp14_m5_2_10_violation]
+        score::platform::internal::ConstructNetworkTraceSegmentHeader(header,
+                                                                     stream,
+                                                                     static_cast<uint16_t>(sequence),
+                                                                     static_cast<uint16_t>(segment_size),
+                                                                     ecu,
+                                                                     mcnt_++,
+                                                                     tmsp,
+                                                                     app_id,
+                                                                     ctx_id);
+        // NOLINTBEGIN(cppcoreguidelines-pro-type-union-access) iovec is unchangable, It's (POSIX standard)
+        // coverity[autosar_cpp14_a5_2_3_violation]
+        const std::array<iovec, 2U> io_vec{
+            iovec{&header, sizeof(header)},
+            iovec{const_cast<char*>(std::next(payload.data(), static_cast<std::ptrdiff_t>(offset))), segment_size}};
+        // NOLINTEND(cppcoreguidelines-pro-type-union-access)
+        SendSingleUnprotected(io_vec.data(), io_vec.size(), verbose);
+    }
+
+    score::platform::internal::DltNetworkTraceEnd end;
+    // coverity[autosar_cpp14_m5_2_10_violation]
+    score::platform::internal::ConstructNetworkTraceEnd(end, stream, ecu, mcnt_++, tmsp, app_id, ctx_id);
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-union-access) iovec is unchangable, It's (POSIX standard)
+    const std::array<iovec, 1U> end_io_vec{iovec{&end, sizeof(end)}};
+    SendSingleUnprotected(end_io_vec.data(), end_io_vec.size(), verbose);
+}
+
+std::optional<pthread_t> DltLogChannel::StartSender(const std::string& thread_name)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if ((sender_queue_depth_ == 0U) || HandsBatchesOver())
+    {
+        return std::nullopt;
+    }
+    // one batch is constructed while the others wait or are sent
+    sender_ = std::make_unique<Sender>(sender_queue_depth_);
+    for (size_t index = 0U; index < sender_queue_depth_; ++index)
+    {
+        batches_.push_back(MakeBatch());
+        std::ignore = sender_->free_batches.TryPush(batches_.back().get());
+    }
+    sender_->thread = std::thread([this]() {
+        RunSender();
+    });
+
+    auto ret_pthread = score::os::Pthread::instance().setname_np(sender_->thread.native_handle(), thread_name.c_str());
+    if (!ret_pthread.has_value())
+    {
+        std::cerr << "setname_np: " << ret_pthread.error() << std::endl;
+    }
+    return sender_->thread.native_handle();
+}
+
+DltLogChannel::SenderQueueStatistics DltLogChannel::GetSenderQueueStatistics()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    SenderQueueStatistics statistics = sender_statistics_;
+    statistics.depth = GetHandOverDepth();
+    return statistics;
+}
+
+bool DltLogChannel::AttachSubmissionRing(IUdpSubmissionRing& ring)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!use_submission_ring_ || HandsBatchesOver())
+    {
+        return false;
+    }
+    if (segmentation_offload_)
+    {
+        std::cerr << "DltLogChannel " << channel_name.Data()
+                  << ": io_uring does not offload segmentation, the datagrams are sent" << std::endl;
+        return false;
+    }
+
+    // without a configured depth, a few batches may be in flight until the next submission reaps them
+    constexpr size_t kDefaultSubmissionDepth{4U};
+    const size_t depth = (sender_queue_depth_ > 0U) ? sender_queue_depth_ : kDefaultSubmissionDepth;
+    submission_ = std::make_unique<Submission>(ring);
+    submission_->free_batches.reserve(depth + 1U);
+    for (size_t index = 0U; index < depth; ++index)
+    {
+        batches_.push_back(MakeBatch());
+        submission_->free_batches.push_back(batches_.back().get());
+    }
+    for (auto& batch : batches_)
+    {
+        batch->channel = this;
+    }
+    return true;
+}
+
+void DltLogChannel::QueueBatch()
+{
+    DatagramBatch* free_batch{nullptr};
+    bool taken = TakeFreeBatch(free_batch);
+    if (!taken && (submission_ != nullptr))
+    {
+        // the datagrams queued so far are submitted, reaping the completions of the batches sent meanwhile
+        std::ignore = submission_->ring.Submit();
+        taken = TakeFreeBatch(free_batch);
+    }
+    if (!taken)
+    {
+        // the network stalls: the newest batch is dropped and constructed again, so that routing goes on
+        ++sender_statistics_.dropped_batches;
+        sender_statistics_.dropped_datagrams += batch_->datagram_count;
+        sender_statistics_.dropped_messages += batch_->verbose_count + batch_->non_verbose_count;
+        return;
+    }
+
+    if (submission_ != nullptr)
+    {
+        // counted before queueing, as the completions may be reaped right away
+        batch_->pending = batch_->datagram_count;
+        const auto depth = submission_->depth.fetch_add(1U, std::memory_order_acq_rel) + 1U;
+        const score::cpp::span<mmsghdr> datagrams(batch_->mmsg_hdr_array.data(), batch_->datagram_count);
+        const auto queue_result = out_.Queue(submission_->ring, datagrams, *batch_);
+        if (!queue_result.has_value())
+        {
+            // none of the datagrams is queued, the batch is constructed again
+            CountSendFailure(queue_result.error(), *batch_);
+            ReleaseBatch(*free_batch);
+            return;
+        }
+        sender_statistics_.high_watermark = std::max(sender_statistics_.high_watermark, depth);
+        ++sender_statistics_.handed_over_batches;
+        batch_ = free_batch;
+        return;
+    }
+
+    Sender& sender = *sender_;
+    // counted before the push, as the sender thread may send the batch right away
+    const auto depth = sender.depth.fetch_add(1U, std::memory_order_acq_rel) + 1U;
+    sender_statistics_.high_watermark = std::max(sender_statistics_.high_watermark, depth);
+    ++sender_statistics_.handed_over_batches;
+    // cannot fail, the queue holds all batches but the one constructed
+    std::ignore = sender.ready_batches.TryPush(batch_);
+    batch_ = free_batch;
+    {
+        std::lock_guard<std::mutex> lock(sender.mutex);
+    }
+    sender.condition.notify_one();
+}
+
+bool DltLogChannel::TakeFreeBatch(DatagramBatch*& batch)
+{
+    if (submission_ == nullptr)
+    {
+        return sender_->free_batches.TryPop(batch);
+    }
+    {
+        std::lock_guard<std::mutex> lock(submission_->mutex);
+        if (submission_->free_batches.empty())
+        {
+            return false;
+        }
+        batch = submission_->free_batches.back();
+        submission_->free_batches.pop_back();
+    }
+    // a failure is counted once the batch is reused, as the completions cannot lock the channel
+    if (batch->send_error != 0)
+    {
+        CountSendFailure(score::os::Error::createFromErrno(batch->send_error), *batch);
+        batch->send_error = 0;
+    }
+    return true;
+}
+
+void DltLogChannel::ReleaseBatch(DatagramBatch& batch) noexcept
+{
+    std::lock_guard<std::mutex> lock(submission_->mutex);
+    // does not allocate, the capacity covers all batches
+    submission_->free_batches.push_back(&batch);
+    std::ignore = submission_->depth.fetch_sub(1U, std::memory_order_acq_rel);
+}
+
+size_t DltLogChannel::GetHandOverDepth() const noexcept
+{
+    if (submission_ != nullptr)
+    {
+        return submission_->depth.load(std::memory_order_acquire);
+    }
+    return (sender_ != nullptr) ? sender_->depth.load(std::memory_order_acquire) : 0U;
+}
+
+void DltLogChannel::DatagramBatch::OnSent(const std::int32_t result) noexcept
+{
+    if (result < 0)
+    {
+        send_error = -result;
+    }
+    --pending;
+    if (pending == 0U)
+    {
+        channel->ReleaseBatch(*this);
+    }
+}
+
+void DltLogChannel::RunSender()
+{
+    Sender& sender = *sender_;
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(sender.mutex);
+            sender.condition.wait(lock, [&sender]() {
+                return sender.exit || !sender.ready_batches.IsEmpty();
+            });
+        }
+        DatagramBatch* batch{nullptr};
+        if (!sender.ready_batches.TryPop(batch))
+        {
+            // exit once the batches handed over are sent
+            break;
+        }
+        const auto send_result = SendBatch(*batch);
+        if (send_result.has_value() == false)
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            CountSendFailure(send_result.error(), *batch);
+        }
+        std::ignore = sender.free_batches.TryPush(batch);
+        std::ignore = sender.depth.fetch_sub(1U, std::memory_order_acq_rel);
+    }
+}
+
+/*
+Deviation from Rule A15-5-1:
+- All user-provided class destructors, deallocation functions, move constructors,
+- move assignment operators and swap functions shall not exit with an exception.
+Justification:
+- join() could throw exception only if something goes wrong on OS level, which could only happen on system shutdown
+*/
+// coverity[autosar_cpp14_a15_5_1_violation] see above
+void DltLogChannel::StopSender() noexcept
+{
+    if (sender_ == nullptr)
+    {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(sender_->mutex);
+        sender_->exit = true;
+    }
+    sender_->condition.notify_all();
+    if (sender_->thread.joinable())
+    {
+        sender_->thread.join();
+    }
+}
+
+DltLogChannel::~DltLogChannel() noexcept
+{
+    StopSender();
+    ReleaseHeldBlocks();
 }
 
 void DltLogChannel::FlushUnprotected()
@@ -18,7 +18,11 @@
 #include "score/datarouter/include/daemon/i_diagnostic_job_handler.h"
 
 #include <algorithm>
+#include <array>
+#include <memory>
 #include <sstream>
+#include <string>
+#include <tuple>
 
 #include <iostream>
 
@@ -33,26 +37,78 @@ void DltLogServer::SendNonVerbose(const score::mw::log::config::NvMsgDescriptor&
                                   uint32_t tmsp,
                                   const void* data,
                                   size_t size)
+{
+    CachedRoute route{};
+    SendNonVerbose(desc, tmsp, data, size, route);
+}
+
+void DltLogServer::SendNonVerbose(const score::mw::log::config::NvMsgDescriptor& desc,
+                                  uint32_t tmsp,
+                                  const void* data,
+                                  size_t size,
+                                  CachedRoute& route)
 {
     auto sender = [&desc, &tmsp, &data, &size, this](DltLogChannel& c) {
         log_sender_->SendNonVerbose(desc, tmsp, data, size, c);
     };
+    const auto encode = [&desc, &data, &size](char* body) {
+        score::platform::internal::ConstructNonVerboseBody(body, data, size, desc.GetIdMsgDescriptor());
+    };
     const auto app_id = desc.GetAppId().GetStringView();
     const auto ctx_id = desc.GetCtxId().GetStringView();
-    FilterAndCall(DltidT{score::cpp::string_view{app_id.data(), app_id.size()}},
-                  DltidT{score::cpp::string_view{ctx_id.data(), ctx_id.size()}},
-                  desc.GetLogLevel(),
-                  sender);
+    RefreshRoute(route,
+                 DltidT{score::cpp::string_view{app_id.data(), app_id.size()}},
+                 DltidT{score::cpp::string_view{ctx_id.data(), ctx_id.size()}});
+    const DltEncodedMessage message{{}, tmsp, desc.GetLogLevel(), false, desc.GetIdMsgDescriptor(), size};
+    CallRoutedEncodingOnce(route, message, sizeof(uint32_t) + size, encode, sender);
 }
 
 void DltLogServer::SendVerbose(
     uint32_t tmsp,
     const score::mw::log::detail::log_entry_deserialization::LogEntryDeserializationReflection& entry)
+{
+    CachedRoute route{};
+    SendVerbose(tmsp, entry, route);
+}
+
+void DltLogServer::SendVerbose(
+    uint32_t tmsp,
+    const score::mw::log::detail::log_entry_deserialization::LogEntryDeserializationReflection& entry,
+    CachedRoute& route)
 {
     const auto sender = [&tmsp, &entry, this](DltLogChannel& c) {
         log_sender_->SendVerbose(tmsp, entry, c);
     };
-    FilterAndCall(platform::DltidT{entry.app_id}, platform::DltidT{entry.ctx_id}, entry.log_level, sender);
+    const auto encode = [&entry](char* body) {
+        score::platform::internal::ConstructVerboseBody(body, entry);
+    };
+    RefreshRoute(route, platform::DltidT{entry.app_id}, platform::DltidT{entry.ctx_id});
+    const auto body_size = score::platform::internal::GetVerboseBodySize(entry);
+    const DltEncodedMessage message{{}, tmsp, entry.log_level, true, 0U, body_size - sizeof(DltExtendedHeader)};
+    CallRoutedEncodingOnce(route, message, body_size, encode, sender);
+}
+
+bool DltLogServer::PrefilterVerbose(CachedRoute& route,
+                                    const DltidT app_id,
+                                    const DltidT ctx_id,
+                                    const mw::log::LogLevel log_level)
+{
+    RefreshRoute(route, app_id, ctx_id);
+    if (route.threshold.has_value() && (log_level > route.threshold.value()))
+    {
+        return false;
+    }
+    bool accepted = false;
+    ForEachRoutedChannel(route, [log_level, &accepted](const DltLogChannel& c) {
+        accepted = accepted || (log_level <= c.channel_threshold.load(std::memory_order_relaxed));
+    });
+    if (!accepted)
+    {
+        ForEachRoutedChannel(route, [](DltLogChannel& c) {
+            c.CountPrefilteredVerbose();
+        });
+    }
+    return accepted;
 }
 
 void DltLogServer::SendFtVerbose(score::cpp::span<const std::uint8_t> data,
@@ -77,6 +133,87 @@ void DltLogServer::SendFtVerbose(score::cpp::span<const std::uint8_t> data,
     }
 }
 
+CachedRoute DltLogServer::RoutingTable::Resolve(const DltidT app_id, const DltidT ctx_id) const noexcept
+{
+    std::optional<LoglevelT> threshold{};
+    std::optional<ChannelmaskT> channels{};
+    if (!rules.empty())
+    {
+        // the same fallbacks as FindInKeyMap(), but resolving both the threshold and the channels in one table
+        const std::array<KeyT, 3U> keys{KeyT{app_id, ctx_id}, KeyT{DltidT{}, ctx_id}, KeyT{app_id, DltidT{}}};
+        for (const auto& key : keys)
+        {
+            const auto rule = rules.find(key);
+            if (rule == rules.end())
+            {
+                continue;
+            }
+            threshold = threshold.has_value() ? threshold : rule->second.threshold;
+            channels = channels.has_value() ? channels : rule->second.channels;
+            if (rule->second.resolved || (threshold.has_value() && channels.has_value()))
+            {
+                break;
+            }
+        }
+    }
+
+    CachedRoute route{};
+    route.generation = generation;
+    if (filtering_enabled)
+    {
+        route.threshold = threshold.value_or(default_threshold);
+    }
+    route.channels = channels.value_or(ChannelmaskT{});
+    return route;
+}
+
+void DltLogServer::PublishRoutingTable()
+{
+    auto routing_table = std::make_unique<RoutingTable>();
+    routing_table->generation = routing_generation_.load(std::memory_order_relaxed) + 1U;
+    routing_table->filtering_enabled = filtering_enabled_;
+    routing_table->default_threshold = default_threshold_;
+    for (const auto& message_threshold : message_thresholds_)
+    {
+        std::ignore = routing_table->rules[message_threshold.first];
+    }
+    for (const auto& assignment : channel_assignments_)
+    {
+        std::ignore = routing_table->rules[assignment.first];
+    }
+
+    for (auto& rule : routing_table->rules)
+    {
+        const DltidT app_id = rule.first.first;
+        const DltidT ctx_id = rule.first.second;
+        // wildcard keys also serve as fallbacks of other keys, thus they keep their own settings only
+        rule.second.resolved = !(app_id == DltidT{}) && !(ctx_id == DltidT{});
+        if (rule.second.resolved)
+        {
+            rule.second.threshold = FindInKeyMap(message_thresholds_, app_id, ctx_id);
+            rule.second.channels = FindInKeyMap(channel_assignments_, app_id, ctx_id);
+        }
+        else
+        {
+            const auto message_threshold = message_thresholds_.find(rule.first);
+            if (message_threshold != message_thresholds_.end())
+            {
+                rule.second.threshold = message_threshold->second;
+            }
+            const auto assignment = channel_assignments_.find(rule.first);
+            if (assignment != channel_assignments_.end())
+            {
+                rule.second.channels = assignment->second;
+            }
+        }
+    }
+
+    const auto generation = routing_table->generation;
+    routing_table_.Publish(std::move(routing_table));
+    // the routes memoized before are resolved again from the table published above
+    routing_generation_.store(generation, std::memory_order_release);
+}
+
 void DltLogServer::InitLogChannels(const bool reloading)
 {
     if (static_config_.channels.empty())
@@ -140,7 +277,8 @@ void DltLogServer::InitLogChannels(const bool reloading)
             const auto* const dst_address = channel.dst_address.empty() ? "239.255.42.99" : channel.dst_address.c_str();
             auto dst_port = channel.dst_port != 0 ? channel.dst_port : 3490U;
             const auto* const multicast_interface = channel.multicast_interface.c_str();
-            channels_.emplace_back(name, threshold, ecu, addr, port, dst_address, dst_port, multicast_interface);
+            channels_.emplace_back(
+                name, threshold, ecu, addr, port, dst_address, dst_port, multicast_interface, channel.transport);
             channel_nums_[name] = i;
         }
     }
@@ -224,6 +362,50 @@ void DltLogServer::SetOutputEnabled(const bool enabled)
         }
     }
 }
+size_t DltLogServer::StartChannelSenders(const score::platform::datarouter::ThreadPlacements* thread_placements)
+{
+    // the datagrams of a few batches of every channel may be in flight
+    constexpr std::uint32_t kSubmissionRingEntries{1024U};
+    const bool io_uring_configured =
+        std::any_of(static_config_.channels.begin(), static_config_.channels.end(), [](const auto& channel) {
+            return channel.second.transport.io_uring;
+        });
+    if (io_uring_configured && (submission_ring_ == nullptr))
+    {
+        auto ring = UdpSubmissionRing::Create(kSubmissionRingEntries);
+        if (ring.has_value())
+        {
+            submission_ring_ = std::move(ring.value());
+        }
+        else
+        {
+            std::cerr << "DltLogServer: io_uring is not available, the channels send their datagrams" << std::endl;
+        }
+    }
+
+    size_t started{0U};
+    for (size_t index = 0U; index < channels_.size(); ++index)
+    {
+        if ((submission_ring_ != nullptr) && channels_[index].AttachSubmissionRing(*submission_ring_))
+        {
+            ++started;
+            continue;
+        }
+        const std::string thread_name = "dlt_tx_" + std::to_string(index);
+        const auto thread = channels_[index].StartSender(thread_name);
+        if (!thread.has_value())
+        {
+            continue;
+        }
+        if (thread_placements != nullptr)
+        {
+            thread_placements->Apply(thread.value(), thread_name);
+        }
+        ++started;
+    }
+    return started;
+}
+
 bool DltLogServer::GetDltEnabled() const noexcept
 {
     return dlt_output_enabled_.load(std::memory_order_acquire);
@@ -299,6 +481,7 @@ std::string DltLogServer::ResetToDefault()
     std::lock_guard<std::mutex> lock(config_mutex_);
     ClearDatabase();
     InitLogChannels(true);
+    PublishRoutingTable();
 
     response[0] = config::kRetOk;
     return response;
@@ -359,6 +542,7 @@ std::string DltLogServer::SetLogLevel(DltidT app_id, DltidT ctx_id, ThresholdT t
     {
         message_thresholds_.emplace(std::make_pair(app_id, ctx_id), std::get<LoglevelT>(threshold));
     }
+    PublishRoutingTable();
     response[0] = config::kRetOk;
     return response;
 }
@@ -369,6 +553,7 @@ std::string DltLogServer::SetMessagingFilteringState(bool enabled)
 
     std::lock_guard<std::mutex> lock(config_mutex_);
     filtering_enabled_ = enabled;
+    PublishRoutingTable();
     response[0] = config::kRetOk;
     return response;
 }
@@ -379,6 +564,7 @@ std::string DltLogServer::SetDefaultLogLevel(LoglevelT level)
 
     std::lock_guard<std::mutex> lock(config_mutex_);
     default_threshold_ = static_cast<LoglevelT>(level);
+    PublishRoutingTable();
     response[0] = config::kRetOk;
     return response;
 }
@@ -425,6 +611,7 @@ std::string DltLogServer::SetLogChannelAssignment(DltidT app_id,
             }
         }
     }
+    PublishRoutingTable();
     response[0] = config::kRetOk;
     return response;
 }
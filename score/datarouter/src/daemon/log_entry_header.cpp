@@ -0,0 +1,179 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include "score/datarouter/include/daemon/log_entry_header.h"
+#include "score/datarouter/include/daemon/log_entry_deserialization_visitor.h"
+#include "score/mw/log/detail/common/log_entry_deserialize.h"
+
+#include "static_reflection_with_serialization/serialization/for_logging.h"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <string_view>
+
+namespace score
+{
+namespace logging
+{
+namespace dltserver
+{
+
+namespace
+{
+
+namespace dlt_server_logging = ::score::mw::log::detail::log_entry_deserialization;
+using S = ::score::common::visitor::logging_serializer;
+using score::platform::BufsizeT;
+using score::platform::DltidT;
+
+// covers the fields preceding the payload, which is stored behind them
+constexpr std::size_t kProbeSize{64U};
+constexpr std::size_t kIdSize{DltidT::size()};
+using Probe = std::array<char, kProbeSize>;
+
+struct LogEntryHeaderLayout
+{
+    std::array<std::size_t, kIdSize> app_id;
+    std::array<std::size_t, kIdSize> ctx_id;
+    std::size_t log_level;
+    // size of a record holding all of the fields
+    std::size_t size;
+};
+
+dlt_server_logging::LogEntryDeserializationReflection DeserializeProbe(const Probe& probe)
+{
+    dlt_server_logging::LogEntryDeserializationReflection entry{};
+    S::deserialize(probe.data(), static_cast<BufsizeT>(probe.size()), entry);
+    return entry;
+}
+
+char GetIdByte(const score::mw::log::detail::LoggingIdentifier& id, const std::size_t index) noexcept
+{
+    const auto view = id.GetStringView();
+    return (index < view.size()) ? view[index] : '\0';
+}
+
+// returns the only free offset of the probe at which the marker shows up in the entry, std::nullopt if none or several
+template <typename Shows>
+std::optional<std::size_t> LocateMarker(const Probe& base, const char marker, Shows shows)
+{
+    std::optional<std::size_t> located{};
+    for (std::size_t offset = 0U; offset < kProbeSize; ++offset)
+    {
+        if (base.at(offset) != '\0')
+        {
+            continue;
+        }
+        Probe probe = base;
+        probe.at(offset) = marker;
+        if (shows(DeserializeProbe(probe)))
+        {
+            if (located.has_value())
+            {
+                return std::nullopt;
+            }
+            located = offset;
+        }
+    }
+    return located;
+}
+
+LogEntryHeader ReadLogEntryHeader(const LogEntryHeaderLayout& layout, const std::string_view record) noexcept
+{
+    std::array<char, kIdSize> app_id{};
+    std::array<char, kIdSize> ctx_id{};
+    for (std::size_t index = 0U; index < kIdSize; ++index)
+    {
+        app_id.at(index) = record[layout.app_id.at(index)];
+        ctx_id.at(index) = record[layout.ctx_id.at(index)];
+    }
+    return LogEntryHeader{DltidT{std::string_view{app_id.data(), app_id.size()}},
+                          DltidT{std::string_view{ctx_id.data(), ctx_id.size()}},
+                          static_cast<mw::log::LogLevel>(static_cast<std::uint8_t>(record[layout.log_level]))};
+}
+
+std::optional<LogEntryHeaderLayout> LocateLogEntryHeader()
+{
+    constexpr char kIdMarker{'#'};
+    // the bytes located are filled, as an id may end at its first null character
+    constexpr char kIdFiller{'_'};
+    constexpr mw::log::LogLevel kLevelMarker{mw::log::LogLevel::kWarn};
+
+    LogEntryHeaderLayout layout{};
+    Probe base{};
+    for (std::size_t index = 0U; index < kIdSize; ++index)
+    {
+        const auto app_id = LocateMarker(base, kIdMarker, [index](const auto& entry) {
+            return GetIdByte(entry.app_id, index) == kIdMarker;
+        });
+        const auto ctx_id = LocateMarker(base, kIdMarker, [index](const auto& entry) {
+            return GetIdByte(entry.ctx_id, index) == kIdMarker;
+        });
+        if ((!app_id.has_value()) || (!ctx_id.has_value()) || (app_id.value() == ctx_id.value()))
+        {
+            return std::nullopt;
+        }
+        layout.app_id.at(index) = app_id.value();
+        layout.ctx_id.at(index) = ctx_id.value();
+        base.at(app_id.value()) = kIdFiller;
+        base.at(ctx_id.value()) = kIdFiller;
+    }
+    const auto log_level = LocateMarker(Probe{}, static_cast<char>(kLevelMarker), [](const auto& entry) {
+        return entry.log_level == kLevelMarker;
+    });
+    if (!log_level.has_value())
+    {
+        return std::nullopt;
+    }
+    layout.log_level = log_level.value();
+    layout.size = std::max({*std::max_element(layout.app_id.begin(), layout.app_id.end()),
+                            *std::max_element(layout.ctx_id.begin(), layout.ctx_id.end()),
+                            layout.log_level}) +
+                  1U;
+
+    // the fields read from the located offsets shall be the ones deserialized
+    constexpr std::string_view kAppId{"APP1"};
+    constexpr std::string_view kCtxId{"CTX1"};
+    Probe probe{};
+    for (std::size_t index = 0U; index < kIdSize; ++index)
+    {
+        probe.at(layout.app_id.at(index)) = kAppId[index];
+        probe.at(layout.ctx_id.at(index)) = kCtxId[index];
+    }
+    probe.at(layout.log_level) = static_cast<char>(mw::log::LogLevel::kInfo);
+    const auto entry = DeserializeProbe(probe);
+    const auto header = ReadLogEntryHeader(layout, std::string_view{probe.data(), probe.size()});
+    if (!(header.app_id == DltidT{entry.app_id}) || !(header.ctx_id == DltidT{entry.ctx_id}) ||
+        (header.log_level != entry.log_level))
+    {
+        return std::nullopt;
+    }
+    return layout;
+}
+
+}  // namespace
+
+std::optional<LogEntryHeader> PeekLogEntryHeader(const char* data, BufsizeT size)
+{
+    static const std::optional<LogEntryHeaderLayout> layout = LocateLogEntryHeader();
+    if ((!layout.has_value()) || (size < layout->size))
+    {
+        return std::nullopt;
+    }
+    return ReadLogEntryHeader(layout.value(), std::string_view{data, size});
+}
+
+}  // namespace dltserver
+}  // namespace logging
+}  // namespace score
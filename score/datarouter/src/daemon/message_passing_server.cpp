@@ -19,8 +19,10 @@
 #include "score/memory.hpp"
 #include <score/jthread.hpp>
 
+#include <algorithm>
 #include <cstring>
 #include <iostream>
+#include <limits>
 #include <sstream>
 #include <string>
 #include <thread>
@@ -35,6 +37,19 @@ namespace internal
 using score::mw::log::detail::DatarouterMessageIdentifier;
 using score::mw::log::detail::MessagePassingConfig;
 
+namespace
+{
+// Default interval between ticks of a session, also the longest sleep of the worker waiting for deadlines.
+constexpr std::chrono::microseconds kTickInterval{100000};
+// Backoff range for sessions waiting for an acquisition to complete.
+constexpr std::chrono::microseconds kMinFastTickDelay{50};
+constexpr std::chrono::microseconds kMaxFastTickDelay{10000};
+// Upper bound for idle sessions, limits the latency until new data of a silent client is noticed.
+constexpr std::chrono::microseconds kMaxIdleTickInterval{400000};
+// Time in a run queue after which a session with an empty buffer is as urgent as one with a full buffer.
+constexpr std::chrono::microseconds kUrgencyAgingInterval{50000};
+}  // namespace
+
 void MessagePassingServer::SessionWrapper::EnqueueForDeleteWhileLocked(bool by_peer)
 {
     to_delete = true;
@@ -54,6 +69,16 @@ bool MessagePassingServer::SessionWrapper::TickAtWorkerThread() const
     return requeue;
 }
 
+MessagePassingServer::TickActivity MessagePassingServer::SessionWrapper::GetTickActivity() const
+{
+    return session->GetTickActivity();
+}
+
+double MessagePassingServer::SessionWrapper::GetFillRatio() const
+{
+    return session->GetFillRatio();
+}
+
 void MessagePassingServer::SessionWrapper::NotifyClosedByPeer() const
 {
     session->OnClosedByPeer();
@@ -63,6 +88,8 @@ void MessagePassingServer::SessionWrapper::SetRunningWhileLocked()
 {
     enqueued = false;
     running = true;
+    // the pending deadline becomes outdated, the next one is scheduled at the end of this tick
+    scheduled_tick = TimestampT{};
 }
 
 bool MessagePassingServer::SessionWrapper::ResetRunningWhileLocked(bool requeue)
@@ -99,29 +126,61 @@ void MessagePassingServer::SessionWrapper::EnqueueTickWhileLocked()
 // coverity[autosar_cpp14_a3_1_1_violation]
 MessagePassingServer::MessagePassingServer(MessagePassingServer::SessionFactory factory,
                                            std::shared_ptr<score::message_passing::IServerFactory> server_factory,
-                                           std::shared_ptr<score::message_passing::IClientFactory> client_factory)
+                                           std::shared_ptr<score::message_passing::IClientFactory> client_factory,
+                                           const std::size_t worker_count,
+                                           const score::platform::datarouter::ThreadPlacements* thread_placements)
     : IMessagePassingServerSessionWrapper(),
       factory_{std::move(factory)},
       mutex_{},
       stop_source_{},
       connection_timeout_{},
+      worker_threads_{},
       worker_cond_{},
       pid_session_map_{},
-      work_queue_{},
+      start_time_{TimestampT::clock::now()},
+      work_queues_{},
+      worker_memory_nodes_(std::max(worker_count, std::size_t{1U})),
+      idle_workers_{0U},
+      tick_deadlines_{},
+      earliest_deadline_{std::numeric_limits<TimestampT::rep>::max()},
+      timer_cond_{},
+      timer_waiting_{false},
       workers_exit_{false},
       server_cond_{},
       session_finishing_{false},
       server_factory_{server_factory},
       client_factory_{client_factory}
 {
-    worker_thread_ = score::cpp::jthread([this]() {
-        RunWorkerThread();
-    });
+    // all queues exist before the first worker may steal from them
+    work_queues_.reserve(worker_memory_nodes_.size());
+    for (std::size_t worker_index = 0U; worker_index < worker_memory_nodes_.size(); ++worker_index)
+    {
+        std::ignore = work_queues_.emplace_back(std::make_unique<RunQueue>());
+    }
 
-    auto ret_pthread = score::os::Pthread::instance().setname_np(worker_thread_.native_handle(), "mp_worker");
-    if (!ret_pthread.has_value())
+    worker_threads_.reserve(work_queues_.size());
+    for (std::size_t worker_index = 0U; worker_index < work_queues_.size(); ++worker_index)
     {
-        std::cerr << "setname_np: " << ret_pthread.error() << std::endl;
+        const std::string thread_name = GetWorkerThreadName(worker_index);
+        if (thread_placements != nullptr)
+        {
+            worker_memory_nodes_.at(worker_index) = thread_placements->GetMemoryNode(thread_name);
+        }
+
+        auto& worker_thread = worker_threads_.emplace_back([this, worker_index]() {
+            RunWorkerThread(worker_index);
+        });
+
+        auto ret_pthread =
+            score::os::Pthread::instance().setname_np(worker_thread.native_handle(), thread_name.c_str());
+        if (!ret_pthread.has_value())
+        {
+            std::cerr << "setname_np: " << ret_pthread.error() << std::endl;
+        }
+        if (thread_placements != nullptr)
+        {
+            thread_placements->Apply(worker_thread.native_handle(), thread_name);
+        }
     }
 
     constexpr score::message_passing::ServiceProtocolConfig kServiceProtocolConfig{
@@ -140,15 +199,12 @@ MessagePassingServer::MessagePassingServer(MessagePassingServer::SessionFactory
         const pid_t client_pid = connection.GetClientIdentity().pid;
         return static_cast<std::uintptr_t>(client_pid);
     };
-    auto disconnect_callback = [mutex_ptr = &mutex_, pid_session_map_ptr = &pid_session_map_](
-                                   score::message_passing::IServerConnection& connection) noexcept {
-        std::unique_lock<std::mutex> lock(*mutex_ptr);
-        const auto found = pid_session_map_ptr->find(connection.GetClientIdentity().pid);
-        if (found != pid_session_map_ptr->end())
+    auto disconnect_callback = [this_ptr = this](score::message_passing::IServerConnection& connection) noexcept {
+        std::unique_lock<std::mutex> lock(this_ptr->mutex_);
+        const auto found = this_ptr->pid_session_map_.find(connection.GetClientIdentity().pid);
+        if (found != this_ptr->pid_session_map_.end())
         {
-            SessionWrapper& wrapper = found->second;
-            wrapper.to_force_finish = true;
-            found->second.EnqueueForDeleteWhileLocked(true);
+            this_ptr->ForceFinishWhileLocked(found->second);
         }
     };
     auto received_send_message_callback = [this_ptr = this](
@@ -180,8 +236,8 @@ Deviation from Rule A15-5-1:
 - move assignment operators and swap functions shall not exit with an exception.
 - A noexcept exception specification shall be added to these functions as appropriate.
 Justification:
-- Ensure that worker_thread_ is not running after destruction of MessagePassingServer
-- checking worker_thread_.joinable() should be enough to avoid exception from join().
+- Ensure that worker_threads_ are not running after destruction of MessagePassingServer
+- checking joinable() of each worker thread should be enough to avoid exception from join().
 - in this case join() could throw exception only if something goes wrong on OS level.
 - this should be fine, moreover it could happen only on system shutdown stage
 - and does not affect normal runtime
@@ -198,164 +254,414 @@ MessagePassingServer::~MessagePassingServer() noexcept
     // then, delete the receiver to finish and disable all receiver-related callbacks
     receiver_.reset();
 
-    // now, we can safely end the worker thread
-    workers_exit_.store(true);
+    // now, we can safely end the worker threads
+    {
+        // store under the lock, so that no worker misses the notification between its check and wait
+        std::lock_guard<std::mutex> lock(mutex_);
+        workers_exit_.store(true);
+    }
 
     worker_cond_.notify_all();
-    if (worker_thread_.joinable())
+    timer_cond_.notify_all();
+    for (auto& worker_thread : worker_threads_)
     {
-        worker_thread_.join();
+        if (worker_thread.joinable())
+        {
+            worker_thread.join();
+        }
     }
 
     // finally, explicitly close all the remaining sessions
     pid_session_map_.clear();
 }
 
-void MessagePassingServer::RunWorkerThread()
+std::chrono::microseconds MessagePassingServer::GetNextTickDelay(const TickActivity activity,
+                                                                 const std::chrono::microseconds previous_delay)
 {
-    constexpr std::int32_t kTimeoutInMs = 100;
-    TimestampT t1 = TimestampT::clock::now() + std::chrono::milliseconds(kTimeoutInMs);
-
-    std::unique_lock<std::mutex> lock(mutex_);
-    while (!workers_exit_)
+    switch (activity)
     {
-        worker_cond_.wait_until(lock, t1, [this]() {
-            return workers_exit_ || !work_queue_.empty();
-        });
-        if (!workers_exit_)
-        {
-            TimestampT now = TimestampT::clock::now();
-            if (connection_timeout_ != TimestampT{} && now >= connection_timeout_)
+        case TickActivity::kPending:
+            // restart the backoff unless the previous tick was already a fast one
+            if ((previous_delay < kMinFastTickDelay) || (previous_delay > kMaxFastTickDelay))
             {
-                connection_timeout_ = TimestampT{};
-                stop_source_.request_stop();
+                return kMinFastTickDelay;
             }
-            if (now >= t1)
+            return std::min(previous_delay * 2, kMaxFastTickDelay);
+        case TickActivity::kYielded:
+            // due right away, the urgency of sessions waiting longer ranks them first
+            return std::chrono::microseconds{0};
+        case TickActivity::kIdle:
+            if (previous_delay < kTickInterval)
             {
-                t1 = now + std::chrono::milliseconds(kTimeoutInMs);
-                for (auto& ps : pid_session_map_)
-                {
-                    if (ps.second.GetIsSourceClosed())
-                    {
-                        /*
-                            this is private functions so it cannot be test.
-                        */
-                        // LCOV_EXCL_START
-                        ps.second.EnqueueForDeleteWhileLocked(true);
-                        // LCOV_EXCL_STOP
-                    }
-                    else
-                    {
-                        ps.second.EnqueueTickWhileLocked();
-                    }
-                }
+                return kTickInterval;
             }
+            return std::min(previous_delay * 2, kMaxIdleTickInterval);
+        case TickActivity::kActive:
+        default:
+            return kTickInterval;
+    }
+}
+
+double MessagePassingServer::GetTickUrgency(const double fill_ratio, const std::chrono::microseconds waiting_time)
+{
+    const double aging = static_cast<double>(waiting_time.count()) / static_cast<double>(kUrgencyAgingInterval.count());
+    return std::clamp(fill_ratio, 0.0, 1.0) + std::max(aging, 0.0);
+}
+
+void MessagePassingServer::RunWorkerThread(const std::size_t worker_index)
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (!workers_exit_)
+    {
+        WaitForWorkWhileLocked(lock);
+        if (workers_exit_)
+        {
+            break;
         }
 
-        while (!workers_exit_ && !work_queue_.empty())
+        const TimestampT now = TimestampT::clock::now();
+        if (connection_timeout_ != TimestampT{} && now >= connection_timeout_)
         {
-            pid_t pid = work_queue_.front();
-            work_queue_.pop();
-            SessionWrapper& wrapper = pid_session_map_.at(pid);
-            wrapper.SetRunningWhileLocked();
-            bool closed_by_peer = wrapper.GetResetClosedByPeer();
-            lock.unlock();
-            if (closed_by_peer)
+            connection_timeout_ = TimestampT{};
+            stop_source_.request_stop();
+        }
+
+        // the run queues have locks of their own, the server lock is only taken to tick the popped session
+        lock.unlock();
+        while (!workers_exit_)
+        {
+            // deadlines passing while the queues are busy are ordered behind the already enqueued work
+            EnqueueDueTicks(TimestampT::clock::now());
+            const std::optional<pid_t> pid = PopWork(worker_index);
+            if (!pid.has_value())
             {
-                wrapper.NotifyClosedByPeer();
+                break;
             }
-            bool requeue = wrapper.TickAtWorkerThread();
             lock.lock();
-            if (wrapper.to_force_finish)
-            {
-                if (!closed_by_peer)
-                {
-                    // received to_force_finish_ for the session while ticking it;
-                    // need to notify the ISession before continuing
-                    /*
-                        this is private functions so it cannot be test.
-                    */
-                    // LCOV_EXCL_START
-                    wrapper.NotifyClosedByPeer();
-                    requeue = true;
-                    // LCOV_EXCL_STOP
-                }
-                if (requeue)
-                {
-                    // need to expedite finishing the ticks and erasing the map entry
-                    // as the server thread is waiting to add another session with the same pid to the map
-                    // LCOV_EXCL_START: see above
-                    lock.unlock();
-                    do
-                    {
-                        requeue = wrapper.TickAtWorkerThread();
-                    } while (requeue);
-                    lock.lock();
-                    // LCOV_EXCL_STOP
-                }
-                // Extract the session wrapper to destroy it outside the mutex lock
-                // to avoid deadlock when destructor blocks (e.g., ClientConnection::~ClientConnection)
-                auto node = pid_session_map_.extract(pid);
-                session_finishing_ = false;
-                server_cond_.notify_all();
-                lock.unlock();
-                // Destroy the extracted node here (destructor runs without holding mutex)
-                node = {};
-                lock.lock();
-            }
-            else if (wrapper.ResetRunningWhileLocked(requeue))
-            {
-                // LCOV_EXCL_START: see above
-                EnqueueTickWhileLocked(pid);
-                // LCOV_EXCL_STOP
-            }
-            else if (wrapper.IsMarkedForDelete())
+            TickSessionWhileLocked(pid.value(), lock);
+            lock.unlock();
+        }
+        lock.lock();
+    }
+}
+
+void MessagePassingServer::WaitForWorkWhileLocked(std::unique_lock<std::mutex>& lock)
+{
+    if (HasWorkWhileLocked())
+    {
+        return;
+    }
+
+    // a single idle worker sleeps until the earliest deadline, the other ones only wait for new work
+    if (!timer_waiting_)
+    {
+        TimestampT wake_up = TimestampT::clock::now() + kTickInterval;
+        if (!tick_deadlines_.empty())
+        {
+            wake_up = std::min(wake_up, tick_deadlines_.top().deadline);
+        }
+        timer_waiting_ = true;
+        std::ignore = timer_cond_.wait_until(lock, wake_up);
+        timer_waiting_ = false;
+        // hand over waiting for deadlines while this worker is busy
+        if (idle_workers_ != 0U)
+        {
+            worker_cond_.notify_one();
+        }
+    }
+    else
+    {
+        ++idle_workers_;
+        worker_cond_.wait(lock);
+        --idle_workers_;
+    }
+}
+
+void MessagePassingServer::ScheduleTickWhileLocked(SessionWrapper& wrapper,
+                                                   const TickActivity activity,
+                                                   const TimestampT now)
+{
+    wrapper.tick_delay = GetNextTickDelay(activity, wrapper.tick_delay);
+    wrapper.scheduled_tick = now + wrapper.tick_delay;
+
+    const bool is_earliest = tick_deadlines_.empty() || (wrapper.scheduled_tick < tick_deadlines_.top().deadline);
+    tick_deadlines_.push(ScheduledTick{wrapper.scheduled_tick, wrapper.pid});
+    UpdateEarliestDeadlineWhileLocked();
+    if (is_earliest && timer_waiting_)
+    {
+        timer_cond_.notify_one();
+    }
+}
+
+void MessagePassingServer::UpdateEarliestDeadlineWhileLocked()
+{
+    earliest_deadline_.store(tick_deadlines_.empty() ? std::numeric_limits<TimestampT::rep>::max()
+                                                     : tick_deadlines_.top().deadline.time_since_epoch().count(),
+                             std::memory_order_relaxed);
+}
+
+void MessagePassingServer::EnqueueDueTicks(const TimestampT now)
+{
+    // busy workers only take the server lock once a deadline passed
+    if (now.time_since_epoch().count() < earliest_deadline_.load(std::memory_order_relaxed))
+    {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    EnqueueDueTicksWhileLocked(now);
+}
+
+void MessagePassingServer::EnqueueDueTicksWhileLocked(const TimestampT now)
+{
+    while (!tick_deadlines_.empty() && (tick_deadlines_.top().deadline <= now))
+    {
+        const ScheduledTick tick = tick_deadlines_.top();
+        tick_deadlines_.pop();
+
+        // entries of finished sessions and of sessions ticked in the meantime are outdated
+        const auto found = pid_session_map_.find(tick.pid);
+        if ((found == pid_session_map_.end()) || (found->second.scheduled_tick != tick.deadline))
+        {
+            continue;
+        }
+
+        SessionWrapper& wrapper = found->second;
+        wrapper.scheduled_tick = TimestampT{};
+        if (wrapper.GetIsSourceClosed())
+        {
+            /*
+                this is private functions so it cannot be test.
+            */
+            // LCOV_EXCL_START
+            wrapper.EnqueueForDeleteWhileLocked(true);
+            // LCOV_EXCL_STOP
+        }
+        else
+        {
+            wrapper.EnqueueTickWhileLocked();
+        }
+    }
+    UpdateEarliestDeadlineWhileLocked();
+}
+
+std::string MessagePassingServer::GetWorkerThreadName(const std::size_t worker_index)
+{
+    return (worker_index == 0U) ? std::string{"mp_worker"} : "mp_worker_" + std::to_string(worker_index);
+}
+
+std::size_t MessagePassingServer::SelectHomeWorker(
+    const pid_t pid,
+    const std::optional<std::int32_t> memory_node,
+    const std::vector<std::optional<std::int32_t>>& worker_memory_nodes)
+{
+    // sessions are spread by pid, over the workers placed on the memory node of the client buffer if there are any
+    const auto spread = static_cast<std::size_t>(pid);
+    if (memory_node.has_value())
+    {
+        std::vector<std::size_t> node_workers{};
+        for (std::size_t worker_index = 0U; worker_index < worker_memory_nodes.size(); ++worker_index)
+        {
+            if (worker_memory_nodes[worker_index] == memory_node)
             {
-                // Extract the session wrapper to destroy it outside the mutex lock
-                auto node = pid_session_map_.extract(pid);
-                lock.unlock();
-                // Destroy the extracted node here (destructor runs without holding mutex)
-                node = {};
-                lock.lock();
+                node_workers.push_back(worker_index);
             }
         }
+        if (!node_workers.empty())
+        {
+            return node_workers[spread % node_workers.size()];
+        }
     }
+    return spread % worker_memory_nodes.size();
 }
 
-void MessagePassingServer::EnqueueTickWhileLocked(pid_t pid)
+MessagePassingServer::RunQueue& MessagePassingServer::GetWorkQueueWhileLocked(const pid_t pid)
 {
-    bool was_empty = work_queue_.empty();
-    work_queue_.push(pid);
-    if (was_empty)
+    // a session always returns to the same queue, so that it tends to be ticked by the same worker
+    const auto found = pid_session_map_.find(pid);
+    if (found == pid_session_map_.end())
     {
-        worker_cond_.notify_all();
+        // LCOV_EXCL_START: ticks are only enqueued for sessions in the map
+        return *work_queues_.at(static_cast<std::size_t>(pid) % work_queues_.size());
+        // LCOV_EXCL_STOP
     }
+    return *work_queues_.at(found->second.home_worker);
 }
 
-void MessagePassingServer::FinishPreviousSessionWhileLocked(
-    std::unordered_map<pid_t, MessagePassingServer::SessionWrapper>::iterator it,
-    std::unique_lock<std::mutex>& lock)
+bool MessagePassingServer::HasWorkWhileLocked() const
 {
-    const pid_t pid = it->first;
-    SessionWrapper& wrapper = it->second;
-    wrapper.to_force_finish = true;
-    wrapper.EnqueueForDeleteWhileLocked(true);
-    // if enqueued_ (i.e. not running) expedite the workload toward the front of the queue
-    if (wrapper.enqueued)
+    // ticks are pushed with the server lock held, so no new work is missed before waiting for it
+    return std::any_of(work_queues_.cbegin(), work_queues_.cend(), [](const std::unique_ptr<RunQueue>& queue) {
+        return queue->size.load(std::memory_order_acquire) != 0U;
+    });
+}
+
+double MessagePassingServer::GetTickPriorityWhileLocked(const pid_t pid, const TimestampT now) const
+{
+    const auto found = pid_session_map_.find(pid);
+    if (found == pid_session_map_.end())
+    {
+        // LCOV_EXCL_START: ticks are only enqueued for sessions in the map
+        return std::numeric_limits<double>::infinity();
+        // LCOV_EXCL_STOP
+    }
+    const SessionWrapper& wrapper = found->second;
+    if (wrapper.to_force_finish)
+    {
+        // the server thread is waiting to add another session with the same pid to the map
+        return std::numeric_limits<double>::infinity();
+    }
+    // the urgency of an entry grows with the time since start until it is popped, like the one of all the others;
+    // subtracting the aging at enqueue thus ranks later entries behind earlier ones of equal fill ratio
+    return GetTickUrgency(wrapper.GetFillRatio(), std::chrono::microseconds::zero()) -
+           GetTickUrgency(0.0, std::chrono::duration_cast<std::chrono::microseconds>(now - start_time_));
+}
+
+std::optional<pid_t> MessagePassingServer::PopWork(const std::size_t worker_index)
+{
+    // own queue first, then steal from the other workers starting with the next one;
+    // the most urgent entry is taken in both cases
+    for (std::size_t offset = 0U; offset < work_queues_.size(); ++offset)
+    {
+        RunQueue& queue = *work_queues_[(worker_index + offset) % work_queues_.size()];
+        if (queue.size.load(std::memory_order_acquire) == 0U)
+        {
+            continue;
+        }
+
+        std::lock_guard<std::mutex> queue_lock(queue.mutex);
+        if (queue.ticks.empty())
+        {
+            // LCOV_EXCL_START: stolen by another worker in the meantime
+            continue;
+            // LCOV_EXCL_STOP
+        }
+        std::pop_heap(queue.ticks.begin(), queue.ticks.end());
+        const pid_t pid = queue.ticks.back().pid;
+        queue.ticks.pop_back();
+        queue.size.store(queue.ticks.size(), std::memory_order_release);
+        return pid;
+    }
+    return std::nullopt;
+}
+
+void MessagePassingServer::TickSessionWhileLocked(const pid_t pid, std::unique_lock<std::mutex>& lock)
+{
+    SessionWrapper& wrapper = pid_session_map_.at(pid);
+    wrapper.SetRunningWhileLocked();
+    bool closed_by_peer = wrapper.GetResetClosedByPeer();
+    lock.unlock();
+    if (closed_by_peer)
+    {
+        wrapper.NotifyClosedByPeer();
+    }
+    bool requeue = wrapper.TickAtWorkerThread();
+    const TickActivity activity = wrapper.GetTickActivity();
+    lock.lock();
+    if (wrapper.to_force_finish)
     {
-        pid_t front_pid = work_queue_.front();
-        while (front_pid != pid)
+        if (!closed_by_peer)
         {
+            // received to_force_finish_ for the session while ticking it;
+            // need to notify the ISession before continuing
             /*
                 this is private functions so it cannot be test.
             */
             // LCOV_EXCL_START
-            work_queue_.pop();
-            work_queue_.push(front_pid);
-            front_pid = work_queue_.front();
+            wrapper.NotifyClosedByPeer();
+            requeue = true;
+            // LCOV_EXCL_STOP
+        }
+        if (requeue)
+        {
+            // need to expedite finishing the ticks and erasing the map entry
+            // as the server thread is waiting to add another session with the same pid to the map
+            // LCOV_EXCL_START: see above
+            lock.unlock();
+            do
+            {
+                requeue = wrapper.TickAtWorkerThread();
+            } while (requeue);
+            lock.lock();
             // LCOV_EXCL_STOP
         }
+        // Extract the session wrapper to destroy it outside the mutex lock
+        // to avoid deadlock when destructor blocks (e.g., ClientConnection::~ClientConnection)
+        auto node = pid_session_map_.extract(pid);
+        session_finishing_ = false;
+        server_cond_.notify_all();
+        lock.unlock();
+        // Destroy the extracted node here (destructor runs without holding mutex)
+        node = {};
+        lock.lock();
+    }
+    else if (wrapper.ResetRunningWhileLocked(requeue))
+    {
+        // LCOV_EXCL_START: see above
+        EnqueueTickWhileLocked(pid);
+        // LCOV_EXCL_STOP
+    }
+    else if (wrapper.IsMarkedForDelete())
+    {
+        // Extract the session wrapper to destroy it outside the mutex lock
+        auto node = pid_session_map_.extract(pid);
+        lock.unlock();
+        // Destroy the extracted node here (destructor runs without holding mutex)
+        node = {};
+        lock.lock();
+    }
+    else
+    {
+        ScheduleTickWhileLocked(wrapper, activity, TimestampT::clock::now());
+    }
+}
+
+void MessagePassingServer::EnqueueTickWhileLocked(pid_t pid)
+{
+    RunQueue& queue = GetWorkQueueWhileLocked(pid);
+    const QueuedTick tick{pid, GetTickPriorityWhileLocked(pid, TimestampT::clock::now())};
+    {
+        std::lock_guard<std::mutex> queue_lock(queue.mutex);
+        queue.ticks.push_back(tick);
+        std::push_heap(queue.ticks.begin(), queue.ticks.end());
+        queue.size.store(queue.ticks.size(), std::memory_order_release);
+    }
+    // any idle worker can take the work, either from its own queue or by stealing it
+    if (idle_workers_ != 0U)
+    {
+        worker_cond_.notify_one();
+    }
+    else if (timer_waiting_)
+    {
+        timer_cond_.notify_one();
+    }
+}
+
+void MessagePassingServer::ForceFinishWhileLocked(SessionWrapper& wrapper)
+{
+    wrapper.to_force_finish = true;
+    if (wrapper.enqueued)
+    {
+        // the tick was queued with the urgency of before, rank it as the most urgent entry of its queue now
+        RunQueue& queue = GetWorkQueueWhileLocked(wrapper.pid);
+        std::lock_guard<std::mutex> queue_lock(queue.mutex);
+        for (auto& entry : queue.ticks)
+        {
+            if (entry.pid == wrapper.pid)
+            {
+                entry.priority = std::numeric_limits<double>::infinity();
+            }
+        }
+        std::make_heap(queue.ticks.begin(), queue.ticks.end());
     }
+    wrapper.EnqueueForDeleteWhileLocked(true);
+}
+
+void MessagePassingServer::FinishPreviousSessionWhileLocked(
+    std::unordered_map<pid_t, MessagePassingServer::SessionWrapper>::iterator it,
+    std::unique_lock<std::mutex>& lock)
+{
+    // if enqueued (i.e. not running), to_force_finish makes the session the most urgent entry of its queue
+    ForceFinishWhileLocked(it->second);
 
     // we have only one server thread waiting on this condition (for only one session at a time)
     session_finishing_ = true;
@@ -481,7 +787,9 @@ void MessagePassingServer::OnConnectRequest(const score::cpp::span<const std::ui
     if (session)
     {
         std::unique_lock<std::mutex> lock(mutex_);
-        auto emplace_result = pid_session_map_.emplace(pid, SessionWrapper{this, pid, std::move(session)});
+        const std::size_t home_worker = SelectHomeWorker(pid, session->GetMemoryNode(), worker_memory_nodes_);
+        auto emplace_result =
+            pid_session_map_.emplace(pid, SessionWrapper{this, pid, std::move(session), home_worker});
         // enqueue the tick to speed up processing connection
         emplace_result.first->second.EnqueueTickWhileLocked();
     }
@@ -506,7 +814,8 @@ void MessagePassingServer::OnAcquireResponse(const score::cpp::span<const std::u
         */
         // coverity[autosar_cpp14_m5_2_8_violation]
         score::cpp::span<std::uint8_t> acq_span{static_cast<uint8_t*>(static_cast<void*>(&acq)), sizeof(acq)};
-        std::ignore = std::copy(message.begin(), message.end(), acq_span.begin());
+        //  Clients without a pool send the acquired buffer only, the pool fields then stay zero.
+        std::ignore = std::copy_n(message.begin(), std::min(message.size(), acq_span.size()), acq_span.begin());
         session.session->OnAcquireResponse(acq);
         // enqueue the tick to speed up processing acquire response
         session.EnqueueTickWhileLocked();
@@ -556,6 +865,18 @@ bool MessagePassingServer::SessionHandle::AcquireRequest() const
     return true;
 }
 
+bool MessagePassingServer::SessionHandle::GrantPoolBlock(const std::uint32_t slot) const
+{
+    //  Only sent after an acquire response, thus the sender is already started.
+    if (sender_state_ != score::message_passing::IClientConnection::State::kReady)
+    {
+        return false;
+    }
+    const auto message =
+        score::mw::log::detail::SerializeMessage(DatarouterMessageIdentifier::kPoolBlockGrant, slot);
+    return sender_->Send(message).has_value();
+}
+
 }  // namespace internal
 }  // namespace platform
 }  // namespace score
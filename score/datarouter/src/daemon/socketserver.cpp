@@ -20,6 +20,7 @@
 
 #include "score/datarouter/daemon_communication/session_handle_interface.h"
 #include "score/datarouter/datarouter/data_router.h"
+#include "score/datarouter/datarouter/thread_placement.h"
 #include "score/datarouter/include/applications/datarouter_feature_config.h"
 #include "unix_domain/unix_domain_common.h"
 #include "unix_domain/unix_domain_server.h"
@@ -29,14 +30,20 @@
 #include "score/os/pthread.h"
 #include "score/os/unistd.h"
 #include "score/mw/log/configuration/nvconfig.h"
+#include "score/mw/log/detail/data_router/shared_memory/shared_memory_pool_factory.h"
 #include "score/mw/log/configuration/nvconfigfactory.h"
 
 // Constants
 #include "data_router_cfg.h"
 
 #include <score/math.hpp>
+#include <algorithm>
 #include <functional>
 #include <iostream>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <thread>
 
 namespace score
 {
@@ -56,6 +63,13 @@ constexpr std::uint32_t kStatisticsLogPeriodUs{10000000U};
 constexpr std::uint32_t kDltFlushPeriodUs{100000U};
 constexpr std::uint32_t kThrottleTimeUs{100000U};
 
+//  Pool blocks are only created once granted to a client, and backed by physical memory once the client writes.
+constexpr std::size_t kSharedMemoryPoolBlockSize{512UL * 1024UL};
+constexpr std::uint32_t kSharedMemoryPoolNumberOfBlocks{128UL};
+
+// Upper bound of message passing workers draining client buffers, one per core below this limit, unless configured.
+constexpr std::uint32_t kMaxMessagePassingWorkers{4U};
+
 }  // namespace
 
 void SocketServer::SetThreadName() noexcept
@@ -175,12 +189,30 @@ std::unique_ptr<score::platform::internal::ILogParserFactory> SocketServer::Crea
             {
                 handle_request_map.emplace(std::move(binding.type_name), binding.handler);
             }
-            return std::make_unique<score::platform::internal::LogParser>(
-                nv_config, std::move(global_handlers), std::move(handle_request_map));
+            return std::make_unique<score::platform::internal::LogParser>(nv_config,
+                                                                          std::move(global_handlers),
+                                                                          std::move(handle_request_map),
+                                                                          GetTypeDescriptorCache(nv_config));
         }
 
       private:
+        // the parsers of all sessions share the descriptors of the types registered by the clients
+        std::shared_ptr<score::platform::internal::TypeDescriptorCache> GetTypeDescriptorCache(
+            const score::mw::log::NvConfig& nv_config)
+        {
+            std::lock_guard<std::mutex> lock(type_descriptor_cache_mutex_);
+            if ((type_descriptor_cache_ == nullptr) || (type_descriptor_cache_nv_config_ != &nv_config))
+            {
+                type_descriptor_cache_ = std::make_shared<score::platform::internal::TypeDescriptorCache>(nv_config);
+                type_descriptor_cache_nv_config_ = &nv_config;
+            }
+            return type_descriptor_cache_;
+        }
+
         score::logging::dltserver::DltLogServer& dlt_server_;
+        std::mutex type_descriptor_cache_mutex_{};
+        std::shared_ptr<score::platform::internal::TypeDescriptorCache> type_descriptor_cache_{};
+        const score::mw::log::NvConfig* type_descriptor_cache_nv_config_{nullptr};
     };
 
     return std::make_unique<DltLogParserFactory>(dlt_server);
@@ -273,7 +305,8 @@ std::unique_ptr<MessagePassingServer::ISession> SocketServer::CreateMessagePassi
     const score::mw::log::NvConfig& nv_config,
     const pid_t client_pid,
     const score::mw::log::detail::ConnectMessageFromClient& conn,
-    score::cpp::pmr::unique_ptr<score::platform::internal::daemon::ISessionHandle> handle)
+    score::cpp::pmr::unique_ptr<score::platform::internal::daemon::ISessionHandle> handle,
+    score::mw::log::detail::SharedMemoryPool* shared_memory_pool)
 {
     const auto appid_sv = conn.GetAppId().GetStringView();
     const std::string appid{appid_sv.data(), appid_sv.size()};
@@ -296,7 +329,15 @@ std::unique_ptr<MessagePassingServer::ISession> SocketServer::CreateMessagePassi
     const auto quota_enforcement_enabled = dlt_server.GetQuotaEnforcementEnabled();
     const bool is_dlt_enabled = dlt_server.GetDltEnabled();
     auto source_session = router.NewSourceSession(
-        fd, appid, is_dlt_enabled, std::move(handle), quota, quota_enforcement_enabled, client_pid, nv_config);
+        fd,
+        appid,
+        is_dlt_enabled,
+        std::move(handle),
+        quota,
+        quota_enforcement_enabled,
+        client_pid,
+        nv_config,
+        score::mw::log::detail::ReaderFactory::Default(score::cpp::pmr::get_default_resource(), shared_memory_pool));
     // The reason for banning is, because it's error-prone to use. One should use abstractions e.g. provided by
     // the C++ standard library. But these abstraction do not support exclusive access, which is why we created
     // this abstraction library.
@@ -310,6 +351,22 @@ std::unique_ptr<MessagePassingServer::ISession> SocketServer::CreateMessagePassi
     return source_session;
 }
 
+score::cpp::optional<score::mw::log::detail::SharedMemoryPool> SocketServer::CreateSharedMemoryPool()
+{
+    auto* const memory_resource = score::cpp::pmr::get_default_resource();
+    score::mw::log::detail::SharedMemoryPoolFactory factory{{score::os::Fcntl::Default(memory_resource),
+                                                             score::os::Unistd::Default(memory_resource),
+                                                             score::os::Mman::Default(memory_resource),
+                                                             score::os::Stat::Default(memory_resource)}};
+    auto shared_memory_pool = factory.Create(kSharedMemoryPoolBlockSize, kSharedMemoryPoolNumberOfBlocks);
+    if (!shared_memory_pool.has_value())
+    {
+        std::cerr << "Failed to create shared-memory pool, logging clients are limited to their own buffers"
+                  << std::endl;
+    }
+    return shared_memory_pool;
+}
+
 /*
     RunEventLoop and doWork are integration-level orchestration functions.
     They are tested through integration tests. All individual functions they call
@@ -360,9 +417,38 @@ void SocketServer::DoWork(const std::atomic_bool& exit_requested, const bool no_
         return;
     }
 
+    // shall outlive the router and the servers placing their threads with it
+    const ThreadPlacements thread_placements{dlt_server->GetThreadPlacementConfig()};
+    thread_placements.Apply(score::os::Pthread::instance().self(), "socketserver");
+    std::ignore = dlt_server->StartChannelSenders(&thread_placements);
+
+    // The pool shall outlive the router, as closing sessions release their pool blocks.
+#if defined(SHARED_MEMORY_POOL_ENABLED)
+    auto shared_memory_pool = CreateSharedMemoryPool();
+#else
+    score::cpp::optional<score::mw::log::detail::SharedMemoryPool> shared_memory_pool{};
+#endif
+    auto* const shared_memory_pool_ptr = shared_memory_pool.has_value() ? &shared_memory_pool.value() : nullptr;
+
     // Create data router with log parser factory
     auto log_parser_factory = CreateLogParserFactory(*dlt_server);
-    DataRouter router(stats_logger, std::move(log_parser_factory));
+    // The overall throughput is configured in Mbps, on the same 1024 base as the per application KBps quotas.
+    const double overall_mbps = dlt_server->GetThroughputOverall();
+    const double overall_quota_k_bps = (dlt_server->GetQuotaEnforcementEnabled() && overall_mbps > 0.0)
+                                           ? overall_mbps * 1024.0
+                                           : std::numeric_limits<double>::max();
+    const std::uint32_t configured_worker_count = dlt_server->GetMessagePassingWorkerCount();
+    const std::uint32_t mp_worker_count =
+        (configured_worker_count > 0U) ? configured_worker_count
+                                       : std::clamp(std::thread::hardware_concurrency(), 1U, kMaxMessagePassingWorkers);
+#if defined(PIPELINED_ROUTING_ENABLED)
+    // as many threads parsing and routing the records as there are workers reading the client buffers
+    const std::size_t pipeline_stage_count = mp_worker_count;
+#else
+    const std::size_t pipeline_stage_count = 0U;
+#endif
+    DataRouter router(
+        stats_logger, std::move(log_parser_factory), overall_quota_k_bps, pipeline_stage_count, &thread_placements);
 
     // Create and set enable handler
     const auto enable_handler = CreateEnableHandler(router, *pd, *dlt_server);
@@ -370,17 +456,18 @@ void SocketServer::DoWork(const std::atomic_bool& exit_requested, const bool no_
 
     // Create Unix domain server for config sessions
     auto unix_domain_server = CreateUnixDomainServer(*dlt_server);
+    thread_placements.Apply(unix_domain_server->GetServerThreadHandle(), "server_routine");
 
     // Load NvConfig
     const score::mw::log::NvConfig nv_config = LoadNvConfig(stats_logger);
 
     // Create message passing factory
-    const auto mp_factory = [&router, &dlt_server, &nv_config](
+    const auto mp_factory = [&router, &dlt_server, &nv_config, shared_memory_pool_ptr](
                                 const pid_t client_pid,
                                 const score::mw::log::detail::ConnectMessageFromClient& conn,
                                 score::cpp::pmr::unique_ptr<score::platform::internal::daemon::ISessionHandle> handle) {
         return SocketServer::CreateMessagePassingSession(
-            router, *dlt_server, nv_config, client_pid, conn, std::move(handle));
+            router, *dlt_server, nv_config, client_pid, conn, std::move(handle), shared_memory_pool_ptr);
     };
 
     std::shared_ptr<ServerFactory> server_factory = std::make_shared<ServerFactory>();
@@ -394,7 +481,8 @@ void SocketServer::DoWork(const std::atomic_bool& exit_requested, const bool no_
     - mp_server does not exist inside any lambda.
     */
     // coverity[autosar_cpp14_a5_1_4_violation: FALSE]
-    MessagePassingServer mp_server(mp_factory, std::move(server_factory), std::move(client_factory));
+    MessagePassingServer mp_server(
+        mp_factory, std::move(server_factory), std::move(client_factory), mp_worker_count, &thread_placements);
 
     // Run main event loop
     RunEventLoop(exit_requested, router, *dlt_server, stats_logger);
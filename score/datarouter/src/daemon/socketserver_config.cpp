@@ -26,6 +26,7 @@
 #include <array>
 
 #include <iostream>
+#include <utility>
 
 namespace score
 {
@@ -52,6 +53,115 @@ inline std::string GetStringFromLogLevelT(LoglevelT level)
     return logchannel_operations::GetStringFromLogLevel(static_cast<score::mw::log::LogLevel>(level));
 }
 
+ThreadPlacementConfig ReadThreadPlacement(const rapidjson::Value& json)
+{
+    ThreadPlacementConfig config{};
+    if (json.HasMember("sessionsOnBufferNode"))
+    {
+        config.sessions_on_buffer_node = json["sessionsOnBufferNode"].GetBool();
+    }
+    if (!json.HasMember("threads"))
+    {
+        return config;
+    }
+
+    const auto& threads = json["threads"];
+    for (auto itr = threads.MemberBegin(); itr != threads.MemberEnd(); ++itr)
+    {
+        ThreadPlacement placement{};
+        const auto& thread = itr->value;
+        if (thread.HasMember("cpus"))
+        {
+            for (const auto& cpu : thread["cpus"].GetArray())
+            {
+                placement.cpus.push_back(cpu.GetUint());
+            }
+        }
+        if (thread.HasMember("numaNode"))
+        {
+            placement.numa_node = thread["numaNode"].GetInt();
+        }
+        if (thread.HasMember("policy"))
+        {
+            placement.policy = ParseSchedulingPolicy(thread["policy"].GetString());
+            if (!placement.policy.has_value())
+            {
+                std::cerr << "Unknown scheduling policy " << thread["policy"].GetString() << " of thread "
+                          << itr->name.GetString() << ", the policy is not changed" << std::endl;
+            }
+        }
+        if (thread.HasMember("priority"))
+        {
+            placement.priority = thread["priority"].GetInt();
+        }
+        config.threads.emplace(itr->name.GetString(), std::move(placement));
+    }
+    return config;
+}
+
+score::logging::dltserver::ChannelTransportConfig ReadChannelTransport(const rapidjson::Value& json, const char* name)
+{
+    // sendmmsg() sends at most UIO_MAXIOV messages, IPv4 hosts shall accept datagrams of 576 bytes
+    constexpr std::size_t kMaxVectorCount{1024U};
+    constexpr std::uint32_t kMinMtu{576U};
+    constexpr std::uint32_t kMaxMtu{65535U};
+    // every batch queued to the sender thread holds the buffers of vectorCount datagrams
+    constexpr std::size_t kMaxSenderQueueDepth{256U};
+
+    score::logging::dltserver::ChannelTransportConfig transport{};
+    if (json.HasMember("vectorCount"))
+    {
+        const auto vector_count = static_cast<std::size_t>(json["vectorCount"].GetUint());
+        if ((vector_count > 0U) && (vector_count <= kMaxVectorCount))
+        {
+            transport.vector_count = vector_count;
+        }
+        else
+        {
+            std::cerr << "Invalid vectorCount " << vector_count << " of channel " << name << ", using "
+                      << transport.vector_count << std::endl;
+        }
+    }
+    if (json.HasMember("mtu"))
+    {
+        const auto mtu = json["mtu"].GetUint();
+        if ((mtu >= kMinMtu) && (mtu <= kMaxMtu))
+        {
+            transport.mtu = mtu;
+        }
+        else
+        {
+            std::cerr << "Invalid mtu " << mtu << " of channel " << name << ", using " << transport.mtu << std::endl;
+        }
+    }
+    if (json.HasMember("socketBufferSize"))
+    {
+        transport.send_buffer_size = json["socketBufferSize"].GetInt();
+    }
+    if (json.HasMember("segmentationOffload"))
+    {
+        transport.segmentation_offload = json["segmentationOffload"].GetBool();
+    }
+    if (json.HasMember("ioUring"))
+    {
+        transport.io_uring = json["ioUring"].GetBool();
+    }
+    if (json.HasMember("senderQueueDepth"))
+    {
+        const auto sender_queue_depth = static_cast<std::size_t>(json["senderQueueDepth"].GetUint());
+        if (sender_queue_depth <= kMaxSenderQueueDepth)
+        {
+            transport.sender_queue_depth = sender_queue_depth;
+        }
+        else
+        {
+            std::cerr << "Invalid senderQueueDepth " << sender_queue_depth << " of channel " << name << ", using "
+                      << transport.sender_queue_depth << std::endl;
+        }
+    }
+    return transport;
+}
+
 }  // namespace
 
 score::Result<score::logging::dltserver::StaticConfig> ReadStaticDlt(const char* path)
@@ -111,8 +221,14 @@ score::Result<score::logging::dltserver::StaticConfig> ReadStaticDlt(const char*
             static_cast<uint16_t>(itr->value.HasMember("dstPort") ? itr->value["dstPort"].GetInt() : 3490);
         const auto* const multicast_interface =
             itr->value.HasMember("multicastInterface") ? itr->value["multicastInterface"].GetString() : "";
-        score::logging::dltserver::StaticConfig::ChannelDescription channel{
-            ecu, addr, port, dst_address, dst_port, threshold, multicast_interface};
+        score::logging::dltserver::StaticConfig::ChannelDescription channel{ecu,
+                                                                           addr,
+                                                                           port,
+                                                                           dst_address,
+                                                                           dst_port,
+                                                                           threshold,
+                                                                           multicast_interface,
+                                                                           ReadChannelTransport(itr->value, name)};
         config.channels.emplace(name, std::move(channel));
     }
 
@@ -187,6 +303,26 @@ score::Result<score::logging::dltserver::StaticConfig> ReadStaticDlt(const char*
             config.throughput.applications_kbps.emplace(DltidT(itr1->name.GetString()), itr1->value.GetDouble());
         }
     }
+
+    if (d.HasMember("threadPlacement"))
+    {
+        config.thread_placement = ReadThreadPlacement(d["threadPlacement"]);
+    }
+
+    if (d.HasMember("messagePassingWorkers"))
+    {
+        // every worker is a thread of its own, ticking a share of the sessions
+        constexpr std::uint32_t kMaxMessagePassingWorkerCount{64U};
+        const auto worker_count = d["messagePassingWorkers"].GetUint();
+        if ((worker_count > 0U) && (worker_count <= kMaxMessagePassingWorkerCount))
+        {
+            config.message_passing_worker_count = worker_count;
+        }
+        else
+        {
+            std::cerr << "Invalid messagePassingWorkers " << worker_count << ", using one per core" << std::endl;
+        }
+    }
     return config;
 }
 
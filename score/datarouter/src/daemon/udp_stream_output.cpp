@@ -19,15 +19,46 @@
 
 #include <arpa/inet.h>
 #include <netinet/in.h>
+#include <netinet/udp.h>
 #include <sys/socket.h>
+#include <cstring>
 #include <system_error>
 
+namespace
+{
+/*
+Deviation from Rule A16-0-1:
+- Rule A16-0-1 (required, implementation, automated)
+The pre-processor shall only be used for unconditional and conditional file
+inclusion and include guards, and using the following directives: (1) #ifndef,
+#ifdef, (3) #if, (4) #if defined, (5) #elif, (6) #else, (7) #define, (8) #endif, (9)
+#include.
+Justification:
+- Implementation selection for different OS and respective versions.
+*/
+// coverity[autosar_cpp14_a16_0_1_violation] see above
+#if defined(UDP_SEGMENT)
+constexpr bool kSegmentationOffloadSupported{true};
+constexpr std::int32_t kUdpSegmentOption{UDP_SEGMENT};
+// coverity[autosar_cpp14_a16_0_1_violation] see above
+#else
+// e.g. QNX, where segmentation offload cannot be enabled and the option is never used
+constexpr bool kSegmentationOffloadSupported{false};
+constexpr std::int32_t kUdpSegmentOption{-1};
+// coverity[autosar_cpp14_a16_0_1_violation] see above
+#endif
+}  // namespace
+
 score::logging::dltserver::UdpStreamOutput::UdpStreamOutput(const char* dst_addr,
                                                           uint16_t dst_port,
                                                           const char* multicast_interface,
                                                           std::unique_ptr<score::os::Socket> socket_instance,
                                                           score::os::Vlan& vlan)
-    : socket_{-1}, dst_{}, pthread_{score::os::Pthread::Default()}, socket_instance_{std::move(socket_instance)}
+    : socket_{-1},
+      dst_{},
+      pthread_{score::os::Pthread::Default()},
+      socket_instance_{std::move(socket_instance)},
+      segment_controls_{}
 {
     dst_.sin_family = AF_INET;
     dst_.sin_port = htons(dst_port);
@@ -163,11 +194,46 @@ score::logging::dltserver::UdpStreamOutput::UdpStreamOutput(UdpStreamOutput&& fr
     : socket_{from.socket_},
       dst_{from.dst_},
       pthread_{std::move(from.pthread_)},
-      socket_instance_{std::move(from.socket_instance_)}
+      socket_instance_{std::move(from.socket_instance_)},
+      segment_controls_{std::move(from.segment_controls_)}
 {
     from.socket_ = -1;
 }
 
+score::cpp::expected_blank<score::os::Error> score::logging::dltserver::UdpStreamOutput::SetSendBufferSize(
+    const std::int32_t size) noexcept
+{
+    const auto ret = socket_instance_->setsockopt(socket_, SOL_SOCKET, SO_SNDBUF, &size, sizeof(size));
+    if (!ret.has_value())
+    {
+        const auto error_string = ret.error().ToString();
+        std::cerr << "ERROR: (UDP) socket cannot set buffer size " << size << ": " << error_string << std::endl;
+    }
+    return ret;
+}
+
+score::cpp::expected_blank<score::os::Error> score::logging::dltserver::UdpStreamOutput::EnableSegmentationOffload(
+    const std::size_t max_messages)
+{
+    if (!kSegmentationOffloadSupported)
+    {
+        std::cerr << "ERROR: (UDP) socket cannot offload segmentation: not supported" << std::endl;
+        return score::cpp::make_unexpected(score::os::Error::createFromErrno(ENOPROTOOPT));
+    }
+    // the segment size is set per message, a socket wide size of zero only probes the support of the kernel
+    constexpr std::int32_t kNoSocketSegmentSize = 0;
+    const auto ret = socket_instance_->setsockopt(
+        socket_, SOL_UDP, kUdpSegmentOption, &kNoSocketSegmentSize, sizeof(kNoSocketSegmentSize));
+    if (!ret.has_value())
+    {
+        const auto error_string = ret.error().ToString();
+        std::cerr << "ERROR: (UDP) socket cannot offload segmentation: " << error_string << std::endl;
+        return ret;
+    }
+    segment_controls_.resize(max_messages);
+    return ret;
+}
+
 score::cpp::expected_blank<score::os::Error> score::logging::dltserver::UdpStreamOutput::Bind(const char* src_addr,
                                                                                    uint16_t src_port) noexcept
 {
@@ -222,6 +288,59 @@ score::cpp::expected<std::int32_t, score::os::Error> score::logging::dltserver::
     return ret;
 }
 
+score::cpp::expected<std::int32_t, score::os::Error> score::logging::dltserver::UdpStreamOutput::Send(
+    score::cpp::span<mmsghdr> mmsg,
+    score::cpp::span<const std::uint16_t> segment_sizes) noexcept
+{
+    if ((mmsg.size() > segment_controls_.size()) || (segment_sizes.size() != mmsg.size()))
+    {
+        return score::cpp::make_unexpected(score::os::Error::createFromErrno(EINVAL));
+    }
+    for (std::size_t index = 0U; index < mmsg.size(); ++index)
+    {
+        auto& msg_hdr = mmsg[index].msg_hdr;
+        msg_hdr.msg_name = static_cast<void*>(&dst_);
+        msg_hdr.msg_namelen = sizeof(dst_);
+        msg_hdr.msg_control = nullptr;
+        msg_hdr.msg_controllen = 0UL;
+        const auto segment_size = segment_sizes[index];
+        if (segment_size == 0U)
+        {
+            continue;
+        }
+        auto& control = segment_controls_.at(index);
+        msg_hdr.msg_control = control.data.data();
+        msg_hdr.msg_controllen = control.data.size();
+        // NOLINTBEGIN(cppcoreguidelines-pro-type-cstyle-cast) the cmsg macros are the POSIX interface
+        // coverity[autosar_cpp14_m5_2_8_violation] CMSG_FIRSTHDR casts the control buffer as specified by POSIX
+        cmsghdr* const cmsg = CMSG_FIRSTHDR(&msg_hdr);
+        cmsg->cmsg_level = SOL_UDP;
+        cmsg->cmsg_type = kUdpSegmentOption;
+        cmsg->cmsg_len = CMSG_LEN(sizeof(segment_size));
+        // NOLINTNEXTLINE(score-banned-function) serialization of trivially copyable
+        std::memcpy(CMSG_DATA(cmsg), &segment_size, sizeof(segment_size));
+        // NOLINTEND(cppcoreguidelines-pro-type-cstyle-cast)
+    }
+    const auto ret = socket_instance_->sendmmsg(
+        socket_, mmsg.data(), static_cast<uint32_t>(mmsg.size()), score::os::Socket::MessageFlag::kNone);
+    return ret;
+}
+
+score::cpp::expected_blank<score::os::Error> score::logging::dltserver::UdpStreamOutput::Queue(
+    IUdpSubmissionRing& ring,
+    score::cpp::span<mmsghdr> mmsg,
+    IUdpSubmissionRing::Completion& completion) noexcept
+{
+    for (auto& msg : mmsg)
+    {
+        msg.msg_hdr.msg_name = static_cast<void*>(&dst_);
+        msg.msg_hdr.msg_namelen = sizeof(dst_);
+        msg.msg_hdr.msg_control = nullptr;
+        msg.msg_hdr.msg_controllen = 0UL;
+    }
+    return ring.Queue(socket_, mmsg, completion);
+}
+
 // Used to send single big message:
 score::cpp::expected<std::int64_t, score::os::Error> score::logging::dltserver::UdpStreamOutput::Send(const iovec* iovec_tab,
                                                                                            const size_t size) noexcept
@@ -0,0 +1,356 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include "daemon/udp_submission_ring.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <iostream>
+#include <tuple>
+
+/*
+    Deviation from Rule A16-0-1:
+    - Rule A16-0-1 (required, implementation, automated)
+    The pre-processor shall only be used for unconditional and conditional file
+    inclusion and include guards, and using the following directives: (1) #ifndef,
+    #ifdef, (3) #if, (4) #if defined, (5) #elif, (6) #else, (7) #define, (8) #endif, (9)
+    #include.
+    Justification:
+    - io_uring is only available through Linux specific interfaces, and only where the build enables it.
+*/
+// coverity[autosar_cpp14_a16_0_1_violation]
+#if defined(__linux__) && defined(IO_URING_OUTPUT_ENABLED)
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <cstring>
+// coverity[autosar_cpp14_a16_0_1_violation] see above
+#endif
+
+namespace score
+{
+namespace logging
+{
+namespace dltserver
+{
+
+// coverity[autosar_cpp14_a16_0_1_violation] see above
+#if defined(__linux__) && defined(IO_URING_OUTPUT_ENABLED)
+
+/// The rings shared with the kernel. The submission queue is only written while holding the mutex of the ring, the
+/// kernel consumes it concurrently; the completion queue is written by the kernel and consumed while holding the mutex.
+struct UdpSubmissionRing::Mapping
+{
+    Mapping() = default;
+    Mapping(const Mapping&) = delete;
+    Mapping& operator=(const Mapping&) = delete;
+    Mapping(Mapping&&) = delete;
+    Mapping& operator=(Mapping&&) = delete;
+
+    ~Mapping() noexcept
+    {
+        if (sqes != nullptr)
+        {
+            std::ignore = ::munmap(sqes, sqes_size);
+        }
+        if ((cq_ring != nullptr) && (cq_ring != sq_ring))
+        {
+            std::ignore = ::munmap(cq_ring, cq_ring_size);
+        }
+        if (sq_ring != nullptr)
+        {
+            std::ignore = ::munmap(sq_ring, sq_ring_size);
+        }
+        if (ring_fd >= 0)
+        {
+            std::ignore = ::close(ring_fd);
+        }
+    }
+
+    score::cpp::expected_blank<score::os::Error> Map(const std::uint32_t entries) noexcept
+    {
+        io_uring_params params{};
+        // NOLINTNEXTLINE(score-banned-function): io_uring_setup() has no wrapper
+        ring_fd = static_cast<std::int32_t>(::syscall(__NR_io_uring_setup, entries, &params));
+        if (ring_fd < 0)
+        {
+            return score::cpp::make_unexpected(score::os::Error::createFromErrno(errno));
+        }
+
+        sq_ring_size = params.sq_off.array + (params.sq_entries * sizeof(std::uint32_t));
+        cq_ring_size = params.cq_off.cqes + (params.cq_entries * sizeof(io_uring_cqe));
+        const bool single_mapping = (params.features & IORING_FEAT_SINGLE_MMAP) != 0U;
+        if (single_mapping)
+        {
+            sq_ring_size = std::max(sq_ring_size, cq_ring_size);
+        }
+        sq_ring = MapRegion(sq_ring_size, IORING_OFF_SQ_RING);
+        cq_ring = single_mapping ? sq_ring : MapRegion(cq_ring_size, IORING_OFF_CQ_RING);
+        sqes_size = params.sq_entries * sizeof(io_uring_sqe);
+        sqes = static_cast<io_uring_sqe*>(MapRegion(sqes_size, IORING_OFF_SQES));
+        if ((sq_ring == nullptr) || (cq_ring == nullptr) || (sqes == nullptr))
+        {
+            return score::cpp::make_unexpected(score::os::Error::createFromErrno(errno));
+        }
+
+        sq_head = At<std::uint32_t>(sq_ring, params.sq_off.head);
+        sq_tail = At<std::uint32_t>(sq_ring, params.sq_off.tail);
+        sq_mask = *At<std::uint32_t>(sq_ring, params.sq_off.ring_mask);
+        sq_array = At<std::uint32_t>(sq_ring, params.sq_off.array);
+        sq_entries = params.sq_entries;
+        cq_head = At<std::uint32_t>(cq_ring, params.cq_off.head);
+        cq_tail = At<std::uint32_t>(cq_ring, params.cq_off.tail);
+        cq_mask = *At<std::uint32_t>(cq_ring, params.cq_off.ring_mask);
+        cq_entries = params.cq_entries;
+        cqes = At<io_uring_cqe>(cq_ring, params.cq_off.cqes);
+        return {};
+    }
+
+    std::uint32_t GetFreeEntries() const noexcept
+    {
+        const auto head = __atomic_load_n(sq_head, __ATOMIC_ACQUIRE);
+        return sq_entries - (*sq_tail - head);
+    }
+
+    void PushSendMsg(const std::int32_t socket, const msghdr& message, Completion& completion) noexcept
+    {
+        const auto tail = *sq_tail;
+        const auto index = tail & sq_mask;
+        io_uring_sqe& sqe = sqes[index];
+        // NOLINTNEXTLINE(score-banned-function) the entry is reused, all fields not set below shall be zero
+        std::memset(&sqe, 0, sizeof(sqe));
+        sqe.opcode = IORING_OP_SENDMSG;
+        sqe.fd = socket;
+        sqe.addr = reinterpret_cast<std::uintptr_t>(&message);
+        sqe.len = 1U;
+        sqe.user_data = reinterpret_cast<std::uintptr_t>(&completion);
+        sq_array[index] = index;
+        __atomic_store_n(sq_tail, tail + 1U, __ATOMIC_RELEASE);
+    }
+
+    score::cpp::expected<std::uint32_t, score::os::Error> Enter(const std::uint32_t submit_count,
+                                                                const std::uint32_t wait_count) noexcept
+    {
+        const std::uint32_t flags = (wait_count > 0U) ? IORING_ENTER_GETEVENTS : 0U;
+        // NOLINTNEXTLINE(score-banned-function): io_uring_enter() has no wrapper
+        const auto result = ::syscall(__NR_io_uring_enter, ring_fd, submit_count, wait_count, flags, nullptr, 0UL);
+        if (result < 0)
+        {
+            return score::cpp::make_unexpected(score::os::Error::createFromErrno(errno));
+        }
+        return static_cast<std::uint32_t>(result);
+    }
+
+    std::uint32_t Reap() noexcept
+    {
+        auto head = *cq_head;
+        const auto tail = __atomic_load_n(cq_tail, __ATOMIC_ACQUIRE);
+        std::uint32_t reaped{0U};
+        while (head != tail)
+        {
+            const io_uring_cqe& cqe = cqes[head & cq_mask];
+            // NOLINTNEXTLINE(performance-no-int-to-ptr) the completion queued with the message
+            reinterpret_cast<Completion*>(static_cast<std::uintptr_t>(cqe.user_data))->OnSent(cqe.res);
+            ++head;
+            ++reaped;
+        }
+        __atomic_store_n(cq_head, head, __ATOMIC_RELEASE);
+        return reaped;
+    }
+
+    void* MapRegion(const std::size_t size, const off_t offset) const noexcept
+    {
+        void* const region = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd, offset);
+        return (region == MAP_FAILED) ? nullptr : region;
+    }
+
+    template <typename T>
+    static T* At(void* const region, const std::uint32_t offset) noexcept
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) offsets reported by the kernel
+        return reinterpret_cast<T*>(static_cast<char*>(region) + offset);
+    }
+
+    std::int32_t ring_fd{-1};
+    void* sq_ring{nullptr};
+    std::size_t sq_ring_size{0U};
+    void* cq_ring{nullptr};
+    std::size_t cq_ring_size{0U};
+    io_uring_sqe* sqes{nullptr};
+    std::size_t sqes_size{0U};
+    std::uint32_t* sq_head{nullptr};
+    std::uint32_t* sq_tail{nullptr};
+    std::uint32_t* sq_array{nullptr};
+    std::uint32_t sq_mask{0U};
+    std::uint32_t sq_entries{0U};
+    std::uint32_t* cq_head{nullptr};
+    std::uint32_t* cq_tail{nullptr};
+    std::uint32_t cq_mask{0U};
+    std::uint32_t cq_entries{0U};
+    io_uring_cqe* cqes{nullptr};
+};
+
+// coverity[autosar_cpp14_a16_0_1_violation] see above
+#else
+
+// never set up, Create() fails
+struct UdpSubmissionRing::Mapping
+{
+    score::cpp::expected_blank<score::os::Error> Map(const std::uint32_t) noexcept
+    {
+        return score::cpp::make_unexpected(score::os::Error::createFromErrno(ENOSYS));
+    }
+
+    std::uint32_t GetFreeEntries() const noexcept
+    {
+        return 0U;
+    }
+
+    void PushSendMsg(const std::int32_t, const msghdr&, Completion&) noexcept {}
+
+    score::cpp::expected<std::uint32_t, score::os::Error> Enter(const std::uint32_t, const std::uint32_t) noexcept
+    {
+        return score::cpp::make_unexpected(score::os::Error::createFromErrno(ENOSYS));
+    }
+
+    std::uint32_t Reap() noexcept
+    {
+        return 0U;
+    }
+
+    std::uint32_t sq_entries{0U};
+    std::uint32_t cq_entries{0U};
+};
+
+// coverity[autosar_cpp14_a16_0_1_violation] see above
+#endif
+
+score::cpp::expected<std::unique_ptr<UdpSubmissionRing>, score::os::Error> UdpSubmissionRing::Create(
+    const std::uint32_t entries)
+{
+    auto mapping = std::make_unique<Mapping>();
+    const auto result = mapping->Map(entries);
+    if (!result.has_value())
+    {
+        std::cerr << "ERROR: (UDP) io_uring cannot be set up: " << result.error() << std::endl;
+        return score::cpp::make_unexpected(result.error());
+    }
+    return std::unique_ptr<UdpSubmissionRing>(new UdpSubmissionRing(std::move(mapping)));
+}
+
+UdpSubmissionRing::UdpSubmissionRing(std::unique_ptr<Mapping> mapping) noexcept
+    : IUdpSubmissionRing(), mapping_{std::move(mapping)}, mutex_{}, queued_{0U}, in_flight_{0U}, statistics_{}
+{
+}
+
+UdpSubmissionRing::~UdpSubmissionRing() noexcept
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    while (in_flight_ > 0U)
+    {
+        const auto result = SubmitAndReap(1U);
+        if (!result.has_value() && (result.error().GetOsDependentErrorCode() != EINTR))
+        {
+            std::cerr << "ERROR: (UDP) io_uring cannot complete " << in_flight_ << " messages: " << result.error()
+                      << std::endl;
+            break;
+        }
+    }
+}
+
+score::cpp::expected_blank<score::os::Error> UdpSubmissionRing::Queue(const std::int32_t socket,
+                                                                    score::cpp::span<mmsghdr> messages,
+                                                                    Completion& completion) noexcept
+{
+    const auto count = static_cast<std::uint32_t>(messages.size());
+    if (count > mapping_->sq_entries)
+    {
+        return score::cpp::make_unexpected(score::os::Error::createFromErrno(EMSGSIZE));
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (GetFreeEntries() < count)
+    {
+        std::ignore = SubmitAndReap(0U);
+        if (GetFreeEntries() < count)
+        {
+            return score::cpp::make_unexpected(score::os::Error::createFromErrno(EAGAIN));
+        }
+    }
+    for (auto& message : messages)
+    {
+        mapping_->PushSendMsg(socket, message.msg_hdr, completion);
+    }
+    queued_ += count;
+    in_flight_ += count;
+    // under load the ring is submitted before the next flush
+    if (queued_ >= (mapping_->sq_entries / 2U))
+    {
+        std::ignore = SubmitAndReap(0U);
+    }
+    return {};
+}
+
+score::cpp::expected<std::uint32_t, score::os::Error> UdpSubmissionRing::Submit() noexcept
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return SubmitAndReap(0U);
+}
+
+UdpSubmissionRing::Statistics UdpSubmissionRing::GetStatistics()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return statistics_;
+}
+
+score::cpp::expected<std::uint32_t, score::os::Error> UdpSubmissionRing::SubmitAndReap(
+    const std::uint32_t wait_count) noexcept
+{
+    std::uint32_t submitted{0U};
+    // without messages queued, the completions are reaped without entering the kernel
+    if ((queued_ > 0U) || (wait_count > 0U))
+    {
+        const auto result = mapping_->Enter(queued_, wait_count);
+        ++statistics_.enter_calls;
+        if (!result.has_value())
+        {
+            // the messages stay queued, e.g. on EBUSY while the completion queue overflows, and the next call retries
+            Reap();
+            return result;
+        }
+        submitted = result.value();
+        queued_ -= submitted;
+        statistics_.submitted_messages += submitted;
+    }
+    Reap();
+    return submitted;
+}
+
+void UdpSubmissionRing::Reap() noexcept
+{
+    const auto reaped = mapping_->Reap();
+    in_flight_ -= reaped;
+    statistics_.completed_messages += reaped;
+}
+
+std::uint32_t UdpSubmissionRing::GetFreeEntries() const noexcept
+{
+    // the completions of all messages in flight shall fit into the completion queue
+    return std::min(mapping_->GetFreeEntries(), mapping_->cq_entries - in_flight_);
+}
+
+}  // namespace dltserver
+}  // namespace logging
+}  // namespace score
@@ -16,6 +16,8 @@
 
 #include "static_reflection_with_serialization/serialization/for_logging.h"
 
+#include <memory>
+
 namespace score
 {
 namespace logging
@@ -23,21 +25,55 @@ namespace logging
 namespace dltserver
 {
 
+namespace
+{
+
+namespace dlt_server_logging = ::score::mw::log::detail::log_entry_deserialization;
+using S = ::score::common::visitor::logging_serializer;
+
+}  // namespace
+
 void DltVerboseHandler::Handle(TimestampT timestamp, const char* data, BufsizeT size)
+{
+    // without a state of the session, the routes are memoized for this message only
+    VerboseRoutingState state{};
+    HandleWithState(&state, timestamp, data, size);
+}
+
+std::unique_ptr<LogParser::HandlerState> DltVerboseHandler::CreateState(const TypeInfo& /*type_info*/)
+{
+    return std::make_unique<VerboseRoutingState>();
+}
+
+void DltVerboseHandler::HandleWithState(LogParser::HandlerState* state,
+                                        TimestampT timestamp,
+                                        const char* data,
+                                        BufsizeT size)
 {
     if (!output_.IsOutputEnabled())
     {
         return;
     }
-    namespace dlt_server_logging = ::score::mw::log::detail::log_entry_deserialization;
+    // the state is created by this handler
+    auto* const routing_state = static_cast<VerboseRoutingState*>(state);
+    const auto header = PeekLogEntryHeader(data, size);
+    if (header.has_value())
+    {
+        auto& header_route = routing_state->GetRoute(header->app_id, header->ctx_id);
+        if (!output_.PrefilterVerbose(header_route, header->app_id, header->ctx_id, header->log_level))
+        {
+            return;
+        }
+    }
     using DltDurationT = std::chrono::duration<uint32_t, std::ratio<1, 10000>>;
     uint32_t duration = std::chrono::duration_cast<DltDurationT>(timestamp.time_since_epoch()).count();
     dlt_server_logging::LogEntryDeserializationReflection log_entry_deserialization_reflection;
-    using S = ::score::common::visitor::logging_serializer;
 
     S::deserialize(data, size, log_entry_deserialization_reflection);
 
-    output_.SendVerbose(duration, log_entry_deserialization_reflection);
+    auto& route = routing_state->GetRoute(
+        DltidT{log_entry_deserialization_reflection.app_id}, DltidT{log_entry_deserialization_reflection.ctx_id});
+    output_.SendVerbose(duration, log_entry_deserialization_reflection, route);
 }
 
 }  // namespace dltserver
@@ -14,6 +14,7 @@
 #include "nonverbose_dlt.h"
 
 #include <chrono>
+#include <memory>
 
 namespace score
 {
@@ -41,6 +42,32 @@ void DltNonverboseHandler::Handle(const TypeInfo& type_info, TimestampT timestam
     }
 }
 
+std::unique_ptr<LogParser::HandlerState> DltNonverboseHandler::CreateState(const TypeInfo& type_info)
+{
+    if (type_info.nv_msg_desc == nullptr)
+    {
+        return nullptr;
+    }
+    return std::make_unique<NonVerboseRoutingState>();
+}
+
+void DltNonverboseHandler::HandleWithState(const TypeInfo& type_info,
+                                           LogParser::HandlerState* state,
+                                           TimestampT timestamp,
+                                           const char* data,
+                                           BufsizeT size)
+{
+    if (!output_.IsOutputEnabled())
+    {
+        return;
+    }
+    // the state is only created for types having a descriptor
+    using DltDurationT = std::chrono::duration<uint32_t, std::ratio<1, 10000>>;
+    uint32_t tmsp = std::chrono::duration_cast<DltDurationT>(timestamp.time_since_epoch()).count();
+    output_.SendNonVerbose(
+        *type_info.nv_msg_desc, tmsp, data, size, static_cast<NonVerboseRoutingState*>(state)->GetRoute());
+}
+
 }  // namespace dltserver
 }  // namespace logging
 }  // namespace score
@@ -19,6 +19,7 @@
 #include "score/mw/log/logger.h"
 
 #include "daemon/dlt_log_channel.h"
+#include "daemon/routing_cache.h"
 
 namespace score
 {
@@ -37,6 +38,12 @@ class DltNonverboseHandler : public LogParser::AnyHandler
                                     uint32_t tmsp,
                                     const void* data,
                                     size_t size) = 0;
+        /// Like the overload above, reusing the route memoized for the type while it is valid.
+        virtual void SendNonVerbose(const score::mw::log::config::NvMsgDescriptor& desc,
+                                    uint32_t tmsp,
+                                    const void* data,
+                                    size_t size,
+                                    CachedRoute& route) = 0;
         virtual bool IsOutputEnabled() const noexcept = 0;
 
       protected:
@@ -46,6 +53,14 @@ class DltNonverboseHandler : public LogParser::AnyHandler
 
     virtual void Handle(const TypeInfo& type_info, TimestampT timestamp, const char* data, BufsizeT size) override;
 
+    /// Keeps the route of each non-verbose type, as its app id, ctx id and log level are fixed.
+    std::unique_ptr<LogParser::HandlerState> CreateState(const TypeInfo& type_info) override;
+    void HandleWithState(const TypeInfo& type_info,
+                         LogParser::HandlerState* state,
+                         TimestampT timestamp,
+                         const char* data,
+                         BufsizeT size) override;
+
   private:
     score::mw::log::Logger& logger_;
     IOutput& output_;
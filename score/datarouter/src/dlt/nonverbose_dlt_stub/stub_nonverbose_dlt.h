@@ -15,6 +15,7 @@
 #define STUB_NONVERBOSE_DLT_H
 
 #include "daemon/dlt_log_channel.h"
+#include "daemon/routing_cache.h"
 #include "logparser/logparser.h"
 #include "score/mw/log/configuration/nvconfig.h"
 #include "score/mw/log/logger.h"
@@ -37,6 +38,12 @@ class StubDltNonverboseHandler : public LogParser::AnyHandler
                                     uint32_t tmsp,
                                     const void* data,
                                     size_t size) = 0;
+        /// Like the overload above, reusing the route memoized for the type while it is valid.
+        virtual void SendNonVerbose(const score::mw::log::config::NvMsgDescriptor& desc,
+                                    uint32_t tmsp,
+                                    const void* data,
+                                    size_t size,
+                                    CachedRoute& route) = 0;
         virtual bool IsOutputEnabled() const noexcept = 0;
 
       protected:
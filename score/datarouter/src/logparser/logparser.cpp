@@ -12,46 +12,20 @@
  ********************************************************************************/
 
 #include "logparser/logparser.h"
+#include "score/datarouter/include/daemon/log_entry_header.h"
+#include "score/datarouter/include/daemon/log_entry_deserialization_visitor.h"
 #include "score/mw/log/configuration/nvconfig.h"
 
 #include <algorithm>
-
-#include <iostream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <utility>
 
 #include "static_reflection_with_serialization/serialization/for_logging.h"
 
-// TODO: remove
-namespace
-{
-
-template <typename T>
-inline std::string LoggerUnmemcpy(const std::string& params, T& t)
-{
-    std::copy_n(params.begin(), sizeof(T), score::cpp::bit_cast<char*>(&t));
-    return params.substr(sizeof(T));
-}
-
-void LoggerUnpackString(std::string params, std::string& str)
-{
-    uint32_t size = 0U;
-    params = LoggerUnmemcpy(params, size);
-    // We can't test the False, the size of argument 'params' can't be negative. Suppress.
-    if (size <= params.size())  // LCOV_EXCL_BR_LINE
-    {
-        str = params.substr(0, static_cast<size_t>(size));
-    }
-    else
-    {
-        // LCOV_EXCL_START
-        str.clear();
-        // TODO: remove debug print
-        std::cerr << "!logger_unpack_string: wrong size" << std::endl;
-        // LCOV_EXCL_STOP
-    }
-}
-
-}  // namespace
-
 namespace score
 {
 namespace platform
@@ -61,58 +35,125 @@ namespace internal
 
 LogParser::LogParser(const score::mw::log::INvConfig& nv_config,
                      std::vector<AnyHandler*> global_handlers,
-                     HandleRequestMap handle_request_map)
+                     HandleRequestMap handle_request_map,
+                     std::shared_ptr<TypeDescriptorCache> type_descriptor_cache)
     : ILogParser(),
       handle_request_map_{std::move(handle_request_map)},
+      type_descriptor_cache_{(type_descriptor_cache != nullptr) ? std::move(type_descriptor_cache)
+                                                                : std::make_shared<TypeDescriptorCache>(nv_config)},
       index_parser_map_{},
-      global_handlers_{std::move(global_handlers)},
-      nv_config_(nv_config)
+      dense_index_parsers_{},
+      global_handlers_{std::move(global_handlers)}
 {
 }
 
+LogParser::IndexParser::IndexParser(TypeInfo info, const std::vector<AnyHandler*>& global_handlers)
+    : info_{std::move(info)},
+      handlers_{},
+      number_of_type_handlers_{0U}
+{
+    handlers_.reserve(global_handlers.size());
+    for (auto* const handler : global_handlers)
+    {
+        handlers_.push_back(Handler{nullptr, handler, handler->CreateState(info_)});
+    }
+}
+
 void LogParser::IndexParser::AddHandler(TypeHandler* handler)
 {
-    handlers_.push_back(handler);
+    // the type handlers precede the global ones
+    const auto position = std::next(handlers_.begin(), static_cast<std::ptrdiff_t>(number_of_type_handlers_));
+    std::ignore = handlers_.insert(position, Handler{handler, nullptr, handler->CreateState(info_)});
+    ++number_of_type_handlers_;
 }
 
-void LogParser::IndexParser::Parse(const TimestampT timestamp, const char* const data, const BufsizeT size)
+void LogParser::IndexParser::Parse(const TimestampT timestamp, const char* const data, const BufsizeT size) const
 {
     for (const auto& handler : handlers_)
     {
-        handler->Handle(timestamp, data, size);
+        // the handlers without state are called directly, saving the forwarding call of HandleWithState()
+        if (handler.type_handler != nullptr)
+        {
+            if (handler.state == nullptr)
+            {
+                handler.type_handler->Handle(timestamp, data, size);
+            }
+            else
+            {
+                handler.type_handler->HandleWithState(handler.state.get(), timestamp, data, size);
+            }
+        }
+        else if (handler.state == nullptr)
+        {
+            handler.any_handler->Handle(info_, timestamp, data, size);
+        }
+        else
+        {
+            handler.any_handler->HandleWithState(info_, handler.state.get(), timestamp, data, size);
+        }
+    }
+}
+
+const LogParser::IndexParser* LogParser::FindIndexParser(const BufsizeT map_index) const noexcept
+{
+    if (map_index < dense_index_parsers_.size())
+    {
+        return dense_index_parsers_[map_index];
     }
+    if (map_index < kDenseIndexLimit)
+    {
+        return nullptr;
+    }
+    const auto i_parser = index_parser_map_.find(map_index);
+    return (i_parser != index_parser_map_.end()) ? &i_parser->second : nullptr;
 }
 
 void LogParser::AddIncomingType(const BufsizeT map_index, const std::string& params)
 {
-    // params format: { DltidT versionId{0}; DltidT ecuId; DltidT appId;
-    //     uint32_t typenameLen; char typename[typenameLen];
-    //     [optional, TBD] char payload_format_description[]; }
-    if (params.size() <= 12 + sizeof(uint32_t) || params[0] != 0 || params[1] != 0 || params[2] != 0 || params[3] != 0)
+    RegisterType(map_index, std::string_view{params});
+}
+
+void LogParser::AddIncomingType(const score::mw::log::detail::TypeRegistration& type_registration)
+{
+    const std::string_view params{type_registration.registration_data.data(),
+                                  score::mw::log::detail::GetDataSizeAsLength(type_registration.registration_data)};
+    RegisterType(type_registration.type_id, params);
+}
+
+void LogParser::RegisterType(const BufsizeT map_index, const std::string_view params)
+{
+    // a type registered again keeps its first registration
+    if (FindIndexParser(map_index) != nullptr)
+    {
+        return;
+    }
+
+    auto descriptor = type_descriptor_cache_->Intern(params);
+    if (descriptor == nullptr)
     {
         // TODO: report
         return;
     }
-    DltidT ecu_id{params.substr(4U, 4U)};
-    DltidT app_id{params.substr(8U, 4U)};
-    std::string type_name;
-    LoggerUnpackString(params.substr(12U), type_name);
-
-    IndexParser index_parser{
-        TypeInfo{nv_config_.GetDltMsgDesc(type_name), map_index, params, type_name, ecu_id, app_id}};
-    const auto ith_range = handle_request_map_.equal_range(type_name);
+
+    // the identifiers of the registering client are not part of the shared descriptor
+    const DltidT ecu_id{params.substr(4U, 4U)};
+    const DltidT app_id{params.substr(8U, 4U)};
+    const auto* const nv_msg_desc = descriptor->nv_msg_desc;
+    IndexParser index_parser{TypeInfo{nv_msg_desc, map_index, std::move(descriptor), ecu_id, app_id}, global_handlers_};
+    const auto ith_range = handle_request_map_.equal_range(index_parser.GetDescriptor().type_name);
     for (auto ith = ith_range.first; ith != ith_range.second; ++ith)
     {
         index_parser.AddHandler(ith->second);
     }
-    index_parser_map_.emplace(map_index, std::move(index_parser));
-}
-
-void LogParser::AddIncomingType(const score::mw::log::detail::TypeRegistration& type_registration)
-{
-    std::string params{type_registration.registration_data.data(),
-                       score::mw::log::detail::GetDataSizeAsLength(type_registration.registration_data)};
-    this->AddIncomingType(type_registration.type_id, params);
+    const auto emplaced = index_parser_map_.emplace(map_index, std::move(index_parser));
+    if (map_index < kDenseIndexLimit)
+    {
+        if (map_index >= dense_index_parsers_.size())
+        {
+            dense_index_parsers_.resize(static_cast<std::size_t>(map_index) + 1U, nullptr);
+        }
+        dense_index_parsers_[map_index] = &emplaced.first->second;
+    }
 }
 
 void LogParser::Parse(TimestampT timestamp, const char* data, BufsizeT size)
@@ -136,33 +177,24 @@ void LogParser::Parse(TimestampT timestamp, const char* data, BufsizeT size)
     std::advance(data, sizeof(index));
     size -= static_cast<BufsizeT>(sizeof(index));
 
-    const auto i_parser = index_parser_map_.find(index);
-    if (i_parser == index_parser_map_.end())
+    const IndexParser* const index_parser = FindIndexParser(index);
+    if (index_parser == nullptr)
     {
         // TODO: somehow report inconsistency?
         return;
     }
 
-    auto& index_parser = i_parser->second;
-    index_parser.Parse(timestamp, data, size);
-
-    const auto& type_info = index_parser.info;
-    for (auto* const handler : global_handlers_)
-    {
-        handler->Handle(type_info, timestamp, data, size);
-    }
+    index_parser->Parse(timestamp, data, size);
 }
 
 void LogParser::ParseSharedMemoryRecord(const score::mw::log::detail::SharedMemoryRecord& record)
 {
-    const auto index_parser_entry = index_parser_map_.find(record.header.type_identifier);
-    if (index_parser_entry == index_parser_map_.end())
+    const IndexParser* const index_parser = FindIndexParser(record.header.type_identifier);
+    if (index_parser == nullptr)
     {
         return;
     }
 
-    auto& index_parser = index_parser_entry->second;
-
     const auto payload_length = score::mw::log::detail::GetDataSizeAsLength(record.payload);
 
     // We can't test the True case because:
@@ -179,13 +211,45 @@ void LogParser::ParseSharedMemoryRecord(const score::mw::log::detail::SharedMemo
     const auto payload_length_buf_size = static_cast<BufsizeT>(payload_length);
     auto* const payload_ptr = record.payload.data();
 
-    index_parser.Parse(record.header.time_stamp, payload_ptr, payload_length_buf_size);
+    index_parser->Parse(record.header.time_stamp, payload_ptr, payload_length_buf_size);
+}
+
+std::optional<score::mw::log::LogLevel> LogParser::GetLogLevel(
+    const score::mw::log::detail::SharedMemoryRecord& record) const
+{
+    const IndexParser* const index_parser = FindIndexParser(record.header.type_identifier);
+    if (index_parser == nullptr)
+    {
+        return std::nullopt;
+    }
+
+    const TypeDescriptor& descriptor = index_parser->GetDescriptor();
+    if (descriptor.is_log_entry)
+    {
+        const auto payload_length = score::mw::log::detail::GetDataSizeAsLength(record.payload);
+        if (payload_length > std::numeric_limits<BufsizeT>::max())  // LCOV_EXCL_BR_LINE: see ParseSharedMemoryRecord
+        {
+            return std::nullopt;  // LCOV_EXCL_LINE
+        }
+        // the level is read at its offset, without deserializing the entry
+        const auto header = score::logging::dltserver::PeekLogEntryHeader(record.payload.data(),
+                                                                          static_cast<BufsizeT>(payload_length));
+        if (header.has_value())
+        {
+            return header->log_level;
+        }
+        // the arguments are only referenced by a span, thus this does not copy the payload
+        score::mw::log::detail::log_entry_deserialization::LogEntryDeserializationReflection entry;
+        using S = ::score::common::visitor::logging_serializer;
+        S::deserialize(record.payload.data(), static_cast<BufsizeT>(payload_length), entry);
+        return entry.log_level;
+    }
 
-    const auto& type_info = index_parser.info;
-    for (auto* const handler : global_handlers_)
+    if (descriptor.nv_msg_desc != nullptr)
     {
-        handler->Handle(type_info, record.header.time_stamp, payload_ptr, payload_length_buf_size);
+        return descriptor.nv_msg_desc->GetLogLevel();
     }
+    return std::nullopt;
 }
 
 }  // namespace internal
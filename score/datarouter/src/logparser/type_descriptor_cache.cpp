@@ -0,0 +1,117 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include "logparser/type_descriptor_cache.h"
+#include "score/mw/log/configuration/nvconfig.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace score
+{
+namespace platform
+{
+namespace internal
+{
+
+namespace
+{
+
+// params format: { DltidT versionId{0}; DltidT ecuId; DltidT appId;
+//     uint32_t typenameLen; char typename[typenameLen];
+//     [optional, TBD] char payload_format_description[]; }
+constexpr std::size_t kLayoutOffset{12U};
+
+}  // namespace
+
+TypeDescriptorCache::TypeDescriptorCache(const score::mw::log::INvConfig& nv_config,
+                                         const std::chrono::steady_clock::duration grace_period) noexcept
+    : nv_config_{nv_config}, grace_period_{grace_period}, mutex_{}, entries_{}, next_drop_{}
+{
+}
+
+std::shared_ptr<const TypeDescriptor> TypeDescriptorCache::Intern(const std::string_view params)
+{
+    if (params.size() <= kLayoutOffset + sizeof(uint32_t) || params[0] != 0 || params[1] != 0 || params[2] != 0 ||
+        params[3] != 0)
+    {
+        // TODO: report
+        return nullptr;
+    }
+    const std::string_view layout = params.substr(kLayoutOffset);
+    uint32_t type_name_size = 0U;
+    std::copy_n(layout.begin(), sizeof(type_name_size), score::cpp::bit_cast<char*>(&type_name_size));
+    if (type_name_size > layout.size() - sizeof(type_name_size))
+    {
+        return nullptr;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    const auto now = std::chrono::steady_clock::now();
+    if (now >= next_drop_)
+    {
+        DropUnused(now);
+        next_drop_ = now + grace_period_;
+    }
+
+    const auto entry = entries_.find(layout);
+    if (entry != entries_.end())
+    {
+        entry->second.unused_since = {};
+        return entry->second.descriptor;
+    }
+
+    std::string type_name{layout.substr(sizeof(type_name_size), static_cast<std::size_t>(type_name_size))};
+    const auto* const nv_msg_desc = nv_config_.GetDltMsgDesc(type_name);
+    const bool is_log_entry = (type_name == "score::mw::log::detail::LogEntry");
+    auto descriptor = std::make_shared<const TypeDescriptor>(
+        TypeDescriptor{std::string{layout}, std::move(type_name), nv_msg_desc, is_log_entry});
+    std::ignore = entries_.emplace(std::string_view{descriptor->layout}, Entry{descriptor, {}});
+    return descriptor;
+}
+
+std::size_t TypeDescriptorCache::GetSize() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return entries_.size();
+}
+
+void TypeDescriptorCache::DropUnused(const std::chrono::steady_clock::time_point now)
+{
+    for (auto entry = entries_.begin(); entry != entries_.end();)
+    {
+        // parsers only take references from the cache while it is locked, thus an unused descriptor stays unused
+        if (entry->second.descriptor.use_count() > 1)
+        {
+            entry->second.unused_since = {};
+            ++entry;
+            continue;
+        }
+        if (entry->second.unused_since == std::chrono::steady_clock::time_point{})
+        {
+            entry->second.unused_since = now;
+        }
+        if (now - entry->second.unused_since >= grace_period_)
+        {
+            entry = entries_.erase(entry);
+        }
+        else
+        {
+            ++entry;
+        }
+    }
+}
+
+}  // namespace internal
+}  // namespace platform
+}  // namespace score
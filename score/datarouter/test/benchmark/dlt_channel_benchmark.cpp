@@ -0,0 +1,294 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+/// Sends verbose messages through a DltLogChannel to a receiver on the loopback interface and reports the rate of
+/// messages and the CPU time the sending thread spends per message, i.e. the cost of batching and sending them.
+/// The rates are reported for the messages delivered to the receiver, as a sender queue, which cannot keep up with the
+/// sending thread on a single CPU, drops batches; the dropped batches and their messages are reported separately.
+/// Interleaved, every other message is a non-verbose one, as sent by a process mixing TRACE and LogStream calls.
+/// With a sender queue, the batches are sent by the sender thread of the channel, whose CPU time is not included.
+/// With io_uring, the batches are queued on a submission ring instead, which is submitted when half full and after the
+/// flush; the number of io_uring_enter() calls is reported against the datagrams.
+/// With mixed sizes, the payloads cycle through sizes from 16 to 180 bytes instead of all having 64 bytes. Then the
+/// segments of a datagram rarely have the same size, which limits segmentation offload to about two per datagram.
+///
+/// Usage: dlt_channel_benchmark [number of messages] [mtu] [vector count] [segmentation offload: 0 or 1]
+///                              [interleaved: 0 or 1] [sender queue depth] [io_uring: 0 or 1] [mixed sizes: 0 or 1]
+
+#include "daemon/dlt_log_channel.h"
+#include "daemon/udp_submission_ring.h"
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <ctime>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace
+{
+
+using score::logging::dltserver::ChannelTransportConfig;
+using score::logging::dltserver::DltLogChannel;
+using score::logging::dltserver::UdpSubmissionRing;
+using LogEntry = score::mw::log::detail::log_entry_deserialization::LogEntryDeserializationReflection;
+
+constexpr std::uint16_t kSourcePort{53491U};
+constexpr std::uint16_t kDestinationPort{53490U};
+constexpr std::size_t kPayloadSize{64UL};
+// about the same average size as kPayloadSize
+constexpr std::array<std::size_t, 5UL> kMixedPayloadSizes{16UL, 40UL, 64UL, 100UL, 180UL};
+constexpr std::size_t kDefaultNumberOfMessages{1000000UL};
+constexpr std::int32_t kReceiveBufferSize{16 * 1024 * 1024};
+constexpr std::uint32_t kSubmissionRingEntries{1024U};
+
+std::chrono::nanoseconds GetThreadCpuTime()
+{
+    timespec time{};
+    std::ignore = clock_gettime(CLOCK_THREAD_CPUTIME_ID, &time);
+    return std::chrono::seconds{time.tv_sec} + std::chrono::nanoseconds{time.tv_nsec};
+}
+
+/// Counts the datagrams arriving on the loopback interface, until none arrived for a while after Stop().
+class Receiver
+{
+  public:
+    Receiver()
+        : socket_{::socket(AF_INET, SOCK_DGRAM, 0)},
+          stopped_{false},
+          datagrams_{0UL},
+          bytes_{0UL},
+          messages_{0UL},
+          thread_{}
+    {
+        sockaddr_in address{};
+        address.sin_family = AF_INET;
+        address.sin_port = htons(kDestinationPort);
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        constexpr timeval kReceiveTimeout{0, 100000};
+        std::ignore = ::setsockopt(socket_, SOL_SOCKET, SO_RCVBUF, &kReceiveBufferSize, sizeof(kReceiveBufferSize));
+        std::ignore = ::setsockopt(socket_, SOL_SOCKET, SO_RCVTIMEO, &kReceiveTimeout, sizeof(kReceiveTimeout));
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) POSIX socket address
+        if ((socket_ < 0) || (::bind(socket_, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0))
+        {
+            std::cerr << "Receiver: cannot bind the loopback port " << kDestinationPort << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
+        thread_ = std::thread([this]() {
+            Receive();
+        });
+    }
+
+    Receiver(const Receiver&) = delete;
+    Receiver& operator=(const Receiver&) = delete;
+    Receiver(Receiver&&) = delete;
+    Receiver& operator=(Receiver&&) = delete;
+
+    ~Receiver()
+    {
+        Stop();
+        std::ignore = ::close(socket_);
+    }
+
+    void Stop()
+    {
+        stopped_ = true;
+        if (thread_.joinable())
+        {
+            thread_.join();
+        }
+    }
+
+    std::size_t GetDatagrams() const
+    {
+        return datagrams_;
+    }
+
+    std::size_t GetBytes() const
+    {
+        return bytes_;
+    }
+
+    std::size_t GetMessages() const
+    {
+        return messages_;
+    }
+
+  private:
+    /// Counts the DLT messages of a datagram, following the lengths in their standard headers.
+    static std::size_t CountMessages(const std::array<std::uint8_t, 65536UL>& buffer, const std::size_t size)
+    {
+        constexpr std::size_t kLengthOffset{2UL};
+        std::size_t count{0UL};
+        std::size_t offset{0UL};
+        while ((offset + kLengthOffset + 2UL) <= size)
+        {
+            const std::size_t length = (static_cast<std::size_t>(buffer.at(offset + kLengthOffset)) << 8U) |
+                                       static_cast<std::size_t>(buffer.at(offset + kLengthOffset + 1UL));
+            if (length == 0UL)
+            {
+                break;
+            }
+            ++count;
+            offset += length;
+        }
+        return count;
+    }
+
+    void Receive()
+    {
+        std::array<std::uint8_t, 65536UL> buffer{};
+        while (true)
+        {
+            const auto size = ::recv(socket_, buffer.data(), buffer.size(), 0);
+            if (size > 0)
+            {
+                ++datagrams_;
+                bytes_ += static_cast<std::size_t>(size);
+                messages_ += CountMessages(buffer, static_cast<std::size_t>(size));
+            }
+            else if (stopped_)
+            {
+                return;
+            }
+        }
+    }
+
+    int socket_;
+    std::atomic<bool> stopped_;
+    std::atomic<std::size_t> datagrams_;
+    std::atomic<std::size_t> bytes_;
+    std::atomic<std::size_t> messages_;
+    std::thread thread_;
+};
+
+}  // namespace
+
+int main(int argc, const char* argv[])
+{
+    const std::size_t number_of_messages =
+        (argc > 1) ? static_cast<std::size_t>(std::strtoul(argv[1], nullptr, 10)) : kDefaultNumberOfMessages;
+    ChannelTransportConfig transport{};
+    transport.mtu = (argc > 2) ? static_cast<std::uint32_t>(std::strtoul(argv[2], nullptr, 10)) : transport.mtu;
+    transport.vector_count =
+        (argc > 3) ? static_cast<std::size_t>(std::strtoul(argv[3], nullptr, 10)) : transport.vector_count;
+    transport.segmentation_offload = (argc > 4) && (std::strtoul(argv[4], nullptr, 10) != 0UL);
+    transport.send_buffer_size = kReceiveBufferSize;
+    const bool interleaved = (argc > 5) && (std::strtoul(argv[5], nullptr, 10) != 0UL);
+    transport.sender_queue_depth =
+        (argc > 6) ? static_cast<std::size_t>(std::strtoul(argv[6], nullptr, 10)) : transport.sender_queue_depth;
+    transport.io_uring = (argc > 7) && (std::strtoul(argv[7], nullptr, 10) != 0UL);
+    const bool mixed_sizes = (argc > 8) && (std::strtoul(argv[8], nullptr, 10) != 0UL);
+
+    Receiver receiver{};
+    DltLogChannel channel{score::platform::DltidT{"BNCH"},
+                          score::mw::log::LogLevel::kVerbose,
+                          score::platform::DltidT{"ECU1"},
+                          "127.0.0.1",
+                          kSourcePort,
+                          "127.0.0.1",
+                          kDestinationPort,
+                          "",
+                          transport};
+    // destroyed before the channel, completing the datagrams in flight
+    std::unique_ptr<UdpSubmissionRing> ring{};
+    if (transport.io_uring)
+    {
+        auto created = UdpSubmissionRing::Create(kSubmissionRingEntries);
+        if (created.has_value() && channel.AttachSubmissionRing(*created.value()))
+        {
+            ring = std::move(created.value());
+        }
+        else
+        {
+            transport.io_uring = false;
+        }
+    }
+    if (ring == nullptr)
+    {
+        std::ignore = channel.StartSender("dlt_tx_0");
+    }
+
+    const std::vector<std::size_t> payload_sizes =
+        mixed_sizes ? std::vector<std::size_t>(kMixedPayloadSizes.begin(), kMixedPayloadSizes.end())
+                    : std::vector<std::size_t>{kPayloadSize};
+    const std::vector<std::uint8_t> payload(*std::max_element(payload_sizes.begin(), payload_sizes.end()),
+                                            std::uint8_t{0x5AU});
+    std::vector<LogEntry> entries{};
+    for (const auto payload_size : payload_sizes)
+    {
+        entries.push_back(LogEntry{score::mw::log::detail::LoggingIdentifier{"APP1"},
+                                   score::mw::log::detail::LoggingIdentifier{"CTX1"},
+                                   {score::cpp::span<const std::uint8_t>{payload.data(), payload_size}},
+                                   1,
+                                   score::mw::log::LogLevel::kInfo});
+    }
+    const score::mw::log::config::NvMsgDescriptor descriptor{1234U,
+                                                             score::mw::log::detail::LoggingIdentifier{"APP1"},
+                                                             score::mw::log::detail::LoggingIdentifier{"CTX1"},
+                                                             score::mw::log::LogLevel::kInfo};
+
+    const auto start = std::chrono::steady_clock::now();
+    const auto cpu_start = GetThreadCpuTime();
+    for (std::size_t message = 0UL; message < number_of_messages; ++message)
+    {
+        const std::size_t size_index = message % payload_sizes.size();
+        if (interleaved && ((message % 2UL) != 0UL))
+        {
+            channel.SendNonVerbose(
+                descriptor, static_cast<std::uint32_t>(message), payload.data(), payload_sizes[size_index]);
+        }
+        else
+        {
+            channel.SendVerbose(static_cast<std::uint32_t>(message), entries[size_index]);
+        }
+    }
+    channel.Flush();
+    while ((ring != nullptr) && (channel.GetSenderQueueStatistics().depth > 0UL))
+    {
+        std::ignore = ring->Submit();
+    }
+    const auto cpu_time = GetThreadCpuTime() - cpu_start;
+    const auto duration = std::chrono::steady_clock::now() - start;
+    const auto sender_statistics = channel.GetSenderQueueStatistics();
+    const auto ring_statistics = (ring != nullptr) ? ring->GetStatistics() : UdpSubmissionRing::Statistics{};
+    receiver.Stop();
+
+    const auto nanoseconds = std::max(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count(), 1L);
+    const auto cpu_nanoseconds = std::max(cpu_time.count(), 1L);
+    const auto delivered_messages = static_cast<double>(receiver.GetMessages());
+    std::cout << "sent " << number_of_messages << " messages (mtu " << transport.mtu << ", vector count "
+              << transport.vector_count << ", segmentation offload " << transport.segmentation_offload
+              << ", interleaved " << interleaved << ", sender queue depth " << transport.sender_queue_depth
+              << ", io_uring " << transport.io_uring << ", mixed sizes " << mixed_sizes << ") in "
+              << (nanoseconds / 1000000) << " ms; delivered " << receiver.GetMessages() << " messages in "
+              << receiver.GetDatagrams() << " datagrams of " << receiver.GetBytes()
+              << " bytes: " << (delivered_messages * 1e9 / static_cast<double>(nanoseconds)) << " messages/s, "
+              << (delivered_messages * 1e9 / static_cast<double>(cpu_nanoseconds))
+              << " messages per CPU second; sender queue high watermark " << sender_statistics.high_watermark
+              << ", dropped " << sender_statistics.dropped_batches << " batches of "
+              << sender_statistics.dropped_messages << " messages; " << ring_statistics.enter_calls
+              << " io_uring_enter() calls submitted " << ring_statistics.submitted_messages << " datagrams"
+              << std::endl;
+    return EXIT_SUCCESS;
+}
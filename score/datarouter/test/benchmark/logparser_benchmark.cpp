@@ -0,0 +1,252 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+/// Replays a block recorded from the shared memory of a logging client through the LogParser and reports the time
+/// spent per record, i.e. the type lookup and the dispatch to the handlers.
+///
+/// Usage: logparser_benchmark [number of replays]
+
+#include "logparser/logparser.h"
+
+#include "score/mw/log/configuration/nvconfigfactory.h"
+#include "score/mw/log/detail/data_router/shared_memory/shared_memory_reader.h"
+#include "score/mw/log/detail/data_router/shared_memory/shared_memory_writer.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+using score::mw::log::detail::Byte;
+using score::mw::log::detail::SharedMemoryRecord;
+using score::mw::log::detail::TypeIdentifier;
+using score::mw::log::detail::TypeRegistration;
+using score::platform::BufsizeT;
+using score::platform::TimestampT;
+using score::platform::TypeInfo;
+using score::platform::internal::LogParser;
+
+constexpr std::size_t kLinearBufferSize{1024UL * 1024UL};
+constexpr std::size_t kNumberOfTypes{48UL};
+constexpr std::size_t kNumberOfRecords{8192UL};
+constexpr std::size_t kPayloadSize{96UL};
+constexpr std::size_t kDefaultNumberOfReplays{200UL};
+
+/// Registration data as sent by the clients: { version, ecu id, app id, type name length, type name }.
+class RegistrationData
+{
+  public:
+    explicit RegistrationData(const std::string& type_name) : data_{std::string(4UL, '\0') + "ECU1" + "APP1"}
+    {
+        const auto type_name_size = static_cast<std::uint32_t>(type_name.size());
+        std::string type_name_size_bytes(sizeof(type_name_size), '\0');
+        // NOLINTNEXTLINE(score-banned-function) serialization of trivially copyable
+        std::memcpy(type_name_size_bytes.data(), &type_name_size, sizeof(type_name_size));
+        data_ += type_name_size_bytes + type_name;
+    }
+
+    std::size_t size() const
+    {
+        return data_.size();
+    }
+
+    void Copy(const score::cpp::span<Byte> data) const
+    {
+        // NOLINTNEXTLINE(score-banned-function) copy into the shared memory
+        std::memcpy(data.data(), data_.data(), data_.size());
+    }
+
+  private:
+    std::string data_;
+};
+
+class CountingTypeHandler : public LogParser::TypeHandler
+{
+  public:
+    void Handle(TimestampT /*timestamp*/, const char* data, BufsizeT size) override
+    {
+        checksum_ += static_cast<std::uint64_t>(size) + static_cast<std::uint8_t>(*data);
+    }
+
+    std::uint64_t GetChecksum() const
+    {
+        return checksum_;
+    }
+
+  private:
+    std::uint64_t checksum_{0UL};
+};
+
+class CountingAnyHandler : public LogParser::AnyHandler
+{
+  public:
+    void Handle(const TypeInfo& type_info, TimestampT /*timestamp*/, const char* /*data*/, BufsizeT size) override
+    {
+        checksum_ += static_cast<std::uint64_t>(size) + type_info.id;
+    }
+
+    std::uint64_t GetChecksum() const
+    {
+        return checksum_;
+    }
+
+  private:
+    std::uint64_t checksum_{0UL};
+};
+
+std::string GetTypeName(const std::size_t type_index)
+{
+    return "benchmark::RecordType" + std::to_string(type_index);
+}
+
+/// The type registrations and records read from one linear buffer of a client. The records reference the buffer.
+class RecordedBlock
+{
+  public:
+    RecordedBlock() : shared_data_{}, buffers_{}, registrations_{}, records_{}
+    {
+        buffers_.at(0U).resize(kLinearBufferSize);
+        buffers_.at(1U).resize(kLinearBufferSize);
+        std::ignore = score::mw::log::detail::InitializeSharedData(shared_data_);
+        shared_data_.control_block.control_block_even.data = GetBuffer(0U);
+        shared_data_.control_block.control_block_odd.data = GetBuffer(1U);
+    }
+
+    void Record()
+    {
+        score::mw::log::detail::SharedMemoryWriter writer{shared_data_, score::mw::log::detail::UnmapCallback{}};
+        std::vector<TypeIdentifier> type_ids{};
+        for (std::size_t type_index = 0UL; type_index < kNumberOfTypes; ++type_index)
+        {
+            const auto type_id = writer.TryRegisterType(RegistrationData{GetTypeName(type_index)});
+            if (!type_id.has_value())
+            {
+                std::cerr << "RecordedBlock: type registration failed" << std::endl;
+                std::exit(EXIT_FAILURE);
+            }
+            type_ids.push_back(type_id.value());
+        }
+        // a few types are traced much more often than the others, as in a typical application
+        for (std::size_t record_index = 0UL; record_index < kNumberOfRecords; ++record_index)
+        {
+            const std::size_t type_index =
+                ((record_index % 4UL) != 0UL) ? (record_index % 4UL) : (record_index % kNumberOfTypes);
+            writer.AllocAndWrite(
+                [record_index](auto payload) noexcept {
+                    std::fill(payload.begin(), payload.end(), static_cast<Byte>(record_index));
+                },
+                type_ids.at(type_index),
+                kPayloadSize);
+        }
+
+        score::mw::log::detail::SharedMemoryReader reader{
+            shared_data_,
+            score::mw::log::detail::AlternatingReadOnlyReader{shared_data_.control_block, GetBuffer(0U), GetBuffer(1U)},
+            score::mw::log::detail::UnmapCallback{}};
+        const auto acquire_result = writer.ReadAcquire();
+        while (!reader.IsBlockReleasedByWriters(acquire_result.acquired_buffer))
+        {
+        }
+        std::ignore = reader.NotifyAcquisitionSetReader(acquire_result);
+        std::ignore = reader.Read(
+            [this](const TypeRegistration& registration) noexcept {
+                const std::string data{registration.registration_data.data(),
+                                       score::mw::log::detail::GetDataSizeAsLength(registration.registration_data)};
+                registrations_.emplace_back(registration.type_id, data);
+            },
+            [this](const SharedMemoryRecord& record) noexcept {
+                records_.push_back(record);
+            });
+    }
+
+    const std::vector<std::pair<BufsizeT, std::string>>& GetRegistrations() const
+    {
+        return registrations_;
+    }
+
+    const std::vector<SharedMemoryRecord>& GetRecords() const
+    {
+        return records_;
+    }
+
+  private:
+    score::cpp::span<Byte> GetBuffer(const std::size_t index)
+    {
+        return score::cpp::span<Byte>{buffers_.at(index).data(), buffers_.at(index).size()};
+    }
+
+    score::mw::log::detail::SharedData shared_data_;
+    std::array<std::vector<Byte>, 2U> buffers_;
+    std::vector<std::pair<BufsizeT, std::string>> registrations_;
+    std::vector<SharedMemoryRecord> records_;
+};
+
+}  // namespace
+
+int main(int argc, const char* argv[])
+{
+    const std::size_t number_of_replays =
+        (argc > 1) ? static_cast<std::size_t>(std::strtoul(argv[1], nullptr, 10)) : kDefaultNumberOfReplays;
+
+    RecordedBlock block{};
+    block.Record();
+    if (block.GetRecords().size() != kNumberOfRecords)
+    {
+        std::cerr << "logparser_benchmark: recorded " << block.GetRecords().size() << " of " << kNumberOfRecords
+                  << " records" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    const auto nv_config = score::mw::log::NvConfigFactory::CreateEmpty();
+    CountingTypeHandler type_handler{};
+    CountingAnyHandler any_handler{};
+    LogParser::HandleRequestMap handle_request_map{};
+    for (std::size_t type_index = 0UL; type_index < kNumberOfTypes; ++type_index)
+    {
+        handle_request_map.emplace(GetTypeName(type_index), &type_handler);
+    }
+    LogParser parser{nv_config, {&any_handler}, std::move(handle_request_map)};
+    for (const auto& registration : block.GetRegistrations())
+    {
+        parser.AddIncomingType(registration.first, registration.second);
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    for (std::size_t replay = 0UL; replay < number_of_replays; ++replay)
+    {
+        for (const auto& record : block.GetRecords())
+        {
+            parser.ParseSharedMemoryRecord(record);
+        }
+    }
+    const auto duration = std::chrono::steady_clock::now() - start;
+
+    const auto number_of_records = number_of_replays * block.GetRecords().size();
+    const auto nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+    std::cout << "replayed " << number_of_records << " records of " << kNumberOfTypes << " types in "
+              << (nanoseconds / 1000000) << " ms, "
+              << (static_cast<double>(nanoseconds) / static_cast<double>(std::max(number_of_records, std::size_t{1U})))
+              << " ns per record (checksum " << (type_handler.GetChecksum() + any_handler.GetChecksum()) << ")"
+              << std::endl;
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,82 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include "score/datarouter/include/daemon/broadcast_body_pool.h"
+
+#include "gtest/gtest.h"
+
+#include <iterator>
+
+namespace score
+{
+namespace logging
+{
+namespace dltserver
+{
+namespace
+{
+
+constexpr std::size_t kBlockSize{64UL};
+
+TEST(BroadcastBodyPoolTest, BodiesAreAllocatedBehindEachOtherInTheirBlock)
+{
+    BroadcastBodyPool pool{kBlockSize};
+
+    const auto first = pool.Allocate(16UL);
+    const auto second = pool.Allocate(16UL);
+
+    EXPECT_EQ(first.block, second.block);
+    EXPECT_EQ(second.data, std::next(first.data, 16));
+    EXPECT_EQ(pool.GetBlockCount(), 1UL);
+    first.block->Release();
+    second.block->Release();
+}
+
+TEST(BroadcastBodyPoolTest, AHeldBlockIsNotReused)
+{
+    BroadcastBodyPool pool{kBlockSize};
+    const auto first = pool.Allocate(kBlockSize);
+    // a channel still references the body
+    first.block->Hold();
+    first.block->Release();
+
+    const auto second = pool.Allocate(kBlockSize);
+    second.block->Release();
+    EXPECT_NE(second.block, first.block);
+
+    // once the channel sent the body, its block is reused
+    first.block->Release();
+    const auto third = pool.Allocate(kBlockSize);
+    third.block->Release();
+
+    EXPECT_EQ(third.block, first.block);
+    EXPECT_EQ(pool.GetBlockCount(), 2UL);
+}
+
+TEST(BroadcastBodyPoolTest, BlocksReleasedByAllHoldersAreReusedWithoutGrowing)
+{
+    BroadcastBodyPool pool{kBlockSize};
+
+    for (std::size_t index = 0UL; index < 100UL; ++index)
+    {
+        const auto body = pool.Allocate(kBlockSize / 2UL);
+        body.block->Release();
+    }
+
+    EXPECT_EQ(pool.GetBlockCount(), 2UL);
+}
+
+}  // namespace
+}  // namespace dltserver
+}  // namespace logging
+}  // namespace score
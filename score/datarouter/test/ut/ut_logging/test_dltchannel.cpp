@@ -14,7 +14,12 @@
 #include "daemon/dlt_log_channel.h"
 #include "daemon/udp_stream_output.h"
 
+#include <algorithm>
+#include <cstring>
+#include <future>
 #include <sstream>
+#include <thread>
+#include <vector>
 
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
@@ -160,6 +165,116 @@ TEST_F(DltChannelTest, WhenSendingVerboseTwice)
     dlt_channel.ShowStats(logger);
 }
 
+TEST_F(DltChannelTest, WhenVerboseMessagesArePrefilteredNothingIsSent)
+{
+    testing::StrictMock<UdpStreamOutput::Tester> outputs;
+    UdpStreamOutput::Tester::Instance() = &outputs;
+
+    EXPECT_CALL(outputs, construct(_, nullptr, 3490U, Eq(std::string("")))).Times(1);
+    EXPECT_CALL(outputs, Bind(_, nullptr, 3491U)).Times(1);
+    EXPECT_CALL(outputs, Destruct(_)).Times(1);
+    EXPECT_CALL(outputs, Send(_, A<score::cpp::span<mmsghdr>>())).Times(0);
+
+    DltLogChannel dlt_channel(
+        DltidT{"CHN0"}, score::mw::log::LogLevel::kOff, DltidT{"ECU0"}, nullptr, 3491U, nullptr, 3490U, "");
+
+    dlt_channel.CountPrefilteredVerbose();
+    dlt_channel.CountPrefilteredVerbose();
+    dlt_channel.Flush();
+
+    Logger logger;
+    dlt_channel.ShowStats(logger);
+}
+
+TEST_F(DltChannelTest, WhenSendingEncodedVerboseTheDatagramReferencesItsBody)
+{
+    testing::StrictMock<UdpStreamOutput::Tester> outputs;
+    UdpStreamOutput::Tester::Instance() = &outputs;
+
+    std::vector<char> body(GetVerboseBodySize(verbose_entry1_));
+    ConstructVerboseBody(body.data(), verbose_entry1_);
+    const DltEncodedMessage message{score::cpp::span<const char>{body.data(), body.size()},
+                                    2U,
+                                    verbose_entry1_.log_level,
+                                    true,
+                                    0U,
+                                    msg1_.size()};
+    // the packets the channel constructs itself, around the one referencing the body
+    std::array<char, sizeof(DltVerboseHeader) + 8> packet{};
+    std::string expected_data{};
+    ConstructVerbosePacket(packet.data(), verbose_entry2_, DltidT{"ECU0"}, 0U, 1U);
+    expected_data.append(packet.data(), packet.size());
+    ConstructVerbosePacket(packet.data(), verbose_entry1_, DltidT{"ECU0"}, 1U, 2U);
+    expected_data.append(packet.data(), packet.size());
+    ConstructVerbosePacket(packet.data(), verbose_entry2_, DltidT{"ECU0"}, 2U, 3U);
+    expected_data.append(packet.data(), packet.size());
+
+    EXPECT_CALL(outputs, construct(_, nullptr, 3490U, Eq(std::string("")))).Times(1);
+    EXPECT_CALL(outputs, Bind(_, nullptr, 3491U)).Times(1);
+    EXPECT_CALL(outputs, Destruct(_)).Times(1);
+    EXPECT_CALL(outputs, Send(_, A<score::cpp::span<mmsghdr>>()))
+        .WillOnce(DoAll(Invoke([&body, &expected_data](UdpStreamOutput*, score::cpp::span<mmsghdr> data_span) {
+                            ASSERT_EQ(data_span.size(), 1);
+                            const auto& msg_hdr = data_span.front().msg_hdr;
+                            // the run of the first packet and the header, the body, the run of the last packet
+                            ASSERT_EQ(msg_hdr.msg_iovlen, 3);
+                            EXPECT_EQ(msg_hdr.msg_iov[1].iov_base, body.data());
+                            std::string data{};
+                            for (std::size_t index = 0U; index < msg_hdr.msg_iovlen; ++index)
+                            {
+                                data.append(static_cast<const char*>(msg_hdr.msg_iov[index].iov_base),
+                                            msg_hdr.msg_iov[index].iov_len);
+                            }
+                            EXPECT_EQ(data, expected_data);
+                        }),
+                        Return(1)));
+
+    DltLogChannel dlt_channel(
+        DltidT{"CHN0"}, score::mw::log::LogLevel::kOff, DltidT{"ECU0"}, nullptr, 3491U, nullptr, 3490U, "");
+
+    dlt_channel.SendVerbose(1U, verbose_entry2_);
+    dlt_channel.SendEncoded(message);
+    dlt_channel.SendVerbose(3U, verbose_entry2_);
+    dlt_channel.Flush();
+}
+
+TEST_F(DltChannelTest, TheBlockOfAnEncodedBodyIsHeldUntilItsDatagramIsSent)
+{
+    testing::NiceMock<UdpStreamOutput::Tester> outputs;
+    UdpStreamOutput::Tester::Instance() = &outputs;
+    constexpr std::size_t kBlockSize{1024UL};
+    BroadcastBodyPool pool{kBlockSize};
+
+    const auto body = pool.Allocate(GetVerboseBodySize(verbose_entry1_));
+    ConstructVerboseBody(body.data, verbose_entry1_);
+    DltEncodedMessage message{score::cpp::span<const char>{body.data, GetVerboseBodySize(verbose_entry1_)},
+                              2U,
+                              verbose_entry1_.log_level,
+                              true,
+                              0U,
+                              msg1_.size()};
+    message.block = body.block;
+
+    DltLogChannel dlt_channel(
+        DltidT{"CHN0"}, score::mw::log::LogLevel::kOff, DltidT{"ECU0"}, nullptr, 3491U, nullptr, 3490U, "");
+    dlt_channel.SendEncoded(message);
+    body.block->Release();
+
+    // the pool cannot reuse the block referenced by the datagram
+    const auto other = pool.Allocate(kBlockSize);
+    other.block->Release();
+    EXPECT_NE(other.block, body.block);
+    EXPECT_EQ(pool.GetBlockCount(), 2UL);
+
+    dlt_channel.Flush();
+
+    // once sent, the block is free again
+    const auto next = pool.Allocate(kBlockSize);
+    next.block->Release();
+    EXPECT_EQ(next.block, body.block);
+    EXPECT_EQ(pool.GetBlockCount(), 2UL);
+}
+
 TEST_F(DltChannelTest, WhenSendingNvVNv)
 {
     testing::StrictMock<UdpStreamOutput::Tester> outputs;
@@ -175,11 +290,11 @@ TEST_F(DltChannelTest, WhenSendingNvVNv)
                             const auto expected_data_size_2 = sizeof(DltVerboseHeader) + 8;
                             const auto expected_data_size_3 = sizeof(DltNvHeaderWithMsgid) + 8;
 
-                            // check data size in all 3 messages
-                            ASSERT_EQ(data_span.size(), 3);
-                            EXPECT_EQ(data_span.subspan(0, 1).front().msg_hdr.msg_iov[0].iov_len, expected_data_size_1);
-                            EXPECT_EQ(data_span.subspan(1, 1).front().msg_hdr.msg_iov[0].iov_len, expected_data_size_2);
-                            EXPECT_EQ(data_span.subspan(2, 1).front().msg_hdr.msg_iov[0].iov_len, expected_data_size_3);
+                            // all 3 messages are packed into one datagram, regardless of their type
+                            ASSERT_EQ(data_span.size(), 1);
+                            ASSERT_EQ(data_span.front().msg_hdr.msg_iovlen, 1);
+                            EXPECT_EQ(data_span.front().msg_hdr.msg_iov[0].iov_len,
+                                      expected_data_size_1 + expected_data_size_2 + expected_data_size_3);
                         }),
                         Return(1)));
 
@@ -301,6 +416,174 @@ TEST_F(DltChannelTest, TestSendUdpBufferingForVerbose)
     dlt_channel.ShowStats(logger);
 }
 
+TEST_F(DltChannelTest, WhenTransportIsConfiguredDatagramsFollowItsMtuAndVectorCount)
+{
+    testing::StrictMock<UdpStreamOutput::Tester> outputs;
+    UdpStreamOutput::Tester::Instance() = &outputs;
+
+    EXPECT_CALL(outputs, construct(_, nullptr, 3490U, Eq(std::string("")))).Times(1);
+    EXPECT_CALL(outputs, Bind(_, nullptr, 3491U)).Times(1);
+    EXPECT_CALL(outputs, SetSendBufferSize(_, 1024 * 1024)).Times(1);
+
+    ChannelTransportConfig transport{};
+    transport.vector_count = 1U;
+    transport.mtu = 576U;
+    transport.send_buffer_size = 1024 * 1024;
+    DltLogChannel dlt_channel(
+        DltidT{"CHN0"}, score::mw::log::LogLevel::kOff, DltidT{"ECU0"}, nullptr, 3491U, nullptr, 3490U, "", transport);
+
+    // a datagram of the MTU holds 18 of the messages, it is sent as soon as the next one does not fit
+    const auto length_of_one_message = sizeof(DltVerboseHeader) + msg1_.size();
+    const auto message_count_to_fill_datagram = (576U - (20U + 8U)) / length_of_one_message;
+    const auto check_full_datagram = [length_of_one_message, message_count_to_fill_datagram](
+                                         UdpStreamOutput*, score::cpp::span<mmsghdr> data_span) {
+        ASSERT_EQ(data_span.size(), 1);
+        EXPECT_EQ(data_span.front().msg_hdr.msg_iov[0].iov_len, length_of_one_message * message_count_to_fill_datagram);
+    };
+    EXPECT_CALL(outputs, Send(_, A<score::cpp::span<mmsghdr>>()))
+        .WillOnce(DoAll(Invoke(check_full_datagram), Return(1)));
+    for (size_t i = 0; i <= message_count_to_fill_datagram; ++i)
+    {
+        dlt_channel.SendVerbose(1U, verbose_entry1_);
+    }
+    Mock::VerifyAndClearExpectations(&outputs);
+
+    const auto check_last_datagram = [length_of_one_message](UdpStreamOutput*, score::cpp::span<mmsghdr> data_span) {
+        ASSERT_EQ(data_span.size(), 1);
+        EXPECT_EQ(data_span.front().msg_hdr.msg_iov[0].iov_len, length_of_one_message);
+    };
+    EXPECT_CALL(outputs, Destruct(_)).Times(1);
+    EXPECT_CALL(outputs, Send(_, A<score::cpp::span<mmsghdr>>()))
+        .WillOnce(DoAll(Invoke(check_last_datagram), Return(1)));
+    dlt_channel.Flush();
+}
+
+TEST_F(DltChannelTest, WithSegmentationOffloadEquallySizedDatagramsAreSentAsOne)
+{
+    testing::StrictMock<UdpStreamOutput::Tester> outputs;
+    UdpStreamOutput::Tester::Instance() = &outputs;
+
+    EXPECT_CALL(outputs, construct(_, nullptr, 3490U, Eq(std::string("")))).Times(1);
+    EXPECT_CALL(outputs, Bind(_, nullptr, 3491U)).Times(1);
+    EXPECT_CALL(outputs, EnableSegmentationOffload(_, 4U)).WillOnce(Return(score::cpp::blank{}));
+    EXPECT_CALL(outputs, Destruct(_)).Times(1);
+
+    ChannelTransportConfig transport{};
+    transport.segmentation_offload = true;
+    DltLogChannel dlt_channel(
+        DltidT{"CHN0"}, score::mw::log::LogLevel::kOff, DltidT{"ECU0"}, nullptr, 3491U, nullptr, 3490U, "", transport);
+
+    // three full segments of 49 messages each and a shorter last segment
+    const auto length_of_one_message = sizeof(DltVerboseHeader) + msg1_.size();
+    const auto message_count_to_fill_segment = kUdpMaxPayload / length_of_one_message;
+    const auto message_count = (3U * message_count_to_fill_segment) + 5U;
+    const auto check_segmented_datagram = [length_of_one_message, message_count_to_fill_segment, message_count](
+                                              UdpStreamOutput*,
+                                              score::cpp::span<mmsghdr> data_span,
+                                              score::cpp::span<const std::uint16_t> segment_sizes) {
+        ASSERT_EQ(data_span.size(), 1);
+        ASSERT_EQ(segment_sizes.size(), 1);
+        EXPECT_EQ(segment_sizes.front(), length_of_one_message * message_count_to_fill_segment);
+        ASSERT_EQ(data_span.front().msg_hdr.msg_iovlen, 1);
+        EXPECT_EQ(data_span.front().msg_hdr.msg_iov[0].iov_len, length_of_one_message * message_count);
+    };
+    EXPECT_CALL(outputs, Send(_, A<score::cpp::span<mmsghdr>>())).Times(0);
+    EXPECT_CALL(outputs, Send(_, A<score::cpp::span<mmsghdr>>(), A<score::cpp::span<const std::uint16_t>>()))
+        .WillOnce(DoAll(Invoke(check_segmented_datagram), Return(1)));
+
+    for (size_t i = 0; i < message_count; ++i)
+    {
+        dlt_channel.SendVerbose(1U, verbose_entry1_);
+    }
+    dlt_channel.Flush();
+}
+
+TEST_F(DltChannelTest, WithSegmentationOffloadAShorterSegmentCompletesTheDatagram)
+{
+    testing::StrictMock<UdpStreamOutput::Tester> outputs;
+    UdpStreamOutput::Tester::Instance() = &outputs;
+
+    EXPECT_CALL(outputs, construct(_, nullptr, 3490U, Eq(std::string("")))).Times(1);
+    EXPECT_CALL(outputs, Bind(_, nullptr, 3491U)).Times(1);
+    EXPECT_CALL(outputs, EnableSegmentationOffload(_, 4U)).WillOnce(Return(score::cpp::blank{}));
+    EXPECT_CALL(outputs, Destruct(_)).Times(1);
+
+    ChannelTransportConfig transport{};
+    transport.segmentation_offload = true;
+    DltLogChannel dlt_channel(
+        DltidT{"CHN0"}, score::mw::log::LogLevel::kOff, DltidT{"ECU0"}, nullptr, 3491U, nullptr, 3490U, "", transport);
+
+    // 47 messages of 30 bytes and one of 62 bytes fill the first segment exactly,
+    // the second segment takes 49 messages, as the next one would exceed the size of the first segment
+    const std::array<uint8_t, 40> long_payload{};
+    const LogEntryT long_entry{score::mw::log::detail::LoggingIdentifier{"APP0"},
+                               score::mw::log::detail::LoggingIdentifier{"CTX0"},
+                               {score::cpp::span<const uint8_t>{long_payload}},
+                               1,
+                               score::mw::log::LogLevel::kOff};
+    const auto length_of_one_message = sizeof(DltVerboseHeader) + msg1_.size();
+    const auto length_of_long_message = sizeof(DltVerboseHeader) + long_payload.size();
+    ASSERT_EQ((47U * length_of_one_message) + length_of_long_message, kUdpMaxPayload);
+    const auto second_segment_size = 49U * length_of_one_message;
+
+    const auto check_datagrams = [length_of_one_message, second_segment_size](
+                                     UdpStreamOutput*,
+                                     score::cpp::span<mmsghdr> data_span,
+                                     score::cpp::span<const std::uint16_t> segment_sizes) {
+        ASSERT_EQ(data_span.size(), 2);
+        ASSERT_EQ(segment_sizes.size(), 2);
+        EXPECT_EQ(segment_sizes[0], kUdpMaxPayload);
+        EXPECT_EQ(data_span[0].msg_hdr.msg_iov[0].iov_len, kUdpMaxPayload + second_segment_size);
+        // a single datagram is not segmented
+        EXPECT_EQ(segment_sizes[1], 0U);
+        EXPECT_EQ(data_span[1].msg_hdr.msg_iov[0].iov_len, length_of_one_message);
+    };
+    EXPECT_CALL(outputs, Send(_, A<score::cpp::span<mmsghdr>>(), A<score::cpp::span<const std::uint16_t>>()))
+        .WillOnce(DoAll(Invoke(check_datagrams), Return(2)));
+
+    for (size_t i = 0; i < 47U; ++i)
+    {
+        dlt_channel.SendVerbose(1U, verbose_entry1_);
+    }
+    dlt_channel.SendVerbose(1U, long_entry);
+    for (size_t i = 0; i < 50U; ++i)
+    {
+        dlt_channel.SendVerbose(1U, verbose_entry1_);
+    }
+    dlt_channel.Flush();
+}
+
+TEST_F(DltChannelTest, WhenSegmentationOffloadIsNotSupportedDatagramsAreSentUnsegmented)
+{
+    testing::StrictMock<UdpStreamOutput::Tester> outputs;
+    UdpStreamOutput::Tester::Instance() = &outputs;
+
+    EXPECT_CALL(outputs, construct(_, nullptr, 3490U, Eq(std::string("")))).Times(1);
+    EXPECT_CALL(outputs, Bind(_, nullptr, 3491U)).Times(1);
+    EXPECT_CALL(outputs, EnableSegmentationOffload(_, 4U))
+        .WillOnce(Return(score::cpp::make_unexpected(score::os::Error::createFromErrno(ENOPROTOOPT))));
+    EXPECT_CALL(outputs, Destruct(_)).Times(1);
+
+    ChannelTransportConfig transport{};
+    transport.segmentation_offload = true;
+    DltLogChannel dlt_channel(
+        DltidT{"CHN0"}, score::mw::log::LogLevel::kOff, DltidT{"ECU0"}, nullptr, 3491U, nullptr, 3490U, "", transport);
+
+    score::cpp::span<mmsghdr> mmsg_span{};
+    EXPECT_CALL(outputs, Send(_, A<score::cpp::span<mmsghdr>>())).WillOnce(DoAll(SaveArg<1>(&mmsg_span), Return(1)));
+    const auto length_of_one_message = sizeof(DltVerboseHeader) + msg1_.size();
+    const auto message_count_to_fill_datagram = kUdpMaxPayload / length_of_one_message;
+    for (size_t i = 0; i <= message_count_to_fill_datagram; ++i)
+    {
+        dlt_channel.SendVerbose(1U, verbose_entry1_);
+    }
+    dlt_channel.Flush();
+
+    ASSERT_EQ(mmsg_span.size(), 2);
+    EXPECT_EQ(mmsg_span[0].msg_hdr.msg_iov[0].iov_len, length_of_one_message * message_count_to_fill_datagram);
+    EXPECT_EQ(mmsg_span[1].msg_hdr.msg_iov[0].iov_len, length_of_one_message);
+}
+
 TEST_F(DltChannelTest, WhenSendFailsWithOnlyVerboseMessages)
 {
     testing::StrictMock<UdpStreamOutput::Tester> outputs;
@@ -353,6 +636,331 @@ TEST_F(DltChannelTest, WhenSendFailsWithOnlyNonVerboseMessages)
     dlt_channel.ShowStats(logger);
 }
 
+TEST_F(DltChannelTest, WhenSendFailsWithMixedMessages)
+{
+    testing::StrictMock<UdpStreamOutput::Tester> outputs;
+    UdpStreamOutput::Tester::Instance() = &outputs;
+
+    EXPECT_CALL(outputs, construct(_, nullptr, 3490U, Eq(std::string("")))).Times(1);
+    EXPECT_CALL(outputs, Bind(_, nullptr, 3491U)).Times(1);
+    EXPECT_CALL(outputs, Destruct(_)).Times(1);
+    EXPECT_CALL(outputs, Send(_, A<score::cpp::span<mmsghdr>>()))
+        .WillOnce(Return(score::cpp::make_unexpected(score::os::Error::createFromErrno(EIO))));
+
+    DltLogChannel dlt_channel(
+        DltidT{"CHN0"}, score::mw::log::LogLevel::kOff, DltidT{"ECU0"}, nullptr, 3491U, nullptr, 3490U, "");
+
+    // the failure of the datagram is counted for both types of its messages
+    dlt_channel.SendVerbose(1U, verbose_entry1_);
+    dlt_channel.SendNonVerbose(nv_desc1_, 2U, msg1_.data(), msg1_.size());
+
+    dlt_channel.Flush();
+    Logger logger;
+    dlt_channel.ShowStats(logger);
+}
+
+TEST_F(DltChannelTest, WhenInterleavingVerboseAndNonVerboseDatagramsAreFilled)
+{
+    testing::StrictMock<UdpStreamOutput::Tester> outputs;
+    UdpStreamOutput::Tester::Instance() = &outputs;
+
+    EXPECT_CALL(outputs, construct(_, nullptr, 3490U, Eq(std::string("")))).Times(1);
+    EXPECT_CALL(outputs, Bind(_, nullptr, 3491U)).Times(1);
+    EXPECT_CALL(outputs, Destruct(_)).Times(1);
+
+    DltLogChannel dlt_channel(
+        DltidT{"CHN0"}, score::mw::log::LogLevel::kOff, DltidT{"ECU0"}, nullptr, 3491U, nullptr, 3490U, "");
+
+    const auto length_of_pair = sizeof(DltVerboseHeader) + msg1_.size() + sizeof(DltNvHeaderWithMsgid) + msg1_.size();
+    const auto pair_count_to_fill_datagram = kUdpMaxPayload / length_of_pair;
+    const auto check_datagram = [length_of_pair, pair_count_to_fill_datagram](UdpStreamOutput*,
+                                                                              score::cpp::span<mmsghdr> data_span) {
+        ASSERT_EQ(data_span.size(), 1);
+        EXPECT_EQ(data_span.front().msg_hdr.msg_iov[0].iov_len, length_of_pair * pair_count_to_fill_datagram);
+    };
+    EXPECT_CALL(outputs, Send(_, A<score::cpp::span<mmsghdr>>())).WillOnce(DoAll(Invoke(check_datagram), Return(1)));
+
+    for (size_t i = 0; i < pair_count_to_fill_datagram; ++i)
+    {
+        dlt_channel.SendVerbose(1U, verbose_entry1_);
+        dlt_channel.SendNonVerbose(nv_desc1_, 1U, msg1_.data(), msg1_.size());
+    }
+    dlt_channel.Flush();
+}
+
+TEST_F(DltChannelTest, WithSenderThreadBatchesAreSentByIt)
+{
+    testing::StrictMock<UdpStreamOutput::Tester> outputs;
+    UdpStreamOutput::Tester::Instance() = &outputs;
+
+    EXPECT_CALL(outputs, construct(_, nullptr, 3490U, Eq(std::string("")))).Times(1);
+    EXPECT_CALL(outputs, Bind(_, nullptr, 3491U)).Times(1);
+    EXPECT_CALL(outputs, Destruct(_)).Times(1);
+
+    const auto routing_thread = std::this_thread::get_id();
+    std::promise<void> sent{};
+    const auto check_batch = [routing_thread, &sent](UdpStreamOutput*, score::cpp::span<mmsghdr> data_span) {
+        EXPECT_EQ(data_span.size(), 1);
+        EXPECT_NE(std::this_thread::get_id(), routing_thread);
+        sent.set_value();
+    };
+    EXPECT_CALL(outputs, Send(_, A<score::cpp::span<mmsghdr>>())).WillOnce(DoAll(Invoke(check_batch), Return(1)));
+
+    ChannelTransportConfig transport{};
+    transport.vector_count = 1U;
+    transport.sender_queue_depth = 2U;
+    DltLogChannel dlt_channel(
+        DltidT{"CHN0"}, score::mw::log::LogLevel::kOff, DltidT{"ECU0"}, nullptr, 3491U, nullptr, 3490U, "", transport);
+    ASSERT_TRUE(dlt_channel.StartSender("dlt_tx_0").has_value());
+    EXPECT_FALSE(dlt_channel.StartSender("dlt_tx_0").has_value());
+
+    dlt_channel.SendVerbose(1U, verbose_entry1_);
+    dlt_channel.Flush();
+    sent.get_future().wait();
+
+    const auto statistics = dlt_channel.GetSenderQueueStatistics();
+    EXPECT_EQ(statistics.handed_over_batches, 1U);
+    EXPECT_EQ(statistics.high_watermark, 1U);
+    EXPECT_EQ(statistics.dropped_batches, 0U);
+}
+
+TEST_F(DltChannelTest, WhenSenderQueueIsFullTheNewestBatchIsDropped)
+{
+    testing::StrictMock<UdpStreamOutput::Tester> outputs;
+    UdpStreamOutput::Tester::Instance() = &outputs;
+
+    EXPECT_CALL(outputs, construct(_, nullptr, 3490U, Eq(std::string("")))).Times(1);
+    EXPECT_CALL(outputs, Bind(_, nullptr, 3491U)).Times(1);
+    EXPECT_CALL(outputs, Destruct(_)).Times(1);
+
+    // the network stalls until the batch handed over first is released
+    std::promise<void> release{};
+    auto released = release.get_future().share();
+    const auto stall = [released](UdpStreamOutput*, score::cpp::span<mmsghdr>) {
+        released.wait();
+    };
+    EXPECT_CALL(outputs, Send(_, A<score::cpp::span<mmsghdr>>())).WillOnce(DoAll(Invoke(stall), Return(1)));
+
+    ChannelTransportConfig transport{};
+    transport.vector_count = 1U;
+    transport.sender_queue_depth = 1U;
+    DltLogChannel dlt_channel(
+        DltidT{"CHN0"}, score::mw::log::LogLevel::kOff, DltidT{"ECU0"}, nullptr, 3491U, nullptr, 3490U, "", transport);
+    ASSERT_TRUE(dlt_channel.StartSender("dlt_tx_0").has_value());
+
+    // the first datagram is handed over, the second one finds no free batch
+    const auto message_count_to_fill_datagram = kUdpMaxPayload / (sizeof(DltVerboseHeader) + msg1_.size());
+    for (size_t i = 0; i <= message_count_to_fill_datagram; ++i)
+    {
+        dlt_channel.SendVerbose(1U, verbose_entry1_);
+    }
+    dlt_channel.Flush();
+
+    const auto statistics = dlt_channel.GetSenderQueueStatistics();
+    EXPECT_EQ(statistics.handed_over_batches, 1U);
+    EXPECT_EQ(statistics.dropped_batches, 1U);
+    EXPECT_EQ(statistics.dropped_datagrams, 1U);
+    EXPECT_EQ(statistics.dropped_messages, 1U);
+    Logger logger;
+    dlt_channel.ShowStats(logger);
+    release.set_value();
+}
+
+TEST_F(DltChannelTest, WithSenderThreadALargeMessageIsCopiedIntoItsOwnDatagram)
+{
+    testing::StrictMock<UdpStreamOutput::Tester> outputs;
+    UdpStreamOutput::Tester::Instance() = &outputs;
+
+    EXPECT_CALL(outputs, construct(_, nullptr, 3490U, Eq(std::string("")))).Times(1);
+    EXPECT_CALL(outputs, Bind(_, nullptr, 3491U)).Times(1);
+    EXPECT_CALL(outputs, Destruct(_)).Times(1);
+
+    std::vector<uint8_t> large_msg(kUdpMaxPayload + 100, 0xAA);
+    const auto check_batch = [&large_msg](UdpStreamOutput*, score::cpp::span<mmsghdr> data_span) {
+        ASSERT_EQ(data_span.size(), 1);
+        ASSERT_EQ(data_span.front().msg_hdr.msg_iovlen, 1);
+        EXPECT_EQ(data_span.front().msg_hdr.msg_iov[0].iov_len, sizeof(DltNvHeaderWithMsgid) + large_msg.size());
+    };
+    EXPECT_CALL(outputs, Send(_, A<score::cpp::span<mmsghdr>>())).WillOnce(DoAll(Invoke(check_batch), Return(1)));
+
+    ChannelTransportConfig transport{};
+    transport.sender_queue_depth = 2U;
+    DltLogChannel dlt_channel(
+        DltidT{"CHN0"}, score::mw::log::LogLevel::kOff, DltidT{"ECU0"}, nullptr, 3491U, nullptr, 3490U, "", transport);
+    ASSERT_TRUE(dlt_channel.StartSender("dlt_tx_0").has_value());
+
+    dlt_channel.SendNonVerbose(nv_desc1_, 1U, large_msg.data(), large_msg.size());
+    // the payload may be released before the sender thread sends the datagram
+    std::fill(large_msg.begin(), large_msg.end(), 0x55);
+    dlt_channel.Flush();
+}
+
+// the channel hands its batches over to the mocked output, which never queues them on the ring
+class SubmissionRingStub : public IUdpSubmissionRing
+{
+  public:
+    score::cpp::expected_blank<score::os::Error> Queue(const std::int32_t,
+                                                       score::cpp::span<mmsghdr>,
+                                                       Completion&) noexcept override
+    {
+        return {};
+    }
+    score::cpp::expected<std::uint32_t, score::os::Error> Submit() noexcept override
+    {
+        ++submit_calls;
+        return 0U;
+    }
+
+    size_t submit_calls{0U};
+};
+
+TEST_F(DltChannelTest, WithSubmissionRingBatchesAreQueuedOnIt)
+{
+    testing::StrictMock<UdpStreamOutput::Tester> outputs;
+    UdpStreamOutput::Tester::Instance() = &outputs;
+
+    EXPECT_CALL(outputs, construct(_, nullptr, 3490U, Eq(std::string("")))).Times(1);
+    EXPECT_CALL(outputs, Bind(_, nullptr, 3491U)).Times(1);
+    EXPECT_CALL(outputs, Destruct(_)).Times(1);
+
+    SubmissionRingStub ring{};
+    // the datagrams complete right away, thus the batch is free again
+    const auto complete = [](UdpStreamOutput*,
+                             IUdpSubmissionRing&,
+                             score::cpp::span<mmsghdr> data_span,
+                             IUdpSubmissionRing::Completion& completion) {
+        EXPECT_EQ(data_span.size(), 1);
+        completion.OnSent(static_cast<std::int32_t>(data_span.front().msg_hdr.msg_iov[0].iov_len));
+        return score::cpp::expected_blank<score::os::Error>{};
+    };
+    EXPECT_CALL(outputs, Queue(_, Ref(ring), _, _)).Times(2).WillRepeatedly(Invoke(complete));
+
+    ChannelTransportConfig transport{};
+    transport.vector_count = 1U;
+    transport.sender_queue_depth = 1U;
+    transport.io_uring = true;
+    DltLogChannel dlt_channel(
+        DltidT{"CHN0"}, score::mw::log::LogLevel::kOff, DltidT{"ECU0"}, nullptr, 3491U, nullptr, 3490U, "", transport);
+    ASSERT_TRUE(dlt_channel.AttachSubmissionRing(ring));
+    EXPECT_FALSE(dlt_channel.AttachSubmissionRing(ring));
+    EXPECT_FALSE(dlt_channel.StartSender("dlt_tx_0").has_value());
+
+    dlt_channel.SendVerbose(1U, verbose_entry1_);
+    dlt_channel.Flush();
+    dlt_channel.SendVerbose(2U, verbose_entry2_);
+    dlt_channel.Flush();
+
+    const auto statistics = dlt_channel.GetSenderQueueStatistics();
+    EXPECT_EQ(statistics.depth, 0U);
+    EXPECT_EQ(statistics.high_watermark, 1U);
+    EXPECT_EQ(statistics.handed_over_batches, 2U);
+    EXPECT_EQ(statistics.dropped_batches, 0U);
+}
+
+TEST_F(DltChannelTest, WhileDatagramsAreInFlightTheNewestBatchIsDropped)
+{
+    testing::StrictMock<UdpStreamOutput::Tester> outputs;
+    UdpStreamOutput::Tester::Instance() = &outputs;
+
+    EXPECT_CALL(outputs, construct(_, nullptr, 3490U, Eq(std::string("")))).Times(1);
+    EXPECT_CALL(outputs, Bind(_, nullptr, 3491U)).Times(1);
+    EXPECT_CALL(outputs, Destruct(_)).Times(1);
+
+    SubmissionRingStub ring{};
+    IUdpSubmissionRing::Completion* in_flight{nullptr};
+    const auto keep = [&in_flight](UdpStreamOutput*,
+                                   IUdpSubmissionRing&,
+                                   score::cpp::span<mmsghdr>,
+                                   IUdpSubmissionRing::Completion& completion) {
+        in_flight = &completion;
+        return score::cpp::expected_blank<score::os::Error>{};
+    };
+    EXPECT_CALL(outputs, Queue(_, Ref(ring), _, _)).Times(2).WillRepeatedly(Invoke(keep));
+
+    ChannelTransportConfig transport{};
+    transport.vector_count = 1U;
+    transport.sender_queue_depth = 1U;
+    transport.io_uring = true;
+    DltLogChannel dlt_channel(
+        DltidT{"CHN0"}, score::mw::log::LogLevel::kOff, DltidT{"ECU0"}, nullptr, 3491U, nullptr, 3490U, "", transport);
+    ASSERT_TRUE(dlt_channel.AttachSubmissionRing(ring));
+
+    // the first datagram is queued, the second one finds no free batch until the first one completes
+    dlt_channel.SendVerbose(1U, verbose_entry1_);
+    dlt_channel.Flush();
+    dlt_channel.SendVerbose(2U, verbose_entry2_);
+    dlt_channel.Flush();
+    ASSERT_NE(in_flight, nullptr);
+    EXPECT_EQ(dlt_channel.GetSenderQueueStatistics().depth, 1U);
+    EXPECT_EQ(dlt_channel.GetSenderQueueStatistics().dropped_batches, 1U);
+    // the ring is submitted before dropping, which reaps the completions
+    EXPECT_EQ(ring.submit_calls, 1U);
+
+    // a failed datagram is counted once its batch is reused
+    in_flight->OnSent(-ECONNREFUSED);
+    EXPECT_EQ(dlt_channel.GetSenderQueueStatistics().depth, 0U);
+    dlt_channel.SendVerbose(3U, verbose_entry1_);
+    dlt_channel.Flush();
+    Logger logger;
+    dlt_channel.ShowStats(logger);
+    in_flight->OnSent(0);
+}
+
+TEST_F(DltChannelTest, WhenQueueingOnTheSubmissionRingFailsTheBatchIsFree)
+{
+    testing::StrictMock<UdpStreamOutput::Tester> outputs;
+    UdpStreamOutput::Tester::Instance() = &outputs;
+
+    EXPECT_CALL(outputs, construct(_, nullptr, 3490U, Eq(std::string("")))).Times(1);
+    EXPECT_CALL(outputs, Bind(_, nullptr, 3491U)).Times(1);
+    EXPECT_CALL(outputs, Destruct(_)).Times(1);
+
+    SubmissionRingStub ring{};
+    EXPECT_CALL(outputs, Queue(_, Ref(ring), _, _))
+        .Times(2)
+        .WillRepeatedly(Return(score::cpp::make_unexpected(score::os::Error::createFromErrno(EAGAIN))));
+
+    ChannelTransportConfig transport{};
+    transport.vector_count = 1U;
+    transport.sender_queue_depth = 1U;
+    transport.io_uring = true;
+    DltLogChannel dlt_channel(
+        DltidT{"CHN0"}, score::mw::log::LogLevel::kOff, DltidT{"ECU0"}, nullptr, 3491U, nullptr, 3490U, "", transport);
+    ASSERT_TRUE(dlt_channel.AttachSubmissionRing(ring));
+
+    dlt_channel.SendVerbose(1U, verbose_entry1_);
+    dlt_channel.Flush();
+    dlt_channel.SendNonVerbose(nv_desc1_, 2U, msg1_.data(), msg1_.size());
+    dlt_channel.Flush();
+
+    const auto statistics = dlt_channel.GetSenderQueueStatistics();
+    EXPECT_EQ(statistics.depth, 0U);
+    EXPECT_EQ(statistics.handed_over_batches, 0U);
+    EXPECT_EQ(statistics.dropped_batches, 0U);
+    Logger logger;
+    dlt_channel.ShowStats(logger);
+}
+
+TEST_F(DltChannelTest, WithSegmentationOffloadTheSubmissionRingIsNotAttached)
+{
+    testing::StrictMock<UdpStreamOutput::Tester> outputs;
+    UdpStreamOutput::Tester::Instance() = &outputs;
+
+    EXPECT_CALL(outputs, construct(_, nullptr, 3490U, Eq(std::string("")))).Times(1);
+    EXPECT_CALL(outputs, Bind(_, nullptr, 3491U)).Times(1);
+    EXPECT_CALL(outputs, EnableSegmentationOffload(_, 4U)).WillOnce(Return(score::cpp::blank{}));
+    EXPECT_CALL(outputs, Destruct(_)).Times(1);
+
+    ChannelTransportConfig transport{};
+    transport.segmentation_offload = true;
+    transport.io_uring = true;
+    DltLogChannel dlt_channel(
+        DltidT{"CHN0"}, score::mw::log::LogLevel::kOff, DltidT{"ECU0"}, nullptr, 3491U, nullptr, 3490U, "", transport);
+
+    SubmissionRingStub ring{};
+    EXPECT_FALSE(dlt_channel.AttachSubmissionRing(ring));
+}
+
 TEST_F(DltChannelTest, WhenSendingLargeMessage_GoesToElse)
 {
     testing::StrictMock<UdpStreamOutput::Tester> outputs;
@@ -379,6 +987,137 @@ TEST_F(DltChannelTest, WhenSendingLargeMessage_GoesToElse)
     dlt_channel.ShowStats(logger);
 }
 
+/// Records the messages sent on their own, i.e. not in a batch of datagrams.
+void RecordSingleMessages(UdpStreamOutput::Tester& outputs,
+                          const size_t count,
+                          std::vector<std::vector<char>>& messages)
+{
+    EXPECT_CALL(outputs, Send(_, A<const iovec*>(), A<size_t>()))
+        .Times(static_cast<int>(count))
+        .WillRepeatedly(Invoke([&messages](UdpStreamOutput*, const iovec* io_vec, size_t io_vec_count) {
+            std::vector<char> message{};
+            for (const auto& part : score::cpp::span<const iovec>{io_vec, io_vec_count})
+            {
+                const auto* const data = static_cast<const char*>(part.iov_base);
+                message.insert(message.end(), data, std::next(data, static_cast<std::ptrdiff_t>(part.iov_len)));
+            }
+            messages.push_back(std::move(message));
+            return score::cpp::expected<std::int64_t, score::os::Error>{static_cast<std::int64_t>(messages.size())};
+        }));
+}
+
+template <typename Header>
+Header GetHeader(const std::vector<char>& message)
+{
+    Header header{};
+    EXPECT_GE(message.size(), sizeof(header));
+    // NOLINTNEXTLINE(score-banned-function) the packed header is read from the message
+    std::memcpy(&header, message.data(), sizeof(header));
+    return header;
+}
+
+/// Checks the messages of a segmented network trace and returns the payload reassembled from its segments.
+std::vector<char> ReassembleNetworkTrace(const std::vector<std::vector<char>>& messages,
+                                         const std::vector<char>& expected_trace_header)
+{
+    static constexpr size_t kMaxDatagramSize = 65535UL - (20UL + 8UL);
+    constexpr auto kNetworkTrace = static_cast<uint8_t>((DLT_TYPE_NW_TRACE << DLT_MSIN_MSTP_SHIFT) |
+                                                        (DLT_NW_TRACE_IPC << DLT_MSIN_MTIN_SHIFT) | DLT_MSIN_VERB);
+    std::vector<char> payload{};
+    EXPECT_GE(messages.size(), 3UL);
+    for (const auto& message : messages)
+    {
+        EXPECT_LE(message.size(), kMaxDatagramSize);
+        EXPECT_EQ(GetHeader<DltVerboseHeader>(message).ext.msin, kNetworkTrace);
+    }
+
+    const auto head = GetHeader<DltNetworkTraceStartHead>(messages.front());
+    EXPECT_EQ(std::string(head.tag.tag.data()), "NWST");
+    const auto trace_header = std::next(messages.front().begin(), sizeof(head));
+    EXPECT_TRUE(std::equal(expected_trace_header.begin(), expected_trace_header.end(), trace_header));
+    DltNetworkTraceStartTail tail{};
+    // NOLINTNEXTLINE(score-banned-function) the packed tail is read from the message
+    std::memcpy(&tail, &*std::next(trace_header, static_cast<std::ptrdiff_t>(head.trace_header.length)), sizeof(tail));
+    EXPECT_EQ(tail.segment_count.value, messages.size() - 2UL);
+
+    for (size_t sequence = 0UL; sequence < (messages.size() - 2UL); ++sequence)
+    {
+        const auto& message = messages.at(sequence + 1UL);
+        const auto segment = GetHeader<DltNetworkTraceSegmentHeader>(message);
+        EXPECT_EQ(std::string(segment.tag.tag.data()), "NWCH");
+        EXPECT_EQ(segment.stream.value, head.stream.value);
+        EXPECT_EQ(segment.sequence.value, sequence);
+        EXPECT_EQ(segment.data.length, message.size() - sizeof(segment));
+        payload.insert(payload.end(), std::next(message.begin(), sizeof(segment)), message.end());
+    }
+
+    const auto end = GetHeader<DltNetworkTraceEnd>(messages.back());
+    EXPECT_EQ(std::string(end.tag.tag.data()), "NWEN");
+    EXPECT_EQ(end.stream.value, head.stream.value);
+    EXPECT_EQ(tail.payload_size.value, payload.size());
+    return payload;
+}
+
+TEST_F(DltChannelTest, WhenSendingMessageBiggerThanDatagram_IsSegmented)
+{
+    testing::StrictMock<UdpStreamOutput::Tester> outputs;
+    UdpStreamOutput::Tester::Instance() = &outputs;
+
+    EXPECT_CALL(outputs, construct(_, nullptr, 3490U, Eq(std::string("")))).Times(1);
+    EXPECT_CALL(outputs, Bind(_, nullptr, 3491U)).Times(1);
+    EXPECT_CALL(outputs, Destruct(_)).Times(1);
+
+    // Payload as it may be delivered from the large payload arena of a logging client, sent in three segments
+    constexpr size_t kLargePayloadSize = 150000UL;
+    std::vector<std::vector<char>> messages{};
+    RecordSingleMessages(outputs, 5UL, messages);
+
+    DltLogChannel dlt_channel(
+        DltidT{"CHN0"}, score::mw::log::LogLevel::kOff, DltidT{"ECU0"}, nullptr, 3491U, nullptr, 3490U, "");
+
+    std::vector<char> large_msg(kLargePayloadSize, '\xAA');
+    dlt_channel.SendNonVerbose(nv_desc1_, 1U, large_msg.data(), large_msg.size());
+
+    // the trace header is the message id
+    const uint32_t msgid = nv_desc1_.GetIdMsgDescriptor();
+    const std::vector<char> trace_header(reinterpret_cast<const char*>(&msgid),
+                                         std::next(reinterpret_cast<const char*>(&msgid), sizeof(msgid)));
+    EXPECT_EQ(ReassembleNetworkTrace(messages, trace_header), large_msg);
+}
+
+TEST_F(DltChannelTest, WhenSendingVerboseMessageBiggerThanDatagram_IsSegmented)
+{
+    testing::StrictMock<UdpStreamOutput::Tester> outputs;
+    UdpStreamOutput::Tester::Instance() = &outputs;
+
+    EXPECT_CALL(outputs, construct(_, nullptr, 3490U, Eq(std::string("")))).Times(1);
+    EXPECT_CALL(outputs, Bind(_, nullptr, 3491U)).Times(1);
+    EXPECT_CALL(outputs, Destruct(_)).Times(1);
+
+    constexpr size_t kLargePayloadSize = 100000UL;
+    std::vector<std::vector<char>> messages{};
+    RecordSingleMessages(outputs, 4UL, messages);
+
+    DltLogChannel dlt_channel(
+        DltidT{"CHN0"}, score::mw::log::LogLevel::kOff, DltidT{"ECU0"}, nullptr, 3491U, nullptr, 3490U, "");
+
+    std::vector<uint8_t> large_payload(kLargePayloadSize, 0xABU);
+    const LogEntryT large_verbose_entry{score::mw::log::detail::LoggingIdentifier{"APP0"},
+                                        score::mw::log::detail::LoggingIdentifier{"CTX0"},
+                                        {score::cpp::span<const uint8_t>{large_payload}},
+                                        1,
+                                        score::mw::log::LogLevel::kOff};
+    dlt_channel.SendVerbose(1U, large_verbose_entry);
+
+    // the trace header is the extended header of the message, which precedes its arguments
+    DltVerboseHeader header{};
+    std::ignore = ConstructVerboseHeader(header, large_verbose_entry, DltidT{"ECU0"}, 0U, 1U);
+    const std::vector<char> trace_header(reinterpret_cast<const char*>(&header.ext),
+                                         std::next(reinterpret_cast<const char*>(&header.ext), sizeof(header.ext)));
+    const auto payload = ReassembleNetworkTrace(messages, trace_header);
+    EXPECT_EQ(std::vector<uint8_t>(payload.begin(), payload.end()), large_payload);
+}
+
 TEST_F(DltChannelTest, WhenSendFailsWithLargeVerboseMessage)
 {
     testing::StrictMock<UdpStreamOutput::Tester> outputs;
@@ -108,6 +108,7 @@ class DltLogServer::DltLogServerTest : public DltLogServer
 
   public:
     using DltLogServer::IsOutputEnabled;
+    using DltLogServer::PrefilterVerbose;
     using DltLogServer::SendFtVerbose;
     using DltLogServer::SendNonVerbose;
     using DltLogServer::SendVerbose;
@@ -199,8 +200,10 @@ class DltServerCreatedWithConfigFixture : public ::testing::Test
         DltidT("DFLT"),
         {
             //  channels as std::unordered_map<DltidT, ChannelDescription>
-            {DltidT("DFLT"), {DltidT("ECU0"), "", 3490U, "", 3491U, score::mw::log::LogLevel::kFatal, "160.48.199.34"}},
-            {DltidT("CORE"), {DltidT("ECU0"), "", 3490U, "", 3492U, score::mw::log::LogLevel::kError, "160.48.199.101"}},
+            {DltidT("DFLT"),
+             {DltidT("ECU0"), "", 3490U, "", 3491U, score::mw::log::LogLevel::kFatal, "160.48.199.34", {}}},
+            {DltidT("CORE"),
+             {DltidT("ECU0"), "", 3490U, "", 3492U, score::mw::log::LogLevel::kError, "160.48.199.101", {}}},
         },
         true,  //  filteringEnabled
         score::mw::log::LogLevel::kOff,
@@ -209,7 +212,8 @@ class DltServerCreatedWithConfigFixture : public ::testing::Test
         },
         {{DltidT("APP0"), {{DltidT("CTX0"), score::mw::log::LogLevel::kOff}}}},
         {100., {{DltidT("APP0"), 1000.}}},
-        false};
+        false,
+        {}};
 
     PersistentConfig p_config{};
     testing::StrictMock<MockFunction<PersistentConfig(void)>> read_callback;
@@ -228,6 +232,32 @@ TEST_F(DltServerCreatedWithConfigFixture, FlushChannelsExpectNoThrowException)
     EXPECT_NO_THROW(dlt_server.Flush());
 }
 
+TEST_F(DltServerCreatedWithConfigFixture, SenderThreadsAreStartedForChannelsWithASenderQueue)
+{
+    EXPECT_CALL(read_callback, Call()).Times(1).WillOnce(Return(p_config));
+    EXPECT_CALL(write_callback, Call(_)).Times(0);
+    s_config.channels.at(DltidT("CORE")).transport.sender_queue_depth = 2U;
+
+    DltLogServer dlt_server(s_config, read_callback.AsStdFunction(), write_callback.AsStdFunction(), true);
+    EXPECT_EQ(dlt_server.StartChannelSenders(), 1U);
+    EXPECT_EQ(dlt_server.StartChannelSenders(), 0U);
+    EXPECT_NO_THROW(dlt_server.Flush());
+}
+
+TEST_F(DltServerCreatedWithConfigFixture, ChannelsConfiguredForIoUringHandTheirBatchesOver)
+{
+    EXPECT_CALL(read_callback, Call()).Times(1).WillOnce(Return(p_config));
+    EXPECT_CALL(write_callback, Call(_)).Times(0);
+    // attached to the submission ring, or where io_uring is not available, sent by a sender thread
+    s_config.channels.at(DltidT("CORE")).transport.io_uring = true;
+    s_config.channels.at(DltidT("CORE")).transport.sender_queue_depth = 2U;
+
+    DltLogServer dlt_server(s_config, read_callback.AsStdFunction(), write_callback.AsStdFunction(), true);
+    EXPECT_EQ(dlt_server.StartChannelSenders(), 1U);
+    EXPECT_EQ(dlt_server.StartChannelSenders(), 0U);
+    EXPECT_NO_THROW(dlt_server.Flush());
+}
+
 TEST_F(DltServerCreatedWithConfigFixture, GetQuotaCorrectAppNameExpectCorrectValue)
 {
     EXPECT_CALL(read_callback, Call()).Times(1).WillOnce(Return(p_config));
@@ -430,8 +460,10 @@ TEST(DltServerWrongChannelsTest,
         DltidT("CORE"),
         DltidT("DFLT"),
         {
-            {DltidT("DFLT"), {DltidT("ECU0"), "", 3490U, "", 3491U, score::mw::log::LogLevel::kFatal, "160.48.199.34"}},
-            {DltidT("CORE"), {DltidT("ECU0"), "", 3490U, "", 3492U, score::mw::log::LogLevel::kError, "160.48.199.101"}},
+            {DltidT("DFLT"),
+             {DltidT("ECU0"), "", 3490U, "", 3491U, score::mw::log::LogLevel::kFatal, "160.48.199.34", {}}},
+            {DltidT("CORE"),
+             {DltidT("ECU0"), "", 3490U, "", 3492U, score::mw::log::LogLevel::kError, "160.48.199.101", {}}},
         },
         true,
         score::mw::log::LogLevel::kOff,
@@ -440,7 +472,8 @@ TEST(DltServerWrongChannelsTest,
         },
         {{DltidT("APP0"), {{DltidT("CTX0"), score::mw::log::LogLevel::kOff}}}},
         {100., {{DltidT("APP0"), 1000.}}},
-        false};
+        false,
+        {}};
 
     PersistentConfig p_config{};
 
@@ -516,7 +549,7 @@ TEST_F(DltServerCreatedWithConfigFixture, SetLogChannelAssignmentBehaviorRemoves
     EXPECT_EQ(resp_add[0], static_cast<char>(config::kRetOk));
 
     // With both channels assigned: 2 sends.
-    EXPECT_CALL(*log_sender_mock_raw_ptr, SendVerbose(_, _, _)).Times(2);
+    EXPECT_CALL(*log_sender_mock_raw_ptr, SendEncoded(_, _)).Times(2);
     dlt_server.SendVerbose(100U, entry);
     ::testing::Mock::VerifyAndClearExpectations(log_sender_mock_raw_ptr);
 
@@ -630,6 +663,7 @@ TEST_F(DltServerCreatedWithConfigFixture, SetDefaultLogLevelBehaviorAffectsNewCo
 
     // With default set to kInfo, verbose must be filtered.
     EXPECT_CALL(*log_sender_mock_raw_ptr, SendVerbose(_, _, _)).Times(0);
+    EXPECT_CALL(*log_sender_mock_raw_ptr, SendEncoded(_, _)).Times(0);
     dlt_server.SendVerbose(100U, verbose_entry);
     ::testing::Mock::VerifyAndClearExpectations(log_sender_mock_raw_ptr);
 
@@ -676,6 +710,7 @@ TEST_F(DltServerCreatedWithConfigFixture, SetMessagingFilteringStateBehaviorBypa
 
     // With filtering enabled, verbose should be filtered.
     EXPECT_CALL(*log_sender_mock_raw_ptr, SendVerbose(_, _, _)).Times(0);
+    EXPECT_CALL(*log_sender_mock_raw_ptr, SendEncoded(_, _)).Times(0);
     dlt_server.SendVerbose(100U, verbose_entry);
     ::testing::Mock::VerifyAndClearExpectations(log_sender_mock_raw_ptr);
 
@@ -695,6 +730,7 @@ TEST_F(DltServerCreatedWithConfigFixture, SetMessagingFilteringStateBehaviorBypa
     EXPECT_EQ(resp_enable[0], static_cast<char>(config::kRetOk));
 
     EXPECT_CALL(*log_sender_mock_raw_ptr, SendVerbose(_, _, _)).Times(0);
+    EXPECT_CALL(*log_sender_mock_raw_ptr, SendEncoded(_, _)).Times(0);
     dlt_server.SendVerbose(100U, verbose_entry);
 }
 
@@ -772,6 +808,7 @@ TEST_F(DltServerCreatedWithConfigFixture, SetLogChannelThresholdBehaviorFiltersL
         app_id, ctx_id, {}, 0, score::mw::log::LogLevel::kVerbose};
     // With the threshold raised to kInfo, verbose must be filtered.
     EXPECT_CALL(*log_sender_mock_raw_ptr, SendVerbose(_, _, _)).Times(0);
+    EXPECT_CALL(*log_sender_mock_raw_ptr, SendEncoded(_, _)).Times(0);
     dlt_server.SendVerbose(100U, verbose_entry);
 }
 
@@ -792,6 +829,7 @@ TEST_F(DltServerCreatedWithConfigFixture, SetLogLevelBehaviorIncreaseThresholdAl
 
     // Initially threshold for APP0/CTX0 is kOff, so verbose should be filtered out.
     EXPECT_CALL(*log_sender_mock_raw_ptr, SendVerbose(_, _, _)).Times(0);
+    EXPECT_CALL(*log_sender_mock_raw_ptr, SendEncoded(_, _)).Times(0);
     dlt_server.SendVerbose(100U, verbose_entry);
     ::testing::Mock::VerifyAndClearExpectations(log_sender_mock_raw_ptr);
 
@@ -802,7 +840,7 @@ TEST_F(DltServerCreatedWithConfigFixture, SetLogLevelBehaviorIncreaseThresholdAl
     EXPECT_EQ(resp[0], static_cast<char>(config::kRetOk));
 
     // Now verbose should pass filtering and be forwarded once per assigned channel (DFLT + CORE) -> 2 calls.
-    EXPECT_CALL(*log_sender_mock_raw_ptr, SendVerbose(_, _, _)).Times(2);
+    EXPECT_CALL(*log_sender_mock_raw_ptr, SendEncoded(_, _)).Times(2);
     dlt_server.SendVerbose(100U, verbose_entry);
 }
 
@@ -824,7 +862,7 @@ TEST_F(DltServerCreatedWithConfigFixture, SetLogLevelBehaviorResetToDefaultBlock
     const auto resp_raise = dlt_server.SetLogLevel(DltidT{"APP0"}, DltidT{"CTX0"}, raise_threshold);
     EXPECT_EQ(resp_raise[0], static_cast<char>(config::kRetOk));
     // With raise_threshold, verbose accepted and forwarded for both assigned channels -> 2 calls.
-    EXPECT_CALL(*log_sender_mock_raw_ptr, SendVerbose(_, _, _)).Times(2);
+    EXPECT_CALL(*log_sender_mock_raw_ptr, SendEncoded(_, _)).Times(2);
     dlt_server.SendVerbose(100U, verbose_entry);
     ::testing::Mock::VerifyAndClearExpectations(log_sender_mock_raw_ptr);
 
@@ -835,6 +873,7 @@ TEST_F(DltServerCreatedWithConfigFixture, SetLogLevelBehaviorResetToDefaultBlock
 
     // With default threshold kOff, verbose must be filtered again
     EXPECT_CALL(*log_sender_mock_raw_ptr, SendVerbose(_, _, _)).Times(0);
+    EXPECT_CALL(*log_sender_mock_raw_ptr, SendEncoded(_, _)).Times(0);
     dlt_server.SendVerbose(100U, verbose_entry);
 }
 
@@ -911,10 +950,79 @@ TEST_F(DltServerCreatedWithConfigFixture, SendNonVerboseAppIdAcceptedByFiltering
     const score::mw::log::detail::LoggingIdentifier ctx_id{"CTX0"};
     const score::mw::log::config::NvMsgDescriptor desc{100U, app_id, ctx_id, score::mw::log::LogLevel::kOff};
 
-    EXPECT_CALL(*log_sender_mock_raw_ptr, SendNonVerbose(_, _, _, _, _)).Times(2);
+    EXPECT_CALL(*log_sender_mock_raw_ptr, SendEncoded(_, _)).Times(2);
     dlt_server.SendNonVerbose(desc, 100U, nullptr, 0);
 }
 
+TEST_F(DltServerCreatedWithConfigFixture, SendNonVerboseWithRouteReusesItUntilTheConfigurationChanges)
+{
+    EXPECT_CALL(read_callback, Call()).Times(1).WillOnce(Return(p_config));
+    EXPECT_CALL(write_callback, Call(_)).Times(0);
+
+    score::logging::dltserver::DltLogServer::DltLogServerTest dlt_server(
+        s_config, read_callback.AsStdFunction(), write_callback.AsStdFunction(), true, std::move(log_sender_mock));
+    const score::mw::log::detail::LoggingIdentifier app_id{"APP0"};
+    const score::mw::log::detail::LoggingIdentifier ctx_id{"CTX0"};
+    const score::mw::log::config::NvMsgDescriptor desc{100U, app_id, ctx_id, score::mw::log::LogLevel::kVerbose};
+    CachedRoute route{};
+
+    // the threshold of APP0/CTX0 is kOff, the route is resolved once and memoized
+    EXPECT_CALL(*log_sender_mock_raw_ptr, SendNonVerbose(_, _, _, _, _)).Times(0);
+    EXPECT_CALL(*log_sender_mock_raw_ptr, SendEncoded(_, _)).Times(0);
+    dlt_server.SendNonVerbose(desc, 100U, nullptr, 0, route);
+    const auto generation = route.generation;
+    EXPECT_NE(generation, 0U);
+    dlt_server.SendNonVerbose(desc, 100U, nullptr, 0, route);
+    EXPECT_EQ(route.generation, generation);
+    ::testing::Mock::VerifyAndClearExpectations(log_sender_mock_raw_ptr);
+
+    // raising the threshold outdates the memoized route, forwarding to both assigned channels
+    const ThresholdT new_threshold{LoglevelT{score::mw::log::LogLevel::kVerbose}};
+    const auto resp = dlt_server.SetLogLevel(DltidT{"APP0"}, DltidT{"CTX0"}, new_threshold);
+    EXPECT_EQ(resp[0], static_cast<char>(config::kRetOk));
+    EXPECT_CALL(*log_sender_mock_raw_ptr, SendEncoded(_, _)).Times(2);
+    dlt_server.SendNonVerbose(desc, 100U, nullptr, 0, route);
+    EXPECT_NE(route.generation, generation);
+}
+
+TEST_F(DltServerCreatedWithConfigFixture, SendVerboseWithRouteAppliesTheThresholdPerMessage)
+{
+    EXPECT_CALL(read_callback, Call()).Times(1).WillOnce(Return(p_config));
+    EXPECT_CALL(write_callback, Call(_)).Times(0);
+
+    score::logging::dltserver::DltLogServer::DltLogServerTest dlt_server(
+        s_config, read_callback.AsStdFunction(), write_callback.AsStdFunction(), true, std::move(log_sender_mock));
+    const score::mw::log::detail::LoggingIdentifier app_id{"APP0"};
+    const score::mw::log::detail::LoggingIdentifier ctx_id{"CTX0"};
+    const score::mw::log::detail::log_entry_deserialization::LogEntryDeserializationReflection off_entry{
+        app_id, ctx_id, {}, 0, score::mw::log::LogLevel::kOff};
+    const score::mw::log::detail::log_entry_deserialization::LogEntryDeserializationReflection verbose_entry{
+        app_id, ctx_id, {}, 0, score::mw::log::LogLevel::kVerbose};
+    CachedRoute route{};
+
+    // the memoized route of the context keeps the threshold, not the decision for one log level
+    EXPECT_CALL(*log_sender_mock_raw_ptr, SendEncoded(_, _)).Times(2);
+    dlt_server.SendVerbose(100U, off_entry, route);
+    dlt_server.SendVerbose(100U, verbose_entry, route);
+}
+
+TEST_F(DltServerCreatedWithConfigFixture, PrefilterVerboseRejectsMessagesAboveTheThresholdsOfAllTheirChannels)
+{
+    EXPECT_CALL(read_callback, Call()).Times(1).WillOnce(Return(p_config));
+    EXPECT_CALL(write_callback, Call(_)).Times(0);
+
+    // leaves the thresholds to the channels
+    s_config.filtering_enabled = false;
+    score::logging::dltserver::DltLogServer::DltLogServerTest dlt_server(
+        s_config, read_callback.AsStdFunction(), write_callback.AsStdFunction(), true, std::move(log_sender_mock));
+    CachedRoute route{};
+
+    // the context is routed to both channels, the more verbose of which sends errors
+    EXPECT_TRUE(dlt_server.PrefilterVerbose(route, DltidT{"APP0"}, DltidT{"CTX0"}, score::mw::log::LogLevel::kError));
+    EXPECT_NE(route.generation, 0U);
+    EXPECT_FALSE(dlt_server.PrefilterVerbose(route, DltidT{"APP0"}, DltidT{"CTX0"}, score::mw::log::LogLevel::kWarn));
+}
+
 // sendVerbose test.
 
 TEST_F(DltServerCreatedWithConfigFixture, SendVerboseNoAppIdAcceptedByFilteringNotAssignedToChannelExpectSendCallOnce)
@@ -942,8 +1050,43 @@ TEST_F(DltServerCreatedWithConfigFixture, SendVerboseAppIdAcceptedByFilteringExp
     const score::mw::log::detail::log_entry_deserialization::LogEntryDeserializationReflection entry{
         app_id, ctx_id, {}, 0, score::mw::log::LogLevel::kOff};
 
-    EXPECT_CALL(*log_sender_mock_raw_ptr, SendVerbose(_, _, _)).Times(2);
+    EXPECT_CALL(*log_sender_mock_raw_ptr, SendEncoded(_, _)).Times(2);
+    dlt_server.SendVerbose(100U, entry);
+}
+
+TEST_F(DltServerCreatedWithConfigFixture, SendVerboseToSeveralChannelsEncodesTheBodyOnce)
+{
+    EXPECT_CALL(read_callback, Call()).Times(1).WillOnce(Return(p_config));
+    EXPECT_CALL(write_callback, Call(_)).Times(0);
+
+    score::logging::dltserver::DltLogServer::DltLogServerTest dlt_server(
+        s_config, read_callback.AsStdFunction(), write_callback.AsStdFunction(), true, std::move(log_sender_mock));
+    const std::array<uint8_t, 8> payload{1, 2, 3, 4, 5, 6, 7, 8};
+    const score::mw::log::detail::log_entry_deserialization::LogEntryDeserializationReflection entry{
+        score::mw::log::detail::LoggingIdentifier{"APP0"},
+        score::mw::log::detail::LoggingIdentifier{"CTX0"},
+        {score::cpp::span<const uint8_t>{payload}},
+        1,
+        score::mw::log::LogLevel::kOff};
+    std::vector<char> expected_body(GetVerboseBodySize(entry));
+    ConstructVerboseBody(expected_body.data(), entry);
+
+    std::vector<const char*> bodies{};
+    EXPECT_CALL(*log_sender_mock_raw_ptr, SendVerbose(_, _, _)).Times(0);
+    EXPECT_CALL(*log_sender_mock_raw_ptr, SendEncoded(_, _))
+        .Times(2)
+        .WillRepeatedly(Invoke([&bodies, &expected_body](const DltEncodedMessage& message, DltLogChannel&) {
+            bodies.push_back(message.body.data());
+            EXPECT_TRUE(message.verbose);
+            EXPECT_EQ(message.tmsp, 100U);
+            EXPECT_EQ(message.payload_size, 8U);
+            EXPECT_EQ(std::string(message.body.data(), message.body.size()),
+                      std::string(expected_body.data(), expected_body.size()));
+        }));
     dlt_server.SendVerbose(100U, entry);
+
+    ASSERT_EQ(bodies.size(), 2U);
+    EXPECT_EQ(bodies.front(), bodies.back());
 }
 
 TEST_F(DltServerCreatedWithConfigFixture, SendVerboseAppIdNotExpectedLogLevelExpectSendNoCall)
@@ -959,6 +1102,7 @@ TEST_F(DltServerCreatedWithConfigFixture, SendVerboseAppIdNotExpectedLogLevelExp
         app_id, ctx_id, {}, 0, score::mw::log::LogLevel::kVerbose};
 
     EXPECT_CALL(*log_sender_mock_raw_ptr, SendVerbose(_, _, _)).Times(0);
+    EXPECT_CALL(*log_sender_mock_raw_ptr, SendEncoded(_, _)).Times(0);
     dlt_server.SendVerbose(100U, entry);
 }
 
@@ -1188,7 +1332,7 @@ TEST_F(DltServerCreatedWithConfigFixture, SetDltOutputEnableBehaviorBlocksAllSen
     EXPECT_TRUE(dlt_server.GetDltEnabled());
 
     // Basic sanity: calling sendVerbose still forwards to the log sender (2 channels).
-    EXPECT_CALL(*log_sender_mock_raw_ptr, SendVerbose(_, _, _)).Times(2);
+    EXPECT_CALL(*log_sender_mock_raw_ptr, SendEncoded(_, _)).Times(2);
     dlt_server.SendVerbose(100U, entry);
 }
 
@@ -1210,6 +1354,7 @@ TEST_F(DltServerCreatedWithConfigFixture, ResetToDefaultBehaviorRestoresInitialT
 
     // Initially threshold for APP0/CTX0 is kOff, so verbose should be filtered out
     EXPECT_CALL(*log_sender_mock_raw_ptr, SendVerbose(_, _, _)).Times(0);
+    EXPECT_CALL(*log_sender_mock_raw_ptr, SendEncoded(_, _)).Times(0);
     dlt_server.SendVerbose(100U, verbose_entry);
     ::testing::Mock::VerifyAndClearExpectations(log_sender_mock_raw_ptr);
 
@@ -1219,7 +1364,7 @@ TEST_F(DltServerCreatedWithConfigFixture, ResetToDefaultBehaviorRestoresInitialT
     EXPECT_EQ(resp[0], static_cast<char>(config::kRetOk));
 
     // Verify verbose now passes (2 channels: DFLT + CORE)
-    EXPECT_CALL(*log_sender_mock_raw_ptr, SendVerbose(_, _, _)).Times(2);
+    EXPECT_CALL(*log_sender_mock_raw_ptr, SendEncoded(_, _)).Times(2);
     dlt_server.SendVerbose(100U, verbose_entry);
     ::testing::Mock::VerifyAndClearExpectations(log_sender_mock_raw_ptr);
 
@@ -1230,6 +1375,7 @@ TEST_F(DltServerCreatedWithConfigFixture, ResetToDefaultBehaviorRestoresInitialT
 
     // After reset, threshold should be back to kOff, so verbose is filtered again
     EXPECT_CALL(*log_sender_mock_raw_ptr, SendVerbose(_, _, _)).Times(0);
+    EXPECT_CALL(*log_sender_mock_raw_ptr, SendEncoded(_, _)).Times(0);
     dlt_server.SendVerbose(100U, verbose_entry);
 }
 
@@ -14,12 +14,19 @@
 #include "logparser/logparser.h"
 
 #include "score/mw/log/configuration/invconfig_mock.h"
+#include "score/mw/log/configuration/nvconfig.h"
+#include "score/mw/log/detail/logging_identifier.h"
 
 #include "static_reflection_with_serialization/serialization/for_logging.h"
 
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 
+#include <array>
+#include <cstring>
+#include <memory>
+#include <vector>
+
 using namespace testing;
 
 using MsgsizeT = std::uint16_t;
@@ -89,6 +96,67 @@ class TypeHandlerMock : public LogParser::TypeHandler
     MOCK_METHOD(void, Handle, (TimestampT, const char*, BufsizeT), (override final));
 };
 
+/// Counts the records of each type in the state it keeps for the type.
+class CountingState : public LogParser::HandlerState
+{
+  public:
+    explicit CountingState(const BufsizeT type_id) : type_id_{type_id} {}
+
+    BufsizeT type_id_;
+    std::size_t count_{0U};
+};
+
+class StatefulTypeHandler : public LogParser::TypeHandler
+{
+  public:
+    void Handle(TimestampT, const char*, BufsizeT) override
+    {
+        ++stateless_calls_;
+    }
+
+    std::unique_ptr<LogParser::HandlerState> CreateState(const TypeInfo& type_info) override
+    {
+        auto state = std::make_unique<CountingState>(type_info.id);
+        states_.push_back(state.get());
+        return state;
+    }
+
+    void HandleWithState(LogParser::HandlerState* state, TimestampT, const char*, BufsizeT) override
+    {
+        ++static_cast<CountingState*>(state)->count_;
+    }
+
+    std::vector<const CountingState*> states_{};
+    std::size_t stateless_calls_{0U};
+};
+
+class StatefulAnyHandler : public LogParser::AnyHandler
+{
+  public:
+    void Handle(const TypeInfo&, TimestampT, const char*, BufsizeT) override
+    {
+        ++stateless_calls_;
+    }
+
+    std::unique_ptr<LogParser::HandlerState> CreateState(const TypeInfo& type_info) override
+    {
+        auto state = std::make_unique<CountingState>(type_info.id);
+        states_.push_back(state.get());
+        return state;
+    }
+
+    void HandleWithState(const TypeInfo& type_info, LogParser::HandlerState* state, TimestampT, const char*, BufsizeT)
+        override
+    {
+        auto* const counting_state = static_cast<CountingState*>(state);
+        EXPECT_EQ(counting_state->type_id_, type_info.id);
+        ++counting_state->count_;
+    }
+
+    std::vector<const CountingState*> states_{};
+    std::size_t stateless_calls_{0U};
+};
+
 TEST(LogParserTest, SingleMessageHandler)
 {
     testing::StrictMock<AnyHandlerMock> any_handler;
@@ -188,4 +256,190 @@ TEST(LogParserTest, WeCanNotParseASharedMemoryRecordIfTheTypeIdentifierIsNotWith
     // Since we didn't fill any values to 'index_parser_map' map, it will be empty which leads to immediate returning.
 }
 
+struct TestLogEntry
+{
+    score::mw::log::detail::LoggingIdentifier app_id{""};
+    score::mw::log::detail::LoggingIdentifier ctx_id{""};
+    std::vector<std::uint8_t> payload;
+    std::uint8_t num_of_args{0U};
+    score::mw::log::LogLevel log_level{score::mw::log::LogLevel::kOff};
+};
+STRUCT_TRACEABLE(TestLogEntry, app_id, ctx_id, payload, num_of_args, log_level)
+
+std::string MakeTypeParamsForName(const std::string& type_name)
+{
+    const auto type_name_size = static_cast<std::uint32_t>(type_name.size());
+    std::string type_name_size_bytes(sizeof(type_name_size), char(0));
+    // NOLINTNEXTLINE(score-banned-function) serialization of trivially copyable
+    std::memcpy(type_name_size_bytes.data(), &type_name_size, sizeof(type_name_size));
+    return std::string(4, char(0)) + std::string(DltidT{"ECU0"}) + std::string(DltidT{"APP0"}) +
+           type_name_size_bytes + type_name;
+}
+
+score::mw::log::detail::SharedMemoryRecord MakeRecord(const BufsizeT type_index, std::string& payload)
+{
+    score::mw::log::detail::SharedMemoryRecord record;
+    record.header.type_identifier = static_cast<score::mw::log::detail::TypeIdentifier>(type_index);
+    record.payload = score::cpp::span<score::mw::log::detail::Byte>{payload.data(), payload.size()};
+    return record;
+}
+
+TEST(LogParserTest, GetLogLevelOfUnknownTypeIsNotAvailable)
+{
+    LogParser parser(CreateTestNvConfig());
+    std::string payload{"TestData"};
+    EXPECT_FALSE(parser.GetLogLevel(MakeRecord(7U, payload)).has_value());
+}
+
+TEST(LogParserTest, GetLogLevelOfNonVerboseRecordIsTakenFromItsDescriptor)
+{
+    static const score::mw::log::config::NvMsgDescriptor kDescriptor{1234U,
+                                                                   score::mw::log::detail::LoggingIdentifier{"APP0"},
+                                                                   score::mw::log::detail::LoggingIdentifier{"CTX0"},
+                                                                   score::mw::log::LogLevel::kWarn};
+    score::mw::log::INvConfigMock nv_config;
+    EXPECT_CALL(nv_config, GetDltMsgDesc(_)).WillRepeatedly(Return(&kDescriptor));
+
+    LogParser parser(nv_config);
+    constexpr BufsizeT kTestMessageIndex = 7U;
+    parser.AddIncomingType(kTestMessageIndex, MakeTypeParams<TestMessage>(DltidT{"ECU0"}, DltidT{"APP0"}));
+
+    std::string payload{"TestData"};
+    EXPECT_EQ(parser.GetLogLevel(MakeRecord(kTestMessageIndex, payload)), score::mw::log::LogLevel::kWarn);
+}
+
+TEST(LogParserTest, GetLogLevelOfTypeWithoutDescriptorIsNotAvailable)
+{
+    score::mw::log::INvConfigMock nv_config;
+    EXPECT_CALL(nv_config, GetDltMsgDesc(_)).WillRepeatedly(Return(nullptr));
+
+    LogParser parser(nv_config);
+    constexpr BufsizeT kTestMessageIndex = 7U;
+    parser.AddIncomingType(kTestMessageIndex, MakeTypeParams<TestMessage>(DltidT{"ECU0"}, DltidT{"APP0"}));
+
+    std::string payload{"TestData"};
+    EXPECT_FALSE(parser.GetLogLevel(MakeRecord(kTestMessageIndex, payload)).has_value());
+}
+
+TEST(LogParserTest, GetLogLevelOfVerboseLogEntryIsReadFromItsHeader)
+{
+    score::mw::log::INvConfigMock nv_config;
+    EXPECT_CALL(nv_config, GetDltMsgDesc(_)).WillRepeatedly(Return(nullptr));
+
+    LogParser parser(nv_config);
+    constexpr BufsizeT kLogEntryIndex = 1U;
+    parser.AddIncomingType(kLogEntryIndex, MakeTypeParamsForName("score::mw::log::detail::LogEntry"));
+
+    TestLogEntry entry;
+    entry.payload = {1U, 2U, 3U};
+    entry.num_of_args = 1U;
+    entry.log_level = score::mw::log::LogLevel::kDebug;
+    std::array<char, 256> buffer{};
+    using LoggingSerializer = ::score::common::visitor::logging_serializer;
+    const auto size = LoggingSerializer::serialize(entry, buffer.data(), buffer.size());
+    std::string payload{buffer.data(), size};
+
+    EXPECT_EQ(parser.GetLogLevel(MakeRecord(kLogEntryIndex, payload)), score::mw::log::LogLevel::kDebug);
+}
+
+TEST(LogParserTest, RecordsOfDenseAndSparseTypeIdentifiersAreDispatchedToTheirTypeHandlers)
+{
+    testing::StrictMock<TypeHandlerMock> message_handler;
+    testing::StrictMock<TypeHandlerMock> filter_handler;
+    EXPECT_CALL(message_handler, Handle(_, _, _)).Times(2);
+    EXPECT_CALL(filter_handler, Handle(_, _, _)).Times(2);
+
+    LogParser parser(CreateTestNvConfig(),
+                     {},
+                     LogParser::HandleRequestMap{{"test::TestMessage", &message_handler},
+                                                 {"test::TestFilter", &filter_handler}});
+    // one identifier looked up by index, one beyond the dense range of the shared memory type identifiers
+    constexpr BufsizeT kDenseIndex = 3U;
+    constexpr BufsizeT kSparseIndex = 50000U;
+    parser.AddIncomingType(kDenseIndex, MakeTypeParams<TestMessage>(DltidT{"ECU0"}, DltidT{"APP0"}));
+    parser.AddIncomingType(kSparseIndex, MakeTypeParams<TestFilter>(DltidT{"ECU0"}, DltidT{"APP0"}));
+
+    std::string payload{"TestData"};
+    parser.ParseSharedMemoryRecord(MakeRecord(kDenseIndex, payload));
+    parser.ParseSharedMemoryRecord(MakeRecord(kSparseIndex, payload));
+
+    const TimestampT time_now = TimestampT::clock::now();
+    const std::string dense_message = MakeMessage(kDenseIndex, TestMessage{1});
+    parser.Parse(time_now, dense_message.data(), static_cast<BufsizeT>(dense_message.size()));
+    const std::string sparse_message = MakeMessage(kSparseIndex, TestFilter{2});
+    parser.Parse(time_now, sparse_message.data(), static_cast<BufsizeT>(sparse_message.size()));
+
+    // unregistered identifiers within the table, past its end and beyond the dense range are dropped
+    parser.ParseSharedMemoryRecord(MakeRecord(2U, payload));
+    parser.ParseSharedMemoryRecord(MakeRecord(100U, payload));
+    parser.ParseSharedMemoryRecord(MakeRecord(50001U, payload));
+}
+
+TEST(LogParserTest, TypeHandlersAreCalledBeforeGlobalHandlersWithTheInfoOfTheType)
+{
+    testing::StrictMock<AnyHandlerMock> any_handler;
+    testing::StrictMock<TypeHandlerMock> type_handler;
+    constexpr BufsizeT kTestMessageIndex = 9U;
+    {
+        testing::InSequence sequence;
+        EXPECT_CALL(type_handler, Handle(_, _, _));
+        EXPECT_CALL(any_handler, Handle(Field(&TypeInfo::id, kTestMessageIndex), _, _, _));
+    }
+
+    LogParser parser(
+        CreateTestNvConfig(), {&any_handler}, LogParser::HandleRequestMap{{"test::TestMessage", &type_handler}});
+    parser.AddIncomingType(kTestMessageIndex, MakeTypeParams<TestMessage>(DltidT{"ECU0"}, DltidT{"APP0"}));
+
+    std::string payload{"TestData"};
+    parser.ParseSharedMemoryRecord(MakeRecord(kTestMessageIndex, payload));
+}
+
+TEST(LogParserTest, TypeRegisteredAgainKeepsItsFirstRegistration)
+{
+    testing::StrictMock<TypeHandlerMock> message_handler;
+    testing::StrictMock<TypeHandlerMock> filter_handler;
+    EXPECT_CALL(message_handler, Handle(_, _, _)).Times(1);
+
+    LogParser parser(CreateTestNvConfig(),
+                     {},
+                     LogParser::HandleRequestMap{{"test::TestMessage", &message_handler},
+                                                 {"test::TestFilter", &filter_handler}});
+    constexpr BufsizeT kTestMessageIndex = 4U;
+    parser.AddIncomingType(kTestMessageIndex, MakeTypeParams<TestMessage>(DltidT{"ECU0"}, DltidT{"APP0"}));
+    parser.AddIncomingType(kTestMessageIndex, MakeTypeParams<TestFilter>(DltidT{"ECU0"}, DltidT{"APP0"}));
+
+    std::string payload{"TestData"};
+    parser.ParseSharedMemoryRecord(MakeRecord(kTestMessageIndex, payload));
+}
+
+TEST(LogParserTest, HandlersKeepTheirStatePerRegisteredType)
+{
+    StatefulTypeHandler type_handler;
+    StatefulAnyHandler any_handler;
+    LogParser parser(CreateTestNvConfig(),
+                     {&any_handler},
+                     LogParser::HandleRequestMap{{"test::TestMessage", &type_handler},
+                                                 {"test::TestFilter", &type_handler}});
+    constexpr BufsizeT kMessageIndex = 5U;
+    constexpr BufsizeT kFilterIndex = 6U;
+    parser.AddIncomingType(kMessageIndex, MakeTypeParams<TestMessage>(DltidT{"ECU0"}, DltidT{"APP0"}));
+    parser.AddIncomingType(kFilterIndex, MakeTypeParams<TestFilter>(DltidT{"ECU0"}, DltidT{"APP0"}));
+    ASSERT_EQ(type_handler.states_.size(), 2U);
+    ASSERT_EQ(any_handler.states_.size(), 2U);
+
+    std::string payload{"TestData"};
+    parser.ParseSharedMemoryRecord(MakeRecord(kMessageIndex, payload));
+    parser.ParseSharedMemoryRecord(MakeRecord(kMessageIndex, payload));
+    parser.ParseSharedMemoryRecord(MakeRecord(kFilterIndex, payload));
+
+    EXPECT_EQ(type_handler.states_.at(0U)->type_id_, kMessageIndex);
+    EXPECT_EQ(type_handler.states_.at(0U)->count_, 2U);
+    EXPECT_EQ(type_handler.states_.at(1U)->type_id_, kFilterIndex);
+    EXPECT_EQ(type_handler.states_.at(1U)->count_, 1U);
+    EXPECT_EQ(any_handler.states_.at(0U)->count_, 2U);
+    EXPECT_EQ(any_handler.states_.at(1U)->count_, 1U);
+    EXPECT_EQ(type_handler.stateless_calls_, 0U);
+    EXPECT_EQ(any_handler.stateless_calls_, 0U);
+}
+
 }  // namespace test
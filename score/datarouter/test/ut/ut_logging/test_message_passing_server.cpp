@@ -26,10 +26,12 @@
 
 #include "gtest/gtest.h"
 
+#include <algorithm>
 #include <atomic>
 #include <condition_variable>
 #include <mutex>
 #include <thread>
+#include <vector>
 
 using namespace score::message_passing;
 
@@ -89,6 +91,8 @@ class MockSession : public MessagePassingServer::ISession
     MOCK_METHOD(void, OnAcquireResponse, (const score::mw::log::detail::ReadAcquireResult&), (override final));
     MOCK_METHOD(void, OnClosedByPeer, (), (override final));
     MOCK_METHOD(bool, IsSourceClosed, (), (override));
+    MOCK_METHOD(MessagePassingServer::TickActivity, GetTickActivity, (), (const, override));
+    MOCK_METHOD(double, GetFillRatio, (), (const, override));
 
     MOCK_METHOD(void, Destruct, (), ());
 
@@ -109,9 +113,12 @@ class MessagePassingServer::MessagePassingServerForTest : public MessagePassingS
   public:
     using MessagePassingServer::connection_timeout_;
     using MessagePassingServer::FinishPreviousSessionWhileLocked;
+    using MessagePassingServer::GetNextTickDelay;
+    using MessagePassingServer::GetTickUrgency;
     using MessagePassingServer::MessagePassingServer;
     using MessagePassingServer::mutex_;
     using MessagePassingServer::pid_session_map_;
+    using MessagePassingServer::SelectHomeWorker;
     using MessagePassingServer::SessionWrapper;
     using MessagePassingServer::stop_source_;
 };
@@ -145,6 +152,9 @@ class MessagePassingServerFixture : public ::testing::Test
         pid_t pid;
         score::cpp::pmr::unique_ptr<score::platform::internal::daemon::ISessionHandle> handle;
 
+        // detects concurrent ticks of the same session
+        std::atomic<bool> in_tick{false};
+
         std::mutex tick_count_mutex;
         std::condition_variable tick_count_cond;
         std::uint32_t tick_count{0};
@@ -189,9 +199,15 @@ class MessagePassingServerFixture : public ::testing::Test
             ++construct_count;
             auto session = std::make_unique<MockSession>();
             EXPECT_CALL(*session, Tick).Times(AnyNumber()).WillRepeatedly([this, &status]() {
+                EXPECT_FALSE(status.in_tick.exchange(true));
                 ++tick_count;
+                {
+                    std::lock_guard<std::mutex> order_lock(tick_order_mutex);
+                    tick_order.push_back(status.pid);
+                }
                 status.IncrementTickCount();
-                CheckWaitTickUnblock();
+                CheckWaitTickUnblock(status.pid);
+                status.in_tick = false;
                 return false;
             });
             EXPECT_CALL(*session, OnAcquireResponse)
@@ -203,6 +219,13 @@ class MessagePassingServerFixture : public ::testing::Test
                 ++closed_by_peer_count;
             });
             EXPECT_CALL(*session, IsSourceClosed).Times(AnyNumber()).WillRepeatedly(Return(false));
+            EXPECT_CALL(*session, GetTickActivity).Times(AnyNumber()).WillRepeatedly([this]() {
+                return tick_activity.load();
+            });
+            const auto fill_ratio = fill_ratios.find(pid);
+            EXPECT_CALL(*session, GetFillRatio)
+                .Times(AnyNumber())
+                .WillRepeatedly(Return((fill_ratio != fill_ratios.end()) ? fill_ratio->second : 0.0));
             EXPECT_CALL(*session, Destruct).Times(1).WillOnce([this, &status]() {
                 ++destruct_count;
                 std::lock_guard<std::mutex> erase_lock(map_mutex);
@@ -221,20 +244,21 @@ class MessagePassingServerFixture : public ::testing::Test
     {
         EXPECT_CALL(*server_mock, Destruct()).Times(AnyNumber());
     }
-    void CheckWaitTickUnblock()
+    void CheckWaitTickUnblock(const pid_t pid)
     {
+        const auto is_unblocked = [this, pid]() {
+            return !tick_blocker && tick_blocker_pid != pid;
+        };
         // atomic fast path, to avoid introduction of explicit thread serialization on tick_blocker_mutex_
-        if (!tick_blocker)
+        if (is_unblocked())
         {
             return;
         }
         std::unique_lock<std::mutex> lock(tick_blocker_mutex);
-        tick_blocker_cond.wait(lock, [this]() {
-            return !tick_blocker;
-        });
+        tick_blocker_cond.wait(lock, is_unblocked);
     }
 
-    void InstantiateServer(MessagePassingServer::SessionFactory factory = {})
+    void InstantiateServer(MessagePassingServer::SessionFactory factory = {}, const std::size_t worker_count = 1U)
     {
         // capture MessagePassingServer-installed callbacks when provided
         EXPECT_CALL(*server_mock,
@@ -254,7 +278,7 @@ class MessagePassingServerFixture : public ::testing::Test
             });
 
         // instantiate MessagePassingServer
-        server.emplace(factory, server_factory_mock, client_factory_mock);
+        server.emplace(factory, server_factory_mock, client_factory_mock, worker_count);
     }
 
     auto CreateConnectMessageSample(const pid_t)
@@ -340,6 +364,7 @@ class MessagePassingServerFixture : public ::testing::Test
     std::mutex map_mutex;
     std::condition_variable map_cond;  // currently only used for destruction
     std::unordered_map<pid_t, SessionStatus> session_map;
+    std::unordered_map<pid_t, double> fill_ratios;  // to be set before the session is connected
 
     std::int32_t construct_count{0};
     std::int32_t acquire_response_count{0};
@@ -349,6 +374,11 @@ class MessagePassingServerFixture : public ::testing::Test
     std::mutex tick_blocker_mutex;
     std::condition_variable tick_blocker_cond;
     std::atomic<bool> tick_blocker{false};
+    std::atomic<pid_t> tick_blocker_pid{0};  // blocks ticks of a single session only
+    std::atomic<MessagePassingServer::TickActivity> tick_activity{MessagePassingServer::TickActivity::kActive};
+
+    std::mutex tick_order_mutex;
+    std::vector<pid_t> tick_order;
 
     // can be run on a worker thread without explicit synchronization
     std::atomic<std::int32_t> tick_count{0};
@@ -653,6 +683,262 @@ TEST_F(MessagePassingServerFixture, TestSamePidWhileQueued)
     EXPECT_EQ(destruct_count, 4);
 }
 
+TEST_F(MessagePassingServerFixture, TestWorkerPoolTicksOtherSessionsWhileOneIsBlocked)
+{
+    ExpectOurPidIsQueried();
+
+    // CLIENT0 and CLIENT2 share the run queue of the first worker, so CLIENT2 can only be ticked by stealing
+    InstantiateServer(GetCountingSessionFactory(), 2U);
+
+    tick_blocker_pid = kClienT0Pid;
+    auto* client0 = ExpectConnectCallBackCalledAndClientCreated(kClienT0Pid);
+    session_map.at(kClienT0Pid).WaitStartOfFirstTick();
+
+    // with a single worker, both sessions would wait until the tick of CLIENT0 is unblocked
+    auto* client1 = ExpectConnectCallBackCalledAndClientCreated(kClienT1Pid);
+    auto* client2 = ExpectConnectCallBackCalledAndClientCreated(kClienT2Pid);
+    session_map.at(kClienT1Pid).WaitStartOfFirstTick();
+    session_map.at(kClienT2Pid).WaitStartOfFirstTick();
+    EXPECT_EQ(construct_count, 3);
+
+    {
+        std::lock_guard<std::mutex> lock(tick_blocker_mutex);
+        tick_blocker_pid = 0;
+    }
+    tick_blocker_cond.notify_all();
+
+    ExpectServerDestruction();
+    ExpectClientDestruction(client0);
+    ExpectClientDestruction(client1);
+    ExpectClientDestruction(client2);
+    UninstantiateServer();
+
+    EXPECT_EQ(closed_by_peer_count, 0);
+    EXPECT_EQ(destruct_count, 3);
+}
+
+TEST_F(MessagePassingServerFixture, TestWorkerPoolNeverTicksSessionConcurrently)
+{
+    ExpectOurPidIsQueried();
+
+    InstantiateServer(GetCountingSessionFactory(), 4U);
+
+    auto* client0 = ExpectConnectCallBackCalledAndClientCreated(kClienT0Pid);
+    auto* client1 = ExpectConnectCallBackCalledAndClientCreated(kClienT1Pid);
+
+    StrictMock<::score::message_passing::ServerConnectionMock> connection;
+    score::message_passing::ClientIdentity client_identity{kClienT0Pid, 0, 0};
+    EXPECT_CALL(connection, GetClientIdentity()).Times(AnyNumber()).WillRepeatedly(ReturnRef(client_identity));
+
+    score::mw::log::detail::ReadAcquireResult acquire_result{0U};
+    std::array<std::uint8_t, sizeof(acquire_result) + 1> message{};
+    message[0] = score::cpp::to_underlying(DatarouterMessageIdentifier::kAcquireResponse);
+    std::memcpy(&message[1], &acquire_result, sizeof(acquire_result));
+
+    // every acquire response requests another tick while idle workers are available;
+    // concurrent ticks of the session are detected inside of the tick
+    constexpr std::int32_t kNumberOfResponses = 1000;
+    for (std::int32_t i = 0; i < kNumberOfResponses; ++i)
+    {
+        sent_callback(connection, message);
+    }
+    EXPECT_EQ(acquire_response_count, kNumberOfResponses);
+
+    ExpectServerDestruction();
+    ExpectClientDestruction(client0);
+    ExpectClientDestruction(client1);
+    UninstantiateServer();
+
+    EXPECT_GE(tick_count, 2);
+    EXPECT_EQ(destruct_count, 2);
+}
+
+TEST_F(MessagePassingServerFixture, TestPendingSessionIsTickedBeforeDefaultInterval)
+{
+    ExpectOurPidIsQueried();
+
+    InstantiateServer(GetCountingSessionFactory());
+
+    tick_activity = MessagePassingServer::TickActivity::kPending;
+    auto* client0 = ExpectConnectCallBackCalledAndClientCreated(kClienT0Pid);
+
+    // with the default interval of 100ms only the tick triggered by the connection would happen
+    using namespace std::chrono_literals;
+    std::this_thread::sleep_for(50ms);
+    EXPECT_GE(tick_count, 3);
+
+    ExpectServerDestruction();
+    ExpectClientDestruction(client0);
+    UninstantiateServer();
+
+    EXPECT_EQ(destruct_count, 1);
+}
+
+TEST_F(MessagePassingServerFixture, TestFullestSessionIsTickedFirst)
+{
+    ExpectOurPidIsQueried();
+
+    InstantiateServer(GetCountingSessionFactory());
+
+    fill_ratios[kClienT1Pid] = 0.1;
+    fill_ratios[kClienT2Pid] = 0.9;
+
+    // keep the only worker busy, so that both sessions wait in its run queue
+    tick_blocker_pid = kClienT0Pid;
+    auto* client0 = ExpectConnectCallBackCalledAndClientCreated(kClienT0Pid);
+    session_map.at(kClienT0Pid).WaitStartOfFirstTick();
+    auto* client1 = ExpectConnectCallBackCalledAndClientCreated(kClienT1Pid);
+    auto* client2 = ExpectConnectCallBackCalledAndClientCreated(kClienT2Pid);
+
+    {
+        std::lock_guard<std::mutex> lock(tick_blocker_mutex);
+        tick_blocker_pid = 0;
+    }
+    tick_blocker_cond.notify_all();
+    session_map.at(kClienT1Pid).WaitStartOfFirstTick();
+    session_map.at(kClienT2Pid).WaitStartOfFirstTick();
+
+    {
+        std::lock_guard<std::mutex> lock(tick_order_mutex);
+        const auto first_tick_of_client1 = std::find(tick_order.cbegin(), tick_order.cend(), kClienT1Pid);
+        const auto first_tick_of_client2 = std::find(tick_order.cbegin(), tick_order.cend(), kClienT2Pid);
+        EXPECT_LT(first_tick_of_client2, first_tick_of_client1);
+    }
+
+    ExpectServerDestruction();
+    ExpectClientDestruction(client0);
+    ExpectClientDestruction(client1);
+    ExpectClientDestruction(client2);
+    UninstantiateServer();
+
+    EXPECT_EQ(destruct_count, 3);
+}
+
+TEST_F(MessagePassingServerFixture, TestEquallyFullSessionsAreTickedInQueueOrder)
+{
+    ExpectOurPidIsQueried();
+
+    InstantiateServer(GetCountingSessionFactory());
+
+    fill_ratios[kClienT1Pid] = 0.5;
+    fill_ratios[kClienT2Pid] = 0.5;
+
+    // keep the only worker busy, so that both sessions wait in its run queue
+    tick_blocker_pid = kClienT0Pid;
+    auto* client0 = ExpectConnectCallBackCalledAndClientCreated(kClienT0Pid);
+    session_map.at(kClienT0Pid).WaitStartOfFirstTick();
+    auto* client1 = ExpectConnectCallBackCalledAndClientCreated(kClienT1Pid);
+    auto* client2 = ExpectConnectCallBackCalledAndClientCreated(kClienT2Pid);
+
+    {
+        std::lock_guard<std::mutex> lock(tick_blocker_mutex);
+        tick_blocker_pid = 0;
+    }
+    tick_blocker_cond.notify_all();
+    session_map.at(kClienT1Pid).WaitStartOfFirstTick();
+    session_map.at(kClienT2Pid).WaitStartOfFirstTick();
+
+    {
+        // the urgency is computed when queued, the session waiting longer ranks first
+        std::lock_guard<std::mutex> lock(tick_order_mutex);
+        const auto first_tick_of_client1 = std::find(tick_order.cbegin(), tick_order.cend(), kClienT1Pid);
+        const auto first_tick_of_client2 = std::find(tick_order.cbegin(), tick_order.cend(), kClienT2Pid);
+        EXPECT_LT(first_tick_of_client1, first_tick_of_client2);
+    }
+
+    ExpectServerDestruction();
+    ExpectClientDestruction(client0);
+    ExpectClientDestruction(client1);
+    ExpectClientDestruction(client2);
+    UninstantiateServer();
+
+    EXPECT_EQ(destruct_count, 3);
+}
+
+TEST(MessagePassingServerTests, TickUrgencyPrefersFullerBuffers)
+{
+    using namespace std::chrono_literals;
+    using Server = MessagePassingServer::MessagePassingServerForTest;
+
+    EXPECT_GT(Server::GetTickUrgency(0.9, 0us), Server::GetTickUrgency(0.1, 0us));
+    EXPECT_GT(Server::GetTickUrgency(0.5, 1000us), Server::GetTickUrgency(0.5, 0us));
+    // the fill ratio is an approximation and may exceed the buffer size
+    EXPECT_EQ(Server::GetTickUrgency(5.0, 0us), Server::GetTickUrgency(1.0, 0us));
+    EXPECT_EQ(Server::GetTickUrgency(-1.0, 0us), Server::GetTickUrgency(0.0, 0us));
+}
+
+TEST(MessagePassingServerTests, TickUrgencyAgesSessionsWithEmptyBuffers)
+{
+    using namespace std::chrono_literals;
+    using Server = MessagePassingServer::MessagePassingServerForTest;
+
+    // a session waiting long enough outranks a newly enqueued one with a full buffer
+    EXPECT_GT(Server::GetTickUrgency(0.0, 60000us), Server::GetTickUrgency(1.0, 0us));
+    EXPECT_LT(Server::GetTickUrgency(0.0, 40000us), Server::GetTickUrgency(1.0, 0us));
+}
+
+TEST(MessagePassingServerTests, NextTickDelayBacksOffPendingSessions)
+{
+    using namespace std::chrono_literals;
+    using Server = MessagePassingServer::MessagePassingServerForTest;
+    constexpr auto kPending = MessagePassingServer::TickActivity::kPending;
+
+    EXPECT_EQ(Server::GetNextTickDelay(kPending, 0us), 50us);
+    EXPECT_EQ(Server::GetNextTickDelay(kPending, 50us), 100us);
+    EXPECT_EQ(Server::GetNextTickDelay(kPending, 6400us), 10000us);
+    EXPECT_EQ(Server::GetNextTickDelay(kPending, 10000us), 10000us);
+    // backoff restarts after a slow tick
+    EXPECT_EQ(Server::GetNextTickDelay(kPending, 100000us), 50us);
+}
+
+TEST(MessagePassingServerTests, NextTickDelayGrowsForIdleSessions)
+{
+    using namespace std::chrono_literals;
+    using Server = MessagePassingServer::MessagePassingServerForTest;
+    constexpr auto kIdle = MessagePassingServer::TickActivity::kIdle;
+
+    EXPECT_EQ(Server::GetNextTickDelay(kIdle, 0us), 100000us);
+    EXPECT_EQ(Server::GetNextTickDelay(kIdle, 50us), 100000us);
+    EXPECT_EQ(Server::GetNextTickDelay(kIdle, 100000us), 200000us);
+    EXPECT_EQ(Server::GetNextTickDelay(kIdle, 200000us), 400000us);
+    EXPECT_EQ(Server::GetNextTickDelay(kIdle, 400000us), 400000us);
+}
+
+TEST(MessagePassingServerTests, NextTickDelayIsDefaultIntervalForActiveSessions)
+{
+    using namespace std::chrono_literals;
+    using Server = MessagePassingServer::MessagePassingServerForTest;
+    constexpr auto kActive = MessagePassingServer::TickActivity::kActive;
+
+    EXPECT_EQ(Server::GetNextTickDelay(kActive, 0us), 100000us);
+    EXPECT_EQ(Server::GetNextTickDelay(kActive, 50us), 100000us);
+    EXPECT_EQ(Server::GetNextTickDelay(kActive, 400000us), 100000us);
+}
+
+TEST(MessagePassingServerTests, NextTickDelayIsZeroForYieldedSessions)
+{
+    using namespace std::chrono_literals;
+    using Server = MessagePassingServer::MessagePassingServerForTest;
+    constexpr auto kYielded = MessagePassingServer::TickActivity::kYielded;
+
+    EXPECT_EQ(Server::GetNextTickDelay(kYielded, 0us), 0us);
+    EXPECT_EQ(Server::GetNextTickDelay(kYielded, 400000us), 0us);
+}
+
+TEST(MessagePassingServerTests, HomeWorkerIsPlacedOnTheMemoryNodeOfTheSession)
+{
+    using Server = MessagePassingServer::MessagePassingServerForTest;
+    const std::vector<std::optional<std::int32_t>> worker_memory_nodes{0, 1, 0, 1};
+
+    EXPECT_EQ(Server::SelectHomeWorker(4, 1, worker_memory_nodes), 1U);
+    EXPECT_EQ(Server::SelectHomeWorker(5, 1, worker_memory_nodes), 3U);
+    EXPECT_EQ(Server::SelectHomeWorker(5, 0, worker_memory_nodes), 2U);
+    // sessions without a node, or on a node without workers, are spread over all workers
+    EXPECT_EQ(Server::SelectHomeWorker(7, std::nullopt, worker_memory_nodes), 3U);
+    EXPECT_EQ(Server::SelectHomeWorker(6, 2, worker_memory_nodes), 2U);
+    EXPECT_EQ(Server::SelectHomeWorker(7, 1, {std::nullopt, std::nullopt}), 1U);
+}
+
 TEST(MessagePassingServerTests, sessionWrapperCreateTest)
 {
     InSequence s;
@@ -886,6 +1172,44 @@ TEST(MessagePassingServerTests, SessionHandleAcquireRequestNotReady)
     EXPECT_CALL(*client_raw_ptr, Destruct()).Times(AnyNumber());
 }
 
+// Covers SessionHandle::GrantPoolBlock: the slot is only announced on a started connection.
+TEST(MessagePassingServerTests, SessionHandleGrantPoolBlockSendsSlotOnceReady)
+{
+    const pid_t pid = 0;
+    constexpr std::uint32_t kSlot{1U};
+
+    auto client = score::cpp::pmr::make_unique<score::message_passing::ClientConnectionMock>(score::cpp::pmr::get_default_resource());
+    auto* client_raw_ptr = client.get();
+    MessagePassingServer* msg_server = nullptr;
+
+    EXPECT_CALL(*client_raw_ptr,
+                Start(Matcher<score::message_passing::IClientConnection::StateCallback>(_),
+                      Matcher<score::message_passing::IClientConnection::NotifyCallback>(_)));
+    EXPECT_CALL(*client_raw_ptr, GetState())
+        .WillRepeatedly(Return(score::message_passing::IClientConnection::State::kReady));
+
+    MessagePassingServer::SessionHandle session_handle(pid, msg_server, std::move(client));
+    EXPECT_FALSE(session_handle.GrantPoolBlock(kSlot));
+
+    std::vector<std::uint8_t> grant_message{};
+    EXPECT_CALL(*client_raw_ptr, Send(An<score::cpp::span<const std::uint8_t>>()))
+        .WillOnce(Return(score::cpp::expected_blank<score::os::Error>{}))
+        .WillOnce([&grant_message](const auto message) {
+            grant_message.assign(message.begin(), message.end());
+            return score::cpp::expected_blank<score::os::Error>{};
+        });
+    EXPECT_TRUE(session_handle.AcquireRequest());
+    EXPECT_TRUE(session_handle.GrantPoolBlock(kSlot));
+
+    ASSERT_EQ(grant_message.size(), sizeof(kSlot) + 1UL);
+    EXPECT_EQ(grant_message.front(), score::cpp::to_underlying(DatarouterMessageIdentifier::kPoolBlockGrant));
+    std::uint32_t slot{};
+    std::memcpy(&slot, &grant_message[1], sizeof(slot));
+    EXPECT_EQ(slot, kSlot);
+
+    EXPECT_CALL(*client_raw_ptr, Destruct()).Times(AnyNumber());
+}
+
 // Covers OnConnectRequest "ConnectMessageFromClient too small" branch:
 // send a kConnect message whose payload is smaller than sizeof(ConnectMessageFromClient).
 TEST_F(MessagePassingServerFixture, OnConnectRequestMessageTooSmall)
@@ -46,6 +46,14 @@ class MockDltOutput : public DltNonverboseHandler::IOutput
                 SendNonVerbose,
                 (const score::mw::log::config::NvMsgDescriptor& desc, uint32_t tmsp, const void* data, size_t size),
                 (override));
+    MOCK_METHOD(void,
+                SendNonVerbose,
+                (const score::mw::log::config::NvMsgDescriptor& desc,
+                 uint32_t tmsp,
+                 const void* data,
+                 size_t size,
+                 CachedRoute& route),
+                (override));
     MOCK_METHOD(bool, IsOutputEnabled, (), (const, noexcept, override));
     virtual ~MockDltOutput() = default;
 };
@@ -67,7 +75,6 @@ class DltNonverboseHandlerTest : public ::testing::Test
 TEST_F(DltNonverboseHandlerTest, HandleShouldCallSendNonVerbose)
 {
     TypeInfo type_info;
-    type_info.type_name = "score::platform::datarouter::test::TestTraceableStruct";
     TimestampT timestamp = score::os::HighResolutionSteadyClock::now();
     const char* data = "TestData";
     BufsizeT size = 10;
@@ -81,7 +88,6 @@ TEST_F(DltNonverboseHandlerTest, HandleShouldCallSendNonVerbose)
 TEST(DltNonverboseHandler_T, HandleShouldNotCallSendNonVerboseWhenDescriptorIsNull)
 {
     TypeInfo type_info;
-    type_info.type_name = "score::platform::datarouter::test::TestTraceableStruct";
     type_info.nv_msg_desc = nullptr;
     TimestampT timestamp = score::os::HighResolutionSteadyClock::now();
     const char data[] = "TestLogData";
@@ -111,7 +117,6 @@ TEST(DltNonverboseHandler_T, HandleCallSendNonVerboseWhenDltMsgDesc)
     DltNonverboseHandler handler(mock_output);
 
     TypeInfo type_info;
-    type_info.type_name = "score::platform::datarouter::test::TestTraceableStruct";
     type_info.nv_msg_desc = &kDescriptor;
 
     TimestampT timestamp = score::os::HighResolutionSteadyClock::now();
@@ -140,3 +145,44 @@ TEST(DltNonverboseHandler_T, HandleDoesNothingWhenOutputDisabled)
     BufsizeT size = sizeof(data);
     handler.Handle(type_info, timestamp, data, size);
 }
+
+TEST(DltNonverboseHandler_T, StateIsOnlyCreatedForTypesWithDescriptor)
+{
+    MockDltOutput mock_output;
+    DltNonverboseHandler handler(mock_output);
+
+    TypeInfo type_info;
+    EXPECT_EQ(handler.CreateState(type_info), nullptr);
+
+    static const score::mw::log::config::NvMsgDescriptor kDescriptor{1234U,
+                                                                   score::mw::log::detail::LoggingIdentifier{"APP0"},
+                                                                   score::mw::log::detail::LoggingIdentifier{"CTX0"},
+                                                                   score::mw::log::LogLevel::kOff};
+    type_info.nv_msg_desc = &kDescriptor;
+    EXPECT_NE(handler.CreateState(type_info), nullptr);
+}
+
+TEST(DltNonverboseHandler_T, HandleWithStateSendsWithTheRouteOfTheType)
+{
+    MockDltOutput mock_output;
+    ON_CALL(mock_output, IsOutputEnabled()).WillByDefault(Return(true));
+    DltNonverboseHandler handler(mock_output);
+
+    static const score::mw::log::config::NvMsgDescriptor kDescriptor{1234U,
+                                                                   score::mw::log::detail::LoggingIdentifier{"APP0"},
+                                                                   score::mw::log::detail::LoggingIdentifier{"CTX0"},
+                                                                   score::mw::log::LogLevel::kOff};
+    TypeInfo type_info;
+    type_info.nv_msg_desc = &kDescriptor;
+    const auto state = handler.CreateState(type_info);
+    ASSERT_NE(state, nullptr);
+    auto& route = static_cast<NonVerboseRoutingState*>(state.get())->GetRoute();
+
+    EXPECT_CALL(mock_output, SendNonVerbose(_, _, _, _)).Times(0);
+    EXPECT_CALL(mock_output, SendNonVerbose(Ref(kDescriptor), _, _, _, Ref(route))).Times(2);
+
+    TimestampT timestamp = score::os::HighResolutionSteadyClock::now();
+    const char data[] = "TestData";
+    handler.HandleWithState(type_info, state.get(), timestamp, data, sizeof(data));
+    handler.HandleWithState(type_info, state.get(), timestamp, data, sizeof(data));
+}
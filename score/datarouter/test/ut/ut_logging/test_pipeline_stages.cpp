@@ -0,0 +1,166 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include "score/datarouter/datarouter/pipeline_stages.h"
+#include "score/datarouter/datarouter/spsc_ring_queue.h"
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <future>
+#include <thread>
+#include <vector>
+
+namespace test
+{
+namespace
+{
+
+using score::platform::datarouter::PipelineStages;
+using score::platform::datarouter::SpscRingQueue;
+using namespace std::chrono_literals;
+
+class QueueLane : public PipelineStages::ILane
+{
+  public:
+    explicit QueueLane(PipelineStages& stages) : stages_{stages}, stage_{stages.AssignStage()}, queue_{16U} {}
+
+    void Push(const std::uint32_t value)
+    {
+        while (!queue_.TryPush(value))
+        {
+            ASSERT_TRUE(stages_.WaitForDrain(stage_, *this));
+        }
+        ++pushed_;
+        stages_.Notify(stage_, *this);
+    }
+
+    void Drain() override
+    {
+        if (drain_started_ != nullptr)
+        {
+            drain_started_->set_value();
+            drain_started_ = nullptr;
+            std::this_thread::sleep_for(50ms);
+        }
+        std::uint32_t value{0U};
+        while (queue_.TryPop(value))
+        {
+            in_order_ = in_order_ && (value == processed_.load());
+            processed_.store(processed_.load() + 1U, std::memory_order_release);
+        }
+        thread_ids_.push_back(std::this_thread::get_id());
+    }
+
+    bool IsDrained() const
+    {
+        return processed_.load(std::memory_order_acquire) == pushed_;
+    }
+
+    void Remove()
+    {
+        stages_.RemoveLane(stage_, *this);
+    }
+
+    PipelineStages& stages_;
+    PipelineStages::StageIndex stage_;
+    SpscRingQueue<std::uint32_t> queue_;
+    std::uint32_t pushed_{0U};
+    std::atomic<std::uint32_t> processed_{0U};
+    bool in_order_{true};
+    std::promise<void>* drain_started_{nullptr};
+    std::vector<std::thread::id> thread_ids_{};
+};
+
+void WaitUntilDrained(const QueueLane& lane)
+{
+    const auto deadline = std::chrono::steady_clock::now() + 5s;
+    while (!lane.IsDrained() && (std::chrono::steady_clock::now() < deadline))
+    {
+        std::this_thread::sleep_for(1ms);
+    }
+}
+
+TEST(PipelineStagesTest, LanesAreAssignedRoundRobin)
+{
+    PipelineStages stages{3U};
+    EXPECT_EQ(stages.GetNumberOfStages(), 3U);
+    EXPECT_EQ(stages.AssignStage(), 0U);
+    EXPECT_EQ(stages.AssignStage(), 1U);
+    EXPECT_EQ(stages.AssignStage(), 2U);
+    EXPECT_EQ(stages.AssignStage(), 0U);
+}
+
+TEST(PipelineStagesTest, AtLeastOneStageIsStarted)
+{
+    PipelineStages stages{0U};
+    EXPECT_EQ(stages.GetNumberOfStages(), 1U);
+}
+
+TEST(PipelineStagesTest, StageDrainsAllEntriesInOrderOnOneThread)
+{
+    PipelineStages stages{2U};
+    QueueLane lane{stages};
+    for (std::uint32_t i = 0U; i < 1000U; ++i)
+    {
+        lane.Push(i);
+    }
+    WaitUntilDrained(lane);
+    lane.Remove();
+
+    EXPECT_TRUE(lane.IsDrained());
+    EXPECT_TRUE(lane.in_order_);
+    ASSERT_FALSE(lane.thread_ids_.empty());
+    for (const auto& thread_id : lane.thread_ids_)
+    {
+        EXPECT_EQ(thread_id, lane.thread_ids_.front());
+        EXPECT_NE(thread_id, std::this_thread::get_id());
+    }
+}
+
+TEST(PipelineStagesTest, RemoveLaneWaitsForTheRunningDrain)
+{
+    PipelineStages stages{1U};
+    QueueLane lane{stages};
+    std::promise<void> drain_started{};
+    lane.drain_started_ = &drain_started;
+
+    lane.Push(0U);
+    drain_started.get_future().wait();
+    lane.Remove();
+
+    // the drain was in progress when the lane was removed, and completed before RemoveLane() returned
+    EXPECT_TRUE(lane.IsDrained());
+}
+
+TEST(PipelineStagesTest, WaitForDrainReturnsOnceTheLaneIsDrained)
+{
+    PipelineStages stages{1U};
+    QueueLane lane{stages};
+    for (std::uint32_t i = 0U; i < 10U; ++i)
+    {
+        ASSERT_TRUE(lane.queue_.TryPush(i));
+        ++lane.pushed_;
+    }
+
+    EXPECT_TRUE(stages.WaitForDrain(lane.stage_, lane));
+
+    EXPECT_TRUE(lane.IsDrained());
+    EXPECT_TRUE(lane.in_order_);
+    lane.Remove();
+}
+
+}  // namespace
+}  // namespace test
@@ -0,0 +1,132 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include "score/datarouter/datarouter/quota_token_bucket.h"
+
+#include "gtest/gtest.h"
+
+#include <limits>
+
+namespace test
+{
+namespace
+{
+
+using score::mw::log::LogLevel;
+using score::platform::datarouter::GetShedReserveFraction;
+using score::platform::datarouter::QuotaTokenBucket;
+using namespace std::chrono_literals;
+
+// 1 KBps fills a bucket of 1024 bytes
+constexpr double kQuotaKBps = 1.0;
+const QuotaTokenBucket::Clock::time_point kStart{};
+
+std::uint64_t ShedCount(const QuotaTokenBucket::ShedCounts& shed_counts, const LogLevel level)
+{
+    return shed_counts.at(static_cast<std::size_t>(level));
+}
+
+TEST(QuotaTokenBucketTest, UnlimitedQuotaNeverSheds)
+{
+    QuotaTokenBucket bucket{std::numeric_limits<double>::max(), kStart};
+    EXPECT_TRUE(bucket.IsUnlimited());
+    for (std::int32_t i = 0; i < 1000; ++i)
+    {
+        EXPECT_TRUE(bucket.TryConsume(1024U * 1024U, LogLevel::kVerbose));
+    }
+    const auto shed_counts = bucket.TakeShedCounts();
+    EXPECT_EQ(ShedCount(shed_counts, LogLevel::kVerbose), 0U);
+}
+
+TEST(QuotaTokenBucketTest, StartsFullAndConsumesRecordSizes)
+{
+    QuotaTokenBucket bucket{kQuotaKBps, kStart};
+    EXPECT_FALSE(bucket.IsUnlimited());
+    EXPECT_DOUBLE_EQ(bucket.GetTokens(), 1024.0);
+    EXPECT_TRUE(bucket.TryConsume(100U, LogLevel::kError));
+    EXPECT_DOUBLE_EQ(bucket.GetTokens(), 924.0);
+}
+
+TEST(QuotaTokenBucketTest, ShedsVerboseBeforeErrors)
+{
+    QuotaTokenBucket bucket{kQuotaKBps, kStart};
+
+    // leave 380 bytes, below the reserves of verbose (512 bytes) and debug (384 bytes)
+    EXPECT_TRUE(bucket.TryConsume(644U, LogLevel::kError));
+
+    EXPECT_FALSE(bucket.TryConsume(1U, LogLevel::kVerbose));
+    EXPECT_FALSE(bucket.TryConsume(1U, LogLevel::kDebug));
+    EXPECT_TRUE(bucket.TryConsume(100U, LogLevel::kInfo));
+    EXPECT_TRUE(bucket.TryConsume(100U, LogLevel::kWarn));
+    EXPECT_FALSE(bucket.TryConsume(100U, LogLevel::kWarn));
+    // errors may use the whole bucket
+    EXPECT_TRUE(bucket.TryConsume(150U, LogLevel::kError));
+    EXPECT_FALSE(bucket.TryConsume(31U, LogLevel::kFatal));
+
+    const auto shed_counts = bucket.TakeShedCounts();
+    EXPECT_EQ(ShedCount(shed_counts, LogLevel::kVerbose), 1U);
+    EXPECT_EQ(ShedCount(shed_counts, LogLevel::kDebug), 1U);
+    EXPECT_EQ(ShedCount(shed_counts, LogLevel::kInfo), 0U);
+    EXPECT_EQ(ShedCount(shed_counts, LogLevel::kWarn), 1U);
+    EXPECT_EQ(ShedCount(shed_counts, LogLevel::kError), 0U);
+    EXPECT_EQ(ShedCount(shed_counts, LogLevel::kFatal), 1U);
+}
+
+TEST(QuotaTokenBucketTest, UnknownSeverityIsTreatedAsInfo)
+{
+    QuotaTokenBucket bucket{kQuotaKBps, kStart};
+    EXPECT_TRUE(bucket.TryConsume(768U, std::nullopt));
+    EXPECT_FALSE(bucket.TryConsume(1U, std::nullopt));
+
+    const auto shed_counts = bucket.TakeShedCounts();
+    EXPECT_EQ(ShedCount(shed_counts, LogLevel::kInfo), 1U);
+}
+
+TEST(QuotaTokenBucketTest, RefillsContinuouslyUpToCapacity)
+{
+    QuotaTokenBucket bucket{kQuotaKBps, kStart};
+    EXPECT_TRUE(bucket.TryConsume(1024U, LogLevel::kError));
+    EXPECT_FALSE(bucket.TryConsume(1U, LogLevel::kError));
+
+    bucket.Refill(kStart + 250ms);
+    EXPECT_DOUBLE_EQ(bucket.GetTokens(), 256.0);
+
+    // time going backwards does not change the bucket
+    bucket.Refill(kStart + 100ms);
+    EXPECT_DOUBLE_EQ(bucket.GetTokens(), 256.0);
+
+    bucket.Refill(kStart + 10s);
+    EXPECT_DOUBLE_EQ(bucket.GetTokens(), 1024.0);
+}
+
+TEST(QuotaTokenBucketTest, TakeShedCountsResetsTheCounters)
+{
+    QuotaTokenBucket bucket{kQuotaKBps, kStart};
+    EXPECT_FALSE(bucket.TryConsume(2048U, LogLevel::kError));
+    EXPECT_EQ(ShedCount(bucket.TakeShedCounts(), LogLevel::kError), 1U);
+    EXPECT_EQ(ShedCount(bucket.TakeShedCounts(), LogLevel::kError), 0U);
+}
+
+TEST(QuotaTokenBucketTest, ShedReserveGrowsWithDecreasingSeverity)
+{
+    EXPECT_DOUBLE_EQ(GetShedReserveFraction(LogLevel::kFatal), 0.0);
+    EXPECT_DOUBLE_EQ(GetShedReserveFraction(LogLevel::kError), 0.0);
+    EXPECT_LT(GetShedReserveFraction(LogLevel::kError), GetShedReserveFraction(LogLevel::kWarn));
+    EXPECT_LT(GetShedReserveFraction(LogLevel::kWarn), GetShedReserveFraction(LogLevel::kInfo));
+    EXPECT_LT(GetShedReserveFraction(LogLevel::kInfo), GetShedReserveFraction(LogLevel::kDebug));
+    EXPECT_LT(GetShedReserveFraction(LogLevel::kDebug), GetShedReserveFraction(LogLevel::kVerbose));
+    EXPECT_LT(GetShedReserveFraction(LogLevel::kVerbose), 1.0);
+}
+
+}  // namespace
+}  // namespace test
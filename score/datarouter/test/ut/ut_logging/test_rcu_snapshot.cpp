@@ -0,0 +1,110 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include "score/datarouter/datarouter/rcu_snapshot.h"
+
+#include "gtest/gtest.h"
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace test
+{
+namespace
+{
+
+using score::platform::datarouter::RcuSnapshot;
+
+struct Sample
+{
+    std::array<std::uint32_t, 5U> values;
+};
+
+TEST(RcuSnapshotTest, ReadsTheInitialValue)
+{
+    const RcuSnapshot<std::uint64_t> defaulted{};
+    EXPECT_EQ(defaulted.Read().Get(), 0U);
+
+    const RcuSnapshot<std::uint64_t> initialized{std::make_unique<const std::uint64_t>(42U)};
+    EXPECT_EQ(initialized.Read().Get(), 42U);
+}
+
+TEST(RcuSnapshotTest, ReadsTheLastPublishedValue)
+{
+    RcuSnapshot<Sample> snapshot{};
+    snapshot.Publish(std::make_unique<const Sample>(Sample{{1U, 2U, 3U, 4U, 5U}}));
+    snapshot.Publish(std::make_unique<const Sample>(Sample{{6U, 7U, 8U, 9U, 10U}}));
+
+    const auto pin = snapshot.Read();
+    EXPECT_EQ(pin->values, (std::array<std::uint32_t, 5U>{6U, 7U, 8U, 9U, 10U}));
+}
+
+TEST(RcuSnapshotTest, PinnedSnapshotOutlivesTheNextPublication)
+{
+    RcuSnapshot<std::uint64_t> snapshot{std::make_unique<const std::uint64_t>(1U)};
+    const auto pin = snapshot.Read();
+    // the other slot is not pinned, so publishing does not wait for the reader
+    snapshot.Publish(std::make_unique<const std::uint64_t>(2U));
+
+    EXPECT_EQ(pin.Get(), 1U);
+    EXPECT_EQ(snapshot.Read().Get(), 2U);
+}
+
+TEST(RcuSnapshotTest, ConcurrentReadersNeverSeeReleasedOrTornValues)
+{
+    constexpr std::uint32_t kPublications = 20000U;
+    constexpr std::size_t kNumberOfReaders = 4U;
+    RcuSnapshot<Sample> snapshot{};
+    std::atomic<bool> done{false};
+    std::atomic<bool> consistent{true};
+
+    std::vector<std::thread> readers{};
+    for (std::size_t index = 0U; index < kNumberOfReaders; ++index)
+    {
+        readers.emplace_back([&snapshot, &done, &consistent]() {
+            std::uint32_t last_seen = 0U;
+            while (!done.load())
+            {
+                const auto pin = snapshot.Read();
+                for (const auto value : pin->values)
+                {
+                    if ((value != pin->values.front()) || (value < last_seen))
+                    {
+                        consistent.store(false);
+                    }
+                }
+                last_seen = pin->values.front();
+            }
+        });
+    }
+
+    for (std::uint32_t i = 1U; i <= kPublications; ++i)
+    {
+        snapshot.Publish(std::make_unique<const Sample>(Sample{{i, i, i, i, i}}));
+    }
+    done.store(true);
+    for (auto& reader : readers)
+    {
+        reader.join();
+    }
+
+    EXPECT_TRUE(consistent.load());
+    EXPECT_EQ(snapshot.Read()->values.front(), kPublications);
+}
+
+}  // namespace
+}  // namespace test
@@ -0,0 +1,215 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include "daemon/dlt_log_server.h"
+#include "logparser/logparser.h"
+#include "score/mw/log/configuration/invconfig_mock.h"
+
+#include "static_reflection_with_serialization/serialization/for_logging.h"
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include <array>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+// counts the allocations of the whole test binary while enabled
+std::atomic<bool> g_count_allocations{false};
+std::atomic<std::size_t> g_allocation_count{0U};
+
+}  // namespace
+
+void* operator new(std::size_t size)
+{
+    if (g_count_allocations.load(std::memory_order_relaxed))
+    {
+        g_allocation_count.fetch_add(1U, std::memory_order_relaxed);
+    }
+    // NOLINTNEXTLINE(score-banned-function) replacement of the global allocation function
+    void* const memory = std::malloc((size == 0U) ? 1U : size);
+    if (memory == nullptr)
+    {
+        throw std::bad_alloc{};
+    }
+    return memory;
+}
+
+void operator delete(void* memory) noexcept
+{
+    // NOLINTNEXTLINE(score-banned-function) replacement of the global deallocation function
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t /*size*/) noexcept
+{
+    // NOLINTNEXTLINE(score-banned-function) replacement of the global deallocation function
+    std::free(memory);
+}
+
+namespace test
+{
+namespace
+{
+
+using namespace score::logging::dltserver;
+using ::testing::_;
+using ::testing::NiceMock;
+using ::testing::Return;
+using ::testing::StrEq;
+
+constexpr BufsizeT kLogEntryIndex = 1U;
+constexpr BufsizeT kNonVerboseIndex = 2U;
+constexpr auto kNonVerboseTypeName = "test::NonVerboseMessage";
+
+struct TestLogEntry
+{
+    score::mw::log::detail::LoggingIdentifier app_id{"APP0"};
+    score::mw::log::detail::LoggingIdentifier ctx_id{"CTX0"};
+    std::vector<std::uint8_t> payload;
+    std::uint8_t num_of_args{0U};
+    score::mw::log::LogLevel log_level{score::mw::log::LogLevel::kOff};
+};
+STRUCT_TRACEABLE(TestLogEntry, app_id, ctx_id, payload, num_of_args, log_level)
+
+std::string MakeTypeParamsForName(const std::string& type_name)
+{
+    const auto type_name_size = static_cast<std::uint32_t>(type_name.size());
+    std::string type_name_size_bytes(sizeof(type_name_size), char(0));
+    // NOLINTNEXTLINE(score-banned-function) serialization of trivially copyable
+    std::memcpy(type_name_size_bytes.data(), &type_name_size, sizeof(type_name_size));
+    return std::string(4, char(0)) + std::string(DltidT{"ECU0"}) + std::string(DltidT{"APP0"}) +
+           type_name_size_bytes + type_name;
+}
+
+score::mw::log::detail::SharedMemoryRecord MakeRecord(const BufsizeT type_index, std::string& payload)
+{
+    score::mw::log::detail::SharedMemoryRecord record;
+    record.header.type_identifier = static_cast<score::mw::log::detail::TypeIdentifier>(type_index);
+    record.payload = score::cpp::span<score::mw::log::detail::Byte>{payload.data(), payload.size()};
+    return record;
+}
+
+class RoutingAllocationsTest : public ::testing::Test
+{
+  protected:
+    RoutingAllocationsTest()
+        : outputs_{},
+          nv_descriptor_{1234U,
+                         score::mw::log::detail::LoggingIdentifier{"APP0"},
+                         score::mw::log::detail::LoggingIdentifier{"CTX0"},
+                         score::mw::log::LogLevel::kInfo},
+          nv_config_{}
+    {
+        UdpStreamOutput::Tester::Instance() = &outputs_;
+        ON_CALL(nv_config_, GetDltMsgDesc(_)).WillByDefault(Return(nullptr));
+        ON_CALL(nv_config_, GetDltMsgDesc(StrEq(kNonVerboseTypeName))).WillByDefault(Return(&nv_descriptor_));
+    }
+
+    static std::string MakeLogEntryPayload()
+    {
+        TestLogEntry entry;
+        entry.payload = {1U, 2U, 3U, 4U};
+        entry.num_of_args = 1U;
+        entry.log_level = score::mw::log::LogLevel::kInfo;
+        std::array<char, 256> buffer{};
+        using LoggingSerializer = ::score::common::visitor::logging_serializer;
+        const auto size = LoggingSerializer::serialize(entry, buffer.data(), buffer.size());
+        return std::string{buffer.data(), size};
+    }
+
+    NiceMock<UdpStreamOutput::Tester> outputs_;
+    const score::mw::log::config::NvMsgDescriptor nv_descriptor_;
+    NiceMock<score::mw::log::INvConfigMock> nv_config_;
+};
+
+TEST_F(RoutingAllocationsTest, RoutingRecordsDoesNotAllocateInSteadyState)
+{
+    DltLogServer dlt_server(
+        StaticConfig{},
+        []() {
+            return PersistentConfig{};
+        },
+        [](const PersistentConfig&) {},
+        true);
+
+    LogParser::HandleRequestMap handle_request_map{};
+    for (const auto& binding : dlt_server.GetTypeHandlerBindings())
+    {
+        handle_request_map.emplace(binding.type_name, binding.handler);
+    }
+    LogParser parser(nv_config_, dlt_server.GetGlobalHandlers(), std::move(handle_request_map));
+    parser.AddIncomingType(kLogEntryIndex, MakeTypeParamsForName("score::mw::log::detail::LogEntry"));
+    parser.AddIncomingType(kNonVerboseIndex, MakeTypeParamsForName(kNonVerboseTypeName));
+
+    std::string log_entry_payload = MakeLogEntryPayload();
+    std::string non_verbose_payload{"non-verbose payload"};
+    const auto log_entry_record = MakeRecord(kLogEntryIndex, log_entry_payload);
+    const auto non_verbose_record = MakeRecord(kNonVerboseIndex, non_verbose_payload);
+
+    // the first records of a message id set up its statistics
+    parser.ParseSharedMemoryRecord(log_entry_record);
+    parser.ParseSharedMemoryRecord(non_verbose_record);
+    dlt_server.Flush();
+
+    // few enough records to be buffered by the channel, the send itself is mocked
+    constexpr std::size_t kRecordsPerType = 10U;
+    g_allocation_count.store(0U);
+    g_count_allocations.store(true);
+    for (std::size_t i = 0U; i < kRecordsPerType; ++i)
+    {
+        parser.ParseSharedMemoryRecord(log_entry_record);
+    }
+    for (std::size_t i = 0U; i < kRecordsPerType; ++i)
+    {
+        parser.ParseSharedMemoryRecord(non_verbose_record);
+    }
+    g_count_allocations.store(false);
+
+    EXPECT_EQ(g_allocation_count.load(), 0U);
+}
+
+TEST_F(RoutingAllocationsTest, StatisticsOutputDoesNotRequireAllocationsForTheNextInterval)
+{
+    DltLogChannel channel(
+        DltidT{"CHN0"}, score::mw::log::LogLevel::kVerbose, DltidT{"ECU0"}, nullptr, 3491U, nullptr, 3490U, "");
+    std::string payload{"non-verbose payload"};
+    channel.SendNonVerbose(nv_descriptor_, 1U, payload.data(), payload.size());
+
+    struct Logger
+    {
+        std::stringstream LogInfo() const
+        {
+            return std::stringstream{};
+        }
+    } logger;
+    channel.ShowStats(logger);
+
+    g_allocation_count.store(0U);
+    g_count_allocations.store(true);
+    channel.SendNonVerbose(nv_descriptor_, 2U, payload.data(), payload.size());
+    g_count_allocations.store(false);
+
+    EXPECT_EQ(g_allocation_count.load(), 0U);
+}
+
+}  // namespace
+}  // namespace test
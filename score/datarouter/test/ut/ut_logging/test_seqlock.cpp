@@ -0,0 +1,93 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include "score/datarouter/datarouter/seqlock.h"
+
+#include "gtest/gtest.h"
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <thread>
+
+namespace test
+{
+namespace
+{
+
+using score::platform::datarouter::Seqlock;
+
+// odd size, to cover a value that does not fill its last word
+struct Sample
+{
+    std::array<std::uint32_t, 5U> values;
+    std::uint8_t tag;
+};
+
+TEST(SeqlockTest, ReadsTheInitialValue)
+{
+    const Seqlock<std::uint64_t> defaulted{};
+    EXPECT_EQ(defaulted.Read(), 0U);
+
+    const Seqlock<std::uint64_t> initialized{42U};
+    EXPECT_EQ(initialized.Read(), 42U);
+}
+
+TEST(SeqlockTest, ReadsTheLastPublishedValue)
+{
+    Seqlock<Sample> seqlock{};
+    seqlock.Publish(Sample{{1U, 2U, 3U, 4U, 5U}, 6U});
+    seqlock.Publish(Sample{{7U, 8U, 9U, 10U, 11U}, 12U});
+
+    const Sample sample = seqlock.Read();
+    EXPECT_EQ(sample.values, (std::array<std::uint32_t, 5U>{7U, 8U, 9U, 10U, 11U}));
+    EXPECT_EQ(sample.tag, 12U);
+}
+
+TEST(SeqlockTest, ConcurrentReadersNeverSeeTornValues)
+{
+    constexpr std::uint32_t kPublications = 100000U;
+    Seqlock<Sample> seqlock{};
+    std::atomic<bool> done{false};
+
+    std::thread writer([&seqlock, &done]() {
+        for (std::uint32_t i = 1U; i <= kPublications; ++i)
+        {
+            seqlock.Publish(Sample{{i, i, i, i, i}, static_cast<std::uint8_t>(i)});
+        }
+        done.store(true);
+    });
+
+    std::uint32_t last_seen = 0U;
+    bool consistent = true;
+    bool monotonic = true;
+    while (!done.load())
+    {
+        const Sample sample = seqlock.Read();
+        for (const auto value : sample.values)
+        {
+            consistent = consistent && (value == sample.values.front());
+        }
+        consistent = consistent && (sample.tag == static_cast<std::uint8_t>(sample.values.front()));
+        monotonic = monotonic && (sample.values.front() >= last_seen);
+        last_seen = sample.values.front();
+    }
+    writer.join();
+
+    EXPECT_TRUE(consistent);
+    EXPECT_TRUE(monotonic);
+    EXPECT_EQ(seqlock.Read().values.front(), kPublications);
+}
+
+}  // namespace
+}  // namespace test
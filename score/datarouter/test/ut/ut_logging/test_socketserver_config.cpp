@@ -111,6 +111,68 @@ TEST(SocketserverConfigTest, JsonQuotasEnabledDeactivated)
     EXPECT_FALSE(result.value().quota_enforcement_enabled);
 }
 
+TEST(SocketserverConfigTest, JsonThreadPlacement)
+{
+    const auto result = ReadStaticDlt(PrepareLogChannelsPath("log-channels-thread-placement.json").c_str());
+    ASSERT_TRUE(result.has_value());
+    const auto& thread_placement = result.value().thread_placement;
+    EXPECT_TRUE(thread_placement.sessions_on_buffer_node);
+    ASSERT_THAT(thread_placement.threads, SizeIs(2));
+
+    const auto& workers = thread_placement.threads.at("mp_worker");
+    EXPECT_EQ(workers.numa_node, 1);
+    EXPECT_THAT(workers.cpus, SizeIs(0));
+    EXPECT_FALSE(workers.policy.has_value());
+
+    const auto& first_worker = thread_placement.threads.at("mp_worker_0");
+    EXPECT_FALSE(first_worker.numa_node.has_value());
+    EXPECT_EQ(first_worker.cpus, (std::vector<std::uint32_t>{2U, 3U}));
+    EXPECT_EQ(first_worker.policy, SCHED_FIFO);
+    EXPECT_EQ(first_worker.priority, 10);
+
+    EXPECT_EQ(result.value().message_passing_worker_count, 2U);
+}
+
+TEST(SocketserverConfigTest, JsonChannelTransport)
+{
+    const auto result = ReadStaticDlt(PrepareLogChannelsPath("log-channels-transport.json").c_str());
+    ASSERT_TRUE(result.has_value());
+    const auto& channels = result.value().channels;
+    ASSERT_THAT(channels, SizeIs(3));
+
+    // without transport settings the defaults apply
+    const auto& default_transport = channels.at(DltidT{"3491"}).transport;
+    EXPECT_EQ(default_transport.vector_count, 4U);
+    EXPECT_EQ(default_transport.mtu, 1500U);
+    EXPECT_FALSE(default_transport.send_buffer_size.has_value());
+    EXPECT_FALSE(default_transport.segmentation_offload);
+    EXPECT_EQ(default_transport.sender_queue_depth, 0U);
+    EXPECT_FALSE(default_transport.io_uring);
+
+    const auto& configured_transport = channels.at(DltidT{"3492"}).transport;
+    EXPECT_EQ(configured_transport.vector_count, 64U);
+    EXPECT_EQ(configured_transport.mtu, 9000U);
+    EXPECT_EQ(configured_transport.send_buffer_size, 1048576);
+    EXPECT_TRUE(configured_transport.segmentation_offload);
+    EXPECT_EQ(configured_transport.sender_queue_depth, 8U);
+
+    // invalid settings are replaced by the defaults
+    const auto& invalid_transport = channels.at(DltidT{"3493"}).transport;
+    EXPECT_EQ(invalid_transport.vector_count, 4U);
+    EXPECT_EQ(invalid_transport.mtu, 1500U);
+    EXPECT_EQ(invalid_transport.sender_queue_depth, 0U);
+    EXPECT_TRUE(invalid_transport.io_uring);
+}
+
+TEST(SocketserverConfigTest, JsonWithoutThreadPlacement)
+{
+    const auto result = ReadStaticDlt(PrepareLogChannelsPath("log-channels-quotas-activated.json").c_str());
+    ASSERT_TRUE(result.has_value());
+    EXPECT_FALSE(result.value().thread_placement.sessions_on_buffer_node);
+    EXPECT_THAT(result.value().thread_placement.threads, SizeIs(0));
+    EXPECT_EQ(result.value().message_passing_worker_count, 0U);
+}
+
 TEST(SocketserverConfigTest, JsonOldFormatErrorExpected)
 {
     const auto result = ReadStaticDlt(PrepareLogChannelsPath("log-channels-old-format.json").c_str());
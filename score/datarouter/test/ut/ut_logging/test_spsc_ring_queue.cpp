@@ -0,0 +1,102 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include "score/datarouter/datarouter/spsc_ring_queue.h"
+
+#include "gtest/gtest.h"
+
+#include <cstdint>
+#include <thread>
+
+namespace test
+{
+namespace
+{
+
+using score::platform::datarouter::SpscRingQueue;
+
+TEST(SpscRingQueueTest, CapacityIsRoundedUpToPowerOfTwo)
+{
+    EXPECT_EQ(SpscRingQueue<int>{0U}.GetCapacity(), 1U);
+    EXPECT_EQ(SpscRingQueue<int>{5U}.GetCapacity(), 8U);
+    EXPECT_EQ(SpscRingQueue<int>{16U}.GetCapacity(), 16U);
+}
+
+TEST(SpscRingQueueTest, PopsInPushOrderUntilEmpty)
+{
+    SpscRingQueue<int> queue{4U};
+    EXPECT_TRUE(queue.IsEmpty());
+    EXPECT_TRUE(queue.TryPush(1));
+    EXPECT_TRUE(queue.TryPush(2));
+    EXPECT_FALSE(queue.IsEmpty());
+
+    int value{0};
+    EXPECT_TRUE(queue.TryPop(value));
+    EXPECT_EQ(value, 1);
+    EXPECT_TRUE(queue.TryPop(value));
+    EXPECT_EQ(value, 2);
+    EXPECT_FALSE(queue.TryPop(value));
+    EXPECT_TRUE(queue.IsEmpty());
+}
+
+TEST(SpscRingQueueTest, RejectsPushWhenFullAndWrapsAround)
+{
+    SpscRingQueue<int> queue{2U};
+    int value{0};
+    for (int round = 0; round < 3; ++round)
+    {
+        EXPECT_TRUE(queue.TryPush(round));
+        EXPECT_TRUE(queue.TryPush(round + 10));
+        EXPECT_FALSE(queue.TryPush(round + 20));
+
+        EXPECT_TRUE(queue.TryPop(value));
+        EXPECT_EQ(value, round);
+        EXPECT_TRUE(queue.TryPop(value));
+        EXPECT_EQ(value, round + 10);
+    }
+}
+
+TEST(SpscRingQueueTest, TransfersAllValuesInOrderBetweenThreads)
+{
+    constexpr std::uint64_t kCount = 100000U;
+    SpscRingQueue<std::uint64_t> queue{64U};
+
+    std::thread producer([&queue]() {
+        for (std::uint64_t i = 0U; i < kCount; ++i)
+        {
+            while (!queue.TryPush(i))
+            {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    bool in_order = true;
+    std::uint64_t expected = 0U;
+    while (expected < kCount)
+    {
+        std::uint64_t value{0U};
+        if (queue.TryPop(value))
+        {
+            in_order = in_order && (value == expected);
+            ++expected;
+        }
+    }
+    producer.join();
+
+    EXPECT_TRUE(in_order);
+    EXPECT_TRUE(queue.IsEmpty());
+}
+
+}  // namespace
+}  // namespace test
@@ -0,0 +1,130 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include "score/datarouter/datarouter/thread_placement.h"
+
+#include "score/os/mocklib/mock_pthread.h"
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include <sched.h>
+
+namespace test
+{
+namespace
+{
+
+using score::platform::datarouter::NarrowCpusToMemoryNode;
+using score::platform::datarouter::ParseCpuList;
+using score::platform::datarouter::ParseSchedulingPolicy;
+using score::platform::datarouter::ThreadPlacement;
+using score::platform::datarouter::ThreadPlacementConfig;
+using score::platform::datarouter::ThreadPlacements;
+using ::testing::_;
+using ::testing::Field;
+using ::testing::Pointee;
+using ::testing::Return;
+using ::testing::StrictMock;
+
+ThreadPlacement MakePlacement(const std::optional<std::int32_t> numa_node,
+                              const std::optional<std::int32_t> policy,
+                              const std::int32_t priority)
+{
+    ThreadPlacement placement{};
+    placement.numa_node = numa_node;
+    placement.policy = policy;
+    placement.priority = priority;
+    return placement;
+}
+
+TEST(ThreadPlacementTest, CpuListsAreParsedAsInSysfs)
+{
+    EXPECT_EQ(ParseCpuList("0-3,8"), (std::vector<std::uint32_t>{0U, 1U, 2U, 3U, 8U}));
+    EXPECT_EQ(ParseCpuList("5"), (std::vector<std::uint32_t>{5U}));
+}
+
+TEST(ThreadPlacementTest, MalformedCpuListsAreEmpty)
+{
+    EXPECT_TRUE(ParseCpuList("").empty());
+    EXPECT_TRUE(ParseCpuList("a").empty());
+    EXPECT_TRUE(ParseCpuList("3-1").empty());
+    EXPECT_TRUE(ParseCpuList("1-").empty());
+    EXPECT_TRUE(ParseCpuList("1+2").empty());
+    EXPECT_TRUE(ParseCpuList("0-100000").empty());
+}
+
+TEST(ThreadPlacementTest, CpusAreNarrowedToTheMemoryNode)
+{
+    const std::vector<std::uint32_t> node_cpus{4U, 5U, 6U, 7U};
+    EXPECT_EQ(NarrowCpusToMemoryNode({5U, 6U, 8U}, node_cpus), (std::vector<std::uint32_t>{5U, 6U}));
+    EXPECT_TRUE(NarrowCpusToMemoryNode({0U, 1U}, node_cpus).empty());
+    // without a CPU list, all CPUs of the node are selected
+    EXPECT_EQ(NarrowCpusToMemoryNode({}, node_cpus), node_cpus);
+}
+
+TEST(ThreadPlacementTest, SchedulingPoliciesAreParsedByName)
+{
+    EXPECT_EQ(ParseSchedulingPolicy("SCHED_FIFO"), SCHED_FIFO);
+    EXPECT_EQ(ParseSchedulingPolicy("SCHED_RR"), SCHED_RR);
+    EXPECT_EQ(ParseSchedulingPolicy("SCHED_OTHER"), SCHED_OTHER);
+    EXPECT_FALSE(ParseSchedulingPolicy("SCHED_DEADLINE").has_value());
+}
+
+TEST(ThreadPlacementTest, PlacementIsFoundByThreadNameBeforeRole)
+{
+    ThreadPlacementConfig config{};
+    config.threads.emplace("mp_worker", MakePlacement(0, std::nullopt, 0));
+    config.threads.emplace("mp_worker_1", MakePlacement(1, std::nullopt, 0));
+    const ThreadPlacements placements{config};
+
+    EXPECT_EQ(placements.GetMemoryNode("mp_worker_0"), 0);
+    EXPECT_EQ(placements.GetMemoryNode("mp_worker_1"), 1);
+    EXPECT_EQ(placements.GetMemoryNode("mp_worker_12"), 0);
+    EXPECT_FALSE(placements.GetMemoryNode("mp_worker_").has_value());
+    EXPECT_FALSE(placements.GetMemoryNode("mp_worker_a").has_value());
+    EXPECT_FALSE(placements.GetMemoryNode("dr_stage_0").has_value());
+    EXPECT_FALSE(placements.IsSessionsOnBufferNodeEnabled());
+}
+
+TEST(ThreadPlacementTest, SchedulingPolicyIsAppliedWithItsPriority)
+{
+    StrictMock<score::os::MockPthread> pthread{};
+    ThreadPlacementConfig config{};
+    config.threads.emplace("socketserver", MakePlacement(std::nullopt, SCHED_FIFO, 10));
+    config.threads.emplace("server_routine", MakePlacement(std::nullopt, std::nullopt, 10));
+    const ThreadPlacements placements{config, pthread};
+
+    EXPECT_CALL(pthread, pthread_setschedparam(_, SCHED_FIFO, Pointee(Field(&sched_param::sched_priority, 10))))
+        .WillOnce(Return(score::cpp::expected_blank<score::os::Error>{}));
+    placements.Apply(pthread_self(), "socketserver");
+
+    // neither a thread without a policy nor an unknown thread is changed
+    placements.Apply(pthread_self(), "server_routine");
+    placements.Apply(pthread_self(), "mp_worker_0");
+}
+
+TEST(ThreadPlacementTest, FailingSchedulingPolicyIsReported)
+{
+    StrictMock<score::os::MockPthread> pthread{};
+    ThreadPlacementConfig config{};
+    config.threads.emplace("dr_stage", MakePlacement(std::nullopt, SCHED_RR, 5));
+    const ThreadPlacements placements{config, pthread};
+
+    EXPECT_CALL(pthread, pthread_setschedparam(_, SCHED_RR, _))
+        .WillOnce(Return(score::cpp::make_unexpected(score::os::Error::createFromErrno(EPERM))));
+    placements.Apply(pthread_self(), "dr_stage_2");
+}
+
+}  // namespace
+}  // namespace test
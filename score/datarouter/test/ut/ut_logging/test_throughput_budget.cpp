@@ -0,0 +1,149 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include "score/datarouter/datarouter/throughput_budget.h"
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <limits>
+#include <thread>
+#include <vector>
+
+namespace test
+{
+namespace
+{
+
+using score::platform::datarouter::ThroughputBudget;
+using namespace std::chrono_literals;
+
+// 4 KBps, i.e. 4096 bytes per second
+constexpr double kOverallKBps = 4.0;
+const ThroughputBudget::Clock::time_point kStart{};
+
+TEST(ThroughputBudgetTest, UnlimitedBudgetGrantsEverything)
+{
+    ThroughputBudget budget{std::numeric_limits<double>::max(), kStart};
+    EXPECT_TRUE(budget.IsUnlimited());
+    const auto share = budget.Register(1.0, kStart);
+    EXPECT_EQ(budget.Acquire(share, kStart), std::numeric_limits<double>::max());
+}
+
+TEST(ThroughputBudgetTest, SingleSessionGetsTheWholeBudget)
+{
+    ThroughputBudget budget{kOverallKBps, kStart};
+    EXPECT_FALSE(budget.IsUnlimited());
+    const auto share = budget.Register(1.0, kStart);
+
+    EXPECT_DOUBLE_EQ(budget.Acquire(share, kStart), 0.0);
+    budget.Release(share, 0.0, true, kStart);
+    EXPECT_DOUBLE_EQ(budget.Acquire(share, kStart + 250ms), 1024.0);
+    budget.Release(share, 0.0, true, kStart + 250ms);
+
+    // at most one second worth of budget is accumulated
+    EXPECT_DOUBLE_EQ(budget.Acquire(share, kStart + 1250ms), 4096.0);
+    budget.Release(share, 0.0, true, kStart + 1250ms);
+    EXPECT_DOUBLE_EQ(budget.Acquire(share, kStart + 10s), 4096.0);
+}
+
+TEST(ThroughputBudgetTest, BusySessionsShareTheBudgetByWeight)
+{
+    ThroughputBudget budget{kOverallKBps, kStart};
+    const auto heavy = budget.Register(3.0, kStart);
+    const auto light = budget.Register(1.0, kStart);
+
+    EXPECT_DOUBLE_EQ(budget.Acquire(heavy, kStart + 500ms), 1536.0);
+    EXPECT_DOUBLE_EQ(budget.Acquire(light, kStart + 500ms), 512.0);
+}
+
+TEST(ThroughputBudgetTest, UnusedGrantIsRedistributed)
+{
+    ThroughputBudget budget{kOverallKBps, kStart};
+    const auto busy = budget.Register(1.0, kStart);
+    const auto idle = budget.Register(1.0, kStart);
+
+    EXPECT_DOUBLE_EQ(budget.Acquire(busy, kStart + 500ms), 1024.0);
+    budget.Release(busy, 0.0, true, kStart + 500ms);
+    EXPECT_DOUBLE_EQ(budget.Acquire(idle, kStart + 500ms), 1024.0);
+    budget.Release(idle, 1024.0, false, kStart + 500ms);
+
+    // the busy session gets its credit and half of the pool, as the idle session is still considered active
+    EXPECT_DOUBLE_EQ(budget.Acquire(busy, kStart + 750ms), 512.0 + 512.0);
+    budget.Release(busy, 0.0, true, kStart + 750ms);
+}
+
+TEST(ThroughputBudgetTest, IdleSessionsDoNotReceiveCredit)
+{
+    ThroughputBudget budget{kOverallKBps, kStart};
+    const auto busy = budget.Register(1.0, kStart);
+    const auto idle = budget.Register(1.0, kStart);
+
+    EXPECT_DOUBLE_EQ(budget.Acquire(busy, kStart + 1500ms), 4096.0);
+    budget.Release(busy, 0.0, true, kStart + 1500ms);
+
+    // only the busy session is active, it receives the whole refill
+    EXPECT_DOUBLE_EQ(budget.Acquire(busy, kStart + 2000ms), 2048.0);
+    budget.Release(busy, 0.0, true, kStart + 2000ms);
+
+    // a session becoming active again competes for the pool only
+    EXPECT_DOUBLE_EQ(budget.Acquire(idle, kStart + 2000ms), 0.0);
+}
+
+TEST(ThroughputBudgetTest, WeightIsClampedToTheOverallBudget)
+{
+    ThroughputBudget budget{kOverallKBps, kStart};
+    const auto unlimited = budget.Register(std::numeric_limits<double>::max(), kStart);
+    const auto limited = budget.Register(4.0, kStart);
+
+    EXPECT_DOUBLE_EQ(budget.Acquire(unlimited, kStart + 500ms), 1024.0);
+    EXPECT_DOUBLE_EQ(budget.Acquire(limited, kStart + 500ms), 1024.0);
+}
+
+TEST(ThroughputBudgetTest, UnregisteredSessionGetsNothing)
+{
+    ThroughputBudget budget{kOverallKBps, kStart};
+    const auto share = budget.Register(1.0, kStart);
+    budget.Unregister(share);
+    EXPECT_DOUBLE_EQ(budget.Acquire(share, kStart), 0.0);
+}
+
+TEST(ThroughputBudgetTest, ConcurrentSessionsDoNotExceedTheOverallBudget)
+{
+    const auto start = ThroughputBudget::Clock::now();
+    ThroughputBudget budget{kOverallKBps, start};
+    std::atomic<double> granted{0.0};
+    std::vector<std::thread> sessions{};
+    for (std::size_t session = 0U; session < 4U; ++session)
+    {
+        sessions.emplace_back([&budget, &granted, start]() {
+            const auto share = budget.Register(1.0, start);
+            while ((ThroughputBudget::Clock::now() - start) < 50ms)
+            {
+                const auto now = ThroughputBudget::Clock::now();
+                granted.fetch_add(budget.Acquire(share, now));
+                budget.Release(share, 0.0, true, now);
+            }
+        });
+    }
+    for (auto& session : sessions)
+    {
+        session.join();
+    }
+
+    const std::chrono::duration<double> elapsed = ThroughputBudget::Clock::now() - start;
+    EXPECT_LE(granted.load(), elapsed.count() * kOverallKBps * 1024.0);
+}
+
+}  // namespace
+}  // namespace test
@@ -0,0 +1,230 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include "logparser/type_descriptor_cache.h"
+#include "logparser/logparser.h"
+
+#include "score/mw/log/configuration/invconfig_mock.h"
+#include "score/mw/log/configuration/nvconfig.h"
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include <chrono>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+using namespace testing;
+
+namespace test
+{
+
+using namespace score::platform;
+using namespace score::platform::internal;
+
+std::string MakeTypeParams(const std::string& type_name, const std::string& app_id = "APP0")
+{
+    const auto type_name_size = static_cast<std::uint32_t>(type_name.size());
+    std::string type_name_size_bytes(sizeof(type_name_size), char(0));
+    // NOLINTNEXTLINE(score-banned-function) serialization of trivially copyable
+    std::memcpy(type_name_size_bytes.data(), &type_name_size, sizeof(type_name_size));
+    return std::string(4, char(0)) + std::string(DltidT{"ECU0"}) + std::string(DltidT{app_id}) +
+           type_name_size_bytes + type_name;
+}
+
+class TypeHandlerMock : public LogParser::TypeHandler
+{
+  public:
+    MOCK_METHOD(void, Handle, (TimestampT, const char*, BufsizeT), (override final));
+};
+
+class TypeDescriptorCacheFixture : public ::testing::Test
+{
+  protected:
+    TypeDescriptorCacheFixture() : nv_config_{}, cache_{nv_config_}
+    {
+        ON_CALL(nv_config_, GetDltMsgDesc(_)).WillByDefault(Return(nullptr));
+    }
+
+    NiceMock<score::mw::log::INvConfigMock> nv_config_;
+    TypeDescriptorCache cache_;
+};
+
+TEST_F(TypeDescriptorCacheFixture, RegistrationIsResolvedIntoItsDescriptor)
+{
+    const auto descriptor = cache_.Intern(MakeTypeParams("score::mw::log::detail::LogEntry", "APP1"));
+
+    ASSERT_NE(descriptor, nullptr);
+    EXPECT_EQ(descriptor->type_name, "score::mw::log::detail::LogEntry");
+    EXPECT_TRUE(descriptor->is_log_entry);
+}
+
+TEST_F(TypeDescriptorCacheFixture, SameRegistrationIsResolvedOnlyOnce)
+{
+    EXPECT_CALL(nv_config_, GetDltMsgDesc("test::Message")).Times(1);
+
+    const auto first = cache_.Intern(MakeTypeParams("test::Message"));
+    const auto second = cache_.Intern(MakeTypeParams("test::Message"));
+
+    ASSERT_NE(first, nullptr);
+    EXPECT_EQ(first, second);
+    EXPECT_FALSE(first->is_log_entry);
+    EXPECT_EQ(cache_.GetSize(), 1U);
+}
+
+TEST_F(TypeDescriptorCacheFixture, RegistrationsOfTheSameTypeByDifferentApplicationsShareTheDescriptor)
+{
+    EXPECT_CALL(nv_config_, GetDltMsgDesc(_)).Times(AnyNumber());
+    EXPECT_CALL(nv_config_, GetDltMsgDesc("test::Message")).Times(1);
+
+    const auto descriptor = cache_.Intern(MakeTypeParams("test::Message"));
+    const auto other_app = cache_.Intern(MakeTypeParams("test::Message", "APP1"));
+    const auto other_type = cache_.Intern(MakeTypeParams("test::Other"));
+
+    EXPECT_EQ(descriptor, other_app);
+    EXPECT_NE(descriptor, other_type);
+    EXPECT_EQ(cache_.GetSize(), 2U);
+}
+
+TEST_F(TypeDescriptorCacheFixture, MalformedRegistrationIsNotInterned)
+{
+    // the version shall be zero
+    std::string params = MakeTypeParams("test::Message");
+    params[0] = 1;
+    // the type name shall not exceed the registration
+    std::string truncated = MakeTypeParams("test::Message");
+    truncated.pop_back();
+
+    EXPECT_EQ(cache_.Intern(params), nullptr);
+    EXPECT_EQ(cache_.Intern(truncated), nullptr);
+    EXPECT_EQ(cache_.Intern("short"), nullptr);
+    EXPECT_EQ(cache_.GetSize(), 0U);
+}
+
+TEST_F(TypeDescriptorCacheFixture, UnusedDescriptorIsKeptWithinTheGracePeriod)
+{
+    EXPECT_CALL(nv_config_, GetDltMsgDesc(_)).Times(AnyNumber());
+    EXPECT_CALL(nv_config_, GetDltMsgDesc("test::Message")).Times(1);
+
+    auto descriptor = cache_.Intern(MakeTypeParams("test::Message"));
+    const auto* const released = descriptor.get();
+    descriptor.reset();
+    std::ignore = cache_.Intern(MakeTypeParams("test::Other"));
+
+    // registered again, e.g. by a restarted client
+    EXPECT_EQ(cache_.Intern(MakeTypeParams("test::Message")).get(), released);
+    EXPECT_EQ(cache_.GetSize(), 2U);
+}
+
+TEST(TypeDescriptorCacheTest, UnusedDescriptorIsDroppedAfterTheGracePeriod)
+{
+    NiceMock<score::mw::log::INvConfigMock> nv_config;
+    TypeDescriptorCache cache{nv_config, std::chrono::steady_clock::duration::zero()};
+
+    auto unused = cache.Intern(MakeTypeParams("test::Message"));
+    const auto used = cache.Intern(MakeTypeParams("test::Used"));
+    EXPECT_EQ(cache.GetSize(), 2U);
+    unused.reset();
+
+    std::ignore = cache.Intern(MakeTypeParams("test::Other"));
+
+    EXPECT_EQ(cache.GetSize(), 2U);
+}
+
+TEST_F(TypeDescriptorCacheFixture, ConcurrentRegistrationsOfTheSameTypeShareOneDescriptor)
+{
+    constexpr std::size_t kNumberOfThreads{8U};
+    const std::string params = MakeTypeParams("test::Message");
+    std::vector<std::shared_ptr<const TypeDescriptor>> descriptors(kNumberOfThreads);
+    std::vector<std::thread> threads{};
+    for (std::size_t index = 0U; index < kNumberOfThreads; ++index)
+    {
+        threads.emplace_back([this, &params, &descriptors, index]() {
+            descriptors.at(index) = cache_.Intern(params);
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    for (const auto& descriptor : descriptors)
+    {
+        EXPECT_EQ(descriptor, descriptors.front());
+    }
+    EXPECT_EQ(cache_.GetSize(), 1U);
+}
+
+class GlobalHandlerMock : public LogParser::AnyHandler
+{
+  public:
+    MOCK_METHOD(void, Handle, (const TypeInfo&, TimestampT, const char*, BufsizeT), (override final));
+};
+
+TEST(TypeDescriptorCacheTest, ParsersSharingTheCacheResolveARegistrationOnce)
+{
+    NiceMock<score::mw::log::INvConfigMock> nv_config;
+    EXPECT_CALL(nv_config, GetDltMsgDesc("test::Message")).Times(1).WillOnce(Return(nullptr));
+    StrictMock<TypeHandlerMock> type_handler;
+    EXPECT_CALL(type_handler, Handle(_, _, _)).Times(2);
+
+    const auto cache = std::make_shared<TypeDescriptorCache>(nv_config);
+    const LogParser::HandleRequestMap handle_request_map{{"test::Message", &type_handler}};
+    LogParser first_parser(nv_config, {}, handle_request_map, cache);
+    LogParser second_parser(nv_config, {}, handle_request_map, cache);
+
+    constexpr BufsizeT kTypeIndex = 2U;
+    first_parser.AddIncomingType(kTypeIndex, MakeTypeParams("test::Message"));
+    second_parser.AddIncomingType(kTypeIndex, MakeTypeParams("test::Message"));
+    EXPECT_EQ(cache->GetSize(), 1U);
+
+    std::string payload{"TestData"};
+    score::mw::log::detail::SharedMemoryRecord record;
+    record.header.type_identifier = static_cast<score::mw::log::detail::TypeIdentifier>(kTypeIndex);
+    record.payload = score::cpp::span<score::mw::log::detail::Byte>{payload.data(), payload.size()};
+    first_parser.ParseSharedMemoryRecord(record);
+    second_parser.ParseSharedMemoryRecord(record);
+}
+
+TEST(TypeDescriptorCacheTest, ParsersPassTheIdentifiersOfTheirOwnRegistrationToTheHandlers)
+{
+    NiceMock<score::mw::log::INvConfigMock> nv_config;
+    EXPECT_CALL(nv_config, GetDltMsgDesc("test::Message")).Times(1).WillOnce(Return(nullptr));
+    StrictMock<GlobalHandlerMock> first_handler;
+    StrictMock<GlobalHandlerMock> second_handler;
+    EXPECT_CALL(first_handler,
+                Handle(AllOf(Field(&TypeInfo::id, 2U), Field(&TypeInfo::app_id, DltidT{"APP0"})), _, _, _));
+    EXPECT_CALL(second_handler,
+                Handle(AllOf(Field(&TypeInfo::id, 5U), Field(&TypeInfo::app_id, DltidT{"APP1"})), _, _, _));
+
+    const auto cache = std::make_shared<TypeDescriptorCache>(nv_config);
+    LogParser first_parser(nv_config, {&first_handler}, {}, cache);
+    LogParser second_parser(nv_config, {&second_handler}, {}, cache);
+    first_parser.AddIncomingType(2U, MakeTypeParams("test::Message", "APP0"));
+    second_parser.AddIncomingType(5U, MakeTypeParams("test::Message", "APP1"));
+    EXPECT_EQ(cache->GetSize(), 1U);
+
+    std::string payload{"TestData"};
+    score::mw::log::detail::SharedMemoryRecord record;
+    record.payload = score::cpp::span<score::mw::log::detail::Byte>{payload.data(), payload.size()};
+    record.header.type_identifier = 2U;
+    first_parser.ParseSharedMemoryRecord(record);
+    record.header.type_identifier = 5U;
+    second_parser.ParseSharedMemoryRecord(record);
+}
+
+}  // namespace test
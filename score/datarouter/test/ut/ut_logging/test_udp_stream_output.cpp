@@ -18,6 +18,9 @@
 #include "gtest/gtest.h"
 #include <score/span.hpp>
 #include <gmock/gmock.h>
+#include <netinet/udp.h>
+#include <array>
+#include <cstring>
 #include <sstream>
 
 namespace score
@@ -256,6 +259,159 @@ TEST_F(UdpStreamOutputFixture, SendMethodShallFailIfSendmsgFailed)
     EXPECT_TRUE(ret.has_value());
 }
 
+TEST_F(UdpStreamOutputFixture, SetSendBufferSizeShallSetTheSocketOption)
+{
+    // The construction sets further socket options.
+    EXPECT_CALL(*sock_mock_, setsockopt(_, _, _, _, _)).Times(AnyNumber());
+    auto* const socket_mock = sock_mock_.get();
+    // When instantiating a UdpStreamOutput instance.
+    stream_output_ = std::make_unique<UdpStreamOutput>(addr_, port_, multicast_interface_, std::move(sock_mock_));
+
+    // And expecting the configured send buffer size to replace the default one.
+    EXPECT_CALL(*socket_mock, setsockopt(_, SOL_SOCKET, SO_SNDBUF, _, sizeof(std::int32_t)))
+        .Times(Exactly(1))
+        .WillOnce([](auto, auto, auto, const void* value, auto) -> score::cpp::expected_blank<score::os::Error> {
+            EXPECT_EQ(*static_cast<const std::int32_t*>(value), 1024 * 1024);
+            return {};
+        });
+
+    // And setting the send buffer size.
+    auto ret = stream_output_->SetSendBufferSize(1024 * 1024);
+
+    // It shall succeed.
+    EXPECT_TRUE(ret.has_value());
+}
+
+TEST_F(UdpStreamOutputFixture, SendWithSegmentSizesShallFailIfSegmentationOffloadIsNotEnabled)
+{
+    // When expecting no message to be sent.
+    EXPECT_CALL(*sock_mock_, sendmmsg(_, _, _, _)).Times(0);
+
+    std::array<mmsghdr, 1UL> mmsg_hdr_array{};
+    const std::array<std::uint16_t, 1UL> segment_sizes{1000U};
+
+    // And instantiating a UdpStreamOutput instance.
+    stream_output_ = std::make_unique<UdpStreamOutput>(addr_, port_, multicast_interface_, std::move(sock_mock_));
+
+    // And sending segmented messages without enabling the segmentation offload.
+    auto ret = stream_output_->Send(score::cpp::span<mmsghdr>{mmsg_hdr_array.data(), mmsg_hdr_array.size()},
+                                    score::cpp::span<const std::uint16_t>{segment_sizes.data(), segment_sizes.size()});
+
+    // It shall fail.
+    EXPECT_FALSE(ret.has_value());
+}
+
+#if defined(UDP_SEGMENT)
+TEST_F(UdpStreamOutputFixture, EnableSegmentationOffloadShallFailIfTheKernelDoesNotSupportIt)
+{
+    // The construction sets further socket options.
+    EXPECT_CALL(*sock_mock_, setsockopt(_, _, _, _, _)).Times(AnyNumber());
+    // When mocking the probe of the segmentation offload to fail.
+    EXPECT_CALL(*sock_mock_, setsockopt(_, SOL_UDP, UDP_SEGMENT, _, _))
+        .Times(Exactly(1))
+        .WillOnce(Return(score::cpp::make_unexpected(score::os::Error::createFromErrno(ENOPROTOOPT))));
+
+    // And instantiating a UdpStreamOutput instance.
+    stream_output_ = std::make_unique<UdpStreamOutput>(addr_, port_, multicast_interface_, std::move(sock_mock_));
+
+    // And enabling the segmentation offload.
+    auto ret = stream_output_->EnableSegmentationOffload(2UL);
+
+    // It shall fail.
+    EXPECT_FALSE(ret.has_value());
+}
+
+TEST_F(UdpStreamOutputFixture, SendWithSegmentSizesShallAttachTheSegmentSizeToSegmentedMessagesOnly)
+{
+    // The construction sets further socket options.
+    EXPECT_CALL(*sock_mock_, setsockopt(_, _, _, _, _)).Times(AnyNumber());
+    // When mocking the probe of the segmentation offload to succeed.
+    EXPECT_CALL(*sock_mock_, setsockopt(_, SOL_UDP, UDP_SEGMENT, _, _))
+        .Times(Exactly(1))
+        .WillOnce(Return(score::cpp::expected_blank<score::os::Error>{}));
+    // And expecting the segment size to be carried by the control message of the first message only.
+    EXPECT_CALL(*sock_mock_, sendmmsg(_, _, 2U, _))
+        .Times(Exactly(1))
+        .WillOnce([](auto, mmsghdr* mmsg, auto, auto) -> score::cpp::expected<std::int32_t, score::os::Error> {
+            const cmsghdr* const cmsg = CMSG_FIRSTHDR(&mmsg[0].msg_hdr);
+            EXPECT_NE(cmsg, nullptr);
+            if (cmsg != nullptr)
+            {
+                EXPECT_EQ(cmsg->cmsg_level, SOL_UDP);
+                EXPECT_EQ(cmsg->cmsg_type, UDP_SEGMENT);
+                std::uint16_t segment_size{};
+                // NOLINTNEXTLINE(score-banned-function) deserialization of trivially copyable
+                std::memcpy(&segment_size, CMSG_DATA(cmsg), sizeof(segment_size));
+                EXPECT_EQ(segment_size, 1000U);
+            }
+            EXPECT_EQ(mmsg[1].msg_hdr.msg_control, nullptr);
+            EXPECT_EQ(mmsg[1].msg_hdr.msg_controllen, 0UL);
+            return 2;
+        });
+
+    std::array<mmsghdr, 2UL> mmsg_hdr_array{};
+    const std::array<std::uint16_t, 2UL> segment_sizes{1000U, 0U};
+
+    // And instantiating a UdpStreamOutput instance with the segmentation offload enabled.
+    stream_output_ = std::make_unique<UdpStreamOutput>(addr_, port_, multicast_interface_, std::move(sock_mock_));
+    ASSERT_TRUE(stream_output_->EnableSegmentationOffload(mmsg_hdr_array.size()).has_value());
+
+    // And sending a segmented and an unsegmented message.
+    auto ret = stream_output_->Send(score::cpp::span<mmsghdr>{mmsg_hdr_array.data(), mmsg_hdr_array.size()},
+                                    score::cpp::span<const std::uint16_t>{segment_sizes.data(), segment_sizes.size()});
+
+    // It shall succeed.
+    ASSERT_TRUE(ret.has_value());
+    EXPECT_EQ(ret.value(), 2);
+}
+#endif
+
+class SubmissionRingMock : public IUdpSubmissionRing
+{
+  public:
+    MOCK_METHOD(score::cpp::expected_blank<score::os::Error>,
+                Queue,
+                (const std::int32_t, score::cpp::span<mmsghdr>, Completion&),
+                (noexcept, override));
+    MOCK_METHOD((score::cpp::expected<std::uint32_t, score::os::Error>), Submit, (), (noexcept, override));
+};
+
+class CompletionStub : public IUdpSubmissionRing::Completion
+{
+  public:
+    void OnSent(const std::int32_t) noexcept override {}
+};
+
+TEST_F(UdpStreamOutputFixture, QueueShallAddressTheMessagesAndHandThemToTheRing)
+{
+    EXPECT_CALL(*sock_mock_, socket(_, _, _)).WillOnce(Return(5));
+    EXPECT_CALL(*sock_mock_, setsockopt(_, _, _, _, _)).Times(AnyNumber());
+    // The socket shall not send the messages itself.
+    EXPECT_CALL(*sock_mock_, sendmmsg(_, _, _, _)).Times(0);
+
+    SubmissionRingMock ring{};
+    CompletionStub completion{};
+    // Expecting the messages to be queued on the socket of the output, addressed to its destination.
+    EXPECT_CALL(ring, Queue(5, _, Ref(completion)))
+        .WillOnce([](auto, score::cpp::span<mmsghdr> mmsg, auto&) -> score::cpp::expected_blank<score::os::Error> {
+            EXPECT_EQ(mmsg.size(), 2U);
+            for (const auto& msg : mmsg)
+            {
+                EXPECT_NE(msg.msg_hdr.msg_name, nullptr);
+                EXPECT_EQ(msg.msg_hdr.msg_namelen, sizeof(sockaddr_in));
+                EXPECT_EQ(msg.msg_hdr.msg_control, nullptr);
+            }
+            return {};
+        });
+
+    std::array<mmsghdr, 2UL> mmsg_hdr_array{};
+    stream_output_ = std::make_unique<UdpStreamOutput>(addr_, port_, multicast_interface_, std::move(sock_mock_));
+    const auto ret = stream_output_->Queue(
+        ring, score::cpp::span<mmsghdr>{mmsg_hdr_array.data(), mmsg_hdr_array.size()}, completion);
+
+    EXPECT_TRUE(ret.has_value());
+}
+
 }  // namespace
 }  // namespace dltserver
 }  // namespace logging
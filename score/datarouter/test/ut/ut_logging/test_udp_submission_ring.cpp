@@ -0,0 +1,205 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include "score/datarouter/include/daemon/udp_submission_ring.h"
+
+#include "gtest/gtest.h"
+#include <gmock/gmock.h>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <array>
+#include <cerrno>
+#include <vector>
+
+namespace score
+{
+namespace logging
+{
+namespace dltserver
+{
+namespace
+{
+
+using namespace testing;
+
+constexpr std::size_t kMessages{3UL};
+constexpr std::uint32_t kEntries{8U};
+
+class CompletionRecorder : public IUdpSubmissionRing::Completion
+{
+  public:
+    void OnSent(const std::int32_t result) noexcept override
+    {
+        results.push_back(result);
+    }
+
+    std::vector<std::int32_t> results{};
+};
+
+/// Sends datagrams from one loopback socket to another, thus without mocking the kernel.
+class UdpSubmissionRingFixture : public testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        auto ring = UdpSubmissionRing::Create(kEntries);
+        if (!ring.has_value())
+        {
+            GTEST_SKIP() << "io_uring is not available";
+        }
+        ring_ = std::move(ring.value());
+
+        receiver_ = ::socket(AF_INET, SOCK_DGRAM, 0);
+        sender_ = ::socket(AF_INET, SOCK_DGRAM, 0);
+        ASSERT_GE(receiver_, 0);
+        ASSERT_GE(sender_, 0);
+        address_.sin_family = AF_INET;
+        address_.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        socklen_t address_size = sizeof(address_);
+        // NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast) POSIX socket address
+        ASSERT_EQ(::bind(receiver_, reinterpret_cast<const sockaddr*>(&address_), sizeof(address_)), 0);
+        ASSERT_EQ(::getsockname(receiver_, reinterpret_cast<sockaddr*>(&address_), &address_size), 0);
+        // NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
+        constexpr timeval kReceiveTimeout{1, 0};
+        ASSERT_EQ(::setsockopt(receiver_, SOL_SOCKET, SO_RCVTIMEO, &kReceiveTimeout, sizeof(kReceiveTimeout)), 0);
+
+        for (std::size_t index = 0UL; index < kMessages; ++index)
+        {
+            payloads_[index].fill(static_cast<char>('a' + index));
+            iovecs_[index] = iovec{payloads_[index].data(), payloads_[index].size()};
+            messages_[index].msg_hdr.msg_name = &address_;
+            messages_[index].msg_hdr.msg_namelen = sizeof(address_);
+            messages_[index].msg_hdr.msg_iov = &iovecs_[index];
+            messages_[index].msg_hdr.msg_iovlen = 1UL;
+        }
+    }
+
+    void TearDown() override
+    {
+        ring_.reset();
+        if (sender_ >= 0)
+        {
+            std::ignore = ::close(sender_);
+        }
+        if (receiver_ >= 0)
+        {
+            std::ignore = ::close(receiver_);
+        }
+    }
+
+    score::cpp::span<mmsghdr> Messages()
+    {
+        return score::cpp::span<mmsghdr>{messages_.data(), messages_.size()};
+    }
+
+    /// Submits until all completions are reaped, the kernel may complete the messages asynchronously.
+    void SubmitUntilCompleted(const CompletionRecorder& completion)
+    {
+        for (std::size_t attempt = 0UL; (attempt < 1000UL) && (completion.results.size() < kMessages); ++attempt)
+        {
+            std::ignore = ring_->Submit();
+        }
+    }
+
+    std::unique_ptr<UdpSubmissionRing> ring_{};
+    std::int32_t receiver_{-1};
+    std::int32_t sender_{-1};
+    sockaddr_in address_{};
+    std::array<std::array<char, 16UL>, kMessages> payloads_{};
+    std::array<iovec, kMessages> iovecs_{};
+    std::array<mmsghdr, kMessages> messages_{};
+};
+
+TEST_F(UdpSubmissionRingFixture, QueuedMessagesAreSentWithOneSubmission)
+{
+    CompletionRecorder completion{};
+    ASSERT_TRUE(ring_->Queue(sender_, Messages(), completion).has_value());
+
+    // Queued below half of the ring, the messages are not submitted yet.
+    EXPECT_EQ(ring_->GetStatistics().enter_calls, 0U);
+    EXPECT_THAT(completion.results, IsEmpty());
+
+    const auto submitted = ring_->Submit();
+    ASSERT_TRUE(submitted.has_value());
+    EXPECT_EQ(submitted.value(), kMessages);
+    SubmitUntilCompleted(completion);
+
+    EXPECT_THAT(completion.results, ElementsAre(16, 16, 16));
+    const auto statistics = ring_->GetStatistics();
+    EXPECT_EQ(statistics.submitted_messages, kMessages);
+    EXPECT_EQ(statistics.completed_messages, kMessages);
+
+    // The datagrams arrive in the order queued.
+    for (std::size_t index = 0UL; index < kMessages; ++index)
+    {
+        std::array<char, 64UL> buffer{};
+        ASSERT_EQ(::recv(receiver_, buffer.data(), buffer.size(), 0), 16);
+        EXPECT_EQ(buffer[0], static_cast<char>('a' + index));
+    }
+}
+
+TEST_F(UdpSubmissionRingFixture, MessagesAreSubmittedWhenHalfOfTheRingIsQueued)
+{
+    CompletionRecorder completion{};
+    ASSERT_TRUE(ring_->Queue(sender_, Messages(), completion).has_value());
+    ASSERT_TRUE(ring_->Queue(sender_, Messages().subspan(0UL, 1UL), completion).has_value());
+
+    // The second call queued the fourth message, thus submitted all four.
+    const auto statistics = ring_->GetStatistics();
+    EXPECT_EQ(statistics.enter_calls, 1U);
+    EXPECT_EQ(statistics.submitted_messages, kMessages + 1UL);
+}
+
+TEST_F(UdpSubmissionRingFixture, MoreMessagesThanTheRingHoldsAreRefused)
+{
+    std::array<mmsghdr, kEntries + 1U> messages{};
+    CompletionRecorder completion{};
+
+    const auto result =
+        ring_->Queue(sender_, score::cpp::span<mmsghdr>{messages.data(), messages.size()}, completion);
+
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(result.error().GetOsDependentErrorCode(), EMSGSIZE);
+    EXPECT_EQ(ring_->GetStatistics().submitted_messages, 0U);
+}
+
+TEST_F(UdpSubmissionRingFixture, FailedMessagesAreReportedByTheirCompletion)
+{
+    CompletionRecorder completion{};
+    // When queueing the messages on a socket that is not open.
+    ASSERT_TRUE(ring_->Queue(-1, Messages(), completion).has_value());
+
+    ASSERT_TRUE(ring_->Submit().has_value());
+    SubmitUntilCompleted(completion);
+
+    EXPECT_THAT(completion.results, ElementsAre(-EBADF, -EBADF, -EBADF));
+}
+
+TEST_F(UdpSubmissionRingFixture, DestructionCompletesTheQueuedMessages)
+{
+    CompletionRecorder completion{};
+    ASSERT_TRUE(ring_->Queue(sender_, Messages(), completion).has_value());
+
+    ring_.reset();
+
+    EXPECT_THAT(completion.results, ElementsAre(16, 16, 16));
+}
+
+}  // namespace
+}  // namespace dltserver
+}  // namespace logging
+}  // namespace score
@@ -16,9 +16,46 @@
 
 #include "score/datarouter/include/daemon/verbose_dlt.h"
 
+#include "static_reflection_with_serialization/serialization/for_logging.h"
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
 using namespace testing;
 using namespace score::logging::dltserver;
 
+namespace
+{
+
+// the LogEntry as serialized by the clients
+struct TestLogEntry
+{
+    score::mw::log::detail::LoggingIdentifier app_id{"APP1"};
+    score::mw::log::detail::LoggingIdentifier ctx_id{"CTX2"};
+    std::vector<std::uint8_t> payload{1U, 2U, 3U, 4U, 5U};
+    std::uint8_t num_of_args{1U};
+    score::mw::log::LogLevel log_level{score::mw::log::LogLevel::kDebug};
+};
+
+}  // namespace
+
+STRUCT_TRACEABLE(TestLogEntry, app_id, ctx_id, payload, num_of_args, log_level)
+
+namespace
+{
+
+std::string SerializeLogEntry(const TestLogEntry& entry)
+{
+    std::array<char, 256> buffer{};
+    using LoggingSerializer = ::score::common::visitor::logging_serializer;
+    const auto size = LoggingSerializer::serialize(entry, buffer.data(), buffer.size());
+    return std::string{buffer.data(), size};
+}
+
+}  // namespace
+
 class MockDltVerboseHandlerOutput : public DltVerboseHandler::IOutput
 {
   public:
@@ -26,6 +63,13 @@ class MockDltVerboseHandlerOutput : public DltVerboseHandler::IOutput
                 SendVerbose,
                 (uint32_t, const score::mw::log::detail::log_entry_deserialization::LogEntryDeserializationReflection&),
                 (override));
+    MOCK_METHOD(void,
+                SendVerbose,
+                (uint32_t,
+                 const score::mw::log::detail::log_entry_deserialization::LogEntryDeserializationReflection&,
+                 CachedRoute&),
+                (override));
+    MOCK_METHOD(bool, PrefilterVerbose, (CachedRoute&, DltidT, DltidT, score::mw::log::LogLevel), (override));
     MOCK_METHOD(bool, IsOutputEnabled, (), (const, noexcept, override));
     virtual ~MockDltVerboseHandlerOutput() = default;
 };
@@ -40,7 +84,7 @@ TEST(DltVerboseHandlerTest, sendVerboseTest)
     const char* data = "data";
     const BufsizeT data_size = static_cast<BufsizeT>(strlen(data));
 
-    EXPECT_CALL(mock_dlt_output, SendVerbose(_, _)).Times(1);
+    EXPECT_CALL(mock_dlt_output, SendVerbose(_, _, _)).Times(1);
 
     handler.Handle(timestamp, data, data_size);
 }
@@ -51,6 +95,7 @@ TEST(DltVerboseHandlerTest, HandleDoesNothingWhenOutputDisabled)
     MockDltVerboseHandlerOutput mock_dlt_output;
     ON_CALL(mock_dlt_output, IsOutputEnabled()).WillByDefault(Return(false));
     EXPECT_CALL(mock_dlt_output, SendVerbose(_, _)).Times(0);
+    EXPECT_CALL(mock_dlt_output, SendVerbose(_, _, _)).Times(0);
     DltVerboseHandler handler(mock_dlt_output);
 
     const TimestampT timestamp = score::os::HighResolutionSteadyClock::time_point{};
@@ -59,3 +104,107 @@ TEST(DltVerboseHandlerTest, HandleDoesNothingWhenOutputDisabled)
 
     handler.Handle(timestamp, data, data_size);
 }
+
+TEST(DltVerboseHandlerTest, HandleWithStateSendsWithTheRouteOfTheContext)
+{
+    MockDltVerboseHandlerOutput mock_dlt_output;
+    ON_CALL(mock_dlt_output, IsOutputEnabled()).WillByDefault(Return(true));
+    DltVerboseHandler handler(mock_dlt_output);
+    const auto state = handler.CreateState(TypeInfo{});
+    ASSERT_NE(state, nullptr);
+
+    const TimestampT timestamp = score::os::HighResolutionSteadyClock::time_point{};
+    const char* data = "data";
+    const BufsizeT data_size = static_cast<BufsizeT>(strlen(data));
+
+    // records of the same context share the route memoized for it
+    std::vector<const CachedRoute*> routes{};
+    EXPECT_CALL(mock_dlt_output, SendVerbose(_, _)).Times(0);
+    EXPECT_CALL(mock_dlt_output, SendVerbose(_, _, _))
+        .Times(2)
+        .WillRepeatedly([&routes](auto, const auto&, CachedRoute& route) {
+            routes.push_back(&route);
+        });
+
+    handler.HandleWithState(state.get(), timestamp, data, data_size);
+    handler.HandleWithState(state.get(), timestamp, data, data_size);
+    ASSERT_EQ(routes.size(), 2U);
+    EXPECT_EQ(routes.at(0U), routes.at(1U));
+}
+
+TEST(DltVerboseHandlerTest, PeekLogEntryHeaderReadsTheFieldsTheEntryIsDeserializedTo)
+{
+    const std::string record = SerializeLogEntry(TestLogEntry{});
+
+    const auto header = PeekLogEntryHeader(record.data(), static_cast<BufsizeT>(record.size()));
+    ASSERT_TRUE(header.has_value());
+    EXPECT_EQ(header->app_id, DltidT{"APP1"});
+    EXPECT_EQ(header->ctx_id, DltidT{"CTX2"});
+    EXPECT_EQ(header->log_level, score::mw::log::LogLevel::kDebug);
+
+    EXPECT_FALSE(PeekLogEntryHeader(record.data(), 1U).has_value());
+}
+
+TEST(DltVerboseHandlerTest, HandleWithStateDropsPrefilteredMessagesBeforeDeserializingThem)
+{
+    MockDltVerboseHandlerOutput mock_dlt_output;
+    ON_CALL(mock_dlt_output, IsOutputEnabled()).WillByDefault(Return(true));
+    DltVerboseHandler handler(mock_dlt_output);
+    const auto state = handler.CreateState(TypeInfo{});
+    const TimestampT timestamp = score::os::HighResolutionSteadyClock::time_point{};
+    const std::string record = SerializeLogEntry(TestLogEntry{});
+
+    // the prefilter and the message share the route of the context
+    CachedRoute* prefiltered_route = nullptr;
+    EXPECT_CALL(mock_dlt_output,
+                PrefilterVerbose(_, DltidT{"APP1"}, DltidT{"CTX2"}, score::mw::log::LogLevel::kDebug))
+        .WillOnce(Return(false))
+        .WillOnce([&prefiltered_route](CachedRoute& route, auto, auto, auto) {
+            prefiltered_route = &route;
+            return true;
+        });
+    EXPECT_CALL(mock_dlt_output, SendVerbose(_, _, _)).WillOnce([&prefiltered_route](auto, const auto&, auto& route) {
+        EXPECT_EQ(&route, prefiltered_route);
+    });
+
+    handler.HandleWithState(state.get(), timestamp, record.data(), static_cast<BufsizeT>(record.size()));
+    handler.HandleWithState(state.get(), timestamp, record.data(), static_cast<BufsizeT>(record.size()));
+}
+
+TEST(DltVerboseHandlerTest, HandleDropsPrefilteredMessagesLikeHandleWithState)
+{
+    MockDltVerboseHandlerOutput mock_dlt_output;
+    ON_CALL(mock_dlt_output, IsOutputEnabled()).WillByDefault(Return(true));
+    DltVerboseHandler handler(mock_dlt_output);
+    const TimestampT timestamp = score::os::HighResolutionSteadyClock::time_point{};
+    const std::string record = SerializeLogEntry(TestLogEntry{});
+
+    EXPECT_CALL(mock_dlt_output,
+                PrefilterVerbose(_, DltidT{"APP1"}, DltidT{"CTX2"}, score::mw::log::LogLevel::kDebug))
+        .WillOnce(Return(false));
+    EXPECT_CALL(mock_dlt_output, SendVerbose(_, _)).Times(0);
+    EXPECT_CALL(mock_dlt_output, SendVerbose(_, _, _)).Times(0);
+
+    handler.Handle(timestamp, record.data(), static_cast<BufsizeT>(record.size()));
+}
+
+TEST(VerboseRoutingStateTest, RouteIsResetWhenItsSlotIsTakenByAnotherContext)
+{
+    VerboseRoutingState state;
+    auto& route = state.GetRoute(DltidT{"APP0"}, DltidT{"CTX0"});
+    route.generation = 1U;
+    EXPECT_EQ(state.GetRoute(DltidT{"APP0"}, DltidT{"CTX0"}).generation, 1U);
+
+    // contexts mapped to the same slot replace each other
+    for (std::uint32_t index = 0U; index < 100U; ++index)
+    {
+        const std::string ctx_id = "C" + std::to_string(index);
+        if (&state.GetRoute(DltidT{"APP0"}, DltidT{ctx_id}) == &route)
+        {
+            EXPECT_EQ(route.generation, 0U);
+            EXPECT_EQ(state.GetRoute(DltidT{"APP0"}, DltidT{"CTX0"}).generation, 0U);
+            return;
+        }
+    }
+    FAIL() << "no context shares the slot of APP0/CTX0";
+}
@@ -18,6 +18,7 @@
 #include "score/span.hpp"
 #include <score/optional.hpp>
 
+#include <limits>
 #include <type_traits>
 
 /// For specification of the DLT protocol, please see:
@@ -582,6 +583,34 @@ AddArgumentResult DLTFormat::Log(VerbosePayload& payload, const LogRawBuffer dat
     return Store(payload, type_info, length_cropped, data_cropped);
 }
 
+AddArgumentResult DLTFormat::LogPacked(VerbosePayload& payload,
+                                       const score::cpp::span<const std::uint8_t> arguments) noexcept
+{
+    const auto size = static_cast<std::size_t>(arguments.size());
+    if (payload.WillOverflow(size))
+    {
+        return AddArgumentResult::kNotAdded;
+    }
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) the arguments are copied byte by byte
+    payload.Put(reinterpret_cast<const Byte*>(arguments.data()), size);
+    return AddArgumentResult::kAdded;
+}
+
+AddArgumentResult DLTFormat::LogPacked(LogRecord& log_record,
+                                       const score::cpp::span<const std::uint8_t> arguments,
+                                       const std::uint8_t argument_count) noexcept
+{
+    auto& num_of_args = log_record.GetLogEntry().num_of_args;
+    using ArgumentCount = std::decay_t<decltype(num_of_args)>;
+    if ((argument_count > (std::numeric_limits<ArgumentCount>::max() - num_of_args)) ||
+        (LogPacked(log_record.GetVerbosePayload(), arguments) == AddArgumentResult::kNotAdded))
+    {
+        return AddArgumentResult::kNotAdded;
+    }
+    num_of_args = static_cast<ArgumentCount>(num_of_args + argument_count);
+    return AddArgumentResult::kAdded;
+}
+
 }  // namespace detail
 }  // namespace log
 }  // namespace mw
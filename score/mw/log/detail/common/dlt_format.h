@@ -15,9 +15,12 @@
 
 #include "score/mw/log/detail/add_argument_result.h"
 #include "score/mw/log/detail/integer_representation.h"
+#include "score/mw/log/detail/log_record.h"
 #include "score/mw/log/detail/verbose_payload.h"
 #include "score/mw/log/log_types.h"
 
+#include "score/span.hpp"
+
 #include <string_view>
 
 #include <cstdint>
@@ -87,6 +90,14 @@ class DLTFormat
     static AddArgumentResult Log(VerbosePayload&, const double) noexcept;
     static AddArgumentResult Log(VerbosePayload&, const std::string_view) noexcept;
     static AddArgumentResult Log(VerbosePayload&, const LogRawBuffer) noexcept;
+
+    /// \brief Adds arguments formatted by the calls above beforehand, either all of them or none.
+    static AddArgumentResult LogPacked(VerbosePayload&, const score::cpp::span<const std::uint8_t>) noexcept;
+
+    /// \brief Adds the packed arguments to the payload of the record and counts them, either all of them or none.
+    static AddArgumentResult LogPacked(LogRecord&,
+                                       const score::cpp::span<const std::uint8_t>,
+                                       const std::uint8_t argument_count) noexcept;
 };
 
 }  // namespace detail
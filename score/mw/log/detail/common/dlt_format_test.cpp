@@ -14,6 +14,10 @@
 
 #include "gtest/gtest.h"
 
+#include <algorithm>
+#include <limits>
+#include <type_traits>
+
 namespace score
 {
 namespace mw
@@ -879,6 +883,73 @@ TEST_F(DLTFormatFixture, RawValueDoesNotFitAny)
     ASSERT_EQ(buffer.size(), 0);
 }
 
+TEST_F(DLTFormatFixture, PackedArgumentsAreCopiedAsFormattedByLog)
+{
+    RecordProperty("Description", "Verifies arguments formatted beforehand are added as Log() adds them.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+
+    DLTFormat::Log(payload, std::uint8_t{0x42});
+    DLTFormat::Log(payload, std::string_view{"ab"});
+    const std::vector<std::uint8_t> packed{buffer.begin(), buffer.end()};
+    buffer.clear();
+
+    ASSERT_EQ(DLTFormat::LogPacked(payload, score::cpp::span<const std::uint8_t>{packed.data(), packed.size()}),
+              AddArgumentResult::kAdded);
+
+    ASSERT_EQ(buffer.size(), packed.size());
+    ASSERT_TRUE(std::equal(buffer.begin(), buffer.end(), packed.begin()));
+}
+
+TEST_F(DLTFormatFixture, PackedArgumentsAreNotAddedIfNotAllFit)
+{
+    RecordProperty("Description", "Verifies packed arguments are not added partially.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+
+    const std::vector<std::uint8_t> packed{0x41U, 0x00U, 0x00U, 0x00U, 0x42U};
+
+    ASSERT_EQ(
+        DLTFormat::LogPacked(size_two_payload, score::cpp::span<const std::uint8_t>{packed.data(), packed.size()}),
+        AddArgumentResult::kNotAdded);
+
+    ASSERT_EQ(size_two_buffer.size(), 0U);
+}
+
+TEST_F(DLTFormatFixture, PackedArgumentsAreCountedInTheRecord)
+{
+    RecordProperty("Description", "Verifies packed arguments added to a record are counted as its arguments.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+
+    LogRecord log_record{};
+    const std::vector<std::uint8_t> packed{0x41U, 0x00U, 0x00U, 0x00U, 0x42U};
+
+    ASSERT_EQ(DLTFormat::LogPacked(log_record, score::cpp::span<const std::uint8_t>{packed.data(), packed.size()}, 2U),
+              AddArgumentResult::kAdded);
+
+    EXPECT_EQ(log_record.GetLogEntry().num_of_args, 2U);
+    EXPECT_EQ(log_record.GetLogEntry().payload.size(), packed.size());
+}
+
+TEST_F(DLTFormatFixture, PackedArgumentsAreNotAddedIfTheArgumentCountOverflows)
+{
+    RecordProperty("Description", "Verifies packed arguments are not added if the record cannot count them.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+
+    LogRecord log_record{};
+    auto& num_of_args = log_record.GetLogEntry().num_of_args;
+    num_of_args = std::numeric_limits<std::decay_t<decltype(num_of_args)>>::max();
+    const std::vector<std::uint8_t> packed{0x41U, 0x00U, 0x00U, 0x00U, 0x42U};
+
+    ASSERT_EQ(DLTFormat::LogPacked(log_record, score::cpp::span<const std::uint8_t>{packed.data(), packed.size()}, 1U),
+              AddArgumentResult::kNotAdded);
+
+    EXPECT_EQ(num_of_args, std::numeric_limits<std::decay_t<decltype(num_of_args)>>::max());
+    EXPECT_EQ(log_record.GetLogEntry().payload.size(), 0U);
+}
+
 }  // namespace
 }  // namespace detail
 }  // namespace log
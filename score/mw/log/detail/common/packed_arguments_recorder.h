@@ -0,0 +1,59 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_MW_LOG_DETAIL_COMMON_PACKED_ARGUMENTS_RECORDER_H
+#define SCORE_MW_LOG_DETAIL_COMMON_PACKED_ARGUMENTS_RECORDER_H
+
+#include "score/mw/log/slot_handle.h"
+
+#include "score/span.hpp"
+
+#include <cstdint>
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+namespace detail
+{
+
+/// \brief Implemented by recorders formatting DLT verbose payloads, next to the Recorder interface.
+///
+/// Frontends serializing all arguments of a message at once, like the Rust bridge, hand them over in a single call
+/// instead of one Log() call per argument.
+class PackedArgumentsRecorder
+{
+  public:
+    /// \brief Appends arguments already serialized in DLT verbose format, in native byte order, to the slot.
+    /// \return false, if not all arguments fit into the slot. Then none is added, and the caller shall log them one by
+    /// one to keep as many as fit.
+    virtual bool LogPacked(const SlotHandle& slot,
+                           const score::cpp::span<const std::uint8_t> arguments,
+                           const std::uint8_t argument_count) noexcept = 0;
+
+  protected:
+    PackedArgumentsRecorder() noexcept = default;
+    PackedArgumentsRecorder(const PackedArgumentsRecorder&) noexcept = default;
+    PackedArgumentsRecorder(PackedArgumentsRecorder&&) noexcept = default;
+    PackedArgumentsRecorder& operator=(const PackedArgumentsRecorder&) noexcept = default;
+    PackedArgumentsRecorder& operator=(PackedArgumentsRecorder&&) noexcept = default;
+    virtual ~PackedArgumentsRecorder() = default;
+};
+
+}  // namespace detail
+}  // namespace log
+}  // namespace mw
+}  // namespace score
+
+#endif  // SCORE_MW_LOG_DETAIL_COMMON_PACKED_ARGUMENTS_RECORDER_H
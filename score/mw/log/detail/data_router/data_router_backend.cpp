@@ -16,6 +16,7 @@
 #include "score/mw/log/legacy_non_verbose_api/tracing.h"
 
 #include <score/utility.hpp>
+#include <algorithm>
 #include <iostream>
 #include <type_traits>
 
@@ -45,6 +46,23 @@ std::size_t CheckForMaxCapacity(const std::size_t capacity) noexcept
     }
 }
 
+//  Room for the serialized fields of a LogEntry besides its payload, i.e. identifiers, level and argument count.
+constexpr std::size_t kLogEntryFieldsReserve{64UL};
+
+/// \brief Sizes the blob arena to hold a record per configured slot, if records may exceed a ring buffer entry.
+BlobPoolConfiguration GetBlobPoolConfiguration(const Configuration& config) noexcept
+{
+    const auto record_size = config.GetSlotSizeInBytes() + kLogEntryFieldsReserve;
+    if (record_size <= static_cast<std::size_t>(SharedMemoryWriter::GetMaxPayloadSize()))
+    {
+        return {};
+    }
+    //  Each slot may be flushed while the arena still holds the records of the other slots.
+    const auto number_of_slots =
+        std::min(config.GetNumberOfSlots(), static_cast<std::size_t>(GetMaxNumberOfBlobSlots()));
+    return BlobPoolConfiguration{number_of_slots, record_size};
+}
+
 }  //  namespace
 
 DataRouterBackend::DataRouterBackend(const std::size_t number_of_slots,
@@ -55,8 +73,10 @@ DataRouterBackend::DataRouterBackend(const std::size_t number_of_slots,
     : Backend{}, buffer_{CheckForMaxCapacity(number_of_slots), initial_slot_value}, message_client_{nullptr}
 {
 
-    auto writer =
-        writer_factory.Create(config.GetRingBufferSize(), config.GetDynamicDatarouterIdentifiers(), config.GetAppId());
+    auto writer = writer_factory.Create(config.GetRingBufferSize(),
+                                        config.GetDynamicDatarouterIdentifiers(),
+                                        config.GetAppId(),
+                                        GetBlobPoolConfiguration(config));
 
     // start running and create the logger and message client factory only if writer is having value.
     if (writer.has_value())
@@ -41,6 +41,7 @@ namespace
 {
 
 using ::testing::_;
+using ::testing::Ge;
 using ::testing::Return;
 using ::testing::StrEq;
 
@@ -533,6 +534,35 @@ TEST_F(DataRouterBackendFixture, WhenIdentifierIsNotDynamicUidShallBeUsed)
         k_slots_size, LogRecord{}, message_client_factory, config, std::move(writer_factory));
 }
 
+TEST_F(DataRouterBackendFixture, WhenSlotsExceedARingBufferEntryTheBlobArenaIsSizedFromTheConfiguration)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "Verifies that the large payload arena holds every configured slot.");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("DerivationTechnique", "Generation and analysis of equivalence classes");
+
+    constexpr std::size_t kNumberOfSlots{4UL};
+    constexpr std::size_t kSlotSizeInBytes{100000UL};
+    const std::uint8_t k_slots_size = 16UL;
+    DatarouterMessageClientFactoryMock message_client_factory{};
+    config.SetNumberOfSlots(kNumberOfSlots);
+    config.SetSlotSizeInBytes(kSlotSizeInBytes);
+
+    EXPECT_CALL(*fcntl_mock_raw_ptr, open(StrEq(GetStaticSharedMemoryFileName()), kOpenReadFlags, kOpenModeFlags))
+        .WillOnce(Return(score::cpp::expected<std::int32_t, score::os::Error>{kFileDescriptor}));
+    EXPECT_CALL(*unistd_mock_raw_ptr,
+                ftruncate(kFileDescriptor, Ge(static_cast<off_t>(kNumberOfSlots * kSlotSizeInBytes))))
+        .WillOnce(Return(score::cpp::expected_blank<score::os::Error>{}));
+
+    EXPECT_CALL(message_client_factory, CreateOnce(_, _))
+        .WillOnce([](const std::string&, const std::string&) -> std::unique_ptr<DatarouterMessageClient> {
+            return std::make_unique<DatarouterMessageClientMock>();
+        });
+
+    DataRouterBackend datarouter_backend(
+        k_slots_size, LogRecord{}, message_client_factory, config, std::move(writer_factory));
+}
+
 TEST_F(DataRouterBackendFixture, ConstructWithDynamicIdentifier)
 {
     RecordProperty("ASIL", "B");
@@ -210,7 +210,13 @@ bool DatarouterMessageClientImpl::StartReceiver()
     };
     auto received_send_message_callback = [this_ptr](
                                               score::message_passing::IServerConnection& /*connection*/,
-                                              const score::cpp::span<const std::uint8_t> /*message*/) noexcept -> score::cpp::blank {
+                                              const score::cpp::span<const std::uint8_t> message) noexcept -> score::cpp::blank {
+        if ((message.empty() == false) &&
+            (message.front() == score::cpp::to_underlying(DatarouterMessageIdentifier::kPoolBlockGrant)))
+        {
+            this_ptr->OnPoolBlockGrant(message);
+            return {};
+        }
         this_ptr->OnAcquireRequest();
         return {};
     };
@@ -380,6 +386,21 @@ void DatarouterMessageClientImpl::OnAcquireRequest() noexcept
     SendMessage(message);
 }
 
+void DatarouterMessageClientImpl::OnPoolBlockGrant(const score::cpp::span<const std::uint8_t> message) noexcept
+{
+    std::uint32_t slot{};
+    if (message.size() != (sizeof(slot) + 1U))
+    {
+        return;
+    }
+    auto source_iterator = message.begin();
+    std::advance(source_iterator, 1U);
+    // coverity[autosar_cpp14_m5_2_8_violation] filling the raw form of the slot from the message payload
+    score::cpp::span<std::uint8_t> slot_span{static_cast<std::uint8_t*>(static_cast<void*>(&slot)), sizeof(slot)};
+    std::ignore = std::copy_n(source_iterator, slot_span.size(), slot_span.begin());
+    std::ignore = shared_memory_writer_.AttachPoolBlock(slot);
+}
+
 void DatarouterMessageClientImpl::HandleFirstMessageReceived() noexcept
 {
     if (first_message_received_.load())
@@ -734,6 +734,47 @@ TEST_F(DatarouterMessageClientFixture, SecondAcquireRequestShouldNotSetMwsrReade
     ExpectClientDestruction(sender_ptr);
 }
 
+TEST_F(DatarouterMessageClientFixture, PoolBlockGrantShallNotBeAnsweredLikeAnAcquireRequest)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description",
+                   "Verifies that a pool block grant is handed to the writer and not answered with an acquire "
+                   "response.");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("DerivationTechnique", "Generation and analysis of equivalence classes");
+
+    testing::InSequence order_matters;
+
+    score::message_passing::ClientConnectionMock* sender_ptr{};
+    score::message_passing::ServerMock* receiver_ptr{};
+    score::message_passing::ConnectCallback connect_callback;
+    score::message_passing::DisconnectCallback disconnect_callback;
+    score::message_passing::MessageCallback sent_callback;
+    score::message_passing::MessageCallback sent_with_reply_callback;
+    score::message_passing::IClientConnection::StateCallback state_callback;
+
+    ExpectSenderAndReceiverCreation(&receiver_ptr,
+                                    &sender_ptr,
+                                    &state_callback,
+                                    nullptr,
+                                    {},
+                                    &connect_callback,
+                                    &disconnect_callback,
+                                    &sent_callback,
+                                    &sent_with_reply_callback);
+
+    ExecuteCreateSenderAndReceiverSequence(true, &state_callback);
+
+    //  The writer of the fixture has no pool, thus ignores the grant. The strict sender mock rejects any message.
+    const std::array<std::uint8_t, 5> grant_message{
+        score::cpp::to_underlying(DatarouterMessageIdentifier::kPoolBlockGrant), 0U, 0U, 0U, 0U};
+    score::message_passing::ServerConnectionMock connection;
+    sent_callback(connection, score::cpp::span<const std::uint8_t>{grant_message.data(), grant_message.size()});
+
+    ExpectServerDestruction(receiver_ptr);
+    ExpectClientDestruction(sender_ptr);
+}
+
 // Refactor to acquire request
 TEST_F(DatarouterMessageClientFixture, ClientShouldShutdownAfterFailingToSendMessage)
 {
@@ -36,6 +36,9 @@ enum class DatarouterMessageIdentifier : std::uint8_t
     kConnect = 0x00,
     kAcquireRequest = 0x01,
     kAcquireResponse = 0x02,
+    //  Sent by Datarouter after an acquire response that requested a pool block. The slot of the block follows as
+    //  std::uint32_t.
+    kPoolBlockGrant = 0x03,
 };
 
 /// \brief Returns a pointer to the raw memory of a trivially copyable object as uint8_t*.
@@ -18,6 +18,7 @@
 #include "score/mw/log/detail/dlt_argument_counter.h"
 
 #include <tuple>
+#include <type_traits>
 
 namespace score
 {
@@ -221,6 +222,14 @@ void DataRouterRecorder::Log(const SlotHandle& slot, const LogSlog2Message data)
     LogData(slot, data.GetMessage());
 }
 
+bool DataRouterRecorder::LogPacked(const SlotHandle& slot,
+                                   const score::cpp::span<const std::uint8_t> arguments,
+                                   const std::uint8_t argument_count) noexcept
+{
+    // the caller logs the arguments one by one if not all fit, which then counts the message as too long
+    return DLTFormat::LogPacked(backend_->GetLogRecord(slot), arguments, argument_count) == AddArgumentResult::kAdded;
+}
+
 void DataRouterRecorder::SetApplicationId(LogRecord& log_record) noexcept
 {
     auto& log_entry = log_record.GetLogEntry();
@@ -17,6 +17,7 @@
 #include "score/mw/log/recorder.h"
 
 #include "score/mw/log/configuration/configuration.h"
+#include "score/mw/log/detail/common/packed_arguments_recorder.h"
 #include "score/mw/log/detail/common/statistics_reporter.h"
 
 #include <memory>
@@ -33,7 +34,7 @@ namespace detail
 class Backend;
 class LogRecord;
 
-class DataRouterRecorder final : public Recorder
+class DataRouterRecorder final : public Recorder, public PackedArgumentsRecorder
 {
   public:
     DataRouterRecorder(std::unique_ptr<Backend>&&, const Configuration& config) noexcept;
@@ -77,6 +78,10 @@ class DataRouterRecorder final : public Recorder
 
     void Log(const SlotHandle&, const LogSlog2Message) noexcept override;
 
+    bool LogPacked(const SlotHandle& slot,
+                   const score::cpp::span<const std::uint8_t> arguments,
+                   const std::uint8_t argument_count) noexcept override;
+
     bool IsLogEnabled(const LogLevel& log_level, const std::string_view context) const noexcept override;
 
   private:
@@ -15,8 +15,10 @@
 
 #include "gtest/gtest.h"
 
+#include <array>
 #include <limits>
 #include <memory>
+#include <vector>
 
 #include "score/mw/log/detail/backend_mock.h"
 
@@ -416,6 +418,38 @@ TEST_F(DataRouterRecorderFixture, Log_LogSlog2Message)
     recorder_->Log(SlotHandle{}, LogSlog2Message{11, "slog message"});
 }
 
+TEST_F(DataRouterRecorderFixture, LogPackedAddsAllArgumentsAtOnce)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "Verifies the ability of recording arguments already formatted by the caller.");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("DerivationTechnique", "Generation and analysis of equivalence classes");
+
+    // Two booleans as formatted by DLTFormat: type info followed by the value.
+    const std::array<std::uint8_t, 10> packed{0x11U, 0U, 0U, 0U, 1U, 0x11U, 0U, 0U, 0U, 0U};
+
+    EXPECT_TRUE(
+        recorder_->LogPacked(SlotHandle{}, score::cpp::span<const std::uint8_t>{packed.data(), packed.size()}, 2U));
+
+    EXPECT_EQ(log_record_.GetVerbosePayload().GetSpan().size(), packed.size());
+    expected_number_of_arguments_at_teardown_ = 2U;
+}
+
+TEST_F(DataRouterRecorderFixture, LogPackedAddsNothingIfNotAllArgumentsFit)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "Verifies that packed arguments exceeding the payload are not recorded.");
+    RecordProperty("TestType", "Interface test");
+    RecordProperty("DerivationTechnique", "Generation and analysis of equivalence classes");
+
+    const std::vector<std::uint8_t> packed(log_record_.GetLogEntry().payload.capacity() + 1UL);
+
+    EXPECT_FALSE(
+        recorder_->LogPacked(SlotHandle{}, score::cpp::span<const std::uint8_t>{packed.data(), packed.size()}, 1U));
+
+    recorder_->Log(SlotHandle{}, bool{});
+}
+
 TEST(DataRouterRecorderTests, DatarouterRecorderShouldClearSlotOnStart)
 {
     RecordProperty("Requirement", "SCR-1633236");
@@ -38,6 +38,11 @@ std::unique_ptr<Recorder> RemoteDltRecorderFactory::CreateConcreteLogRecorder(
                                                         score::os::Mman::Default(memory_resource),
                                                         score::os::Stat::Default(memory_resource),
                                                         score::os::Stdlib::Default(memory_resource)};
+    //  Attaching to the shared-memory pool only takes effect if Datarouter created one.
+    SharedMemoryPoolFactory::OsalInstances shared_memory_pool_osal = {score::os::Fcntl::Default(memory_resource),
+                                                                      score::os::Unistd::Default(memory_resource),
+                                                                      score::os::Mman::Default(memory_resource),
+                                                                      score::os::Stat::Default(memory_resource)};
 
     //  Although std::make_unique may throw (e.g., on memory allocation failure), this function is marked noexcept
     //  because our design assumes that the provided memory_resource is nothrow, and any allocation failure is
@@ -48,7 +53,8 @@ std::unique_ptr<Recorder> RemoteDltRecorderFactory::CreateConcreteLogRecorder(
                                             LogRecord{config.GetSlotSizeInBytes()},
                                             *message_client_factory,
                                             config,
-                                            WriterFactory{std::move(writer_factory_osal)}),
+                                            WriterFactory{std::move(writer_factory_osal),
+                                                          std::move(shared_memory_pool_osal)}),
         config);
 }
 
@@ -0,0 +1,124 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include "score/mw/log/detail/data_router/shared_memory/blob_pool_writer.h"
+
+#include <algorithm>
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+namespace detail
+{
+
+namespace
+{
+
+//  The descriptor lands in a block whose count is at most the switch count observed after releasing the descriptor.
+//  Datarouter reads a block once it was switched away from and finishes reading before it requests the next switch,
+//  thus two further switches guarantee that the block holding the descriptor was consumed.
+constexpr std::uint32_t kSwitchesUntilSlotIsReusable{2UL};
+
+bool IsSwitchCountReached(const std::uint32_t current, const std::uint32_t threshold) noexcept
+{
+    //  The switch counter wraps around, compare by distance instead of by value.
+    return static_cast<std::int32_t>(current - threshold) >= 0;
+}
+
+}  // namespace
+
+BlobPoolWriter::BlobPoolWriter(SharedData& shared_data) noexcept : shared_data_{shared_data}, slots_{} {}
+
+// Suppressed "AUTOSAR C++14 A12-8-4": shared_data_ is a reference, the slot states are atomics that can not be moved.
+// coverity[autosar_cpp14_a12_8_4_violation]
+BlobPoolWriter::BlobPoolWriter(BlobPoolWriter&& other) noexcept : shared_data_{other.shared_data_}, slots_{}
+{
+    for (std::size_t slot_index = 0UL; slot_index < slots_.size(); ++slot_index)
+    {
+        auto& slot = slots_.at(slot_index);
+        const auto& other_slot = other.slots_.at(slot_index);
+        slot.reusable_from_switch_count.store(other_slot.reusable_from_switch_count.load());
+        slot.claimed.store(other_slot.claimed.load());
+    }
+}
+
+Length BlobPoolWriter::GetMaxBlobSize() const noexcept
+{
+    if (GetNumberOfSlots() == 0UL)
+    {
+        return 0UL;
+    }
+    return shared_data_.blob_slot_size;
+}
+
+std::uint32_t BlobPoolWriter::GetNumberOfSlots() const noexcept
+{
+    if (shared_data_.blob_slot_size == 0UL)
+    {
+        return 0UL;
+    }
+    const auto number_of_slots = GetDataSizeAsLength(shared_data_.blob_arena) / shared_data_.blob_slot_size;
+    return static_cast<std::uint32_t>(std::min(number_of_slots, static_cast<Length>(GetMaxNumberOfBlobSlots())));
+}
+
+score::cpp::optional<std::uint32_t> BlobPoolWriter::TryAcquireSlot() noexcept
+{
+    const auto current_switch_count = shared_data_.control_block.switch_count_points_active_for_writing.load();
+    const auto number_of_slots = GetNumberOfSlots();
+    for (std::uint32_t slot_index = 0UL; slot_index < number_of_slots; ++slot_index)
+    {
+        auto& slot = slots_.at(slot_index);
+        if (slot.claimed.exchange(true) == true)
+        {
+            continue;
+        }
+        if (IsSwitchCountReached(current_switch_count, slot.reusable_from_switch_count.load()))
+        {
+            return slot_index;
+        }
+        slot.claimed.store(false);
+    }
+    return {};
+}
+
+score::cpp::span<Byte> BlobPoolWriter::GetSlotData(const std::uint32_t slot_index,
+                                                const Length payload_size) const noexcept
+{
+    using SpanSizeType = score::cpp::span<Byte>::size_type;
+    const auto offset = static_cast<SpanSizeType>(static_cast<Length>(slot_index) * shared_data_.blob_slot_size);
+    const auto size = static_cast<SpanSizeType>(std::min(payload_size, shared_data_.blob_slot_size));
+    return shared_data_.blob_arena.subspan(offset, size);
+}
+
+void BlobPoolWriter::ReleaseSlotToReader(const std::uint32_t slot_index,
+                                         const std::uint32_t switch_count_after_release) noexcept
+{
+    auto& slot = slots_.at(slot_index);
+    // The switch counter wraps around by design.
+    // coverity[autosar_cpp14_a4_7_1_violation]
+    slot.reusable_from_switch_count.store(switch_count_after_release + kSwitchesUntilSlotIsReusable);
+    slot.claimed.store(false);
+}
+
+void BlobPoolWriter::ReleaseSlotUnused(const std::uint32_t slot_index) noexcept
+{
+    slots_.at(slot_index).claimed.store(false);
+}
+
+}  // namespace detail
+}  // namespace log
+}  // namespace mw
+}  // namespace score
@@ -0,0 +1,87 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#ifndef SCORE_MW_LOG_DETAIL_DATA_ROUTER_SHARED_MEMORY_BLOB_POOL_WRITER_H
+#define SCORE_MW_LOG_DETAIL_DATA_ROUTER_SHARED_MEMORY_BLOB_POOL_WRITER_H
+
+#include "score/mw/log/detail/data_router/shared_memory/common.h"
+
+#include <score/optional.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+namespace detail
+{
+
+/// \brief Manages the slots of the large payload arena on the writer side.
+///
+/// The arena is a read-only region for Datarouter, thus the reader can not hand slots back explicitly. Instead, a slot
+/// is reclaimed by the writer once the ring buffer block holding the matching BlobDescriptor is known to be consumed:
+/// Datarouter reads an acquired block completely before requesting the next acquisition, so after two further buffer
+/// switches the descriptor and the slot contents are no longer referenced.
+///
+/// This class is thread-safe, lock-free and wait-free.
+class BlobPoolWriter
+{
+  public:
+    explicit BlobPoolWriter(SharedData& shared_data) noexcept;
+
+    BlobPoolWriter(const BlobPoolWriter&) = delete;
+    /// \brief Takes over the claimed and not yet reusable slots, the moved-from writer shall not be used anymore.
+    BlobPoolWriter(BlobPoolWriter&& other) noexcept;
+    BlobPoolWriter& operator=(const BlobPoolWriter&) = delete;
+    BlobPoolWriter& operator=(BlobPoolWriter&&) = delete;
+    ~BlobPoolWriter() noexcept = default;
+
+    /// \brief Returns the largest payload that can be stored in a single slot. Zero if the arena is disabled.
+    Length GetMaxBlobSize() const noexcept;
+
+    /// \brief Claims a free slot. Returns empty if the arena is disabled or all slots are in use.
+    score::cpp::optional<std::uint32_t> TryAcquireSlot() noexcept;
+
+    /// \brief Returns the writable memory of a claimed slot truncated to payload_size.
+    score::cpp::span<Byte> GetSlotData(const std::uint32_t slot_index, const Length payload_size) const noexcept;
+
+    /// \brief Hands the slot over to Datarouter. The slot becomes reusable after the reader is done with it.
+    void ReleaseSlotToReader(const std::uint32_t slot_index, const std::uint32_t switch_count_after_release) noexcept;
+
+    /// \brief Returns a slot that was not published to Datarouter, e.g. when the descriptor could not be written.
+    void ReleaseSlotUnused(const std::uint32_t slot_index) noexcept;
+
+  private:
+    std::uint32_t GetNumberOfSlots() const noexcept;
+
+    struct SlotState
+    {
+        std::atomic<bool> claimed{false};
+        std::atomic<std::uint32_t> reusable_from_switch_count{0UL};
+    };
+
+    SharedData& shared_data_;
+    std::array<SlotState, GetMaxNumberOfBlobSlots()> slots_;
+};
+
+}  // namespace detail
+}  // namespace log
+}  // namespace mw
+}  // namespace score
+
+#endif  // SCORE_MW_LOG_DETAIL_DATA_ROUTER_SHARED_MEMORY_BLOB_POOL_WRITER_H
@@ -30,6 +30,25 @@ namespace log
 {
 namespace detail
 {
+
+/// \brief Marks a linear buffer that uses the memory of the client ring buffer instead of a shared-memory pool block.
+constexpr std::uint32_t GetNoPoolBlockIndex()
+{
+    return std::numeric_limits<std::uint32_t>::max();
+}
+
+/// \brief Maximum number of blocks Datarouter hands out to all logging clients together.
+constexpr std::uint32_t GetMaxNumberOfPoolBlocks()
+{
+    return 1024UL;
+}
+
+/// \brief Maximum number of pool blocks a single logging client holds, one per linear buffer.
+constexpr std::uint32_t GetMaxNumberOfPoolBlocksPerClient()
+{
+    return 2UL;
+}
+
 struct SharedData
 {
     /*
@@ -56,6 +75,33 @@ struct SharedData
     std::atomic<bool> writer_detached{};
     // coverity[autosar_cpp14_m11_0_1_violation]
     pid_t producer_pid{};  // Helps Datarouter to check if a sender pid matches the shared-memory file pid.
+    // coverity[autosar_cpp14_m11_0_1_violation]
+    score::cpp::span<Byte> blob_arena{};  // Writer side view of the large payload arena. Empty if disabled.
+    // coverity[autosar_cpp14_m11_0_1_violation]
+    Length blob_arena_offset{};  // Allows the reader to determine the blob arena address in shared-memory.
+    // coverity[autosar_cpp14_m11_0_1_violation]
+    Length blob_slot_size{};
+    //  Slot of the pool block granted to the client that backs the linear buffer, GetNoPoolBlockIndex() if the own
+    //  buffer is in use.
+    // coverity[autosar_cpp14_m11_0_1_violation]
+    std::atomic<std::uint32_t> pool_block_index_even{GetNoPoolBlockIndex()};
+    // coverity[autosar_cpp14_m11_0_1_violation]
+    std::atomic<std::uint32_t> pool_block_index_odd{GetNoPoolBlockIndex()};
+};
+
+/// \brief Content of the read-only file by which Datarouter announces its shared-memory pool to the logging clients.
+struct SharedPoolHeader
+{
+    /*
+        Maintaining compatibility and avoiding performance overhead outweighs POD Type (class) based design for this
+       particular struct. The Type is simple and does not require invariance (interface OR custom behavior) as per the
+       design. Moreover the type is ONLY used internally under the namespace detail and NOT exposed publicly; this is
+       additionally guaranteed by the build system(bazel) visibility
+    */
+    // coverity[autosar_cpp14_m11_0_1_violation]
+    Length block_size{};
+    // coverity[autosar_cpp14_m11_0_1_violation]
+    std::uint32_t number_of_blocks{};
 };
 
 /// \brief This helper initialization method shall be only called once at the construction of the object in
@@ -86,6 +132,10 @@ struct BufferEntryHeader
 struct ReadAcquireResult
 {
     std::uint32_t acquired_buffer;
+    //  Number of additional pool blocks the client asks Datarouter to grant.
+    std::uint8_t requested_pool_blocks{0U};
+    //  Bit per slot of the pool blocks the client handed back. Datarouter frees them.
+    std::uint8_t returned_pool_blocks{0U};
 };
 
 std::uint32_t GetExpectedNextAcquiredBlockId(const ReadAcquireResult& acquired) noexcept;
@@ -95,6 +145,35 @@ constexpr TypeIdentifier GetRegisterTypeToken()
     return std::numeric_limits<TypeIdentifier>::max();
 }
 
+/// \brief Type identifier of ring buffer entries that carry a BlobDescriptor instead of the payload itself.
+constexpr TypeIdentifier GetBlobDescriptorToken()
+{
+    return std::numeric_limits<TypeIdentifier>::max() - 1U;
+}
+
+/// \brief Maximum number of slots in the large payload arena.
+constexpr std::uint32_t GetMaxNumberOfBlobSlots()
+{
+    return 16UL;
+}
+
+/// \brief Payload of a ring buffer entry pointing to a large payload stored in the blob arena.
+struct BlobDescriptor
+{
+    /*
+        Maintaining compatibility and avoiding performance overhead outweighs POD Type (class) based design for this
+       particular struct. The Type is simple and does not require invariance (interface OR custom behavior) as per the
+       design. Moreover the type is ONLY used internally under the namespace detail and NOT exposed publicly; this is
+       additionally guaranteed by the build system(bazel) visibility
+    */
+    // coverity[autosar_cpp14_m11_0_1_violation]
+    TypeIdentifier type_identifier{};  // Type of the payload stored in the slot.
+    // coverity[autosar_cpp14_m11_0_1_violation]
+    std::uint32_t slot_index{};
+    // coverity[autosar_cpp14_m11_0_1_violation]
+    Length payload_size{};
+};
+
 }  // namespace detail
 }  // namespace log
 }  // namespace mw
@@ -47,6 +47,8 @@ TEST(CommonTests, TypesShallBeLockFree)
     ASSERT_TRUE(data.size_of_drops_buffer_full.is_lock_free());
     ASSERT_TRUE(data.number_of_drops_invalid_size.is_lock_free());
     ASSERT_TRUE(data.writer_detached.is_lock_free());
+    ASSERT_TRUE(data.pool_block_index_even.is_lock_free());
+    ASSERT_TRUE(data.pool_block_index_odd.is_lock_free());
 }
 
 TEST(CommonTests, GetExpectedNextAcquiredBlockId)
@@ -65,6 +65,16 @@ class ISharedMemoryReader
     virtual std::optional<Length> Read(const TypeRegistrationCallback& type_registration_callback,
                                        const NewRecordCallback& new_message_callback) noexcept = 0;
 
+    /// \brief Like Read(), but returns once the entries read take at least max_number_of_bytes, so that the read of a
+    /// large buffer can be spread over several calls. The next call continues with the following entry.
+    /// Returns the number of bytes in the buffers only with the call completing the read.
+    virtual std::optional<Length> ReadBounded(const TypeRegistrationCallback& type_registration_callback,
+                                              const NewRecordCallback& new_message_callback,
+                                              const Length max_number_of_bytes) noexcept = 0;
+
+    /// \brief Returns true while the acquired data was not read completely.
+    virtual bool IsReadPending() const noexcept = 0;
+
     virtual std::optional<Length> PeekNumberOfBytesAcquiredInBuffer(
         const std::uint32_t acquired_buffer_count_id) const noexcept = 0;
 
@@ -78,9 +88,16 @@ class ISharedMemoryReader
 
     virtual Length GetRingBufferSizeBytes() const noexcept = 0;
 
+    /// \brief Address of the shared memory written by the client, e.g. to find the memory node holding it.
+    virtual const void* GetSharedMemoryAddress() const noexcept = 0;
+
     virtual bool IsBlockReleasedByWriters(const std::uint32_t block_count) noexcept = 0;
 
     virtual std::optional<Length> NotifyAcquisitionSetReader(const ReadAcquireResult& acquire_result) noexcept = 0;
+
+    /// \brief Returns the slot of the pool block created for the client by the last NotifyAcquisitionSetReader(), if
+    /// any. The caller shall announce the slot to the client, after which it is not returned again.
+    virtual std::optional<std::uint32_t> TakePoolBlockGrant() noexcept = 0;
 };
 
 }  // namespace detail
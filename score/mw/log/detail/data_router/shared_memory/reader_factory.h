@@ -46,7 +46,10 @@ class ReaderFactory
     ReaderFactory& operator=(ReaderFactory&&) = delete;
     ReaderFactory& operator=(const ReaderFactory&) = delete;
 
-    static ReaderFactoryPtr Default(score::cpp::pmr::memory_resource* memory_resource) noexcept;
+    /// \param shared_memory_pool Pool the clients may borrow linear buffers from. Blocks owned by a client are
+    /// released when its reader is destroyed. The pool shall outlive all created readers.
+    static ReaderFactoryPtr Default(score::cpp::pmr::memory_resource* memory_resource,
+                                    SharedMemoryPool* shared_memory_pool = nullptr) noexcept;
 };
 
 }  // namespace detail
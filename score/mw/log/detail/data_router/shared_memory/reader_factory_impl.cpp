@@ -13,6 +13,7 @@
 
 #include "score/mw/log/detail/data_router/shared_memory/reader_factory_impl.h"
 
+#include <algorithm>
 #include <iostream>
 
 namespace score
@@ -25,8 +26,9 @@ namespace detail
 {
 
 ReaderFactoryImpl::ReaderFactoryImpl(score::cpp::pmr::unique_ptr<score::os::Mman>&& mman,
-                                     score::cpp::pmr::unique_ptr<score::os::Stat>&& stat_osal) noexcept
-    : ReaderFactory(), mman_{std::move(mman)}, stat_{std::move(stat_osal)}
+                                     score::cpp::pmr::unique_ptr<score::os::Stat>&& stat_osal,
+                                     SharedMemoryPool* shared_memory_pool) noexcept
+    : ReaderFactory(), mman_{std::move(mman)}, stat_{std::move(stat_osal)}, shared_memory_pool_{shared_memory_pool}
 {
 }
 
@@ -91,8 +93,9 @@ std::unique_ptr<ISharedMemoryReader> ReaderFactoryImpl::Create(const std::int32_
     const SharedData& shared_data = *(static_cast<const SharedData*>(mmap_result.value()));
 
     const auto max_offset_bytes = std::max(
-        shared_data.linear_buffer_1_offset + GetDataSizeAsLength(shared_data.control_block.control_block_even.data),
-        shared_data.linear_buffer_2_offset + GetDataSizeAsLength(shared_data.control_block.control_block_odd.data));
+        {shared_data.linear_buffer_1_offset + GetDataSizeAsLength(shared_data.control_block.control_block_even.data),
+         shared_data.linear_buffer_2_offset + GetDataSizeAsLength(shared_data.control_block.control_block_odd.data),
+         shared_data.blob_arena_offset + GetDataSizeAsLength(shared_data.blob_arena)});
 
     UnmapCallback unmap_callback = [mman = std::move(mman_), address = mmap_result.value(), map_size_bytes]() {
         const auto munmap_result = mman->munmap(address, map_size_bytes);
@@ -135,11 +138,23 @@ std::unique_ptr<ISharedMemoryReader> ReaderFactoryImpl::Create(const std::int32_
     AlternatingReadOnlyReader alternating_read_only_reader{
         shared_data.control_block, buffer_block_even, buffer_block_odd};
 
-    return std::make_unique<SharedMemoryReader>(
-        shared_data, std::move(alternating_read_only_reader), std::move(unmap_callback));
+    score::cpp::span<Byte> blob_arena{};
+    if (shared_data.blob_arena.empty() == false)
+    {
+        auto* const blob_arena_addr = GetBufferAddress(shared_data_addr, shared_data.blob_arena_offset);
+        blob_arena = score::cpp::span<Byte>(blob_arena_addr, shared_data.blob_arena.size());
+    }
+
+    return std::make_unique<SharedMemoryReader>(shared_data,
+                                                std::move(alternating_read_only_reader),
+                                                std::move(unmap_callback),
+                                                blob_arena,
+                                                shared_memory_pool_,
+                                                buffer.st_uid);
 }
 
-ReaderFactoryPtr ReaderFactory::Default(score::cpp::pmr::memory_resource* memory_resource) noexcept
+ReaderFactoryPtr ReaderFactory::Default(score::cpp::pmr::memory_resource* memory_resource,
+                                        SharedMemoryPool* shared_memory_pool) noexcept
 {
     if (memory_resource == nullptr)
     {
@@ -147,8 +162,8 @@ ReaderFactoryPtr ReaderFactory::Default(score::cpp::pmr::memory_resource* memory
         return nullptr;
     }
 
-    return std::make_unique<ReaderFactoryImpl>(score::os::Mman::Default(memory_resource),
-                                               score::os::Stat::Default(memory_resource));
+    return std::make_unique<ReaderFactoryImpl>(
+        score::os::Mman::Default(memory_resource), score::os::Stat::Default(memory_resource), shared_memory_pool);
 }
 
 }  // namespace detail
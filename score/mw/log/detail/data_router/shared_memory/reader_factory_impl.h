@@ -35,13 +35,15 @@ class ReaderFactoryImpl : public ReaderFactory
 {
   public:
     explicit ReaderFactoryImpl(score::cpp::pmr::unique_ptr<score::os::Mman>&& mman,
-                               score::cpp::pmr::unique_ptr<score::os::Stat>&& stat_osal) noexcept;
+                               score::cpp::pmr::unique_ptr<score::os::Stat>&& stat_osal,
+                               SharedMemoryPool* shared_memory_pool = nullptr) noexcept;
     std::unique_ptr<ISharedMemoryReader> Create(const std::int32_t file_descriptor,
                                                 const pid_t expected_pid) noexcept override;
 
   private:
     score::cpp::pmr::unique_ptr<score::os::Mman> mman_;
     score::cpp::pmr::unique_ptr<score::os::Stat> stat_;
+    SharedMemoryPool* shared_memory_pool_;
 };
 
 }  // namespace detail
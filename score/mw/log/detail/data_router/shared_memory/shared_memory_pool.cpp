@@ -0,0 +1,232 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include "score/mw/log/detail/data_router/shared_memory/shared_memory_pool.h"
+
+#include <algorithm>
+#include <iostream>
+#include <limits>
+#include <sstream>
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+namespace detail
+{
+
+namespace
+{
+// NOLINTNEXTLINE(modernize-avoid-c-arrays) size available in compile time and bounds are checked
+constexpr char kBlockFileNamePrefix[] = "/tmp/logging.pool.";
+// NOLINTNEXTLINE(modernize-avoid-c-arrays) size available in compile time and bounds are checked
+constexpr char kBlockFileNameSuffix[] = ".shmem";
+
+//  Only the client the block is granted to may open it.
+constexpr auto kBlockFileMode = score::os::Stat::Mode::kReadUser | score::os::Stat::Mode::kWriteUser;
+
+//  Keeps the group of the file when changing its owner.
+constexpr gid_t kUnchangedGroup = std::numeric_limits<gid_t>::max();
+}  // namespace
+
+std::string GetSharedMemoryPoolBlockFileName(const pid_t client_pid, const std::uint32_t slot)
+{
+    std::stringstream file_name;
+    file_name << std::begin(kBlockFileNamePrefix) << client_pid << '.' << slot << std::begin(kBlockFileNameSuffix);
+    return file_name.str();
+}
+
+SharedMemoryPoolBlock::SharedMemoryPoolBlock(score::cpp::span<Byte> data, UnmapCallback unmap_callback) noexcept
+    : data_{data}, unmap_callback_{std::move(unmap_callback)}
+{
+}
+
+SharedMemoryPoolBlock::SharedMemoryPoolBlock(SharedMemoryPoolBlock&& other) noexcept
+    : data_{other.data_}, unmap_callback_{std::move(other.unmap_callback_)}
+{
+    other.data_ = {};
+}
+
+SharedMemoryPoolBlock::~SharedMemoryPoolBlock() noexcept
+{
+    if (!unmap_callback_.empty())
+    {
+        unmap_callback_();
+    }
+}
+
+score::cpp::span<Byte> SharedMemoryPoolBlock::GetData() const noexcept
+{
+    return data_;
+}
+
+SharedMemoryPool::SharedMemoryPool(OsalInstances osal,
+                                   const Length block_size,
+                                   const std::uint32_t number_of_blocks) noexcept
+    : osal_{std::move(osal)},
+      block_size_{block_size},
+      number_of_free_blocks_{std::min(number_of_blocks, GetMaxNumberOfPoolBlocks())}
+{
+}
+
+SharedMemoryPool::SharedMemoryPool(SharedMemoryPool&& other) noexcept
+    : osal_{std::move(other.osal_)},
+      block_size_{other.block_size_},
+      number_of_free_blocks_{other.number_of_free_blocks_.exchange(0UL)}
+{
+    other.block_size_ = 0UL;
+}
+
+Length SharedMemoryPool::GetBlockSize() const noexcept
+{
+    return block_size_;
+}
+
+score::cpp::optional<SharedMemoryPoolBlock> SharedMemoryPool::CreateBlock(const pid_t client_pid,
+                                                                   const uid_t client_uid,
+                                                                   const std::uint32_t slot) noexcept
+{
+    if ((slot >= GetMaxNumberOfPoolBlocksPerClient()) || (block_size_ == 0UL) || (osal_.fcntl_osal == nullptr))
+    {
+        return {};
+    }
+
+    auto number_of_free_blocks = number_of_free_blocks_.load();
+    do
+    {
+        if (number_of_free_blocks == 0UL)
+        {
+            return {};
+        }
+    } while (number_of_free_blocks_.compare_exchange_weak(number_of_free_blocks, number_of_free_blocks - 1UL) ==
+             false);
+
+    const auto file_name = GetSharedMemoryPoolBlockFileName(client_pid, slot);
+    //  A block left behind by a crashed Datarouter instance for a client that had the same pid.
+    std::ignore = osal_.unistd->unlink(file_name.c_str());
+
+    const auto flags = score::os::Fcntl::Open::kReadWrite | score::os::Fcntl::Open::kCreate |
+                       score::os::Fcntl::Open::kExclusive | score::os::Fcntl::Open::kCloseOnExec;
+    // NOLINTNEXTLINE(score-banned-function) it is among safety headers.
+    const auto open_result = osal_.fcntl_osal->open(file_name.c_str(), flags, kBlockFileMode);
+    if (open_result.has_value() == false)
+    {
+        std::cerr << "SharedMemoryPool::CreateBlock: open " << file_name << " " << open_result.error() << '\n';
+        std::ignore = number_of_free_blocks_.fetch_add(1UL);
+        return {};
+    }
+    const auto file_descriptor = open_result.value();
+
+    const auto truncate_result = osal_.unistd->ftruncate(file_descriptor, static_cast<off_t>(block_size_));
+    const auto chown_result = osal_.unistd->chown(file_name.c_str(), client_uid, kUnchangedGroup);
+    if ((truncate_result.has_value() == false) || (chown_result.has_value() == false))
+    {
+        std::cerr << "SharedMemoryPool::CreateBlock: failed to hand over " << file_name << " to uid " << client_uid
+                  << '\n';
+        std::ignore = osal_.unistd->close(file_descriptor);
+        std::ignore = osal_.unistd->unlink(file_name.c_str());
+        std::ignore = number_of_free_blocks_.fetch_add(1UL);
+        return {};
+    }
+
+    auto block = Map(file_descriptor, score::os::Mman::Protection::kRead);
+    if (block.has_value() == false)
+    {
+        std::ignore = osal_.unistd->unlink(file_name.c_str());
+        std::ignore = number_of_free_blocks_.fetch_add(1UL);
+    }
+    return block;
+}
+
+void SharedMemoryPool::ReleaseBlock(const pid_t client_pid, const std::uint32_t slot) noexcept
+{
+    if (slot >= GetMaxNumberOfPoolBlocksPerClient())
+    {
+        return;
+    }
+    //  The name is already gone if the client mapped the block.
+    std::ignore = osal_.unistd->unlink(GetSharedMemoryPoolBlockFileName(client_pid, slot).c_str());
+    std::ignore = number_of_free_blocks_.fetch_add(1UL);
+}
+
+score::cpp::optional<SharedMemoryPoolBlock> SharedMemoryPool::OpenBlock(const pid_t own_pid,
+                                                                 const std::uint32_t slot) noexcept
+{
+    if ((slot >= GetMaxNumberOfPoolBlocksPerClient()) || (block_size_ == 0UL) || (osal_.fcntl_osal == nullptr))
+    {
+        return {};
+    }
+
+    const auto file_name = GetSharedMemoryPoolBlockFileName(own_pid, slot);
+    // NOLINTNEXTLINE(score-banned-function) it is among safety headers.
+    const auto open_result = osal_.fcntl_osal->open(
+        file_name.c_str(), score::os::Fcntl::Open::kReadWrite | score::os::Fcntl::Open::kCloseOnExec);
+    if (open_result.has_value() == false)
+    {
+        std::cerr << "SharedMemoryPool::OpenBlock: open " << file_name << " " << open_result.error() << '\n';
+        return {};
+    }
+    const auto file_descriptor = open_result.value();
+    std::ignore = osal_.unistd->unlink(file_name.c_str());
+
+    //  Any user may create a file of this name, but only Datarouter hands over files to the own uid.
+    score::os::StatBuffer buffer{};
+    const auto stat_result = osal_.stat_osal->fstat(file_descriptor, buffer);
+    if (((stat_result.has_value() == false) || (buffer.st_uid != osal_.unistd->getuid())) ||
+        (buffer.st_size < static_cast<off_t>(block_size_)))
+    {
+        std::cerr << "SharedMemoryPool::OpenBlock: refusing " << file_name << '\n';
+        std::ignore = osal_.unistd->close(file_descriptor);
+        return {};
+    }
+
+    return Map(file_descriptor, score::os::Mman::Protection::kRead | score::os::Mman::Protection::kWrite);
+}
+
+score::cpp::optional<SharedMemoryPoolBlock> SharedMemoryPool::Map(const std::int32_t file_descriptor,
+                                                           const score::os::Mman::Protection protection) noexcept
+{
+    const auto mmap_result =
+        osal_.mman->mmap(nullptr, block_size_, protection, score::os::Mman::Map::kShared, file_descriptor, 0);
+    //  The mapping stays valid after closing the descriptor.
+    std::ignore = osal_.unistd->close(file_descriptor);
+
+    if ((mmap_result.has_value() == false) || (mmap_result.value() == nullptr))
+    {
+        std::cerr << "SharedMemoryPool: mmap of pool block failed\n";
+        return {};
+    }
+
+    //  The osal instances are owned through pointers, thus stay in place when the pool is moved.
+    UnmapCallback unmap_callback = [mman = osal_.mman.get(), address = mmap_result.value(), size = block_size_]() {
+        const auto munmap_result = mman->munmap(address, size);
+        if (munmap_result.has_value() == false)
+        {
+            std::cerr << "UnmapCallback: failed to unmap: " << munmap_result.error()
+                      << '\n';  // LCOV_EXCL_BR_LINE: there are no branches to be covered here.
+        }
+    };
+
+    // coverity[autosar_cpp14_m5_2_8_violation] casted as Byte to access memory mapped by mmap.
+    auto* const data = static_cast<Byte*>(mmap_result.value());
+    using SpanSizeType = score::cpp::span<Byte>::size_type;
+    return SharedMemoryPoolBlock{score::cpp::span<Byte>{data, static_cast<SpanSizeType>(block_size_)},
+                                 std::move(unmap_callback)};
+}
+
+}  // namespace detail
+}  // namespace log
+}  // namespace mw
+}  // namespace score
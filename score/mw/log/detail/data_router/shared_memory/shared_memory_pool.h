@@ -0,0 +1,136 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#ifndef SCORE_MW_LOG_DETAIL_DATA_ROUTER_SHARED_MEMORY_SHARED_MEMORY_POOL_H
+#define SCORE_MW_LOG_DETAIL_DATA_ROUTER_SHARED_MEMORY_SHARED_MEMORY_POOL_H
+
+#include "score/mw/log/detail/data_router/shared_memory/common.h"
+
+#include "score/os/fcntl.h"
+#include "score/os/mman.h"
+#include "score/os/stat.h"
+#include "score/os/unistd.h"
+
+#include <score/optional.hpp>
+
+#include <sys/types.h>
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+namespace detail
+{
+
+/// \brief Name of the file backing the pool block in the given slot of the logging client with the given pid.
+std::string GetSharedMemoryPoolBlockFileName(const pid_t client_pid, const std::uint32_t slot);
+
+/// \brief A pool block mapped by Datarouter or by the logging client it was granted to. Unmapped on destruction.
+class SharedMemoryPoolBlock
+{
+  public:
+    explicit SharedMemoryPoolBlock(score::cpp::span<Byte> data, UnmapCallback unmap_callback) noexcept;
+
+    SharedMemoryPoolBlock(SharedMemoryPoolBlock&& other) noexcept;
+    ~SharedMemoryPoolBlock() noexcept;
+
+    SharedMemoryPoolBlock(const SharedMemoryPoolBlock&) = delete;
+    SharedMemoryPoolBlock& operator=(const SharedMemoryPoolBlock&) = delete;
+    SharedMemoryPoolBlock& operator=(SharedMemoryPoolBlock&&) = delete;
+
+    score::cpp::span<Byte> GetData() const noexcept;
+
+  private:
+    score::cpp::span<Byte> data_;
+    UnmapCallback unmap_callback_;
+};
+
+/// \brief Budget of linear buffers Datarouter lends to logging clients under load.
+///
+/// Each block is a file of its own that Datarouter creates for a single client on request, owned by the uid of the
+/// client and accessible by this uid only. Datarouter announces the slot of the block in the acquire handshake, the
+/// client maps the block and removes its name. Thus no block is ever visible to another client, and the memory of a
+/// block is only allocated while a client holds it.
+///
+/// Datarouter uses CreateBlock() and ReleaseBlock(), a logging client uses OpenBlock().
+/// This class is thread-safe.
+class SharedMemoryPool
+{
+  public:
+    struct OsalInstances
+    {
+        /*
+          Maintaining compatibility and avoiding performance overhead outweighs POD Type (class) based design for this
+          particular struct. The Type is simple and does not require invariance (interface OR custom behavior) as per
+          the design. Moreover the type is ONLY used internally under the namespace detail and NOT exposed publicly;
+          this is additionally guaranteed by the build system(bazel) visibility
+        */
+        // coverity[autosar_cpp14_m11_0_1_violation]
+        score::cpp::pmr::unique_ptr<score::os::Fcntl> fcntl_osal{};
+        // coverity[autosar_cpp14_m11_0_1_violation]
+        score::cpp::pmr::unique_ptr<score::os::Unistd> unistd{};
+        // coverity[autosar_cpp14_m11_0_1_violation]
+        score::cpp::pmr::unique_ptr<score::os::Mman> mman{};
+        // coverity[autosar_cpp14_m11_0_1_violation]
+        score::cpp::pmr::unique_ptr<score::os::Stat> stat_osal{};
+    };
+
+    /// \param number_of_blocks Number of blocks Datarouter hands out to all clients together. Unused by clients.
+    explicit SharedMemoryPool(OsalInstances osal,
+                              const Length block_size,
+                              const std::uint32_t number_of_blocks) noexcept;
+
+    SharedMemoryPool(SharedMemoryPool&& other) noexcept;
+    ~SharedMemoryPool() noexcept = default;
+
+    SharedMemoryPool(const SharedMemoryPool&) = delete;
+    SharedMemoryPool& operator=(const SharedMemoryPool&) = delete;
+    SharedMemoryPool& operator=(SharedMemoryPool&&) = delete;
+
+    Length GetBlockSize() const noexcept;
+
+    /// \brief Creates the block in the given slot of a client if the budget allows. Datarouter maps it read-only.
+    /// The file is only accessible by the client uid. Returns empty if no block is left or the file cannot be created.
+    score::cpp::optional<SharedMemoryPoolBlock> CreateBlock(const pid_t client_pid,
+                                                            const uid_t client_uid,
+                                                            const std::uint32_t slot) noexcept;
+
+    /// \brief Returns a block created by CreateBlock() to the budget and removes its name if the client did not.
+    /// The caller shall destroy its mapping of the block.
+    void ReleaseBlock(const pid_t client_pid, const std::uint32_t slot) noexcept;
+
+    /// \brief Maps the block Datarouter granted to the calling client and removes its name.
+    /// Blocks that are not owned by the calling user or smaller than the announced block size are refused.
+    score::cpp::optional<SharedMemoryPoolBlock> OpenBlock(const pid_t own_pid, const std::uint32_t slot) noexcept;
+
+  private:
+    score::cpp::optional<SharedMemoryPoolBlock> Map(const std::int32_t file_descriptor,
+                                                    const score::os::Mman::Protection protection) noexcept;
+
+    OsalInstances osal_;
+    Length block_size_;
+    std::atomic<std::uint32_t> number_of_free_blocks_;
+};
+
+}  // namespace detail
+}  // namespace log
+}  // namespace mw
+}  // namespace score
+
+#endif  // SCORE_MW_LOG_DETAIL_DATA_ROUTER_SHARED_MEMORY_SHARED_MEMORY_POOL_H
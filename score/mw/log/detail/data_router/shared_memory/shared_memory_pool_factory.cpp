@@ -0,0 +1,171 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include "score/mw/log/detail/data_router/shared_memory/shared_memory_pool_factory.h"
+
+#include <algorithm>
+#include <iostream>
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+namespace detail
+{
+
+namespace
+{
+// NOLINTNEXTLINE(modernize-avoid-c-arrays) size available in compile time and bounds are checked
+constexpr char kPoolFileName[] = "/tmp/logging.pool.shmem";
+
+//  Clients only learn the block size from the file, blocks are granted through the acquire handshake.
+constexpr auto kPoolFileMode =
+    score::os::Stat::Mode::kReadUser | score::os::Stat::Mode::kReadGroup | score::os::Stat::Mode::kReadOthers;
+}  // namespace
+
+std::string_view GetSharedMemoryPoolFileName() noexcept
+{
+    return std::string_view{std::begin(kPoolFileName), sizeof(kPoolFileName) - 1UL};
+}
+
+SharedMemoryPoolFactory::SharedMemoryPoolFactory(OsalInstances osal) noexcept : osal_(std::move(osal)) {}
+
+bool SharedMemoryPoolFactory::IsOsalValid() const noexcept
+{
+    return ((osal_.fcntl_osal != nullptr) && (osal_.unistd != nullptr)) &&
+           ((osal_.mman != nullptr) && (osal_.stat_osal != nullptr));
+}
+
+score::cpp::optional<SharedMemoryPool> SharedMemoryPoolFactory::Create(const std::size_t block_size,
+                                                                const std::uint32_t number_of_blocks) noexcept
+{
+    if ((IsOsalValid() == false) || (block_size == 0UL) || (number_of_blocks == 0UL))
+    {
+        return {};
+    }
+
+    if (osal_.unistd->access(kPoolFileName, score::os::Unistd::AccessMode::kExists).has_value())
+    {
+        const auto unlink_result = osal_.unistd->unlink(kPoolFileName);
+        if (unlink_result.has_value() == false)
+        {
+            std::cerr << "Unlinking of '" << kPoolFileName << "' failed with code: " << unlink_result.error() << '\n';
+        }
+    }
+
+    const auto flags = score::os::Fcntl::Open::kReadWrite | score::os::Fcntl::Open::kCreate |
+                       score::os::Fcntl::Open::kExclusive | score::os::Fcntl::Open::kCloseOnExec;
+    // NOLINTNEXTLINE(score-banned-function) it is among safety headers.
+    const auto open_result = osal_.fcntl_osal->open(kPoolFileName, flags, kPoolFileMode);
+    if (open_result.has_value() == false)
+    {
+        std::cerr << "SharedMemoryPoolFactory::Create: open " << kPoolFileName << " " << open_result.error() << '\n';
+        return {};
+    }
+    const auto file_descriptor = open_result.value();
+
+    const auto truncate_result = osal_.unistd->ftruncate(file_descriptor, static_cast<off_t>(sizeof(SharedPoolHeader)));
+    if (truncate_result.has_value() == false)
+    {
+        std::cerr << "SharedMemoryPoolFactory::Create: ftruncate " << truncate_result.error() << '\n';
+        std::ignore = osal_.unistd->close(file_descriptor);
+        std::ignore = osal_.unistd->unlink(kPoolFileName);
+        return {};
+    }
+
+    const auto mmap_result = osal_.mman->mmap(nullptr,
+                                              sizeof(SharedPoolHeader),
+                                              score::os::Mman::Protection::kRead | score::os::Mman::Protection::kWrite,
+                                              score::os::Mman::Map::kShared,
+                                              file_descriptor,
+                                              0);
+    std::ignore = osal_.unistd->close(file_descriptor);
+    if ((mmap_result.has_value() == false) || (mmap_result.value() == nullptr))
+    {
+        std::cerr << "SharedMemoryPoolFactory::Create: mmap of " << kPoolFileName << " failed\n";
+        std::ignore = osal_.unistd->unlink(kPoolFileName);
+        return {};
+    }
+
+    // NOLINTNEXTLINE(score-no-dynamic-raw-memory) new keyword is intended by design
+    auto* const header = new (mmap_result.value()) SharedPoolHeader();
+    header->block_size = block_size;
+    header->number_of_blocks = std::min(number_of_blocks, GetMaxNumberOfPoolBlocks());
+    std::ignore = osal_.mman->munmap(mmap_result.value(), sizeof(SharedPoolHeader));
+
+    return SharedMemoryPool{std::move(osal_), block_size, number_of_blocks};
+}
+
+score::cpp::optional<SharedMemoryPool> SharedMemoryPoolFactory::Open() noexcept
+{
+    if (IsOsalValid() == false)
+    {
+        return {};
+    }
+
+    //  Absence of the file is the regular case when Datarouter runs without a pool.
+    if (osal_.unistd->access(kPoolFileName, score::os::Unistd::AccessMode::kExists).has_value() == false)
+    {
+        return {};
+    }
+
+    // NOLINTNEXTLINE(score-banned-function) it is among safety headers.
+    const auto open_result = osal_.fcntl_osal->open(
+        kPoolFileName, score::os::Fcntl::Open::kReadOnly | score::os::Fcntl::Open::kCloseOnExec);
+    if (open_result.has_value() == false)
+    {
+        std::cerr << "SharedMemoryPoolFactory::Open: open " << kPoolFileName << " " << open_result.error() << '\n';
+        return {};
+    }
+    const auto file_descriptor = open_result.value();
+
+    score::os::StatBuffer buffer{};
+    const auto stat_result = osal_.stat_osal->fstat(file_descriptor, buffer);
+    if ((stat_result.has_value() == false) || (buffer.st_size < static_cast<off_t>(sizeof(SharedPoolHeader))))
+    {
+        std::cerr << "SharedMemoryPoolFactory::Open: invalid pool file " << kPoolFileName << '\n';
+        std::ignore = osal_.unistd->close(file_descriptor);
+        return {};
+    }
+
+    const auto mmap_result = osal_.mman->mmap(nullptr,
+                                              sizeof(SharedPoolHeader),
+                                              score::os::Mman::Protection::kRead,
+                                              score::os::Mman::Map::kShared,
+                                              file_descriptor,
+                                              0);
+    std::ignore = osal_.unistd->close(file_descriptor);
+    if ((mmap_result.has_value() == false) || (mmap_result.value() == nullptr))
+    {
+        std::cerr << "SharedMemoryPoolFactory::Open: mmap of " << kPoolFileName << " failed\n";
+        return {};
+    }
+
+    // coverity[autosar_cpp14_m5_2_8_violation] casted as SharedPoolHeader to access memory mapped by mmap.
+    const auto block_size = static_cast<const SharedPoolHeader*>(mmap_result.value())->block_size;
+    std::ignore = osal_.mman->munmap(mmap_result.value(), sizeof(SharedPoolHeader));
+    if (block_size == 0UL)
+    {
+        return {};
+    }
+
+    //  The client draws on the budget of Datarouter only, it has none of its own.
+    return SharedMemoryPool{std::move(osal_), block_size, 0UL};
+}
+
+}  // namespace detail
+}  // namespace log
+}  // namespace mw
+}  // namespace score
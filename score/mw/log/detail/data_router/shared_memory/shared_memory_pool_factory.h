@@ -0,0 +1,69 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#ifndef SCORE_MW_LOG_DETAIL_DATA_ROUTER_SHARED_MEMORY_SHARED_MEMORY_POOL_FACTORY_H
+#define SCORE_MW_LOG_DETAIL_DATA_ROUTER_SHARED_MEMORY_SHARED_MEMORY_POOL_FACTORY_H
+
+#include "score/mw/log/detail/data_router/shared_memory/shared_memory_pool.h"
+
+#include "score/os/fcntl.h"
+#include "score/os/mman.h"
+#include "score/os/stat.h"
+#include "score/os/unistd.h"
+
+#include "score/optional.hpp"
+
+#include <string_view>
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+namespace detail
+{
+
+/// \brief Name of the file by which Datarouter announces its shared-memory pool. The pool mode is active if and only
+/// if Datarouter created this file.
+std::string_view GetSharedMemoryPoolFileName() noexcept;
+
+/// \brief The factory is responsible for announcing the shared-memory pool on the Datarouter side and for finding it
+/// on the logging client side. Each factory instance shall be used for a single successful Create() or Open().
+class SharedMemoryPoolFactory
+{
+  public:
+    using OsalInstances = SharedMemoryPool::OsalInstances;
+
+    explicit SharedMemoryPoolFactory(OsalInstances osal) noexcept;
+
+    /// \brief Writes the read-only announcement file. A stale file left behind by a previous Datarouter instance is
+    /// replaced. No block memory is allocated until a client is granted a block.
+    score::cpp::optional<SharedMemoryPool> Create(const std::size_t block_size,
+                                                  const std::uint32_t number_of_blocks) noexcept;
+
+    /// \brief Reads the announcement file written by Datarouter. Returns empty if there is no pool.
+    score::cpp::optional<SharedMemoryPool> Open() noexcept;
+
+  private:
+    bool IsOsalValid() const noexcept;
+
+    OsalInstances osal_;
+};
+
+}  // namespace detail
+}  // namespace log
+}  // namespace mw
+}  // namespace score
+
+#endif  // SCORE_MW_LOG_DETAIL_DATA_ROUTER_SHARED_MEMORY_SHARED_MEMORY_POOL_FACTORY_H
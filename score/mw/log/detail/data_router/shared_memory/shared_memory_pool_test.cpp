@@ -0,0 +1,505 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include "score/mw/log/detail/data_router/shared_memory/shared_memory_pool.h"
+#include "score/mw/log/detail/data_router/shared_memory/shared_memory_pool_factory.h"
+#include "score/mw/log/detail/data_router/shared_memory/shared_memory_reader.h"
+#include "score/mw/log/detail/data_router/shared_memory/shared_memory_writer.h"
+
+#include "score/os/mocklib/fcntl_mock.h"
+#include "score/os/mocklib/mman_mock.h"
+#include "score/os/mocklib/stat_mock.h"
+#include "score/os/mocklib/unistdmock.h"
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include <array>
+#include <memory>
+#include <vector>
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+namespace detail
+{
+namespace
+{
+
+using ::testing::_;
+using ::testing::NiceMock;
+using ::testing::Return;
+using ::testing::StrEq;
+
+constexpr auto kRingSize = 4UL * 1024UL;
+constexpr auto kPoolBlockSize = 4UL * kRingSize;
+constexpr std::uint32_t kNumberOfPoolBlocks{2UL};
+constexpr pid_t kClientPid{1234};
+constexpr pid_t kOtherClientPid{5678};
+constexpr uid_t kClientUid{1001U};
+constexpr uid_t kOtherUid{1002U};
+constexpr std::int32_t kFileDescriptor{0x17};
+constexpr TypeIdentifier kTypeIdentifier{1U};
+constexpr Length kSmallPayload{100UL};
+constexpr auto kBlockFileMode = score::os::Stat::Mode::kReadUser | score::os::Stat::Mode::kWriteUser;
+constexpr auto kCreateBlockFlags = score::os::Fcntl::Open::kReadWrite | score::os::Fcntl::Open::kCreate |
+                                   score::os::Fcntl::Open::kExclusive | score::os::Fcntl::Open::kCloseOnExec;
+
+/// Osal mocks of one side of the pool. All calls succeed unless a test expects otherwise.
+class PoolOsal
+{
+  public:
+    explicit PoolOsal(void* const block_address)
+    {
+        auto* memory_resource = score::cpp::pmr::get_default_resource();
+        auto fcntl_mock = score::cpp::pmr::make_unique<NiceMock<score::os::FcntlMock>>(memory_resource);
+        auto unistd_mock = score::cpp::pmr::make_unique<NiceMock<score::os::UnistdMock>>(memory_resource);
+        auto mman_mock = score::cpp::pmr::make_unique<NiceMock<score::os::MmanMock>>(memory_resource);
+        auto stat_mock = score::cpp::pmr::make_unique<NiceMock<score::os::StatMock>>(memory_resource);
+
+        fcntl_mock_raw_ptr = fcntl_mock.get();
+        unistd_mock_raw_ptr = unistd_mock.get();
+        mman_mock_raw_ptr = mman_mock.get();
+        stat_mock_raw_ptr = stat_mock.get();
+
+        osal.fcntl_osal = std::move(fcntl_mock);
+        osal.unistd = std::move(unistd_mock);
+        osal.mman = std::move(mman_mock);
+        osal.stat_osal = std::move(stat_mock);
+
+        ON_CALL(*fcntl_mock_raw_ptr, open(_, _, _))
+            .WillByDefault(Return(score::cpp::expected<std::int32_t, score::os::Error>{kFileDescriptor}));
+        ON_CALL(*fcntl_mock_raw_ptr, open(_, _))
+            .WillByDefault(Return(score::cpp::expected<std::int32_t, score::os::Error>{kFileDescriptor}));
+        ON_CALL(*unistd_mock_raw_ptr, getuid()).WillByDefault(Return(kClientUid));
+        ON_CALL(*stat_mock_raw_ptr, fstat(kFileDescriptor, _))
+            .WillByDefault(::testing::Invoke(
+                [](const auto& /*handle*/, auto& stat_buffer) -> score::cpp::expected_blank<score::os::Error> {
+                    stat_buffer.st_uid = kClientUid;
+                    stat_buffer.st_size = static_cast<off_t>(kPoolBlockSize);
+                    return score::cpp::expected_blank<score::os::Error>{};
+                }));
+        ON_CALL(*mman_mock_raw_ptr, mmap(nullptr, kPoolBlockSize, _, score::os::Mman::Map::kShared, kFileDescriptor, 0))
+            .WillByDefault(Return(score::cpp::expected<void*, score::os::Error>{block_address}));
+        //  Names are removed on several occasions, tests only expect the ones they are about.
+        EXPECT_CALL(*unistd_mock_raw_ptr, unlink(_)).Times(::testing::AnyNumber());
+    }
+
+    score::os::FcntlMock* fcntl_mock_raw_ptr;
+    score::os::UnistdMock* unistd_mock_raw_ptr;
+    score::os::MmanMock* mman_mock_raw_ptr;
+    score::os::StatMock* stat_mock_raw_ptr;
+    SharedMemoryPool::OsalInstances osal;
+};
+
+class SharedMemoryPoolFixture : public ::testing::Test
+{
+  public:
+    SharedMemoryPoolFixture()
+        : block_memory(kPoolBlockSize, 0),
+          datarouter_osal{block_memory.data()},
+          client_osal{block_memory.data()},
+          datarouter_mman_mock{datarouter_osal.mman_mock_raw_ptr},
+          datarouter_unistd_mock{datarouter_osal.unistd_mock_raw_ptr},
+          client_fcntl_mock{client_osal.fcntl_mock_raw_ptr},
+          client_unistd_mock{client_osal.unistd_mock_raw_ptr},
+          client_mman_mock{client_osal.mman_mock_raw_ptr},
+          datarouter_pool{std::move(datarouter_osal.osal), kPoolBlockSize, kNumberOfPoolBlocks},
+          client_pool{std::move(client_osal.osal), kPoolBlockSize, 0UL}
+    {
+    }
+
+    std::vector<Byte> block_memory;
+    PoolOsal datarouter_osal;
+    PoolOsal client_osal;
+    score::os::MmanMock* datarouter_mman_mock;
+    score::os::UnistdMock* datarouter_unistd_mock;
+    score::os::FcntlMock* client_fcntl_mock;
+    score::os::UnistdMock* client_unistd_mock;
+    score::os::MmanMock* client_mman_mock;
+    SharedMemoryPool datarouter_pool;
+    SharedMemoryPool client_pool;
+};
+
+class SharedMemoryPoolWriterFixture : public SharedMemoryPoolFixture
+{
+  public:
+    SharedMemoryPoolWriterFixture() : SharedMemoryPoolFixture{}, shared_data{}
+    {
+        stack_based_shared_memory[0].fill(0x00);
+        stack_based_shared_memory[1].fill(0x00);
+
+        std::ignore = InitializeSharedData(shared_data);
+        shared_data.producer_pid = kClientPid;
+        shared_data.linear_buffer_1_offset = sizeof(SharedData);
+        shared_data.linear_buffer_2_offset = sizeof(SharedData) + kRingSize / 2UL;
+        shared_data.control_block.control_block_even.data =
+            score::cpp::span<Byte>(stack_based_shared_memory[0].data(), kRingSize / 2UL);
+        shared_data.control_block.control_block_odd.data =
+            score::cpp::span<Byte>(stack_based_shared_memory[1].data(), kRingSize / 2UL);
+
+        shared_memory_writer =
+            std::make_unique<SharedMemoryWriter>(shared_data, UnmapCallback{}, std::move(client_pool));
+
+        AlternatingReadOnlyReader read_only_reader{
+            shared_data.control_block,
+            shared_data.control_block.control_block_even.data,
+            shared_data.control_block.control_block_odd.data,
+        };
+        shared_memory_reader = std::make_unique<SharedMemoryReader>(shared_data,
+                                                                    std::move(read_only_reader),
+                                                                    UnmapCallback{},
+                                                                    score::cpp::span<Byte>{},
+                                                                    &datarouter_pool,
+                                                                    kClientUid);
+    }
+
+    bool Write(const Length payload_size)
+    {
+        const auto drops = shared_data.number_of_drops_buffer_full.load();
+        shared_memory_writer->AllocAndWrite([](auto) {}, kTypeIdentifier, payload_size);
+        return drops == shared_data.number_of_drops_buffer_full.load();
+    }
+
+    void FillUntilDropping()
+    {
+        while (Write(kSmallPayload))
+        {
+        }
+    }
+
+    /// Runs the acquire handshake including the grant message Datarouter sends to the client.
+    std::vector<Length> AcquireAndRead()
+    {
+        std::vector<Length> payload_sizes{};
+        shared_memory_reader->NotifyAcquisitionSetReader(shared_memory_writer->ReadAcquire());
+        const auto grant = shared_memory_reader->TakePoolBlockGrant();
+        if (grant.has_value())
+        {
+            std::ignore = shared_memory_writer->AttachPoolBlock(grant.value());
+        }
+        shared_memory_reader->Read([](const TypeRegistration&) noexcept {},
+                                   [&payload_sizes](const SharedMemoryRecord& record) noexcept {
+                                       payload_sizes.push_back(record.payload.size());
+                                   });
+        return payload_sizes;
+    }
+
+    SharedData shared_data;
+    std::array<char, kRingSize> stack_based_shared_memory[2];
+    std::unique_ptr<SharedMemoryWriter> shared_memory_writer;
+    std::unique_ptr<SharedMemoryReader> shared_memory_reader;
+};
+
+TEST_F(SharedMemoryPoolFixture, DatarouterShallCreateBlocksOnlyAccessibleByTheClient)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description",
+                   "Each block shall be a file of its own, owned by the client and only accessible by its user. "
+                   "Datarouter shall map it read-only.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+
+    const auto file_name = GetSharedMemoryPoolBlockFileName(kClientPid, 1UL);
+    EXPECT_EQ(file_name, "/tmp/logging.pool.1234.1.shmem");
+
+    EXPECT_CALL(*datarouter_osal.fcntl_mock_raw_ptr, open(StrEq(file_name), kCreateBlockFlags, kBlockFileMode));
+    EXPECT_CALL(*datarouter_unistd_mock, ftruncate(kFileDescriptor, static_cast<off_t>(kPoolBlockSize)));
+    EXPECT_CALL(*datarouter_unistd_mock, chown(StrEq(file_name), kClientUid, _));
+    EXPECT_CALL(*datarouter_mman_mock,
+                mmap(nullptr,
+                     kPoolBlockSize,
+                     score::os::Mman::Protection::kRead,
+                     score::os::Mman::Map::kShared,
+                     kFileDescriptor,
+                     0));
+    EXPECT_CALL(*datarouter_mman_mock, munmap(block_memory.data(), kPoolBlockSize));
+
+    const auto block = datarouter_pool.CreateBlock(kClientPid, kClientUid, 1UL);
+    ASSERT_TRUE(block.has_value());
+    EXPECT_EQ(block.value().GetData().data(), block_memory.data());
+    EXPECT_EQ(block.value().GetData().size(), kPoolBlockSize);
+}
+
+TEST_F(SharedMemoryPoolFixture, DatarouterShallGrantNoMoreBlocksThanBudgeted)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description",
+                   "Datarouter shall only create blocks while the budget allows and reuse returned ones.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+
+    auto first = datarouter_pool.CreateBlock(kClientPid, kClientUid, 0UL);
+    const auto second = datarouter_pool.CreateBlock(kOtherClientPid, kOtherUid, 0UL);
+    ASSERT_TRUE(first.has_value());
+    ASSERT_TRUE(second.has_value());
+    EXPECT_FALSE(datarouter_pool.CreateBlock(kClientPid, kClientUid, 1UL).has_value());
+
+    EXPECT_CALL(*datarouter_unistd_mock, unlink(StrEq(GetSharedMemoryPoolBlockFileName(kClientPid, 0UL))));
+    first.reset();
+    datarouter_pool.ReleaseBlock(kClientPid, 0UL);
+
+    EXPECT_TRUE(datarouter_pool.CreateBlock(kClientPid, kClientUid, 1UL).has_value());
+}
+
+TEST_F(SharedMemoryPoolFixture, SlotsBeyondTheClientLimitShallBeRefused)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "Neither side shall use a slot beyond the number of blocks a client may hold.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+
+    EXPECT_CALL(*datarouter_osal.fcntl_mock_raw_ptr, open(_, _, _)).Times(0);
+    EXPECT_CALL(*client_fcntl_mock, open(_, _)).Times(0);
+
+    EXPECT_FALSE(
+        datarouter_pool.CreateBlock(kClientPid, kClientUid, GetMaxNumberOfPoolBlocksPerClient()).has_value());
+    EXPECT_FALSE(client_pool.OpenBlock(kClientPid, GetMaxNumberOfPoolBlocksPerClient()).has_value());
+}
+
+TEST_F(SharedMemoryPoolFixture, FailedHandOverShallRemoveTheBlockAndRestoreTheBudget)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description",
+                   "A block that cannot be handed over to the client user shall be removed and not count against the "
+                   "budget.");
+    RecordProperty("TestingTechnique", "Fault injection test");
+    RecordProperty("DerivationTechnique", "Error guessing based on knowledge or experience");
+
+    const auto file_name = GetSharedMemoryPoolBlockFileName(kClientPid, 0UL);
+    EXPECT_CALL(*datarouter_unistd_mock, chown(_, _, _)).Times(::testing::AnyNumber());
+    EXPECT_CALL(*datarouter_unistd_mock, chown(StrEq(file_name), kClientUid, _))
+        .WillOnce(Return(score::cpp::make_unexpected(score::os::Error::createFromErrno(EPERM))));
+    EXPECT_CALL(*datarouter_unistd_mock, close(kFileDescriptor)).Times(::testing::AtLeast(1));
+    //  Once for the stale name before creating, once for the failed hand over.
+    EXPECT_CALL(*datarouter_unistd_mock, unlink(StrEq(file_name))).Times(::testing::AtLeast(2));
+
+    EXPECT_FALSE(datarouter_pool.CreateBlock(kClientPid, kClientUid, 0UL).has_value());
+
+    EXPECT_TRUE(datarouter_pool.CreateBlock(kClientPid, kClientUid, 1UL).has_value());
+    EXPECT_TRUE(datarouter_pool.CreateBlock(kOtherClientPid, kOtherUid, 0UL).has_value());
+}
+
+TEST_F(SharedMemoryPoolFixture, ClientShallMapGrantedBlockAndRemoveItsName)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "The client shall map the granted block writable and remove its name.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+
+    const auto file_name = GetSharedMemoryPoolBlockFileName(kClientPid, 0UL);
+    EXPECT_CALL(*client_fcntl_mock,
+                open(StrEq(file_name), score::os::Fcntl::Open::kReadWrite | score::os::Fcntl::Open::kCloseOnExec));
+    EXPECT_CALL(*client_unistd_mock, unlink(StrEq(file_name)));
+    EXPECT_CALL(*client_mman_mock,
+                mmap(nullptr,
+                     kPoolBlockSize,
+                     score::os::Mman::Protection::kRead | score::os::Mman::Protection::kWrite,
+                     score::os::Mman::Map::kShared,
+                     kFileDescriptor,
+                     0));
+
+    const auto block = client_pool.OpenBlock(kClientPid, 0UL);
+    ASSERT_TRUE(block.has_value());
+    EXPECT_EQ(block.value().GetData().data(), block_memory.data());
+}
+
+TEST_F(SharedMemoryPoolFixture, ClientShallRefuseBlockNotOwnedByItsUser)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description",
+                   "The client shall not map a block file of another user, e.g. one planted to read its logs.");
+    RecordProperty("TestingTechnique", "Fault injection test");
+    RecordProperty("DerivationTechnique", "Error guessing based on knowledge or experience");
+
+    EXPECT_CALL(*client_osal.stat_mock_raw_ptr, fstat(kFileDescriptor, _))
+        .WillOnce(::testing::Invoke(
+            [](const auto& /*handle*/, auto& stat_buffer) -> score::cpp::expected_blank<score::os::Error> {
+                stat_buffer.st_uid = kOtherUid;
+                stat_buffer.st_size = static_cast<off_t>(kPoolBlockSize);
+                return score::cpp::expected_blank<score::os::Error>{};
+            }));
+    EXPECT_CALL(*client_unistd_mock, close(kFileDescriptor));
+    EXPECT_CALL(*client_mman_mock, mmap(_, _, _, _, _, _)).Times(0);
+
+    EXPECT_FALSE(client_pool.OpenBlock(kClientPid, 0UL).has_value());
+}
+
+TEST_F(SharedMemoryPoolWriterFixture, WriterShallBorrowPoolBlockAfterDropsAndReturnItWhenIdle)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description",
+                   "A client running out of buffer space shall request a pool block in the acquire handshake, map "
+                   "the block granted, and write into it at the next buffer switch. Datarouter shall read from that "
+                   "block, and the block shall be returned once the client is idle.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+
+    FillUntilDropping();
+    const auto own_buffer_even = shared_data.control_block.control_block_even.data;
+
+    //  The grant arrives in the same handshake, but the block backs a buffer only from the next switch on.
+    EXPECT_FALSE(AcquireAndRead().empty());
+    EXPECT_EQ(shared_data.pool_block_index_even.load(), GetNoPoolBlockIndex());
+    EXPECT_EQ(shared_data.pool_block_index_odd.load(), GetNoPoolBlockIndex());
+
+    FillUntilDropping();
+    EXPECT_FALSE(AcquireAndRead().empty());
+    const auto borrowed_in_even = shared_data.pool_block_index_even.load() != GetNoPoolBlockIndex();
+    const auto& borrowed_block = borrowed_in_even ? shared_data.control_block.control_block_even
+                                                  : shared_data.control_block.control_block_odd;
+    ASSERT_NE(borrowed_in_even ? shared_data.pool_block_index_even.load() : shared_data.pool_block_index_odd.load(),
+              GetNoPoolBlockIndex());
+    EXPECT_EQ(borrowed_block.data.data(), block_memory.data());
+
+    //  A payload exceeding the own buffer fits into the borrowed block.
+    constexpr Length kLargePayload{kRingSize};
+    EXPECT_TRUE(Write(kLargePayload));
+    EXPECT_EQ(AcquireAndRead(), std::vector<Length>{kLargePayload});
+
+    //  Nothing was logged in the last cycle, thus the block is handed back and Datarouter removes it.
+    EXPECT_CALL(*client_mman_mock, munmap(block_memory.data(), kPoolBlockSize));
+    EXPECT_CALL(*datarouter_mman_mock, munmap(block_memory.data(), kPoolBlockSize));
+    EXPECT_CALL(*datarouter_unistd_mock, unlink(StrEq(GetSharedMemoryPoolBlockFileName(kClientPid, 0UL))));
+    EXPECT_TRUE(AcquireAndRead().empty());
+    ::testing::Mock::VerifyAndClearExpectations(client_mman_mock);
+    ::testing::Mock::VerifyAndClearExpectations(datarouter_mman_mock);
+
+    EXPECT_EQ(shared_data.pool_block_index_even.load(), GetNoPoolBlockIndex());
+    EXPECT_EQ(shared_data.pool_block_index_odd.load(), GetNoPoolBlockIndex());
+    EXPECT_EQ(shared_data.control_block.control_block_even.data.data(), own_buffer_even.data());
+
+    //  The whole budget is available again.
+    EXPECT_TRUE(datarouter_pool.CreateBlock(kOtherClientPid, kOtherUid, 0UL).has_value());
+    EXPECT_TRUE(datarouter_pool.CreateBlock(kOtherClientPid, kOtherUid, 1UL).has_value());
+}
+
+TEST_F(SharedMemoryPoolWriterFixture, WriterShallHandBackBlockItCannotMap)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "A granted block the client cannot map shall be returned in the next handshake.");
+    RecordProperty("TestingTechnique", "Fault injection test");
+    RecordProperty("DerivationTechnique", "Error guessing based on knowledge or experience");
+
+    EXPECT_CALL(*client_fcntl_mock, open(_, _))
+        .WillOnce(Return(score::cpp::make_unexpected(score::os::Error::createFromErrno(ENOENT))));
+
+    FillUntilDropping();
+    EXPECT_FALSE(AcquireAndRead().empty());
+
+    const auto result = shared_memory_writer->ReadAcquire();
+    EXPECT_EQ(result.returned_pool_blocks, 1U);
+
+    EXPECT_CALL(*datarouter_unistd_mock, unlink(StrEq(GetSharedMemoryPoolBlockFileName(kClientPid, 0UL))));
+    shared_memory_reader->NotifyAcquisitionSetReader(result);
+    EXPECT_TRUE(datarouter_pool.CreateBlock(kOtherClientPid, kOtherUid, 0UL).has_value());
+    EXPECT_TRUE(datarouter_pool.CreateBlock(kOtherClientPid, kOtherUid, 1UL).has_value());
+}
+
+TEST_F(SharedMemoryPoolWriterFixture, ReaderShallDropBufferRedirectedToSlotNotGranted)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "Datarouter shall not read a pool block that was not granted to the client.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+
+    EXPECT_TRUE(Write(kSmallPayload));
+    shared_data.pool_block_index_odd.store(1UL);
+
+    EXPECT_TRUE(AcquireAndRead().empty());
+}
+
+TEST_F(SharedMemoryPoolWriterFixture, ReaderShallReleaseGrantedBlocksOnDestruction)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "Blocks of a closed client session shall go back to the budget.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+
+    FillUntilDropping();
+    EXPECT_FALSE(AcquireAndRead().empty());
+    EXPECT_TRUE(datarouter_pool.CreateBlock(kOtherClientPid, kOtherUid, 0UL).has_value());
+    EXPECT_FALSE(datarouter_pool.CreateBlock(kOtherClientPid, kOtherUid, 1UL).has_value());
+
+    EXPECT_CALL(*datarouter_unistd_mock, unlink(StrEq(GetSharedMemoryPoolBlockFileName(kClientPid, 0UL))));
+    shared_memory_reader.reset();
+
+    EXPECT_TRUE(datarouter_pool.CreateBlock(kOtherClientPid, kOtherUid, 1UL).has_value());
+}
+
+TEST(SharedMemoryPoolFactoryTest, MissingAnnouncementShallResultInEmptyOptional)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "Clients shall not use a pool if Datarouter did not announce one.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+
+    PoolOsal client_osal{nullptr};
+    EXPECT_CALL(*client_osal.unistd_mock_raw_ptr, access(StrEq(GetSharedMemoryPoolFileName().data()), _))
+        .WillOnce(Return(score::cpp::make_unexpected(score::os::Error::createFromErrno(ENOENT))));
+    EXPECT_CALL(*client_osal.fcntl_mock_raw_ptr, open(_, _)).Times(0);
+
+    SharedMemoryPoolFactory factory{std::move(client_osal.osal)};
+    EXPECT_FALSE(factory.Open().has_value());
+}
+
+TEST(SharedMemoryPoolFactoryTest, AnnouncementShallBeReadOnlyAndCarryTheBlockSize)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description",
+                   "Datarouter shall announce the pool in a file no client can write, clients shall learn the block "
+                   "size from it.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+
+    SharedPoolHeader header{};
+    PoolOsal datarouter_osal{&header};
+    const auto kReadOnlyMode =
+        score::os::Stat::Mode::kReadUser | score::os::Stat::Mode::kReadGroup | score::os::Stat::Mode::kReadOthers;
+    EXPECT_CALL(*datarouter_osal.fcntl_mock_raw_ptr,
+                open(StrEq(GetSharedMemoryPoolFileName().data()), _, kReadOnlyMode));
+    EXPECT_CALL(*datarouter_osal.mman_mock_raw_ptr, mmap(nullptr, sizeof(SharedPoolHeader), _, _, kFileDescriptor, 0))
+        .WillOnce(Return(score::cpp::expected<void*, score::os::Error>{&header}));
+
+    SharedMemoryPoolFactory datarouter_factory{std::move(datarouter_osal.osal)};
+    const auto datarouter_pool = datarouter_factory.Create(kPoolBlockSize, kNumberOfPoolBlocks);
+    ASSERT_TRUE(datarouter_pool.has_value());
+    EXPECT_EQ(header.block_size, kPoolBlockSize);
+    EXPECT_EQ(header.number_of_blocks, kNumberOfPoolBlocks);
+
+    PoolOsal client_osal{&header};
+    ON_CALL(*client_osal.stat_mock_raw_ptr, fstat(kFileDescriptor, _))
+        .WillByDefault(::testing::Invoke(
+            [](const auto& /*handle*/, auto& stat_buffer) -> score::cpp::expected_blank<score::os::Error> {
+                stat_buffer.st_size = static_cast<off_t>(sizeof(SharedPoolHeader));
+                return score::cpp::expected_blank<score::os::Error>{};
+            }));
+    EXPECT_CALL(*client_osal.fcntl_mock_raw_ptr, open(StrEq(GetSharedMemoryPoolFileName().data()), _));
+    EXPECT_CALL(*client_osal.mman_mock_raw_ptr,
+                mmap(nullptr, sizeof(SharedPoolHeader), score::os::Mman::Protection::kRead, _, kFileDescriptor, 0))
+        .WillOnce(Return(score::cpp::expected<void*, score::os::Error>{&header}));
+
+    SharedMemoryPoolFactory client_factory{std::move(client_osal.osal)};
+    const auto client_pool = client_factory.Open();
+    ASSERT_TRUE(client_pool.has_value());
+    EXPECT_EQ(client_pool.value().GetBlockSize(), kPoolBlockSize);
+}
+
+}  // namespace
+}  // namespace detail
+}  // namespace log
+}  // namespace mw
+}  // namespace score
@@ -13,7 +13,9 @@
 
 #include "score/mw/log/detail/data_router/shared_memory/shared_memory_reader.h"
 
+#include <algorithm>
 #include <iostream>
+#include <limits>
 #include <type_traits>
 
 namespace score
@@ -30,18 +32,67 @@ namespace detail
 
 namespace
 {
+
+/// \brief Resolves a BlobDescriptor entry into a record pointing to the blob arena.
+/// Returns false if the descriptor is malformed or does not fit into the arena.
+bool ResolveBlobDescriptor(const score::cpp::span<Byte> payload_span,
+                           const score::cpp::span<Byte> blob_arena,
+                           const Length blob_slot_size,
+                           SharedMemoryRecord& record) noexcept
+{
+    BlobDescriptor descriptor{};
+    if (GetDataSizeAsLength(payload_span) < sizeof(descriptor))
+    {
+        return false;
+    }
+    static_assert(std::is_trivially_copyable_v<BlobDescriptor> == true);
+    /*
+        Deviation from Rule M5-2-8:
+        - An object with integer type or pointer to void type shall not be converted
+            to an object with pointer type.
+        Justification:
+        - We need to convert descriptor to bytes (raw data) to read from payload_span into object descriptor.
+    */
+    // coverity[autosar_cpp14_m5_2_8_violation]
+    auto descriptor_destination =
+        score::cpp::span<Byte>{static_cast<Byte*>(static_cast<void*>(&descriptor)), sizeof(descriptor)};
+    const auto descriptor_source = payload_span.subspan(0, sizeof(descriptor));
+    std::ignore = std::copy(descriptor_source.cbegin(), descriptor_source.cend(), descriptor_destination.begin());
+
+    const auto number_of_slots =
+        (blob_slot_size == 0UL) ? Length{0UL} : (GetDataSizeAsLength(blob_arena) / blob_slot_size);
+    if ((static_cast<Length>(descriptor.slot_index) >= number_of_slots) || (descriptor.payload_size > blob_slot_size))
+    {
+        std::cerr << "SharedMemoryReader: Dropping invalid blob descriptor for slot " << descriptor.slot_index
+                  << " with size " << descriptor.payload_size << '\n';
+        return false;
+    }
+
+    using SpanSizeType = score::cpp::span<Byte>::size_type;
+    const auto offset = static_cast<SpanSizeType>(static_cast<Length>(descriptor.slot_index) * blob_slot_size);
+    record.header.type_identifier = descriptor.type_identifier;
+    record.payload = blob_arena.subspan(offset, static_cast<SpanSizeType>(descriptor.payload_size));
+    return true;
+}
+
+/// \brief Reads entries until the buffer is exhausted or the entries read take at least max_number_of_bytes.
+/// Returns the number of bytes read including the length prefixes.
 Length ReadLinearBuffer(LinearReader& reader,
                         const TypeRegistrationCallback& type_registration_callback,
-                        const NewRecordCallback& new_message_callback) noexcept
+                        const NewRecordCallback& new_message_callback,
+                        const score::cpp::span<Byte> blob_arena,
+                        const Length blob_slot_size,
+                        const Length max_number_of_bytes) noexcept
 {
-    const Length length{reader.GetSizeOfWholeDataBuffer()};
-    while (true)
+    Length number_of_bytes_read{0U};
+    while (number_of_bytes_read < max_number_of_bytes)
     {
         const auto read_result = reader.Read();
         if (read_result.has_value() == false)
         {
             break;
         }
+        number_of_bytes_read += GetDataSizeAsLength(read_result.value()) + GetLengthOffsetBytes();
 
         if (GetDataSizeAsLength(read_result.value()) < sizeof(BufferEntryHeader))
         {
@@ -113,6 +164,15 @@ Length ReadLinearBuffer(LinearReader& reader,
 
             type_registration_callback(type_registration);
         }
+        else if (header.type_identifier == score::mw::log::detail::GetBlobDescriptorToken())
+        {
+            SharedMemoryRecord record{};
+            record.header = header;
+            if (ResolveBlobDescriptor(payload_span, blob_arena, blob_slot_size, record))
+            {
+                new_message_callback(record);
+            }
+        }
         else
         {
             SharedMemoryRecord record{};
@@ -121,23 +181,33 @@ Length ReadLinearBuffer(LinearReader& reader,
             new_message_callback(record);
         }
     }
-    return length;
+    return number_of_bytes_read;
 }
 
 }  // namespace
 
 SharedMemoryReader::SharedMemoryReader(const SharedData& shared_data,
                                        AlternatingReadOnlyReader alternating_read_only_reader,
-                                       UnmapCallback unmap_callback) noexcept
+                                       UnmapCallback unmap_callback,
+                                       score::cpp::span<Byte> blob_arena,
+                                       SharedMemoryPool* shared_memory_pool,
+                                       const uid_t client_uid) noexcept
     : shared_data_{shared_data},
       unmap_callback_{std::move(unmap_callback)},
       linear_reader_{std::nullopt},
       acquired_data_{std::nullopt},
       number_of_acquired_bytes_{0U},
+      length_of_pending_read_{std::nullopt},
+      detached_buffer_read_started_{false},
       finished_reading_after_detach_{false},
       buffer_expected_to_read_next_{shared_data.control_block.switch_count_points_active_for_writing.load()},
       is_writer_detached_{false},
-      alternating_read_only_reader_{std::move(alternating_read_only_reader)}
+      alternating_read_only_reader_{std::move(alternating_read_only_reader)},
+      blob_arena_{blob_arena},
+      shared_memory_pool_{shared_memory_pool},
+      client_uid_{client_uid},
+      pool_blocks_{},
+      pool_block_grant_{std::nullopt}
 {
 }
 
@@ -147,15 +217,28 @@ SharedMemoryReader::SharedMemoryReader(SharedMemoryReader&& other) noexcept
       linear_reader_{std::move(other.linear_reader_)},
       acquired_data_{other.acquired_data_},
       number_of_acquired_bytes_{other.number_of_acquired_bytes_},
+      length_of_pending_read_{other.length_of_pending_read_},
+      detached_buffer_read_started_{other.detached_buffer_read_started_},
       finished_reading_after_detach_{other.finished_reading_after_detach_},
       buffer_expected_to_read_next_{other.buffer_expected_to_read_next_},
       is_writer_detached_{other.is_writer_detached_},
-      alternating_read_only_reader_{std::move(other.alternating_read_only_reader_)}
+      alternating_read_only_reader_{std::move(other.alternating_read_only_reader_)},
+      blob_arena_{other.blob_arena_},
+      shared_memory_pool_{other.shared_memory_pool_},
+      client_uid_{other.client_uid_},
+      pool_blocks_{std::move(other.pool_blocks_)},
+      pool_block_grant_{other.pool_block_grant_}
 {
+    //  The blocks are returned to the pool by this instance only.
+    for (auto& pool_block : other.pool_blocks_)
+    {
+        pool_block.reset();
+    }
 }
 
 SharedMemoryReader::~SharedMemoryReader()
 {
+    ReleasePoolBlocks();
     if (!unmap_callback_.empty())
     {
         unmap_callback_();
@@ -164,38 +247,64 @@ SharedMemoryReader::~SharedMemoryReader()
 
 std::optional<Length> SharedMemoryReader::Read(const TypeRegistrationCallback& type_registration_callback,
                                                const NewRecordCallback& new_message_callback) noexcept
+{
+    return ReadBounded(type_registration_callback, new_message_callback, std::numeric_limits<Length>::max());
+}
+
+std::optional<Length> SharedMemoryReader::ReadBounded(const TypeRegistrationCallback& type_registration_callback,
+                                                      const NewRecordCallback& new_message_callback,
+                                                      const Length max_number_of_bytes) noexcept
 {
     if (finished_reading_after_detach_)
     {
         return std::nullopt;
     }
 
-    std::optional<Length> return_written_bytes{std::nullopt};
-
-    if (linear_reader_.has_value())
-    {
-        return_written_bytes =
-            ReadLinearBuffer(linear_reader_.value(), type_registration_callback, new_message_callback);
-        linear_reader_.reset();
-    }
-
-    if (IsWriterDetached())
+    Length remaining_number_of_bytes{max_number_of_bytes};
+    while (true)
     {
-        auto reader = alternating_read_only_reader_.CreateLinearReader(buffer_expected_to_read_next_);
-        const auto written_bytes_detached = ReadLinearBuffer(reader, type_registration_callback, new_message_callback);
-        if (return_written_bytes.has_value())
+        if (linear_reader_.has_value())
         {
-            return_written_bytes = return_written_bytes.value() + written_bytes_detached;
+            const auto number_of_bytes_read = ReadLinearBuffer(linear_reader_.value(),
+                                                               type_registration_callback,
+                                                               new_message_callback,
+                                                               blob_arena_,
+                                                               shared_data_.blob_slot_size,
+                                                               remaining_number_of_bytes);
+            remaining_number_of_bytes -= std::min(number_of_bytes_read, remaining_number_of_bytes);
+            if (linear_reader_->IsFullyRead() == false)
+            {
+                //  The next call continues from the read index kept by the linear reader.
+                return std::nullopt;
+            }
+            linear_reader_.reset();
         }
-        else
+
+        if ((IsWriterDetached() == false) || detached_buffer_read_started_)
         {
-            return_written_bytes = written_bytes_detached;
+            break;
         }
 
+        //  The detached writer no longer modifies the buffer it was writing to, so it can be read as well.
+        const auto reader = CreateLinearReader(buffer_expected_to_read_next_);
+        length_of_pending_read_ = length_of_pending_read_.value_or(0U) + reader.GetSizeOfWholeDataBuffer();
+        linear_reader_ = reader;
+        detached_buffer_read_started_ = true;
+    }
+
+    if (detached_buffer_read_started_)
+    {
         finished_reading_after_detach_ = true;
     }
 
-    return return_written_bytes;
+    const auto length_of_read = length_of_pending_read_;
+    length_of_pending_read_.reset();
+    return length_of_read;
+}
+
+bool SharedMemoryReader::IsReadPending() const noexcept
+{
+    return linear_reader_.has_value();
 }
 
 std::optional<Length> SharedMemoryReader::ReadDetached(const TypeRegistrationCallback& type_registration_callback,
@@ -236,6 +345,11 @@ Length SharedMemoryReader::GetRingBufferSizeBytes() const noexcept
            GetDataSizeAsLength(shared_data_.control_block.control_block_odd.data);
 }
 
+const void* SharedMemoryReader::GetSharedMemoryAddress() const noexcept
+{
+    return &shared_data_;
+}
+
 bool SharedMemoryReader::IsWriterDetached() const noexcept
 {
     return (is_writer_detached_ == true) || (shared_data_.writer_detached.load() == true);
@@ -248,6 +362,8 @@ bool SharedMemoryReader::IsBlockReleasedByWriters(const std::uint32_t block_coun
 
 std::optional<Length> SharedMemoryReader::NotifyAcquisitionSetReader(const ReadAcquireResult& acquire_result) noexcept
 {
+    //  The client let go of returned blocks already, thus they are released even if the acquisition fails.
+    UpdatePoolBlocks(acquire_result);
     if (not alternating_read_only_reader_.IsBlockReleasedByWriters(
             acquire_result.acquired_buffer))  //  , "Working on a block that was not released by writers");
     {
@@ -259,14 +375,95 @@ std::optional<Length> SharedMemoryReader::NotifyAcquisitionSetReader(const ReadA
         //  safety qualification.
         return std::nullopt;
     }
-    auto reader = alternating_read_only_reader_.CreateLinearReader(acquire_result.acquired_buffer);
+    auto reader = CreateLinearReader(acquire_result.acquired_buffer);
     number_of_acquired_bytes_ = reader.GetSizeOfWholeDataBuffer();
     linear_reader_ = reader;
+    length_of_pending_read_ = number_of_acquired_bytes_;
 
     buffer_expected_to_read_next_ = acquire_result.acquired_buffer + 1;
     return number_of_acquired_bytes_;
 }
 
+std::optional<std::uint32_t> SharedMemoryReader::TakePoolBlockGrant() noexcept
+{
+    const auto grant = pool_block_grant_;
+    pool_block_grant_.reset();
+    return grant;
+}
+
+void SharedMemoryReader::UpdatePoolBlocks(const ReadAcquireResult& acquire_result) noexcept
+{
+    if (shared_memory_pool_ == nullptr)
+    {
+        return;
+    }
+
+    std::optional<std::uint32_t> free_slot{};
+    for (std::uint32_t slot = 0UL; slot < GetMaxNumberOfPoolBlocksPerClient(); ++slot)
+    {
+        auto& pool_block = pool_blocks_.at(slot);
+        if (pool_block.has_value() && ((acquire_result.returned_pool_blocks & (1U << slot)) != 0U))
+        {
+            pool_block.reset();
+            shared_memory_pool_->ReleaseBlock(shared_data_.producer_pid, slot);
+        }
+        if ((pool_block.has_value() == false) && (free_slot.has_value() == false))
+        {
+            free_slot = slot;
+        }
+    }
+
+    //  A client holds at most one block per linear buffer.
+    if ((acquire_result.requested_pool_blocks == 0U) || (free_slot.has_value() == false))
+    {
+        return;
+    }
+    auto pool_block = shared_memory_pool_->CreateBlock(shared_data_.producer_pid, client_uid_, free_slot.value());
+    if (pool_block.has_value())
+    {
+        std::ignore = pool_blocks_.at(free_slot.value()).emplace(std::move(pool_block.value()));
+        pool_block_grant_ = free_slot;
+    }
+}
+
+void SharedMemoryReader::ReleasePoolBlocks() noexcept
+{
+    for (std::uint32_t slot = 0UL; slot < GetMaxNumberOfPoolBlocksPerClient(); ++slot)
+    {
+        auto& pool_block = pool_blocks_.at(slot);
+        if (pool_block.has_value())
+        {
+            pool_block.reset();
+            shared_memory_pool_->ReleaseBlock(shared_data_.producer_pid, slot);
+        }
+    }
+}
+
+LinearReader SharedMemoryReader::CreateLinearReader(const std::uint32_t block_id_count) noexcept
+{
+    const auto block_id = SelectLinearControlBlockId(block_id_count);
+    const auto pool_block_index = (block_id == AlternatingControlBlockSelectId::kBlockEven)
+                                      ? shared_data_.pool_block_index_even.load()
+                                      : shared_data_.pool_block_index_odd.load();
+    if (pool_block_index == GetNoPoolBlockIndex())
+    {
+        return alternating_read_only_reader_.CreateLinearReader(block_id_count);
+    }
+
+    //  Only blocks granted to this client are mapped, so a client can never make Datarouter read other memory.
+    if ((pool_block_index >= GetMaxNumberOfPoolBlocksPerClient()) ||
+        (pool_blocks_.at(pool_block_index).has_value() == false))
+    {
+        std::cerr << "SharedMemoryReader: Dropping buffer redirected to pool block " << pool_block_index
+                  << " not granted to pid " << shared_data_.producer_pid << '\n';
+        return LinearReader{score::cpp::span<Byte>{}};
+    }
+
+    const auto& block = SelectLinearControlBlockReference(block_id, shared_data_.control_block);
+    return CreateLinearReaderFromDataAndLength(pool_blocks_.at(pool_block_index).value().GetData(),
+                                               block.written_index.load());
+}
+
 std::optional<Length> SharedMemoryReader::PeekNumberOfBytesAcquiredInBuffer(
     const std::uint32_t acquired_buffer_count_id) const noexcept
 {
@@ -15,10 +15,14 @@
 #define SCORE_MW_LOG_DETAIL_DATA_ROUTER_SHARED_MEMORY_SHARED_MEMORY_READER_H
 
 #include "score/mw/log/detail/data_router/shared_memory/i_shared_memory_reader.h"
+#include "score/mw/log/detail/data_router/shared_memory/shared_memory_pool.h"
 #include "score/mw/log/detail/wait_free_producer_queue/alternating_reader.h"
 
 #include <score/utility.hpp>
 
+#include <sys/types.h>
+
+#include <array>
 #include <cstring>
 
 namespace score
@@ -35,9 +39,15 @@ namespace detail
 class SharedMemoryReader : public ISharedMemoryReader
 {
   public:
+    /// \param blob_arena Reader side view of the large payload arena. Leave empty if the arena is disabled.
+    /// \param shared_memory_pool Pool to grant blocks to the client from on request. Shall outlive the reader.
+    /// \param client_uid Owner of the blocks granted to the client.
     explicit SharedMemoryReader(const SharedData& shared_data,
                                 AlternatingReadOnlyReader alternating_read_only_reader,
-                                UnmapCallback unmap_callback) noexcept;
+                                UnmapCallback unmap_callback,
+                                score::cpp::span<Byte> blob_arena = {},
+                                SharedMemoryPool* shared_memory_pool = nullptr,
+                                const uid_t client_uid = 0U) noexcept;
 
     ~SharedMemoryReader();
 
@@ -53,6 +63,14 @@ class SharedMemoryReader : public ISharedMemoryReader
     std::optional<Length> Read(const TypeRegistrationCallback& type_registration_callback,
                                const NewRecordCallback& new_message_callback) noexcept override;
 
+    /// \brief Reads at least max_number_of_bytes of entries, if available, and keeps the position for the next call.
+    /// Read() is equivalent to a ReadBounded() without limit.
+    std::optional<Length> ReadBounded(const TypeRegistrationCallback& type_registration_callback,
+                                      const NewRecordCallback& new_message_callback,
+                                      const Length max_number_of_bytes) noexcept override;
+
+    bool IsReadPending() const noexcept override;
+
     //  This function may be used to get a temporary view of the value of bytes acquired by writers.
     std::optional<Length> PeekNumberOfBytesAcquiredInBuffer(
         const std::uint32_t acquired_buffer_count_id) const noexcept override;
@@ -67,14 +85,18 @@ class SharedMemoryReader : public ISharedMemoryReader
     Length GetSizeOfDropsWithBufferFull() const noexcept override;
 
     Length GetRingBufferSizeBytes() const noexcept override;
+    const void* GetSharedMemoryAddress() const noexcept override;
 
     bool IsBlockReleasedByWriters(const std::uint32_t block_count) noexcept override;
 
     /// \brief This method shall be called by the server when a client has acknowledged an acquire request.
     /// It sets Reader to acquired data that can be later used by Read() method
     /// Returns number of bytes of acquired buffer if available. Otherwise it returns std::nullopt
+    /// Releases the pool blocks handed back by the client and creates a block if the client requested one.
     std::optional<Length> NotifyAcquisitionSetReader(const ReadAcquireResult& acquire_result) noexcept override;
 
+    std::optional<std::uint32_t> TakePoolBlockGrant() noexcept override;
+
   private:
     const SharedData& shared_data_;
     UnmapCallback unmap_callback_;
@@ -82,10 +104,23 @@ class SharedMemoryReader : public ISharedMemoryReader
     std::optional<LinearReader> linear_reader_;
     std::optional<ReadAcquireResult> acquired_data_;
     Length number_of_acquired_bytes_;
+    std::optional<Length> length_of_pending_read_;
+    bool detached_buffer_read_started_;
     bool finished_reading_after_detach_;
     std::uint32_t buffer_expected_to_read_next_;
     bool is_writer_detached_;
     AlternatingReadOnlyReader alternating_read_only_reader_;
+    score::cpp::span<Byte> blob_arena_;
+    SharedMemoryPool* shared_memory_pool_;
+    uid_t client_uid_;
+    std::array<std::optional<SharedMemoryPoolBlock>, GetMaxNumberOfPoolBlocksPerClient()> pool_blocks_;
+    std::optional<std::uint32_t> pool_block_grant_;
+
+    /// \brief Creates a reader on the own buffer of the client or on the pool block the buffer was redirected to.
+    LinearReader CreateLinearReader(const std::uint32_t block_id_count) noexcept;
+
+    void UpdatePoolBlocks(const ReadAcquireResult& acquire_result) noexcept;
+    void ReleasePoolBlocks() noexcept;
 
     /// \brief Method shall be called when a client closed the connection to Datarouter.
     /// The next call to Read() will return the data from both buffers.
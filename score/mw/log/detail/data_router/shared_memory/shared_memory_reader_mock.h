@@ -37,6 +37,15 @@ class ISharedMemoryReaderMock : public ISharedMemoryReader
                  const NewRecordCallback& new_message_callback),
                 (noexcept, override));
 
+    MOCK_METHOD(std::optional<Length>,
+                ReadBounded,
+                (const TypeRegistrationCallback& type_registration_callback,
+                 const NewRecordCallback& new_message_callback,
+                 const Length max_number_of_bytes),
+                (noexcept, override));
+
+    MOCK_METHOD(bool, IsReadPending, (), (const, noexcept, override));
+
     MOCK_METHOD(std::optional<Length>,
                 PeekNumberOfBytesAcquiredInBuffer,
                 (const std::uint32_t acquired_buffer_count_id),
@@ -53,11 +62,13 @@ class ISharedMemoryReaderMock : public ISharedMemoryReader
     MOCK_METHOD(Length, GetNumberOfDropsWithTypeRegistrationFailed, (), (const, noexcept, override));
     MOCK_METHOD(Length, GetSizeOfDropsWithBufferFull, (), (const, noexcept, override));
     MOCK_METHOD(Length, GetRingBufferSizeBytes, (), (const, noexcept, override));
+    MOCK_METHOD(const void*, GetSharedMemoryAddress, (), (const, noexcept, override));
     MOCK_METHOD(bool, IsBlockReleasedByWriters, (const std::uint32_t block_count), (noexcept, override));
     MOCK_METHOD(std::optional<Length>,
                 NotifyAcquisitionSetReader,
                 (const ReadAcquireResult& acquire_result),
                 (noexcept, override));
+    MOCK_METHOD(std::optional<std::uint32_t>, TakePoolBlockGrant, (), (noexcept, override));
 };
 
 }  // namespace detail
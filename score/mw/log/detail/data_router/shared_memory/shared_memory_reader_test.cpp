@@ -136,6 +136,15 @@ TEST_F(SharedMemoryReaderFixture, RingBufferSizeShallReturnValueBasedOnControlBl
     EXPECT_EQ(kRingSize, shared_memory_reader.GetRingBufferSizeBytes());
 }
 
+TEST_F(SharedMemoryReaderFixture, SharedMemoryAddressShallBeTheAddressOfTheSharedData)
+{
+    RecordProperty("Description", "Verifies that the shared memory address refers to the shared data of the client.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+
+    EXPECT_EQ(&shared_data, shared_memory_reader.GetSharedMemoryAddress());
+}
+
 TEST_F(SharedMemoryReaderFixture, GetterShallReadSharedDataNumberOfDropsWithTypeRegistrationFailed)
 {
 
@@ -363,6 +372,105 @@ TEST_F(SharedMemoryReaderFixture, ReaderNotifiedShallAcquireData)
     EXPECT_FALSE(shared_memory_reader.Read(on_new_type_discard, on_new_record_discard).has_value());
 }
 
+TEST_F(SharedMemoryReaderFixture, BoundedReadShallContinueWithTheNextEntry)
+{
+    RecordProperty("ParentRequirement", "SCR-861827, SCR-12206795");
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "Verifies that a bounded read can be continued until the data is read completely.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+
+    const auto type_id = shared_memory_writer.TryRegisterType(TypeInfoTest{});
+    for (auto i = 0; i < 2; ++i)
+    {
+        shared_memory_writer.AllocAndWrite(
+            [](auto span) noexcept {
+                std::memcpy(span.data(), kTestDataSample.data(), kTestDataSample.size());
+            },
+            type_id.value(),
+            kTestDataSample.size());
+    }
+
+    const auto read_acquire_result = shared_memory_writer.ReadAcquire();
+    const auto acquired_length = shared_memory_reader.NotifyAcquisitionSetReader(read_acquire_result);
+    ASSERT_TRUE(acquired_length.has_value());
+    EXPECT_TRUE(shared_memory_reader.IsReadPending());
+
+    std::size_t number_of_types{0U};
+    std::size_t number_of_records{0U};
+    auto on_new_type = [&number_of_types](const score::mw::log::detail::TypeRegistration&) noexcept {
+        ++number_of_types;
+    };
+    auto on_new_record = [&number_of_records](const score::mw::log::detail::SharedMemoryRecord&) noexcept {
+        ++number_of_records;
+    };
+
+    //  Each call reads a single entry, as any entry exceeds the limit of one byte:
+    EXPECT_FALSE(shared_memory_reader.ReadBounded(on_new_type, on_new_record, 1U).has_value());
+    EXPECT_EQ(number_of_types, 1U);
+    EXPECT_EQ(number_of_records, 0U);
+    EXPECT_TRUE(shared_memory_reader.IsReadPending());
+
+    EXPECT_FALSE(shared_memory_reader.ReadBounded(on_new_type, on_new_record, 1U).has_value());
+    EXPECT_EQ(number_of_records, 1U);
+    EXPECT_TRUE(shared_memory_reader.IsReadPending());
+
+    //  The call reading the last entry completes the read:
+    EXPECT_EQ(shared_memory_reader.ReadBounded(on_new_type, on_new_record, 1U), acquired_length);
+    EXPECT_EQ(number_of_types, 1U);
+    EXPECT_EQ(number_of_records, 2U);
+    EXPECT_FALSE(shared_memory_reader.IsReadPending());
+
+    EXPECT_FALSE(shared_memory_reader.ReadBounded(on_new_type, on_new_record, 1U).has_value());
+    EXPECT_EQ(number_of_records, 2U);
+}
+
+TEST_F(SharedMemoryReaderFixture, BoundedReadShallContinueIntoTheBufferOfADetachedWriter)
+{
+    RecordProperty("ParentRequirement", "SCR-861827, SCR-12206795");
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "Verifies that a bounded read covers both buffers once the writer detached.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+
+    const auto type_id = shared_memory_writer.TryRegisterType(TypeInfoTest{});
+    auto write = [&, this]() noexcept {
+        shared_memory_writer.AllocAndWrite(
+            [](auto span) noexcept {
+                std::memcpy(span.data(), kTestDataSample.data(), kTestDataSample.size());
+            },
+            type_id.value(),
+            kTestDataSample.size());
+    };
+
+    write();
+    const auto read_acquire_result = shared_memory_writer.ReadAcquire();
+    write();
+    ASSERT_TRUE(shared_memory_reader.NotifyAcquisitionSetReader(read_acquire_result).has_value());
+    shared_data.writer_detached = true;
+
+    std::size_t number_of_records{0U};
+    auto on_new_type = [](const score::mw::log::detail::TypeRegistration&) noexcept {};
+    auto on_new_record = [&number_of_records](const score::mw::log::detail::SharedMemoryRecord&) noexcept {
+        ++number_of_records;
+    };
+
+    std::optional<Length> length_of_read{};
+    std::size_t number_of_calls{0U};
+    while (!length_of_read.has_value() && (number_of_calls < 10U))
+    {
+        length_of_read = shared_memory_reader.ReadBounded(on_new_type, on_new_record, 1U);
+        ++number_of_calls;
+    }
+
+    //  Type registration and record of the acquired buffer, then the record of the detached one:
+    EXPECT_EQ(number_of_calls, 3U);
+    EXPECT_EQ(number_of_records, 2U);
+    EXPECT_TRUE(length_of_read.has_value());
+    EXPECT_FALSE(shared_memory_reader.IsReadPending());
+    EXPECT_FALSE(shared_memory_reader.ReadBounded(on_new_type, on_new_record, 1U).has_value());
+}
+
 TEST_F(SharedMemoryReaderFixture, WriterAcquireShallAllowDataToBeWritten)
 {
     RecordProperty("ParentRequirement", "SCR-861827, SCR-12206795");
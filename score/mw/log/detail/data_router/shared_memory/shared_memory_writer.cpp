@@ -22,10 +22,30 @@ namespace log
 namespace detail
 {
 
-SharedMemoryWriter::SharedMemoryWriter(SharedData& shared_data, UnmapCallback unmap_callback) noexcept
+namespace
+{
+
+//  A buffer filled above this fraction during one read cycle makes the client borrow a pool block.
+constexpr Length kBorrowFillNumerator{3UL};
+constexpr Length kBorrowFillDenominator{4UL};
+//  A pool block is handed back once a read cycle used less than this fraction of the own buffer.
+constexpr Length kReturnFillDenominator{4UL};
+
+}  // namespace
+
+SharedMemoryWriter::SharedMemoryWriter(SharedData& shared_data,
+                                       UnmapCallback unmap_callback,
+                                       score::cpp::optional<SharedMemoryPool> shared_memory_pool) noexcept
     : shared_data_{shared_data},
       alternating_writer_{shared_data.control_block},
       alternating_reader_{shared_data.control_block},
+      blob_pool_{shared_data},
+      shared_memory_pool_{std::move(shared_memory_pool)},
+      pool_blocks_{},
+      returned_pool_blocks_{0U},
+      own_buffer_even_{shared_data.control_block.control_block_even.data},
+      own_buffer_odd_{shared_data.control_block.control_block_odd.data},
+      drops_at_last_read_acquire_{shared_data.number_of_drops_buffer_full.load()},
       unmap_callback_{std::move(unmap_callback)},
       type_identifier_{},
       moved_from_{}
@@ -41,6 +61,13 @@ SharedMemoryWriter::SharedMemoryWriter(SharedMemoryWriter&& other) noexcept
       alternating_writer_{shared_data_.control_block},
       // coverity[autosar_cpp14_a12_8_4_violation]
       alternating_reader_{shared_data_.control_block},
+      blob_pool_{std::move(other.blob_pool_)},
+      shared_memory_pool_{std::move(other.shared_memory_pool_)},
+      pool_blocks_{std::move(other.pool_blocks_)},
+      returned_pool_blocks_{other.returned_pool_blocks_},
+      own_buffer_even_{other.own_buffer_even_},
+      own_buffer_odd_{other.own_buffer_odd_},
+      drops_at_last_read_acquire_{other.drops_at_last_read_acquire_},
       unmap_callback_{std::move(other.unmap_callback_)},
       // coverity[autosar_cpp14_a12_8_4_violation]
       // coverity[autosar_cpp14_a18_9_2_violation : FALSE]
@@ -52,12 +79,112 @@ SharedMemoryWriter::SharedMemoryWriter(SharedMemoryWriter&& other) noexcept
 
 ReadAcquireResult SharedMemoryWriter::ReadAcquire() noexcept
 {
-    const auto acquired = alternating_reader_.Switch();
     ReadAcquireResult result{};
-    result.acquired_buffer = acquired;
+    RebalanceRestartingBuffer(result);
+    result.acquired_buffer = alternating_reader_.Switch();
     return result;
 }
 
+bool SharedMemoryWriter::AttachPoolBlock(const std::uint32_t slot) noexcept
+{
+    //  Datarouter only grants slots the client does not hold, anything else is a protocol violation to be ignored.
+    if (((shared_memory_pool_.has_value() == false) || (slot >= GetMaxNumberOfPoolBlocksPerClient())) ||
+        pool_blocks_.at(slot).has_value())
+    {
+        return false;
+    }
+    auto block = shared_memory_pool_.value().OpenBlock(shared_data_.producer_pid, slot);
+    if (block.has_value() == false)
+    {
+        returned_pool_blocks_ = static_cast<std::uint8_t>(returned_pool_blocks_ | (1U << slot));
+        return false;
+    }
+    std::ignore = pool_blocks_.at(slot).emplace(std::move(block.value()));
+    return true;
+}
+
+void SharedMemoryWriter::RebalanceRestartingBuffer(ReadAcquireResult& result) noexcept
+{
+    result.returned_pool_blocks = returned_pool_blocks_;
+    returned_pool_blocks_ = 0U;
+    if (shared_memory_pool_.has_value() == false)
+    {
+        return;
+    }
+
+    //  Datarouter requests a switch only after it finished reading the previously acquired buffer. Thus the buffer
+    //  opposite to the one active for writing is neither read nor written and its memory can be exchanged.
+    const auto block_id_active_for_writing =
+        SelectLinearControlBlockId(shared_data_.control_block.switch_count_points_active_for_writing.load());
+    const auto restarting_block_id = GetOppositeLinearControlBlock(block_id_active_for_writing);
+    const auto& active_block =
+        SelectLinearControlBlockReference(block_id_active_for_writing, shared_data_.control_block);
+    auto& restarting_block = SelectLinearControlBlockReference(restarting_block_id, shared_data_.control_block);
+    const bool is_restarting_block_even = restarting_block_id == AlternatingControlBlockSelectId::kBlockEven;
+    auto& restarting_pool_block_index =
+        is_restarting_block_even ? shared_data_.pool_block_index_even : shared_data_.pool_block_index_odd;
+    const auto active_pool_block_index =
+        is_restarting_block_even ? shared_data_.pool_block_index_odd.load() : shared_data_.pool_block_index_even.load();
+    const auto own_buffer = is_restarting_block_even ? own_buffer_even_ : own_buffer_odd_;
+
+    const auto drops = shared_data_.number_of_drops_buffer_full.load();
+    const bool dropped_since_last_read_acquire = drops != drops_at_last_read_acquire_;
+    drops_at_last_read_acquire_ = drops;
+
+    const auto active_capacity = GetDataSizeAsLength(active_block.data);
+    const auto active_usage = std::min(active_block.acquired_index.load(), active_capacity);
+    const auto own_capacity = GetDataSizeAsLength(own_buffer);
+    const bool is_under_pressure =
+        dropped_since_last_read_acquire ||
+        (active_usage > ((active_capacity / kBorrowFillDenominator) * kBorrowFillNumerator));
+    const bool is_calm =
+        (dropped_since_last_read_acquire == false) && (active_usage < (own_capacity / kReturnFillDenominator));
+
+    auto restarting_slot = restarting_pool_block_index.load();
+    if ((restarting_slot != GetNoPoolBlockIndex()) && is_calm)
+    {
+        restarting_block.data = own_buffer;
+        restarting_pool_block_index.store(GetNoPoolBlockIndex());
+        restarting_slot = GetNoPoolBlockIndex();
+    }
+
+    std::uint32_t number_of_granted_blocks{0UL};
+    for (std::uint32_t slot = 0UL; slot < GetMaxNumberOfPoolBlocksPerClient(); ++slot)
+    {
+        if (pool_blocks_.at(slot).has_value() == false)
+        {
+            continue;
+        }
+        if ((slot == active_pool_block_index) || (slot == restarting_slot))
+        {
+            ++number_of_granted_blocks;
+            continue;
+        }
+        if (is_calm)
+        {
+            //  Blocks not backing any buffer go back to Datarouter as soon as the load is gone.
+            pool_blocks_.at(slot).reset();
+            result.returned_pool_blocks = static_cast<std::uint8_t>(result.returned_pool_blocks | (1U << slot));
+            continue;
+        }
+        ++number_of_granted_blocks;
+        if ((restarting_slot == GetNoPoolBlockIndex()) && is_under_pressure &&
+            (shared_memory_pool_.value().GetBlockSize() > own_capacity))
+        {
+            restarting_block.data = pool_blocks_.at(slot).value().GetData();
+            restarting_pool_block_index.store(slot);
+            restarting_slot = slot;
+        }
+    }
+
+    if ((restarting_slot == GetNoPoolBlockIndex()) && is_under_pressure &&
+        (shared_memory_pool_.value().GetBlockSize() > own_capacity) &&
+        (number_of_granted_blocks < GetMaxNumberOfPoolBlocksPerClient()))
+    {
+        result.requested_pool_blocks = 1U;
+    }
+}
+
 void SharedMemoryWriter::DetachWriter() noexcept
 {
     shared_data_.writer_detached.store(true);
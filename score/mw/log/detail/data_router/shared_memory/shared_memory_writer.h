@@ -14,11 +14,14 @@
 #ifndef SCORE_MW_LOG_DETAIL_DATA_ROUTER_SHARED_MEMORY_SHARED_MEMORY_WRITER_H
 #define SCORE_MW_LOG_DETAIL_DATA_ROUTER_SHARED_MEMORY_SHARED_MEMORY_WRITER_H
 
+#include "score/mw/log/detail/data_router/shared_memory/blob_pool_writer.h"
 #include "score/mw/log/detail/data_router/shared_memory/common.h"
+#include "score/mw/log/detail/data_router/shared_memory/shared_memory_pool.h"
 #include "score/mw/log/detail/wait_free_producer_queue/alternating_reader_proxy.h"
 #include "score/mw/log/detail/wait_free_producer_queue/wait_free_alternating_writer.h"
 
 #include <algorithm>
+#include <array>
 #include <cstring>
 #include <limits>
 #include <type_traits>
@@ -39,7 +42,11 @@ class SharedMemoryWriter
   public:
     using size_type = score::cpp::span<Byte>::size_type;
 
-    explicit SharedMemoryWriter(SharedData& shared_data, UnmapCallback unmap_callback) noexcept;
+    /// \param shared_memory_pool Pool announced by Datarouter to borrow linear buffers from under load. Disabled if
+    /// empty.
+    explicit SharedMemoryWriter(SharedData& shared_data,
+                                UnmapCallback unmap_callback,
+                                score::cpp::optional<SharedMemoryPool> shared_memory_pool = {}) noexcept;
 
     //  Moving the object is not allowed during operation.
     //  It is allowed to be used only in initialization phase by a factory
@@ -61,6 +68,8 @@ class SharedMemoryWriter
     }
 
     /// \brief Allocates space on buffer and writes data into it.
+    /// Payloads exceeding GetMaxPayloadSize() are stored in the blob arena, if configured, and only a BlobDescriptor
+    /// is written into the ring buffer.
     /// This method is thread-safe, lock-free and wait-free.
     template <typename WriteCallback>
     // Suppressing the "AUTOSAR C++14 A15-5-3" rule violation:
@@ -75,46 +84,16 @@ class SharedMemoryWriter
     {
         if (payload_size > GetMaxPayloadSize())
         {
-            shared_data_.number_of_drops_invalid_size++;
+            if (payload_size > blob_pool_.GetMaxBlobSize())
+            {
+                shared_data_.number_of_drops_invalid_size++;
+                return;
+            }
+            AllocAndWriteBlob(timestamp, type_identifier, payload_size, write_callback);
             return;
         }
 
-        const Length total_size = payload_size + sizeof(BufferEntryHeader);
-        const auto acquired_data = alternating_writer_.Acquire(total_size);
-
-        if (acquired_data.has_value() == false)
-        {
-            shared_data_.number_of_drops_buffer_full++;
-            shared_data_.size_of_drops_buffer_full += total_size;
-            return;
-        }
-
-        // Write header
-        const BufferEntryHeader header{
-            timestamp,
-            type_identifier,
-        };
-        const score::cpp::span<Byte> header_span = acquired_data.value().data.subspan(0, sizeof(BufferEntryHeader));
-        // Suppress "AUTOSAR C++14 M5-2-8" rule. The rule declares:
-        // An object with integer type or pointer to void type shall not be converted to an object with pointer type.
-        // But we need to convert void pointer to bytes for serialization purposes, no out of bounds there
-        // coverity[autosar_cpp14_m5_2_8_violation]
-        const score::cpp::span<const Byte> header_source{static_cast<const char*>(static_cast<const void*>(&header)),
-                                                  sizeof(header)};
-        // coverity[autosar_cpp14_m5_0_16_violation:FALSE]
-        std::ignore = std::copy(header_source.begin(), header_source.end(), header_span.begin());
-
-        // Write payload
-        const auto payload_span =
-            acquired_data.value().data.subspan(sizeof(BufferEntryHeader), static_cast<size_type>(payload_size));
-        // Suppressing the "AUTOSAR C++14 A15-4-2" rule violation:
-        // This rule states: "If a function is declared as noexcept, noexcept(true), or noexcept(<true condition>),
-        // then it shall not exit with an exception."
-        // Removing `noexcept` would introduce new Coverity findings.
-        // coverity[autosar_cpp14_a15_4_2_violation]
-        write_callback(payload_span);
-
-        alternating_writer_.Release(acquired_data.value());
+        std::ignore = AllocAndWriteEntry(timestamp, type_identifier, payload_size, write_callback);
     }
 
     /// \brief Allocates space on buffer and writes data into it.
@@ -150,7 +129,14 @@ class SharedMemoryWriter
         //  cast to bigger type:
         const auto total_size = static_cast<Length>(kTypeIdentifierSize) + static_cast<Length>(type_info_size);
 
-        this->AllocAndWrite(
+        //  Type registrations are never offloaded into the blob arena.
+        if (total_size > GetMaxPayloadSize())
+        {
+            shared_data_.number_of_drops_invalid_size++;
+            return result;
+        }
+
+        std::ignore = this->AllocAndWriteEntry(
             TimePoint::clock::now(),
             GetRegisterTypeToken(),
             total_size,
@@ -178,11 +164,20 @@ class SharedMemoryWriter
 
     /// \brief Toggles the buffer active for writing and returns buffer that is intended for reading when released by
     /// writers.
+    /// If a shared-memory pool is attached, the buffer that becomes active for writing borrows a granted pool block
+    /// when the client is running out of space, and hands it back once the load is gone. The result asks Datarouter
+    /// for a block if none is granted yet and reports the blocks handed back.
     ///
     /// This method is thread safe only against AllocAndWrite() and TryRegisterType().
     /// This method shall not be called from multiple threads.
     ReadAcquireResult ReadAcquire() noexcept;
 
+    /// \brief Maps the pool block Datarouter granted in the given slot upon a former request, to be used by the next
+    /// calls of ReadAcquire(). A block that cannot be mapped is handed back with the next ReadAcquire().
+    ///
+    /// This method shall only be called from the thread calling ReadAcquire().
+    bool AttachPoolBlock(const std::uint32_t slot) noexcept;
+
     /// \brief Signals to Datarouter to switch to detached mode.
     ///
     /// This method is thread-safe and wait-free.
@@ -194,9 +189,114 @@ class SharedMemoryWriter
     void IncrementTypeRegistrationFailures() noexcept;
 
   private:
+    template <typename WriteCallback>
+    // coverity[autosar_cpp14_a15_5_3_violation] see AllocAndWrite().
+    bool AllocAndWriteEntry(const TimePoint timestamp,
+                            const TypeIdentifier type_identifier,
+                            const Length payload_size,
+                            WriteCallback write_callback) noexcept
+    {
+        const Length total_size = payload_size + sizeof(BufferEntryHeader);
+        const auto acquired_data = alternating_writer_.Acquire(total_size);
+
+        if (acquired_data.has_value() == false)
+        {
+            shared_data_.number_of_drops_buffer_full++;
+            shared_data_.size_of_drops_buffer_full += total_size;
+            return false;
+        }
+
+        // Write header
+        const BufferEntryHeader header{
+            timestamp,
+            type_identifier,
+        };
+        const score::cpp::span<Byte> header_span = acquired_data.value().data.subspan(0, sizeof(BufferEntryHeader));
+        // Suppress "AUTOSAR C++14 M5-2-8" rule. The rule declares:
+        // An object with integer type or pointer to void type shall not be converted to an object with pointer type.
+        // But we need to convert void pointer to bytes for serialization purposes, no out of bounds there
+        // coverity[autosar_cpp14_m5_2_8_violation]
+        const score::cpp::span<const Byte> header_source{static_cast<const char*>(static_cast<const void*>(&header)),
+                                                  sizeof(header)};
+        // coverity[autosar_cpp14_m5_0_16_violation:FALSE]
+        std::ignore = std::copy(header_source.begin(), header_source.end(), header_span.begin());
+
+        // Write payload
+        const auto payload_span =
+            acquired_data.value().data.subspan(sizeof(BufferEntryHeader), static_cast<size_type>(payload_size));
+        // Suppressing the "AUTOSAR C++14 A15-4-2" rule violation:
+        // This rule states: "If a function is declared as noexcept, noexcept(true), or noexcept(<true condition>),
+        // then it shall not exit with an exception."
+        // Removing `noexcept` would introduce new Coverity findings.
+        // coverity[autosar_cpp14_a15_4_2_violation]
+        write_callback(payload_span);
+
+        alternating_writer_.Release(acquired_data.value());
+        return true;
+    }
+
+    /// \brief Writes the payload into a blob arena slot and publishes it through a BlobDescriptor entry.
+    template <typename WriteCallback>
+    // coverity[autosar_cpp14_a15_5_3_violation] see AllocAndWrite().
+    void AllocAndWriteBlob(const TimePoint timestamp,
+                           const TypeIdentifier type_identifier,
+                           const Length payload_size,
+                           WriteCallback write_callback) noexcept
+    {
+        const auto slot_index = blob_pool_.TryAcquireSlot();
+        if (slot_index.has_value() == false)
+        {
+            shared_data_.number_of_drops_buffer_full++;
+            shared_data_.size_of_drops_buffer_full += payload_size;
+            return;
+        }
+
+        // coverity[autosar_cpp14_a15_4_2_violation] see AllocAndWriteEntry().
+        write_callback(blob_pool_.GetSlotData(slot_index.value(), payload_size));
+
+        BlobDescriptor descriptor{};
+        descriptor.type_identifier = type_identifier;
+        descriptor.slot_index = slot_index.value();
+        descriptor.payload_size = payload_size;
+
+        const bool published = AllocAndWriteEntry(
+            timestamp,
+            GetBlobDescriptorToken(),
+            sizeof(descriptor),
+            [&descriptor](const score::cpp::span<Byte> payload_span) noexcept {
+                // coverity[autosar_cpp14_m5_2_8_violation] see AllocAndWriteEntry().
+                const score::cpp::span<const Byte> source{
+                    static_cast<const Byte*>(static_cast<const void*>(&descriptor)), sizeof(descriptor)};
+                std::ignore = std::copy(source.begin(), source.end(), payload_span.begin());
+            });
+
+        if (published)
+        {
+            blob_pool_.ReleaseSlotToReader(slot_index.value(),
+                                           shared_data_.control_block.switch_count_points_active_for_writing.load());
+        }
+        else
+        {
+            blob_pool_.ReleaseSlotUnused(slot_index.value());
+        }
+    }
+
+    /// \brief Swaps the memory of the buffer that is about to become active for writing between the own buffer and a
+    /// granted pool block, hands back unused blocks and requests one more if needed in the result.
+    /// Shall only be called from ReadAcquire() before switching.
+    void RebalanceRestartingBuffer(ReadAcquireResult& result) noexcept;
+
     SharedData& shared_data_;
     WaitFreeAlternatingWriter alternating_writer_;
     AlternatingReaderProxy alternating_reader_;
+    BlobPoolWriter blob_pool_;
+    score::cpp::optional<SharedMemoryPool> shared_memory_pool_;
+    //  Unmapped before the pool goes away, the blocks are unmapped by the pool osal.
+    std::array<score::cpp::optional<SharedMemoryPoolBlock>, GetMaxNumberOfPoolBlocksPerClient()> pool_blocks_;
+    std::uint8_t returned_pool_blocks_;
+    score::cpp::span<Byte> own_buffer_even_;
+    score::cpp::span<Byte> own_buffer_odd_;
+    Length drops_at_last_read_acquire_;
     UnmapCallback unmap_callback_;
     std::atomic<TypeIdentifier> type_identifier_;
     bool moved_from_;
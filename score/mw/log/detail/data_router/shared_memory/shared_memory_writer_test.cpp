@@ -17,8 +17,10 @@
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 
+#include <algorithm>
 #include <array>
 #include <thread>
+#include <vector>
 
 namespace score
 {
@@ -83,6 +85,42 @@ INSTANTIATE_TEST_SUITE_P(OversizedRequests,
                          testing::Values(SharedMemoryWriter::GetMaxPayloadSize(),
                                          SharedMemoryWriter::GetMaxPayloadSize() + 1UL));
 
+constexpr auto kBlobSlotSize = SharedMemoryWriter::GetMaxPayloadSize() + 1024UL;
+constexpr auto kNumberOfBlobSlots = 2UL;
+constexpr auto kBlobSize = SharedMemoryWriter::GetMaxPayloadSize() + 1UL;
+
+class SharedMemoryWriterBlobFixture : public SharedMemoryWriterFixture
+{
+  public:
+    SharedMemoryWriterBlobFixture() : SharedMemoryWriterFixture{}, blob_arena(kBlobSlotSize * kNumberOfBlobSlots, 0)
+    {
+        shared_data.blob_arena = score::cpp::span<Byte>(blob_arena.data(), blob_arena.size());
+        shared_data.blob_arena_offset = sizeof(SharedData) + kRingSize;
+        shared_data.blob_slot_size = kBlobSlotSize;
+
+        AlternatingReadOnlyReader read_only_reader{
+            shared_data.control_block,
+            shared_data.control_block.control_block_even.data,
+            shared_data.control_block.control_block_odd.data,
+        };
+        shared_memory_reader = std::make_unique<SharedMemoryReader>(
+            shared_data, std::move(read_only_reader), UnmapCallback{}, shared_data.blob_arena);
+    }
+
+    void WriteBlob(const TypeIdentifier type_id, const Byte value)
+    {
+        shared_memory_writer.AllocAndWrite(
+            [value](auto span) {
+                EXPECT_EQ(span.size(), kBlobSize);
+                std::fill(span.begin(), span.end(), value);
+            },
+            type_id,
+            kBlobSize);
+    }
+
+    std::vector<Byte> blob_arena;
+};
+
 class TypeInfoTest
 {
   public:
@@ -353,6 +391,129 @@ TEST_F(SharedMemoryWriterFixture, MultipleConcurrentWritesShallAllBeReceivedVali
     }
 }
 
+TEST_F(SharedMemoryWriterBlobFixture, BlobWriteShallBeReadFromArena)
+{
+    RecordProperty("Requirement", "SCR-861534,SCR-1016719");
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description",
+                   "Payloads exceeding the ring buffer entry limit shall be stored in the blob arena and be read back "
+                   "with the original type identifier.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+
+    const auto type_id = shared_memory_writer.TryRegisterType(TypeInfoTest{});
+    constexpr Byte kValue{0x5A};
+    WriteBlob(type_id.value(), kValue);
+
+    shared_memory_reader->NotifyAcquisitionSetReader(shared_memory_writer.ReadAcquire());
+
+    auto count = 0UL;
+    auto on_new_type = [](const score::mw::log::detail::TypeRegistration&) noexcept {};
+    auto on_new_record = [&](const score::mw::log::detail::SharedMemoryRecord& record) noexcept {
+        EXPECT_EQ(record.header.type_identifier, type_id.value());
+        ASSERT_EQ(record.payload.size(), kBlobSize);
+        EXPECT_EQ(record.payload.data(), blob_arena.data());
+        EXPECT_TRUE(std::all_of(record.payload.begin(), record.payload.end(), [](const Byte byte) {
+            return byte == kValue;
+        }));
+        count++;
+    };
+    shared_memory_reader->Read(on_new_type, on_new_record);
+
+    EXPECT_EQ(count, 1UL);
+    EXPECT_EQ(shared_data.number_of_drops_invalid_size.load(), 0UL);
+}
+
+TEST_F(SharedMemoryWriterBlobFixture, BlobShallBeDroppedWhenAllSlotsAreInUse)
+{
+    RecordProperty("Requirement", "SCR-861534,SCR-1016719");
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "A blob shall be dropped and counted if no slot of the blob arena is free.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+
+    const auto type_id = shared_memory_writer.TryRegisterType(TypeInfoTest{});
+    for (auto i = 0UL; i <= kNumberOfBlobSlots; i++)
+    {
+        WriteBlob(type_id.value(), static_cast<Byte>(i));
+    }
+
+    EXPECT_EQ(shared_data.number_of_drops_buffer_full.load(), 1UL);
+    EXPECT_EQ(shared_data.size_of_drops_buffer_full.load(), kBlobSize);
+}
+
+TEST_F(SharedMemoryWriterBlobFixture, BlobSlotShallBeReusedOnlyAfterReaderConsumedTheDescriptor)
+{
+    RecordProperty("Requirement", "SCR-861534,SCR-1016719");
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description",
+                   "A blob slot shall not be overwritten before Datarouter had the chance to read the block holding "
+                   "its descriptor.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+
+    const auto type_id = shared_memory_writer.TryRegisterType(TypeInfoTest{});
+    for (auto i = 0UL; i < kNumberOfBlobSlots; i++)
+    {
+        WriteBlob(type_id.value(), static_cast<Byte>(i));
+    }
+
+    //  The block holding the descriptors was handed over to the reader but not yet consumed.
+    shared_memory_reader->NotifyAcquisitionSetReader(shared_memory_writer.ReadAcquire());
+    WriteBlob(type_id.value(), Byte{0x7F});
+    EXPECT_EQ(shared_data.number_of_drops_buffer_full.load(), 1UL);
+
+    auto count = 0UL;
+    auto on_new_type = [](const score::mw::log::detail::TypeRegistration&) noexcept {};
+    auto on_new_record = [&count](const score::mw::log::detail::SharedMemoryRecord& record) noexcept {
+        EXPECT_EQ(record.payload.front(), static_cast<Byte>(count));
+        count++;
+    };
+    shared_memory_reader->Read(on_new_type, on_new_record);
+    EXPECT_EQ(count, kNumberOfBlobSlots);
+
+    //  Requesting the next acquisition implies that the previous block was consumed.
+    shared_memory_reader->NotifyAcquisitionSetReader(shared_memory_writer.ReadAcquire());
+    WriteBlob(type_id.value(), Byte{0x7F});
+    EXPECT_EQ(shared_data.number_of_drops_buffer_full.load(), 1UL);
+}
+
+TEST_F(SharedMemoryWriterBlobFixture, MovedWriterShallKeepTheBlobSlotsInUse)
+{
+    RecordProperty("Requirement", "SCR-861534,SCR-1016719");
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "A moved writer shall not overwrite blob slots still referenced by the reader.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+
+    const auto type_id = shared_memory_writer.TryRegisterType(TypeInfoTest{});
+    for (auto i = 0UL; i < kNumberOfBlobSlots; i++)
+    {
+        WriteBlob(type_id.value(), static_cast<Byte>(i));
+    }
+
+    SharedMemoryWriter moved_writer{std::move(shared_memory_writer)};
+    moved_writer.AllocAndWrite([](auto span) { std::fill(span.begin(), span.end(), Byte{0x7F}); },
+                               type_id.value(),
+                               kBlobSize);
+
+    EXPECT_EQ(shared_data.number_of_drops_buffer_full.load(), 1UL);
+    EXPECT_EQ(blob_arena.front(), Byte{0});
+}
+
+TEST_F(SharedMemoryWriterBlobFixture, TypeRegistrationShallNotUseBlobArena)
+{
+    RecordProperty("Requirement", "SCR-861534,SCR-1016719");
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "Oversized type registrations shall be rejected even if a blob arena is available.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+
+    const auto result = shared_memory_writer.TryRegisterType(TypeInfoTestOversized{});
+    EXPECT_FALSE(result.has_value());
+    EXPECT_EQ(shared_data.number_of_drops_invalid_size.load(), 1UL);
+}
+
 }  // namespace
 }  // namespace detail
 }  // namespace log
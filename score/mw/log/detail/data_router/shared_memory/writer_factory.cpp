@@ -13,6 +13,7 @@
 
 #include "score/mw/log/detail/data_router/shared_memory/writer_factory.h"
 
+#include <algorithm>
 #include <iostream>
 #include <memory>
 #include <sstream>
@@ -41,6 +42,23 @@ static_assert(sizeof(kSuffixName) <= static_cast<std::size_t>(std::numeric_limit
               "size of kSuffixName is too big");
 constexpr int32_t kSizeOfTemplateSuffix{static_cast<int32_t>(sizeof(kSuffixName)) - 1};
 
+//  With a pool to borrow from under load, the own ring buffer only needs to cover the regular load.
+constexpr std::size_t kRingBufferShrinkDivisor{4UL};
+constexpr std::size_t kMinRingBufferSizeWithPool{16UL * 1024UL};
+
+std::size_t GetOwnRingBufferSize(const std::size_t configured_ring_buffer_size,
+                                 const score::cpp::optional<SharedMemoryPool>& shared_memory_pool) noexcept
+{
+    //  A pool block replaces one of the two linear buffers, thus it is only of use if larger than half of the ring.
+    if ((shared_memory_pool.has_value() == false) ||
+        (shared_memory_pool.value().GetBlockSize() <= (configured_ring_buffer_size / 2UL)))
+    {
+        return configured_ring_buffer_size;
+    }
+    return std::min(configured_ring_buffer_size,
+                    std::max(configured_ring_buffer_size / kRingBufferShrinkDivisor, kMinRingBufferSizeWithPool));
+}
+
 }  // namespace
 
 LoggingClientFileNameResult WriterFactory::GetStaticLoggingClientFilename(const std::string_view app_id) const noexcept
@@ -58,7 +76,10 @@ LoggingClientFileNameResult WriterFactory::GetStaticLoggingClientFilename(const
     return result;
 }
 
-WriterFactory::WriterFactory(OsalInstances osal) noexcept : osal_(std::move(osal)) {}
+WriterFactory::WriterFactory(OsalInstances osal, SharedMemoryPoolFactory::OsalInstances pool_osal) noexcept
+    : osal_(std::move(osal)), pool_osal_(std::move(pool_osal))
+{
+}
 
 void WriterFactory::UnlinkExistingFile(const std::string& file_name) const noexcept
 {
@@ -220,6 +241,29 @@ SharedData* WriterFactory::ConstructSharedData(void* const ring_buffer_address,
     return shared_data;
 }
 
+void WriterFactory::ConstructBlobArena(SharedData& shared_data,
+                                       const std::size_t ring_buffer_size,
+                                       const BlobPoolConfiguration& blob_pool) const noexcept
+{
+    if ((blob_pool.number_of_slots == 0UL) || (blob_pool.slot_size == 0UL))
+    {
+        return;
+    }
+
+    //  The arena directly follows the second linear buffer.
+    auto* iter = &shared_data;
+    std::advance(iter, 1); /*moving pointer forward by one SharedData  type*/
+    // coverity[autosar_cpp14_m5_2_8_violation] see ConstructSharedData().
+    auto* arena_data = static_cast<Byte*>(static_cast<void*>(iter));
+    std::advance(arena_data, static_cast<std::ptrdiff_t>(ring_buffer_size));
+
+    using SpanSizeType = score::cpp::span<Byte>::size_type;
+    const auto arena_size = static_cast<SpanSizeType>(blob_pool.number_of_slots * blob_pool.slot_size);
+    shared_data.blob_arena = score::cpp::span<Byte>{arena_data, arena_size};
+    shared_data.blob_arena_offset = sizeof(SharedData) + ring_buffer_size;
+    shared_data.blob_slot_size = blob_pool.slot_size;
+}
+
 LoggingClientFileNameResult WriterFactory::PrepareFileNameAndUpdateOpenFlags(
     score::os::Fcntl::Open& file_open_flags,
     const bool dynamic_mode,
@@ -291,9 +335,10 @@ score::cpp::optional<void* const> WriterFactory::GetAlignedRingBufferAddress(
     return ring_buffer_address.value();
 }
 
-score::cpp::optional<SharedMemoryWriter> WriterFactory::Create(const std::size_t ring_buffer_size,
+score::cpp::optional<SharedMemoryWriter> WriterFactory::Create(const std::size_t configured_ring_buffer_size,
                                                         const bool dynamic_mode,
-                                                        const std::string_view app_id) noexcept
+                                                        const std::string_view app_id,
+                                                        const BlobPoolConfiguration& blob_pool) noexcept
 {
     if ((((osal_.fcntl_osal == nullptr) || (osal_.unistd == nullptr)) || (osal_.mman == nullptr)) ||
         ((osal_.stat_osal == nullptr) || (osal_.stdlib == nullptr)))
@@ -305,6 +350,9 @@ score::cpp::optional<SharedMemoryWriter> WriterFactory::Create(const std::size_t
         score::os::Fcntl::Open::kReadWrite | score::os::Fcntl::Open::kExclusive | score::os::Fcntl::Open::kCloseOnExec;
     file_attributes_ = PrepareFileNameAndUpdateOpenFlags(flags, dynamic_mode, app_id);
 
+    auto shared_memory_pool = SharedMemoryPoolFactory{std::move(pool_osal_)}.Open();
+    const auto ring_buffer_size = GetOwnRingBufferSize(configured_ring_buffer_size, shared_memory_pool);
+
     constexpr std::size_t kBufferStartOffset = sizeof(SharedData);
     if (kBufferStartOffset > std::numeric_limits<size_t>::max() - ring_buffer_size)
     {
@@ -313,7 +361,22 @@ score::cpp::optional<SharedMemoryWriter> WriterFactory::Create(const std::size_t
                   << " in line : " << __LINE__ << "\n";
     }
     const std::size_t buffer_end_offset = kBufferStartOffset + ring_buffer_size;
-    const auto total_size = buffer_end_offset;
+
+    BlobPoolConfiguration effective_blob_pool = blob_pool;
+    if (effective_blob_pool.number_of_slots > static_cast<std::size_t>(GetMaxNumberOfBlobSlots()))
+    {
+        std::cerr << "Limiting number of blob slots from " << effective_blob_pool.number_of_slots << " to "
+                  << GetMaxNumberOfBlobSlots() << '\n';
+        effective_blob_pool.number_of_slots = static_cast<std::size_t>(GetMaxNumberOfBlobSlots());
+    }
+    if ((effective_blob_pool.slot_size != 0UL) &&
+        (effective_blob_pool.slot_size > (std::numeric_limits<size_t>::max() - buffer_end_offset) /
+                                             static_cast<std::size_t>(GetMaxNumberOfBlobSlots())))
+    {
+        std::cerr << "Blob slot size " << effective_blob_pool.slot_size << " is too large, disabling blob arena\n";
+        effective_blob_pool = BlobPoolConfiguration{};
+    }
+    const auto total_size = buffer_end_offset + (effective_blob_pool.number_of_slots * effective_blob_pool.slot_size);
 
     auto ring_buffer_address = GetAlignedRingBufferAddress(total_size, file_attributes_.file_name, flags);
     if (ring_buffer_address.has_value() == false)
@@ -321,8 +384,10 @@ score::cpp::optional<SharedMemoryWriter> WriterFactory::Create(const std::size_t
         return {};
     }
 
-    SharedMemoryWriter shared_memory_writer{*ConstructSharedData(ring_buffer_address.value(), ring_buffer_size),
-                                            std::move(unmap_callback_)};
+    auto& shared_data = *ConstructSharedData(ring_buffer_address.value(), ring_buffer_size);
+    ConstructBlobArena(shared_data, ring_buffer_size, effective_blob_pool);
+
+    SharedMemoryWriter shared_memory_writer{shared_data, std::move(unmap_callback_), std::move(shared_memory_pool)};
     return shared_memory_writer;
 }
 
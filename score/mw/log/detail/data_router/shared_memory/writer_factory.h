@@ -14,6 +14,7 @@
 #ifndef SCORE_MW_LOG_DETAIL_DATA_ROUTER_SHARED_MEMORY_WRITER_FACTORY_H
 #define SCORE_MW_LOG_DETAIL_DATA_ROUTER_SHARED_MEMORY_WRITER_FACTORY_H
 
+#include "score/mw/log/detail/data_router/shared_memory/shared_memory_pool_factory.h"
 #include "score/mw/log/detail/data_router/shared_memory/shared_memory_writer.h"
 
 #include "score/os/fcntl.h"
@@ -48,6 +49,21 @@ struct LoggingClientFileNameResult
     std::string identifier;
 };
 
+/// \brief Optional large payload arena appended behind the ring buffer. Disabled if any of the values is zero.
+struct BlobPoolConfiguration
+{
+    /*
+    Maintaining compatibility and avoiding performance overhead outweighs POD Type (class) based design for this
+    particular struct. The Type is simple and does not require invariance (interface OR custom behavior) as per the
+    design. Moreover the type is ONLY used internally under the namespace detail and NOT exposed publicly; this is
+    additionally guaranteed by the build system(bazel) visibility
+  */
+    // coverity[autosar_cpp14_m11_0_1_violation]
+    std::size_t number_of_slots{0UL};
+    // coverity[autosar_cpp14_m11_0_1_violation]
+    std::size_t slot_size{0UL};
+};
+
 /// \brief The factory is responsible for creating the shared memory file and instantiating the SharedMemoryWriter
 class WriterFactory
 {
@@ -72,10 +88,15 @@ class WriterFactory
         score::cpp::pmr::unique_ptr<score::os::Stdlib> stdlib{};
     };
 
-    explicit WriterFactory(OsalInstances osal) noexcept;
-    score::cpp::optional<SharedMemoryWriter> Create(const std::size_t ring_buffer_size,
+    /// \param pool_osal Enables borrowing from the shared-memory pool if Datarouter announces one.
+    explicit WriterFactory(OsalInstances osal, SharedMemoryPoolFactory::OsalInstances pool_osal = {}) noexcept;
+
+    /// \param configured_ring_buffer_size Size of the two linear buffers together. Reduced to a quarter if Datarouter
+    /// announces a pool with blocks larger than a linear buffer, as the client borrows pool blocks under load.
+    score::cpp::optional<SharedMemoryWriter> Create(const std::size_t configured_ring_buffer_size,
                                              const bool dynamic_mode,
-                                             const std::string_view app_id) noexcept;
+                                             const std::string_view app_id,
+                                             const BlobPoolConfiguration& blob_pool = {}) noexcept;
 
     std::string GetIdentifier() const noexcept;
     std::string GetFileName() const noexcept;
@@ -91,6 +112,9 @@ class WriterFactory
                                                const std::string& file_name) noexcept;
     bool IsMemoryAligned(void* const ring_buffer_address) noexcept;
     SharedData* ConstructSharedData(void* const ring_buffer_address, const std::size_t ring_buffer_size) const noexcept;
+    void ConstructBlobArena(SharedData& shared_data,
+                            const std::size_t ring_buffer_size,
+                            const BlobPoolConfiguration& blob_pool) const noexcept;
     LoggingClientFileNameResult PrepareFileNameAndUpdateOpenFlags(score::os::Fcntl::Open& file_open_flags,
                                                                   const bool dynamic_mode,
                                                                   const std::string_view app_id) const noexcept;
@@ -99,6 +123,7 @@ class WriterFactory
                                                            const score::os::Fcntl::Open file_open_flags) noexcept;
 
     OsalInstances osal_;
+    SharedMemoryPoolFactory::OsalInstances pool_osal_;
     score::cpp::expected<void*, score::os::Error> mmap_result_;
     UnmapCallback unmap_callback_;
     LoggingClientFileNameResult file_attributes_;
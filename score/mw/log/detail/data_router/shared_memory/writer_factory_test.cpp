@@ -552,8 +552,8 @@ TEST_F(WriterFactoryFixture, MmapReturingImproperAlignedMemoryShallCallUnmapAndR
 TEST_F(WriterFactoryFixture, UnexpectedBufferSizeWithOverflowShallMakeCerrOutput)
 {
     // Tests behavior when ring buffer size causes integer overflow during total size calculation.
-    // Expected size is sizeof(SharedData) which contains
-    const std::size_t expected_shared_data_size = 143;
+    // Expected size is sizeof(SharedData) plus the maximum ring buffer size, which wraps around by one
+    const std::size_t expected_shared_data_size = sizeof(SharedData) - 1UL;
     WriterFactory writer(std::move(osal));
 
     // Step 1: Open shared memory file succeeds
@@ -586,6 +586,70 @@ TEST_F(WriterFactoryFixture, UnexpectedBufferSizeWithOverflowShallMakeCerrOutput
     EXPECT_FALSE(result.has_value());
 }
 
+
+TEST_F(WriterFactoryFixture, OwnRingBufferShallShrinkWhenDatarouterAnnouncesAPool)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description",
+                   "Verifies that a client able to borrow pool blocks larger than its linear buffers maps a smaller "
+                   "ring buffer of its own.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+
+    constexpr auto kConfiguredRingSize = 256UL * 1024UL;
+    constexpr auto kShrunkSharedSize = (kConfiguredRingSize / 4UL) + sizeof(SharedData);
+    SharedPoolHeader pool_header{};
+    pool_header.block_size = kConfiguredRingSize * 2UL;
+    pool_header.number_of_blocks = 1UL;
+
+    auto* memory_resource = score::cpp::pmr::get_default_resource();
+    auto pool_fcntl_mock = score::cpp::pmr::make_unique<score::os::FcntlMock>(memory_resource);
+    auto pool_unistd_mock = score::cpp::pmr::make_unique<score::os::UnistdMock>(memory_resource);
+    auto pool_mman_mock = score::cpp::pmr::make_unique<score::os::MmanMock>(memory_resource);
+    auto pool_stat_mock = score::cpp::pmr::make_unique<score::os::StatMock>(memory_resource);
+    EXPECT_CALL(*pool_unistd_mock, access(StrEq(GetSharedMemoryPoolFileName().data()), _))
+        .WillOnce(Return(score::cpp::expected_blank<score::os::Error>{}));
+    EXPECT_CALL(*pool_fcntl_mock, open(StrEq(GetSharedMemoryPoolFileName().data()), _))
+        .WillOnce(Return(score::cpp::expected<std::int32_t, score::os::Error>{kFileDescriptor}));
+    EXPECT_CALL(*pool_stat_mock, fstat(kFileDescriptor, _))
+        .WillOnce(
+            ::testing::Invoke([](const auto& /*handle*/, auto& stat_buffer) -> score::cpp::expected_blank<score::os::Error> {
+                stat_buffer.st_size = sizeof(SharedPoolHeader);
+                return score::cpp::expected_blank<score::os::Error>{};
+            }));
+    EXPECT_CALL(*pool_mman_mock, mmap(nullptr, sizeof(SharedPoolHeader), _, _, kFileDescriptor, 0))
+        .WillOnce(Return(score::cpp::expected<void*, score::os::Error>{&pool_header}));
+    EXPECT_CALL(*pool_mman_mock, munmap(&pool_header, sizeof(SharedPoolHeader)))
+        .WillOnce(Return(score::cpp::expected_blank<score::os::Error>{}));
+    EXPECT_CALL(*pool_unistd_mock, close(kFileDescriptor))
+        .WillOnce(Return(score::cpp::expected_blank<score::os::Error>{}));
+    SharedMemoryPoolFactory::OsalInstances pool_osal{};
+    pool_osal.fcntl_osal = std::move(pool_fcntl_mock);
+    pool_osal.unistd = std::move(pool_unistd_mock);
+    pool_osal.mman = std::move(pool_mman_mock);
+    pool_osal.stat_osal = std::move(pool_stat_mock);
+
+    WriterFactory writer(std::move(osal), std::move(pool_osal));
+
+    EXPECT_CALL(*fcntl_mock_raw_ptr, open(StrEq(kFileNameDynamic), kOpenReadFlagsDynamic, kOpenModeFlags))
+        .WillOnce(Return(score::cpp::expected<std::int32_t, score::os::Error>{kFileDescriptor}));
+    //  A quarter of the configured ring buffer is mapped.
+    EXPECT_CALL(*unistd_mock_raw_ptr, ftruncate(kFileDescriptor, kShrunkSharedSize))
+        .WillOnce(Return(score::cpp::expected_blank<score::os::Error>{}));
+    EXPECT_CALL(*mman_mock_raw_ptr,
+                mmap(nullptr,
+                     kShrunkSharedSize,
+                     score::os::Mman::Protection::kRead | score::os::Mman::Protection::kWrite,
+                     score::os::Mman::Map::kShared,
+                     kFileDescriptor,
+                     0))
+        .WillOnce(Return(score::cpp::expected<void*, score::os::Error>{nullptr}));
+    EXPECT_CALL(*mman_mock_raw_ptr, munmap(_, kShrunkSharedSize))
+        .WillOnce(Return(score::cpp::expected_blank<score::os::Error>{}));
+
+    EXPECT_FALSE(writer.Create(kConfiguredRingSize, kDynamicTrue, "UTST").has_value());
+}
+
 }  // namespace
 }  // namespace detail
 }  // namespace log
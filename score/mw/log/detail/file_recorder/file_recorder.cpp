@@ -192,6 +192,14 @@ void FileRecorder::Log(const SlotHandle& slot, const LogSlog2Message data) noexc
     LogData(slot, *backend_, data.GetMessage());
 }
 
+bool FileRecorder::LogPacked(const SlotHandle& slot,
+                             const score::cpp::span<const std::uint8_t> arguments,
+                             const std::uint8_t argument_count) noexcept
+{
+    // the caller logs the arguments one by one if not all fit, which then counts the message as too long
+    return DLTFormat::LogPacked(backend_->GetLogRecord(slot), arguments, argument_count) == AddArgumentResult::kAdded;
+}
+
 bool FileRecorder::IsLogEnabled(const LogLevel& log_level, const std::string_view context) const noexcept
 {
     return config_.IsLogLevelEnabled(log_level, context);
@@ -15,6 +15,7 @@
 
 #include "score/mw/log/configuration/configuration.h"
 #include "score/mw/log/detail/backend.h"
+#include "score/mw/log/detail/common/packed_arguments_recorder.h"
 #include "score/mw/log/detail/common/statistics_reporter.h"
 #include "score/mw/log/recorder.h"
 
@@ -27,7 +28,7 @@ namespace log
 namespace detail
 {
 
-class FileRecorder final : public Recorder
+class FileRecorder final : public Recorder, public PackedArgumentsRecorder
 {
   public:
     FileRecorder(const detail::Configuration& config, std::unique_ptr<detail::Backend> backend);
@@ -63,6 +64,10 @@ class FileRecorder final : public Recorder
 
     void Log(const SlotHandle&, const LogSlog2Message) noexcept override;
 
+    bool LogPacked(const SlotHandle& slot,
+                   const score::cpp::span<const std::uint8_t> arguments,
+                   const std::uint8_t argument_count) noexcept override;
+
     bool IsLogEnabled(const LogLevel&, const std::string_view context) const noexcept override;
 
   private:
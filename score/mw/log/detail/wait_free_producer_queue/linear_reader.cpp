@@ -68,6 +68,11 @@ std::optional<score::cpp::span<Byte>> LinearReader::Read() noexcept
     return data_.subspan(static_cast<SpanLength>(payload_offset), static_cast<SpanLength>(length));
 }
 
+bool LinearReader::IsFullyRead() const noexcept
+{
+    return DoBytesFitInRemainingCapacity(data_, read_index_, GetLengthOffsetBytes()) == false;
+}
+
 LinearReader CreateLinearReaderFromControlBlock(const LinearControlBlock& control_block) noexcept
 {
     return CreateLinearReaderFromDataAndLength(control_block.data, control_block.written_index.load());
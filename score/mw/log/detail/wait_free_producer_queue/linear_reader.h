@@ -40,6 +40,9 @@ class LinearReader
     /// \brief Try to read the next available data.
     /// Returns empty if the data is not available.
     std::optional<score::cpp::span<Byte>> Read() noexcept;
+    /// \brief Returns true if no further data can be read, i.e. the next call to Read() would return empty.
+    /// The read index is kept between calls, so reading can be continued at any later point.
+    bool IsFullyRead() const noexcept;
     /// \brief Get size of whole data span which means sum of length encoding headers and payload of each chunk
     Length GetSizeOfWholeDataBuffer() const noexcept;
 
@@ -44,4 +44,31 @@ TEST(LinearReaderTests, LengthExceedingMaxThresholdShouldReturnEmpty)
     ASSERT_FALSE(reader.Read().has_value());
 }
 
+TEST(LinearReaderTests, ReaderShallReportWhenAllEntriesWereRead)
+{
+    RecordProperty("Requirement", "SCR-1016719");
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "The reader shall report whether further entries can be read.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+
+    constexpr score::mw::log::detail::Length kPayloadLength{4U};
+    std::vector<score::mw::log::detail::Byte> buffer(
+        2U * (score::mw::log::detail::GetLengthOffsetBytes() + kPayloadLength));
+    auto data = score::cpp::span<score::mw::log::detail::Byte>(buffer.data(),
+                                                      static_cast<score::mw::log::detail::SpanLength>(buffer.size()));
+    std::ignore = memcpy(buffer.data(), &kPayloadLength, sizeof(kPayloadLength));
+    std::ignore = memcpy(buffer.data() + score::mw::log::detail::GetLengthOffsetBytes() + kPayloadLength,
+                         &kPayloadLength,
+                         sizeof(kPayloadLength));
+
+    score::mw::log::detail::LinearReader reader(data);
+    EXPECT_FALSE(reader.IsFullyRead());
+    EXPECT_TRUE(reader.Read().has_value());
+    EXPECT_FALSE(reader.IsFullyRead());
+    EXPECT_TRUE(reader.Read().has_value());
+    EXPECT_TRUE(reader.IsFullyRead());
+    EXPECT_FALSE(reader.Read().has_value());
+}
+
 }  // namespace
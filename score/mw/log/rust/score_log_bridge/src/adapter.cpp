@@ -11,9 +11,14 @@
  * SPDX-License-Identifier: Apache-2.0
  ********************************************************************************/
 
+#include "score/mw/log/detail/common/packed_arguments_recorder.h"
 #include "score/mw/log/runtime.h"
 #include "score/mw/log/slot_handle.h"
 
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+
 using namespace score::mw::log;
 using namespace score::mw::log::detail;
 
@@ -31,10 +36,192 @@ static_assert(alignof(SlotHandle) == 8);
 #error "Unknown configuration, unable to check layout"
 #endif
 
+namespace {
+// DLT verbose type info bits, see `dlt_format.cpp` (PRS_Dlt_00625, PRS_Dlt_00354, PRS_Dlt_00783).
+// Must be kept in sync with `ffi.rs`.
+constexpr uint32_t kTypeLengthMask{0x0FU};
+constexpr uint32_t kTypeLength8Bit{0x01U};
+constexpr uint32_t kTypeLength16Bit{0x02U};
+constexpr uint32_t kTypeLength32Bit{0x03U};
+constexpr uint32_t kTypeLength64Bit{0x04U};
+constexpr uint32_t kTypeBoolBit{1U << 4U};
+constexpr uint32_t kTypeSignedBit{1U << 5U};
+constexpr uint32_t kTypeUnsignedBit{1U << 6U};
+constexpr uint32_t kTypeFloatBit{1U << 7U};
+constexpr uint32_t kTypeStringBit{1U << 9U};
+constexpr uint32_t kRepresentationShift{15U};
+constexpr uint32_t kRepresentationMask{0x07U};
+constexpr uint32_t kRepresentationBase16{0x02U};
+constexpr uint32_t kRepresentationBase2{0x03U};
+
+/// @brief Sequential reader over arguments packed by `ffi.rs`.
+class PackedReader {
+  public:
+    PackedReader(const uint8_t* data, size_t size) : data_{data}, size_{size}, offset_{0} {}
+
+    bool IsEmpty() const { return offset_ >= size_; }
+
+    template <typename T>
+    bool Read(T& value) {
+        if (size_ - offset_ < sizeof(T)) {
+            return false;
+        }
+        std::memcpy(&value, data_ + offset_, sizeof(T));
+        offset_ += sizeof(T);
+        return true;
+    }
+
+    bool Read(std::string_view& value, size_t size) {
+        if (size_ - offset_ < size) {
+            return false;
+        }
+        value = std::string_view{reinterpret_cast<const char*>(data_ + offset_), size};
+        offset_ += size;
+        return true;
+    }
+
+  private:
+    const uint8_t* data_;
+    size_t size_;
+    size_t offset_;
+};
+
+template <typename T>
+bool LogValue(Recorder* recorder, SlotHandle& slot, PackedReader& reader) {
+    T value{};
+    if (!reader.Read(value)) {
+        return false;
+    }
+    recorder->Log(slot, value);
+    return true;
+}
+
+template <typename T, typename Hex, typename Bin>
+bool LogUnsigned(Recorder* recorder, SlotHandle& slot, PackedReader& reader, uint32_t representation) {
+    T value{};
+    if (!reader.Read(value)) {
+        return false;
+    }
+    if (representation == kRepresentationBase16) {
+        recorder->Log(slot, Hex{value});
+    } else if (representation == kRepresentationBase2) {
+        recorder->Log(slot, Bin{value});
+    } else {
+        recorder->Log(slot, value);
+    }
+    return true;
+}
+
+/// @brief Log a single packed argument.
+/// @return `false` if argument is malformed or truncated.
+bool LogPackedArgument(Recorder* recorder, SlotHandle& slot, PackedReader& reader) {
+    uint32_t type_info{};
+    if (!reader.Read(type_info)) {
+        return false;
+    }
+    const uint32_t length{type_info & kTypeLengthMask};
+    const uint32_t representation{(type_info >> kRepresentationShift) & kRepresentationMask};
+
+    if ((type_info & kTypeStringBit) != 0U) {
+        uint16_t length_incl_null{};
+        std::string_view value{};
+        if (!reader.Read(length_incl_null) || (length_incl_null == 0U) || !reader.Read(value, length_incl_null)) {
+            return false;
+        }
+        recorder->Log(slot, value.substr(0U, value.size() - 1U));
+        return true;
+    }
+    if ((type_info & kTypeBoolBit) != 0U) {
+        uint8_t value{};
+        if (!reader.Read(value)) {
+            return false;
+        }
+        recorder->Log(slot, value != 0U);
+        return true;
+    }
+    if ((type_info & kTypeFloatBit) != 0U) {
+        switch (length) {
+            case kTypeLength32Bit:
+                return LogValue<float>(recorder, slot, reader);
+            case kTypeLength64Bit:
+                return LogValue<double>(recorder, slot, reader);
+            default:
+                return false;
+        }
+    }
+    if ((type_info & kTypeSignedBit) != 0U) {
+        switch (length) {
+            case kTypeLength8Bit:
+                return LogValue<int8_t>(recorder, slot, reader);
+            case kTypeLength16Bit:
+                return LogValue<int16_t>(recorder, slot, reader);
+            case kTypeLength32Bit:
+                return LogValue<int32_t>(recorder, slot, reader);
+            case kTypeLength64Bit:
+                return LogValue<int64_t>(recorder, slot, reader);
+            default:
+                return false;
+        }
+    }
+    if ((type_info & kTypeUnsignedBit) != 0U) {
+        switch (length) {
+            case kTypeLength8Bit:
+                return LogUnsigned<uint8_t, LogHex8, LogBin8>(recorder, slot, reader, representation);
+            case kTypeLength16Bit:
+                return LogUnsigned<uint16_t, LogHex16, LogBin16>(recorder, slot, reader, representation);
+            case kTypeLength32Bit:
+                return LogUnsigned<uint32_t, LogHex32, LogBin32>(recorder, slot, reader, representation);
+            case kTypeLength64Bit:
+                return LogUnsigned<uint64_t, LogHex64, LogBin64>(recorder, slot, reader, representation);
+            default:
+                return false;
+        }
+    }
+    return false;
+}
+
+void LogPackedArguments(Recorder* recorder, PackedArgumentsRecorder* packed_recorder, SlotHandle& slot,
+                        const uint8_t* data, size_t size, uint8_t count) {
+    if (size == 0U) {
+        return;
+    }
+    // Copied into the slot at once, unless not all arguments fit.
+    if ((packed_recorder != nullptr) &&
+        packed_recorder->LogPacked(slot, score::cpp::span<const uint8_t>{data, size}, count)) {
+        return;
+    }
+
+    PackedReader reader{data, size};
+    // Stop on first malformed argument, the rest of the buffer cannot be interpreted.
+    while (!reader.IsEmpty() && LogPackedArgument(recorder, slot, reader)) {
+    }
+}
+
+// Incremented on log level configuration changes.
+// Read directly by `ffi.rs` to invalidate cached log levels, must stay lock-free and `uint64_t`-sized.
+std::atomic<uint64_t> log_level_epoch{0U};
+static_assert(std::atomic<uint64_t>::is_always_lock_free);
+static_assert(sizeof(std::atomic<uint64_t>) == sizeof(uint64_t));
+
+// Recorder handed out last, a replaced recorder carries another log level configuration.
+std::atomic<const Recorder*> last_recorder{nullptr};
+}  // namespace
+
 extern "C" {
+/// @brief Notify that log levels changed.
+/// Log levels cached by Rust are queried again on next use.
+void recorder_log_level_changed() { log_level_epoch.fetch_add(1U, std::memory_order_release); }
+
 /// @brief Get current recorder from runtime.
+/// Log levels cached for a previous recorder are queried again.
 /// @return Current recorder.
-Recorder* recorder_get() { return &Runtime::GetRecorder(); }
+Recorder* recorder_get() {
+    Recorder* recorder{&Runtime::GetRecorder()};
+    if (last_recorder.exchange(recorder, std::memory_order_relaxed) != recorder) {
+        recorder_log_level_changed();
+    }
+    return recorder;
+}
 
 /// @brief Start recording log message.
 /// @param recorder     Recorder.
@@ -73,33 +260,41 @@ LogLevel recorder_log_level(const Recorder* recorder, const char* context, size_
     return LogLevel::kOff;
 }
 
-/// @brief Stop recording log message.
-/// @param recorder Recorder.
-/// @param slot     Acquired slot.
-void recorder_stop(Recorder* recorder, SlotHandle* slot) { recorder->StopRecord(*slot); }
+/// @brief Get log level epoch.
+/// @return Epoch counter, valid for the lifetime of the process.
+const std::atomic<uint64_t>* recorder_log_level_epoch() { return &log_level_epoch; }
 
-/// @brief Add bool value to message.
+/// @brief Get interface of recorder taking packed values at once.
 /// @param recorder Recorder.
-/// @param slot     Acquired slot.
-/// @param value    Value.
-void log_bool(Recorder* recorder, SlotHandle* slot, const bool* value) {
-    recorder->Log(*slot, *value);
+/// @return `nullptr` if values must be added one by one.
+PackedArgumentsRecorder* recorder_packed(Recorder* recorder) {
+    return dynamic_cast<PackedArgumentsRecorder*>(recorder);
 }
 
-/// @brief Add f32 value to message.
-/// @param recorder Recorder.
-/// @param slot     Acquired slot.
-/// @param value    Value.
-void log_f32(Recorder* recorder, SlotHandle* slot, const float* value) {
-    recorder->Log(*slot, *value);
+/// @brief Add packed values to message and stop recording it.
+/// @param recorder        Recorder.
+/// @param packed_recorder Result of `recorder_packed` for `recorder`.
+/// @param slot            Acquired slot.
+/// @param data            Values serialized by `ffi.rs` in DLT verbose format.
+/// @param size            Number of bytes in `data`.
+/// @param count           Number of values in `data`.
+void recorder_stop_packed(Recorder* recorder, PackedArgumentsRecorder* packed_recorder, SlotHandle* slot,
+                          const uint8_t* data, size_t size, uint8_t count) {
+    LogPackedArguments(recorder, packed_recorder, *slot, data, size, count);
+    recorder->StopRecord(*slot);
 }
 
-/// @brief Add f64 value to message.
-/// @param recorder Recorder.
-/// @param slot     Acquired slot.
-/// @param value    Value.
-void log_f64(Recorder* recorder, SlotHandle* slot, const double* value) {
-    recorder->Log(*slot, *value);
+/// @brief Add packed values to message.
+/// Values are added in a single call instead of one call per value.
+/// @param recorder        Recorder.
+/// @param packed_recorder Result of `recorder_packed` for `recorder`.
+/// @param slot            Acquired slot.
+/// @param data            Values serialized by `ffi.rs` in DLT verbose format.
+/// @param size            Number of bytes in `data`.
+/// @param count           Number of values in `data`.
+void log_packed(Recorder* recorder, PackedArgumentsRecorder* packed_recorder, SlotHandle* slot, const uint8_t* data,
+                size_t size, uint8_t count) {
+    LogPackedArguments(recorder, packed_recorder, *slot, data, size, count);
 }
 
 /// @brief Add string value to message.
@@ -110,134 +305,6 @@ void log_string(Recorder* recorder, SlotHandle* slot, const char* value, size_t
     recorder->Log(*slot, std::string_view{value, size});
 }
 
-/// @brief Add i8 value to message.
-/// @param recorder Recorder.
-/// @param slot     Acquired slot.
-/// @param value    Value.
-void log_i8(Recorder* recorder, SlotHandle* slot, const int8_t* value) {
-    recorder->Log(*slot, *value);
-}
-
-/// @brief Add i16 value to message.
-/// @param recorder Recorder.
-/// @param slot     Acquired slot.
-/// @param value    Value.
-void log_i16(Recorder* recorder, SlotHandle* slot, const int16_t* value) {
-    recorder->Log(*slot, *value);
-}
-
-/// @brief Add i32 value to message.
-/// @param recorder Recorder.
-/// @param slot     Acquired slot.
-/// @param value    Value.
-void log_i32(Recorder* recorder, SlotHandle* slot, const int32_t* value) {
-    recorder->Log(*slot, *value);
-}
-
-/// @brief Add i64 value to message.
-/// @param recorder Recorder.
-/// @param slot     Acquired slot.
-/// @param value    Value.
-void log_i64(Recorder* recorder, SlotHandle* slot, const int64_t* value) {
-    recorder->Log(*slot, *value);
-}
-
-/// @brief Add u8 value to message.
-/// @param recorder Recorder.
-/// @param slot     Acquired slot.
-/// @param value    Value.
-void log_u8(Recorder* recorder, SlotHandle* slot, const uint8_t* value) {
-    recorder->Log(*slot, *value);
-}
-
-/// @brief Add u16 value to message.
-/// @param recorder Recorder.
-/// @param slot     Acquired slot.
-/// @param value    Value.
-void log_u16(Recorder* recorder, SlotHandle* slot, const uint16_t* value) {
-    recorder->Log(*slot, *value);
-}
-
-/// @brief Add u32 value to message.
-/// @param recorder Recorder.
-/// @param slot     Acquired slot.
-/// @param value    Value.
-void log_u32(Recorder* recorder, SlotHandle* slot, const uint32_t* value) {
-    recorder->Log(*slot, *value);
-}
-
-/// @brief Add u64 value to message.
-/// @param recorder Recorder.
-/// @param slot     Acquired slot.
-/// @param value    Value.
-void log_u64(Recorder* recorder, SlotHandle* slot, const uint64_t* value) {
-    recorder->Log(*slot, *value);
-}
-
-/// @brief Add 8-bit binary value to message.
-/// @param recorder Recorder.
-/// @param slot     Acquired slot.
-/// @param value    Value.
-void log_bin8(Recorder* recorder, SlotHandle* slot, const uint8_t* value) {
-    recorder->Log(*slot, LogBin8{*value});
-}
-
-/// @brief Add 16-bit binary value to message.
-/// @param recorder Recorder.
-/// @param slot     Acquired slot.
-/// @param value    Value.
-void log_bin16(Recorder* recorder, SlotHandle* slot, const uint16_t* value) {
-    recorder->Log(*slot, LogBin16{*value});
-}
-
-/// @brief Add 32-bit binary value to message.
-/// @param recorder Recorder.
-/// @param slot     Acquired slot.
-/// @param value    Value.
-void log_bin32(Recorder* recorder, SlotHandle* slot, const uint32_t* value) {
-    recorder->Log(*slot, LogBin32{*value});
-}
-
-/// @brief Add 64-bit binary value to message.
-/// @param recorder Recorder.
-/// @param slot     Acquired slot.
-/// @param value    Value.
-void log_bin64(Recorder* recorder, SlotHandle* slot, const uint64_t* value) {
-    recorder->Log(*slot, LogBin64{*value});
-}
-
-/// @brief Add 8-bit hexadecimal value to message.
-/// @param recorder Recorder.
-/// @param slot     Acquired slot.
-/// @param value    Value.
-void log_hex8(Recorder* recorder, SlotHandle* slot, const uint8_t* value) {
-    recorder->Log(*slot, LogHex8{*value});
-}
-
-/// @brief Add 16-bit hexadecimal value to message.
-/// @param recorder Recorder.
-/// @param slot     Acquired slot.
-/// @param value    Value.
-void log_hex16(Recorder* recorder, SlotHandle* slot, const uint16_t* value) {
-    recorder->Log(*slot, LogHex16{*value});
-}
-
-/// @brief Add 32-bit hexadecimal value to message.
-/// @param recorder Recorder.
-/// @param slot     Acquired slot.
-/// @param value    Value.
-void log_hex32(Recorder* recorder, SlotHandle* slot, const uint32_t* value) {
-    recorder->Log(*slot, LogHex32{*value});
-}
-
-/// @brief Add 64-bit hexadecimal value to message.
-/// @param recorder Recorder.
-/// @param slot     Acquired slot.
-/// @param value    Value.
-void log_hex64(Recorder* recorder, SlotHandle* slot, const uint64_t* value) {
-    recorder->Log(*slot, LogHex64{*value});
-}
-
 /// @brief Get size of `SlotHandle`.
 /// @return Size.
 size_t slot_handle_size() { return sizeof(SlotHandle); }
@@ -13,12 +13,13 @@
 use core::alloc::Layout;
 use core::cmp::min;
 use core::ffi::c_char;
-use core::mem::transmute;
+use core::mem::size_of;
 use core::slice::from_raw_parts;
+use core::sync::atomic::AtomicU64;
 use score_log::fmt::{DisplayHint, Error, FormatSpec, Result as FmtResult, ScoreWrite};
 
 /// Represents severity of a log message.
-#[derive(PartialEq, Eq, PartialOrd, Ord, Debug)]
+#[derive(Clone, Copy, PartialEq, Eq, PartialOrd, Ord, Debug)]
 #[repr(u8)]
 pub enum LogLevel {
     #[allow(dead_code)]
@@ -112,6 +113,18 @@ impl From<&str> for Context {
     }
 }
 
+impl Context {
+    /// Pack name and its size into an integer uniquely identifying the context.
+    /// Only lower 35 bits are used.
+    pub fn key(&self) -> u64 {
+        let mut bytes = [0u8; 4];
+        for (byte, value) in bytes.iter_mut().zip(self.data) {
+            *byte = value as u8;
+        }
+        u64::from(u32::from_le_bytes(bytes)) | ((self.size as u64) << 32)
+    }
+}
+
 impl From<&Context> for &str {
     fn from(value: &Context) -> Self {
         // SAFETY:
@@ -138,9 +151,17 @@ struct RecorderPtr {
     _private: [u8; 0],
 }
 
+/// Opaque type representing `PackedArgumentsRecorder`.
+#[repr(C)]
+struct PackedRecorderPtr {
+    _private: [u8; 0],
+}
+
 /// Recorder instance.
 pub struct Recorder {
     ptr: *mut RecorderPtr,
+    /// Interface of the same recorder taking packed arguments at once, null if not implemented.
+    packed: *mut PackedRecorderPtr,
 }
 
 impl Recorder {
@@ -154,13 +175,23 @@ impl Recorder {
         // SAFETY: Recorder must be available. Null indicates lack of proper initialization.
         let ptr = unsafe { recorder_get() };
         assert!(!ptr.is_null(), "recorder is not properly initialized");
-        Self { ptr }
+        // SAFETY: FFI call. `ptr` is checked above.
+        let packed = unsafe { recorder_packed(ptr) };
+        Self { ptr, packed }
     }
 
     pub fn log_level(&self, context: &Context) -> LogLevel {
         // SAFETY: FFI call. Validity of provided objects checked elsewhere.
         unsafe { recorder_log_level(self.ptr, context.data.as_ptr(), context.size) }
     }
+
+    /// Counter incremented by C++ on log level configuration changes.
+    pub fn log_level_epoch(&self) -> &'static AtomicU64 {
+        // SAFETY:
+        // Parameter-less FFI call returning a non-null pointer to a static `std::atomic<uint64_t>`.
+        // Lock-free `std::atomic<uint64_t>` has the same in-memory representation as `AtomicU64`.
+        unsafe { &*recorder_log_level_epoch().cast::<AtomicU64>() }
+    }
 }
 
 // SAFETY:
@@ -216,12 +247,104 @@ impl Default for SlotHandleStorage {
     }
 }
 
+/// DLT verbose type info bits, see `dlt_format.cpp` (PRS_Dlt_00625, PRS_Dlt_00354, PRS_Dlt_00783).
+/// Must be kept in sync with `adapter.cpp`.
+mod type_info {
+    pub const LENGTH_8BIT: u32 = 0x01;
+    pub const LENGTH_16BIT: u32 = 0x02;
+    pub const LENGTH_32BIT: u32 = 0x03;
+    pub const LENGTH_64BIT: u32 = 0x04;
+    pub const BOOL: u32 = 1 << 4;
+    pub const SIGNED: u32 = 1 << 5;
+    pub const UNSIGNED: u32 = 1 << 6;
+    pub const FLOAT: u32 = 1 << 7;
+    pub const STRING: u32 = 1 << 9;
+    pub const ENCODING_UTF8: u32 = 0x01 << 15;
+    pub const REPRESENTATION_BASE16: u32 = 0x02 << 15;
+    pub const REPRESENTATION_BASE2: u32 = 0x03 << 15;
+}
+
+/// Capacity of the stack buffer holding packed arguments of a single log message.
+const PACKED_ARGUMENTS_CAPACITY: usize = 512;
+
+/// Arguments of a log message serialized in DLT verbose format.
+/// Values are stored in native byte order, as they never leave the process before being parsed by `adapter.cpp`.
+struct PackedArguments {
+    data: [u8; PACKED_ARGUMENTS_CAPACITY],
+    size: usize,
+    count: u8,
+}
+
+impl PackedArguments {
+    fn new() -> Self {
+        Self {
+            data: [0; _],
+            size: 0,
+            count: 0,
+        }
+    }
+
+    fn as_slice(&self) -> &[u8] {
+        &self.data[..self.size]
+    }
+
+    fn is_empty(&self) -> bool {
+        self.size == 0
+    }
+
+    fn clear(&mut self) {
+        self.size = 0;
+        self.count = 0;
+    }
+
+    fn fits(&self, size: usize) -> bool {
+        size <= PACKED_ARGUMENTS_CAPACITY - self.size && self.count < u8::MAX
+    }
+
+    fn put(&mut self, bytes: &[u8]) {
+        self.data[self.size..self.size + bytes.len()].copy_from_slice(bytes);
+        self.size += bytes.len();
+    }
+
+    /// Adds an argument with fixed size value.
+    /// Returns `false` if argument doesn't fit into remaining space.
+    fn push_value(&mut self, type_info: u32, value: &[u8]) -> bool {
+        if !self.fits(size_of::<u32>() + value.len()) {
+            return false;
+        }
+        self.put(&type_info.to_ne_bytes());
+        self.put(value);
+        self.count += 1;
+        true
+    }
+
+    /// Adds a null-terminated string argument.
+    /// Returns `false` if argument doesn't fit into remaining space.
+    fn push_str(&mut self, value: &str) -> bool {
+        let length_incl_null = match u16::try_from(value.len() + 1) {
+            Ok(length) => length,
+            Err(_) => return false,
+        };
+        if !self.fits(size_of::<u32>() + size_of::<u16>() + usize::from(length_incl_null)) {
+            return false;
+        }
+        self.put(&(type_info::STRING | type_info::ENCODING_UTF8).to_ne_bytes());
+        self.put(&length_incl_null.to_ne_bytes());
+        self.put(value.as_bytes());
+        self.put(&[0]);
+        self.count += 1;
+        true
+    }
+}
+
 /// Single log message.
 /// Adds values to the log message with selected formatting.
+/// Values are collected on stack and passed to the recorder in a single call.
 /// Message is flushed on drop.
 pub struct LogMessage<'a> {
     recorder: &'a Recorder,
     slot: SlotHandleStorage,
+    arguments: PackedArguments,
 }
 
 impl<'a> LogMessage<'a> {
@@ -248,193 +371,130 @@ impl<'a> LogMessage<'a> {
             return Err(());
         }
 
-        Ok(Self { recorder, slot })
+        Ok(Self {
+            recorder,
+            slot,
+            arguments: PackedArguments::new(),
+        })
+    }
+
+    /// Pass collected arguments to the recorder.
+    fn flush_arguments(&mut self) {
+        if self.arguments.is_empty() {
+            return;
+        }
+
+        let data = self.arguments.as_slice();
+        // SAFETY: FFI call. Data is passed as pointer and number of bytes.
+        unsafe {
+            log_packed(
+                self.recorder.ptr,
+                self.recorder.packed,
+                self.slot.as_mut_ptr(),
+                data.as_ptr(),
+                data.len(),
+                self.arguments.count,
+            );
+        }
+        self.arguments.clear();
+    }
+
+    fn write_value(&mut self, type_info: u32, value: &[u8]) {
+        if !self.arguments.push_value(type_info, value) {
+            // Fixed size values always fit into an empty buffer.
+            self.flush_arguments();
+            let _ = self.arguments.push_value(type_info, value);
+        }
+    }
+
+    fn write_integer(&mut self, signed: bool, length: u32, value: &[u8], spec: &FormatSpec) -> FmtResult {
+        // Hexadecimal and binary representations are defined for unsigned values only.
+        let type_info = match spec.get_display_hint() {
+            DisplayHint::NoHint if signed => type_info::SIGNED | length,
+            DisplayHint::NoHint => type_info::UNSIGNED | length,
+            DisplayHint::LowerHex | DisplayHint::UpperHex => {
+                type_info::UNSIGNED | length | type_info::REPRESENTATION_BASE16
+            },
+            DisplayHint::Binary => type_info::UNSIGNED | length | type_info::REPRESENTATION_BASE2,
+            _ => return Err(Error),
+        };
+        self.write_value(type_info, value);
+        Ok(())
     }
 }
 
 impl ScoreWrite for LogMessage<'_> {
     #[inline]
     fn write_bool(&mut self, v: &bool, _spec: &FormatSpec) -> FmtResult {
-        // SAFETY: FFI call. Reference is reinterpreted as a pointer of the same type.
-        unsafe { log_bool(self.recorder.ptr, self.slot.as_mut_ptr(), v as *const _) };
+        self.write_value(type_info::BOOL | type_info::LENGTH_8BIT, &[u8::from(*v)]);
         Ok(())
     }
 
     #[inline]
     fn write_f32(&mut self, v: &f32, _spec: &FormatSpec) -> FmtResult {
-        // SAFETY: FFI call. Reference is reinterpreted as a pointer of the same type.
-        unsafe { log_f32(self.recorder.ptr, self.slot.as_mut_ptr(), v as *const _) };
+        self.write_value(type_info::FLOAT | type_info::LENGTH_32BIT, &v.to_ne_bytes());
         Ok(())
     }
 
     #[inline]
     fn write_f64(&mut self, v: &f64, _spec: &FormatSpec) -> FmtResult {
-        // SAFETY: FFI call. Reference is reinterpreted as a pointer of the same type.
-        unsafe { log_f64(self.recorder.ptr, self.slot.as_mut_ptr(), v as *const _) };
+        self.write_value(type_info::FLOAT | type_info::LENGTH_64BIT, &v.to_ne_bytes());
         Ok(())
     }
 
     #[inline]
     fn write_i8(&mut self, v: &i8, spec: &FormatSpec) -> FmtResult {
-        // SAFETY: FFI calls. Reference is reinterpreted as a pointer of the same type.
-        match spec.get_display_hint() {
-            DisplayHint::NoHint => unsafe { log_i8(self.recorder.ptr, self.slot.as_mut_ptr(), v as *const _) },
-            DisplayHint::LowerHex | DisplayHint::UpperHex => {
-                // SAFETY: source and destination types are of the same length.
-                unsafe {
-                    let v: &u8 = transmute(v);
-                    log_hex8(self.recorder.ptr, self.slot.as_mut_ptr(), v as *const _);
-                }
-            },
-            DisplayHint::Binary => {
-                // SAFETY: source and destination types are of the same length.
-                unsafe {
-                    let v: &u8 = transmute(v);
-                    log_bin8(self.recorder.ptr, self.slot.as_mut_ptr(), v as *const _);
-                }
-            },
-            _ => return Err(Error),
-        }
-        Ok(())
+        self.write_integer(true, type_info::LENGTH_8BIT, &v.to_ne_bytes(), spec)
     }
 
     #[inline]
     fn write_i16(&mut self, v: &i16, spec: &FormatSpec) -> FmtResult {
-        // SAFETY: FFI calls. Reference is reinterpreted as a pointer of the same type.
-        match spec.get_display_hint() {
-            DisplayHint::NoHint => unsafe { log_i16(self.recorder.ptr, self.slot.as_mut_ptr(), v as *const _) },
-            DisplayHint::LowerHex | DisplayHint::UpperHex => {
-                // SAFETY: source and destination types are of the same length.
-                unsafe {
-                    let v: &u16 = transmute(v);
-                    log_hex16(self.recorder.ptr, self.slot.as_mut_ptr(), v as *const _);
-                }
-            },
-            DisplayHint::Binary => {
-                // SAFETY: source and destination types are of the same length.
-                unsafe {
-                    let v: &u16 = transmute(v);
-                    log_bin16(self.recorder.ptr, self.slot.as_mut_ptr(), v as *const _);
-                }
-            },
-            _ => return Err(Error),
-        }
-        Ok(())
+        self.write_integer(true, type_info::LENGTH_16BIT, &v.to_ne_bytes(), spec)
     }
 
     #[inline]
     fn write_i32(&mut self, v: &i32, spec: &FormatSpec) -> FmtResult {
-        // SAFETY: FFI calls. Reference is reinterpreted as a pointer of the same type.
-        match spec.get_display_hint() {
-            DisplayHint::NoHint => unsafe { log_i32(self.recorder.ptr, self.slot.as_mut_ptr(), v as *const _) },
-            DisplayHint::LowerHex | DisplayHint::UpperHex => {
-                // SAFETY: source and destination types are of the same length.
-                unsafe {
-                    let v: &u32 = transmute(v);
-                    log_hex32(self.recorder.ptr, self.slot.as_mut_ptr(), v as *const _);
-                }
-            },
-            DisplayHint::Binary => {
-                // SAFETY: source and destination types are of the same length.
-                unsafe {
-                    let v: &u32 = transmute(v);
-                    log_bin32(self.recorder.ptr, self.slot.as_mut_ptr(), v as *const _);
-                }
-            },
-            _ => return Err(Error),
-        }
-        Ok(())
+        self.write_integer(true, type_info::LENGTH_32BIT, &v.to_ne_bytes(), spec)
     }
 
     #[inline]
     fn write_i64(&mut self, v: &i64, spec: &FormatSpec) -> FmtResult {
-        // SAFETY: FFI calls. Reference is reinterpreted as a pointer of the same type.
-        match spec.get_display_hint() {
-            DisplayHint::NoHint => unsafe { log_i64(self.recorder.ptr, self.slot.as_mut_ptr(), v as *const _) },
-            DisplayHint::LowerHex | DisplayHint::UpperHex => {
-                // SAFETY: source and destination types are of the same length.
-                unsafe {
-                    let v: &u64 = transmute(v);
-                    log_hex64(self.recorder.ptr, self.slot.as_mut_ptr(), v as *const _);
-                }
-            },
-            DisplayHint::Binary => {
-                // SAFETY: source and destination types are of the same length.
-                unsafe {
-                    let v: &u64 = transmute(v);
-                    log_bin64(self.recorder.ptr, self.slot.as_mut_ptr(), v as *const _);
-                }
-            },
-            _ => return Err(Error),
-        }
-        Ok(())
+        self.write_integer(true, type_info::LENGTH_64BIT, &v.to_ne_bytes(), spec)
     }
 
     #[inline]
     fn write_u8(&mut self, v: &u8, spec: &FormatSpec) -> FmtResult {
-        // SAFETY: FFI calls. Reference is reinterpreted as a pointer of the same type.
-        match spec.get_display_hint() {
-            DisplayHint::NoHint => unsafe { log_u8(self.recorder.ptr, self.slot.as_mut_ptr(), v as *const _) },
-            DisplayHint::LowerHex | DisplayHint::UpperHex => unsafe {
-                log_hex8(self.recorder.ptr, self.slot.as_mut_ptr(), v as *const _)
-            },
-            DisplayHint::Binary => unsafe { log_bin8(self.recorder.ptr, self.slot.as_mut_ptr(), v as *const _) },
-            _ => return Err(Error),
-        }
-        Ok(())
+        self.write_integer(false, type_info::LENGTH_8BIT, &v.to_ne_bytes(), spec)
     }
 
     #[inline]
     fn write_u16(&mut self, v: &u16, spec: &FormatSpec) -> FmtResult {
-        // SAFETY: FFI calls. Reference is reinterpreted as a pointer of the same type.
-        match spec.get_display_hint() {
-            DisplayHint::NoHint => unsafe { log_u16(self.recorder.ptr, self.slot.as_mut_ptr(), v as *const _) },
-            DisplayHint::LowerHex | DisplayHint::UpperHex => unsafe {
-                log_hex16(self.recorder.ptr, self.slot.as_mut_ptr(), v as *const _)
-            },
-            DisplayHint::Binary => unsafe { log_bin16(self.recorder.ptr, self.slot.as_mut_ptr(), v as *const _) },
-            _ => return Err(Error),
-        }
-        Ok(())
+        self.write_integer(false, type_info::LENGTH_16BIT, &v.to_ne_bytes(), spec)
     }
 
     #[inline]
     fn write_u32(&mut self, v: &u32, spec: &FormatSpec) -> FmtResult {
-        // SAFETY: FFI calls. Reference is reinterpreted as a pointer of the same type.
-        match spec.get_display_hint() {
-            DisplayHint::NoHint => unsafe { log_u32(self.recorder.ptr, self.slot.as_mut_ptr(), v as *const _) },
-            DisplayHint::LowerHex | DisplayHint::UpperHex => unsafe {
-                log_hex32(self.recorder.ptr, self.slot.as_mut_ptr(), v as *const _)
-            },
-            DisplayHint::Binary => unsafe { log_bin32(self.recorder.ptr, self.slot.as_mut_ptr(), v as *const _) },
-            _ => return Err(Error),
-        }
-        Ok(())
+        self.write_integer(false, type_info::LENGTH_32BIT, &v.to_ne_bytes(), spec)
     }
 
     #[inline]
     fn write_u64(&mut self, v: &u64, spec: &FormatSpec) -> FmtResult {
-        // SAFETY: FFI calls. Reference is reinterpreted as a pointer of the same type.
-        match spec.get_display_hint() {
-            DisplayHint::NoHint => unsafe { log_u64(self.recorder.ptr, self.slot.as_mut_ptr(), v as *const _) },
-            DisplayHint::LowerHex | DisplayHint::UpperHex => unsafe {
-                log_hex64(self.recorder.ptr, self.slot.as_mut_ptr(), v as *const _)
-            },
-            DisplayHint::Binary => unsafe { log_bin64(self.recorder.ptr, self.slot.as_mut_ptr(), v as *const _) },
-            _ => return Err(Error),
-        }
-        Ok(())
+        self.write_integer(false, type_info::LENGTH_64BIT, &v.to_ne_bytes(), spec)
     }
 
     #[inline]
     fn write_str(&mut self, v: &str, _spec: &FormatSpec) -> FmtResult {
-        // Get string as pointer and size.
-        let v_ptr = v.as_ptr().cast();
-        let v_size = v.len();
+        if self.arguments.push_str(v) {
+            return Ok(());
+        }
 
-        // SAFETY: FFI call. String is reinterpreted into `c_char` pointer and number of bytes.
-        unsafe {
-            log_string(self.recorder.ptr, self.slot.as_mut_ptr(), v_ptr, v_size);
+        // Retry with empty buffer, pass string directly if still too long.
+        self.flush_arguments();
+        if !self.arguments.push_str(v) {
+            // SAFETY: FFI call. String is reinterpreted into `c_char` pointer and number of bytes.
+            unsafe {
+                log_string(self.recorder.ptr, self.slot.as_mut_ptr(), v.as_ptr().cast(), v.len());
+            }
         }
         Ok(())
     }
@@ -442,9 +502,18 @@ impl ScoreWrite for LogMessage<'_> {
 
 impl Drop for LogMessage<'_> {
     fn drop(&mut self) {
+        let data = self.arguments.as_slice();
         // SAFETY: FFI call. Validity of objects is checked elsewhere.
+        // Remaining arguments are passed together with stopping the record.
         unsafe {
-            recorder_stop(self.recorder.ptr, self.slot.as_mut_ptr());
+            recorder_stop_packed(
+                self.recorder.ptr,
+                self.recorder.packed,
+                self.slot.as_mut_ptr(),
+                data.as_ptr(),
+                data.len(),
+                self.arguments.count,
+            );
         }
     }
 }
@@ -458,35 +527,34 @@ unsafe extern "C" {
         log_level: LogLevel,
         slot: *mut SlotHandleStorage,
     ) -> *mut SlotHandleStorage;
-    fn recorder_stop(recorder: *mut RecorderPtr, slot: *mut SlotHandleStorage);
+    fn recorder_packed(recorder: *mut RecorderPtr) -> *mut PackedRecorderPtr;
+    fn recorder_stop_packed(
+        recorder: *mut RecorderPtr,
+        packed_recorder: *mut PackedRecorderPtr,
+        slot: *mut SlotHandleStorage,
+        data: *const u8,
+        size: usize,
+        count: u8,
+    );
     fn recorder_log_level(recorder: *const RecorderPtr, context: *const c_char, context_size: usize) -> LogLevel;
-    fn log_bool(recorder: *mut RecorderPtr, slot: *mut SlotHandleStorage, value: *const bool);
-    fn log_f32(recorder: *mut RecorderPtr, slot: *mut SlotHandleStorage, value: *const f32);
-    fn log_f64(recorder: *mut RecorderPtr, slot: *mut SlotHandleStorage, value: *const f64);
+    fn recorder_log_level_epoch() -> *const u64;
+    fn log_packed(
+        recorder: *mut RecorderPtr,
+        packed_recorder: *mut PackedRecorderPtr,
+        slot: *mut SlotHandleStorage,
+        data: *const u8,
+        size: usize,
+        count: u8,
+    );
     fn log_string(recorder: *mut RecorderPtr, slot: *mut SlotHandleStorage, value: *const c_char, size: usize);
-    fn log_i8(recorder: *mut RecorderPtr, slot: *mut SlotHandleStorage, value: *const i8);
-    fn log_i16(recorder: *mut RecorderPtr, slot: *mut SlotHandleStorage, value: *const i16);
-    fn log_i32(recorder: *mut RecorderPtr, slot: *mut SlotHandleStorage, value: *const i32);
-    fn log_i64(recorder: *mut RecorderPtr, slot: *mut SlotHandleStorage, value: *const i64);
-    fn log_u8(recorder: *mut RecorderPtr, slot: *mut SlotHandleStorage, value: *const u8);
-    fn log_u16(recorder: *mut RecorderPtr, slot: *mut SlotHandleStorage, value: *const u16);
-    fn log_u32(recorder: *mut RecorderPtr, slot: *mut SlotHandleStorage, value: *const u32);
-    fn log_u64(recorder: *mut RecorderPtr, slot: *mut SlotHandleStorage, value: *const u64);
-    fn log_bin8(recorder: *mut RecorderPtr, slot: *mut SlotHandleStorage, value: *const u8);
-    fn log_bin16(recorder: *mut RecorderPtr, slot: *mut SlotHandleStorage, value: *const u16);
-    fn log_bin32(recorder: *mut RecorderPtr, slot: *mut SlotHandleStorage, value: *const u32);
-    fn log_bin64(recorder: *mut RecorderPtr, slot: *mut SlotHandleStorage, value: *const u64);
-    fn log_hex8(recorder: *mut RecorderPtr, slot: *mut SlotHandleStorage, value: *const u8);
-    fn log_hex16(recorder: *mut RecorderPtr, slot: *mut SlotHandleStorage, value: *const u16);
-    fn log_hex32(recorder: *mut RecorderPtr, slot: *mut SlotHandleStorage, value: *const u32);
-    fn log_hex64(recorder: *mut RecorderPtr, slot: *mut SlotHandleStorage, value: *const u64);
     fn slot_handle_size() -> usize;
     fn slot_handle_alignment() -> usize;
 }
 
 #[cfg(test)]
 mod tests {
-    use crate::ffi::{Context, LogLevel};
+    use core::mem::size_of;
+    use crate::ffi::{type_info, Context, LogLevel, PackedArguments, PACKED_ARGUMENTS_CAPACITY};
 
     #[test]
     fn test_log_level_from_score_log_level() {
@@ -558,9 +626,58 @@ mod tests {
         assert_eq!(context.data, [116, 114, 105, 109]);
     }
 
+    #[test]
+    fn test_context_key() {
+        assert_eq!(Context::from("TEST").key(), 0x4_5453_4554);
+        assert_eq!(Context::from("").key(), 0);
+        assert_ne!(Context::from("X").key(), Context::from("X\0").key());
+    }
+
     #[test]
     #[should_panic(expected = "provided context contains non-ASCII characters: ")]
     fn test_context_non_ascii() {
         let _ = Context::from("❌");
     }
+
+    #[test]
+    fn test_packed_arguments_value() {
+        let mut arguments = PackedArguments::new();
+        assert!(arguments.is_empty());
+        assert!(arguments.push_value(type_info::UNSIGNED | type_info::LENGTH_16BIT, &0x1234u16.to_ne_bytes()));
+        assert_eq!(arguments.count, 1);
+
+        let mut expected = Vec::new();
+        expected.extend_from_slice(&0x42u32.to_ne_bytes());
+        expected.extend_from_slice(&0x1234u16.to_ne_bytes());
+        assert_eq!(arguments.as_slice(), expected.as_slice());
+    }
+
+    #[test]
+    fn test_packed_arguments_string() {
+        let mut arguments = PackedArguments::new();
+        assert!(arguments.push_str("abc"));
+
+        let mut expected = Vec::new();
+        expected.extend_from_slice(&0x8200u32.to_ne_bytes());
+        expected.extend_from_slice(&4u16.to_ne_bytes());
+        expected.extend_from_slice(b"abc\0");
+        assert_eq!(arguments.as_slice(), expected.as_slice());
+    }
+
+    #[test]
+    fn test_packed_arguments_full() {
+        let mut arguments = PackedArguments::new();
+        let value = 0u64.to_ne_bytes();
+        let argument_size = size_of::<u32>() + value.len();
+        for _ in 0..PACKED_ARGUMENTS_CAPACITY / argument_size {
+            assert!(arguments.push_value(type_info::UNSIGNED | type_info::LENGTH_64BIT, &value));
+        }
+        assert!(!arguments.push_value(type_info::UNSIGNED | type_info::LENGTH_64BIT, &value));
+
+        arguments.clear();
+        assert!(arguments.is_empty());
+        assert_eq!(arguments.count, 0);
+        assert!(!arguments.push_str(&"x".repeat(PACKED_ARGUMENTS_CAPACITY)));
+        assert!(arguments.is_empty());
+    }
 }
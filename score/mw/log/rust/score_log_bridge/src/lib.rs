@@ -18,6 +18,7 @@
 #![warn(clippy::alloc_instead_of_core)]
 
 mod ffi;
+mod log_level_cache;
 mod score_log_bridge;
 
 pub use crate::score_log_bridge::{ScoreLogBridge, ScoreLogBridgeBuilder};
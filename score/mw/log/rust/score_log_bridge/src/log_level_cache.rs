@@ -0,0 +1,212 @@
+// *******************************************************************************
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// <https://www.apache.org/licenses/LICENSE-2.0>
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+//! Rust-side cache of per-context log levels.
+
+use crate::ffi::{Context, LogLevel};
+use core::sync::atomic::{fence, AtomicU64, Ordering};
+
+/// Number of cached contexts, power of two.
+const NUMBER_OF_SLOTS: usize = 64;
+
+// Entry layout:
+// - bits 0..35  - `Context::key()`
+// - bit 35      - slot occupied
+// - bits 36..39 - log level
+// - bit 63      - slot being written
+const KEY_MASK: u64 = (1 << 36) - 1;
+const OCCUPIED: u64 = 1 << 35;
+const LEVEL_SHIFT: u32 = 36;
+const LEVEL_MASK: u64 = 0x07;
+const BUSY: u64 = 1 << 63;
+
+/// Cached log level of a context and the epoch it was resolved in.
+///
+/// The whole epoch is kept next to the entry, so that it never wraps.
+/// Writers mark the entry busy while writing the epoch, readers check the entry is unchanged after reading it.
+struct Slot {
+    entry: AtomicU64,
+    epoch: AtomicU64,
+}
+
+impl Slot {
+    const fn new() -> Self {
+        Self {
+            entry: AtomicU64::new(0),
+            epoch: AtomicU64::new(0),
+        }
+    }
+
+    /// Epoch of `entry`, if the slot still holds it.
+    fn epoch_of(&self, entry: u64) -> Option<u64> {
+        let epoch = self.epoch.load(Ordering::Relaxed);
+        // Pairs with the fence of `store`, a newer epoch is only read along with the busy or a newer entry.
+        fence(Ordering::Acquire);
+        (self.entry.load(Ordering::Relaxed) == entry).then_some(epoch)
+    }
+
+    /// Replace `entry`, unless another thread changed it in the meantime.
+    fn store(&self, entry: u64, new_entry: u64, epoch: u64) {
+        if self
+            .entry
+            .compare_exchange(entry, BUSY, Ordering::Relaxed, Ordering::Relaxed)
+            .is_ok()
+        {
+            fence(Ordering::Release);
+            self.epoch.store(epoch, Ordering::Relaxed);
+            self.entry.store(new_entry, Ordering::Release);
+        }
+    }
+}
+
+/// Effective log level per context, resolved once per epoch.
+///
+/// Lookup is lock-free and does not cross the FFI boundary while the epoch is unchanged.
+/// C++ increments the epoch on log level configuration changes, which invalidates all entries.
+/// If all slots are taken by other contexts, or a slot is being written, the level is resolved on every call.
+pub struct LogLevelCache {
+    epoch: &'static AtomicU64,
+    slots: [Slot; NUMBER_OF_SLOTS],
+}
+
+impl LogLevelCache {
+    /// Create empty cache invalidated by `epoch`.
+    pub fn new(epoch: &'static AtomicU64) -> Self {
+        Self {
+            epoch,
+            slots: [const { Slot::new() }; NUMBER_OF_SLOTS],
+        }
+    }
+
+    /// Get log level for `context`, calling `resolve` if not cached for current epoch.
+    pub fn get(&self, context: &Context, resolve: impl FnOnce() -> LogLevel) -> LogLevel {
+        // Acquire pairs with the C++ increment, `resolve` observes configuration of this epoch or newer.
+        let epoch = self.epoch.load(Ordering::Acquire);
+        let key = context.key() | OCCUPIED;
+        let start = (key.wrapping_mul(0x9E37_79B9_7F4A_7C15) >> 32) as usize;
+
+        for offset in 0..NUMBER_OF_SLOTS {
+            let slot = &self.slots[(start + offset) % NUMBER_OF_SLOTS];
+            // Acquire pairs with the release of `Slot::store`, the epoch read is the one of `entry` or newer.
+            let entry = slot.entry.load(Ordering::Acquire);
+            if entry & BUSY != 0 {
+                return resolve();
+            }
+            if entry != 0 && (entry & KEY_MASK) != key {
+                continue;
+            }
+            if entry != 0 && slot.epoch_of(entry) == Some(epoch) {
+                return decode_level(entry);
+            }
+
+            // Empty or outdated slot.
+            // Losing the race to another thread only skips caching, entry is not duplicated.
+            let level = resolve();
+            slot.store(entry, key | (level as u64) << LEVEL_SHIFT, epoch);
+            return level;
+        }
+
+        resolve()
+    }
+}
+
+fn decode_level(entry: u64) -> LogLevel {
+    match (entry >> LEVEL_SHIFT) & LEVEL_MASK {
+        0x01 => LogLevel::Fatal,
+        0x02 => LogLevel::Error,
+        0x03 => LogLevel::Warn,
+        0x04 => LogLevel::Info,
+        0x05 => LogLevel::Debug,
+        0x06 => LogLevel::Verbose,
+        _ => LogLevel::Off,
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use crate::ffi::{Context, LogLevel};
+    use crate::log_level_cache::{LogLevelCache, NUMBER_OF_SLOTS};
+    use core::cell::Cell;
+    use core::sync::atomic::{AtomicU64, Ordering};
+
+    fn new_cache() -> (&'static AtomicU64, LogLevelCache) {
+        let epoch: &'static AtomicU64 = Box::leak(Box::new(AtomicU64::new(0)));
+        (epoch, LogLevelCache::new(epoch))
+    }
+
+    #[test]
+    fn test_resolved_once_per_epoch() {
+        let (epoch, cache) = new_cache();
+        let context = Context::from("TEST");
+        let calls = Cell::new(0);
+        let resolve = |level| {
+            calls.set(calls.get() + 1);
+            level
+        };
+
+        assert_eq!(cache.get(&context, || resolve(LogLevel::Info)), LogLevel::Info);
+        assert_eq!(cache.get(&context, || resolve(LogLevel::Verbose)), LogLevel::Info);
+        assert_eq!(calls.get(), 1);
+
+        epoch.fetch_add(1, Ordering::Release);
+        assert_eq!(cache.get(&context, || resolve(LogLevel::Verbose)), LogLevel::Verbose);
+        assert_eq!(cache.get(&context, || resolve(LogLevel::Info)), LogLevel::Verbose);
+        assert_eq!(calls.get(), 2);
+    }
+
+    #[test]
+    fn test_epoch_does_not_wrap() {
+        let (epoch, cache) = new_cache();
+        let context = Context::from("WRAP");
+        assert_eq!(cache.get(&context, || LogLevel::Info), LogLevel::Info);
+
+        // Lower bits of the epoch are unchanged.
+        epoch.fetch_add(1 << 40, Ordering::Release);
+        assert_eq!(cache.get(&context, || LogLevel::Debug), LogLevel::Debug);
+        assert_eq!(cache.get(&context, || panic!("level not cached")), LogLevel::Debug);
+    }
+
+    #[test]
+    fn test_contexts_cached_separately() {
+        let (_, cache) = new_cache();
+        let levels = [LogLevel::Off, LogLevel::Fatal, LogLevel::Error, LogLevel::Warn, LogLevel::Debug];
+        let contexts = ["", "A", "AB", "ABC", "ABCD"].map(Context::from);
+
+        for (context, level) in contexts.iter().zip(levels) {
+            assert_eq!(cache.get(context, || level), level);
+        }
+        for (context, level) in contexts.iter().zip(levels) {
+            assert_eq!(cache.get(context, || panic!("level not cached")), level);
+        }
+    }
+
+    #[test]
+    fn test_full_cache_resolves_every_time() {
+        let (_, cache) = new_cache();
+        for index in 0..NUMBER_OF_SLOTS {
+            let name = format!("{index:04}");
+            let _ = cache.get(&Context::from(name.as_str()), || LogLevel::Info);
+        }
+
+        let context = Context::from("FULL");
+        let calls = Cell::new(0);
+        for _ in 0..2 {
+            let level = cache.get(&context, || {
+                calls.set(calls.get() + 1);
+                LogLevel::Debug
+            });
+            assert_eq!(level, LogLevel::Debug);
+        }
+        assert_eq!(calls.get(), 2);
+    }
+}
@@ -14,6 +14,7 @@
 //! C++-based logger implementation
 
 use crate::ffi::{Context, LogLevel, LogMessage, Recorder, SlotHandleStorage};
+use crate::log_level_cache::LogLevelCache;
 use score_log::fmt::{score_write, write};
 use score_log::{Log, Metadata, Record};
 use std::env::{set_var, var_os};
@@ -80,12 +81,14 @@ impl ScoreLogBridgeBuilder {
     /// Build the [`ScoreLogBridge`] with provided context and configuration.
     pub fn build(self) -> ScoreLogBridge {
         let recorder = Recorder::new();
+        let log_level_cache = LogLevelCache::new(recorder.log_level_epoch());
         ScoreLogBridge {
             context: self.context,
             show_module: self.show_module,
             show_file: self.show_file,
             show_line: self.show_line,
             recorder,
+            log_level_cache,
         }
     }
 
@@ -160,12 +163,14 @@ pub struct ScoreLogBridge {
     show_file: bool,
     show_line: bool,
     recorder: Recorder,
+    log_level_cache: LogLevelCache,
 }
 
 impl ScoreLogBridge {
     /// Current log level for provided context.
+    /// Queried from C++ only once per context until log levels change.
     pub(crate) fn log_level(&self, context: &Context) -> LogLevel {
-        self.recorder.log_level(context)
+        self.log_level_cache.get(context, || self.recorder.log_level(context))
     }
 }
 
@@ -19,6 +19,8 @@ extern "C" void set_default_logger(const char* context_ptr,
                                    const bool* show_file,
                                    const bool* show_line);
 
+extern "C" void recorder_log_level_changed();
+
 namespace score::mw::log::rust
 {
 
@@ -62,6 +64,13 @@ void ScoreLogBridgeBuilder::SetAsDefaultLogger() noexcept
     const bool* show_line{show_line_ ? &show_line_.value() : nullptr};
 
     set_default_logger(context_ptr, context_size, show_module, show_file, show_line);
+    // the logging configuration is applied to Rust now, levels cached for the previous one are outdated
+    NotifyLogLevelChanged();
+}
+
+void NotifyLogLevelChanged() noexcept
+{
+    recorder_log_level_changed();
 }
 
 }  // namespace score::mw::log::rust
@@ -62,4 +62,11 @@ class ScoreLogBridgeBuilder final
     std::optional<bool> show_line_;
 };
 
+/// @brief Notify Rust loggers that log level configuration changed.
+///
+/// @note
+/// Rust loggers cache log level per context.
+/// Must be called after log levels are changed at runtime, otherwise Rust keeps using previous levels.
+void NotifyLogLevelChanged() noexcept;
+
 }  // namespace score::mw::log::rust
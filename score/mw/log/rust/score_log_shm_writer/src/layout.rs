@@ -0,0 +1,128 @@
+// *******************************************************************************
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// <https://www.apache.org/licenses/LICENSE-2.0>
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+//! Shared-memory layout of a logging client.
+//!
+//! Objects in this module mirror the C++ definitions from
+//! `score/mw/log/detail/wait_free_producer_queue` and `score/mw/log/detail/data_router/shared_memory/common.h`.
+//! Any change on either side must be reflected on the other side, conformance tests check both are in sync.
+
+use core::mem::size_of;
+use core::sync::atomic::{AtomicBool, AtomicU32, AtomicU64};
+
+/// Length type used for indexes and sizes in shared memory.
+pub type Length = u64;
+
+/// Identifier of a registered type.
+pub type TypeIdentifier = u16;
+
+/// Each entry in a linear buffer consists of a length prefix followed by payload.
+pub const LENGTH_OFFSET_BYTES: Length = size_of::<Length>() as Length;
+
+/// Upper bound of a single acquisition to avoid index overflows.
+pub const MAX_ACQUIRE_LENGTH_BYTES: Length = 128 * 1024 * 1024;
+
+/// Maximum number of writers concurrently accessing a linear buffer.
+pub const MAX_NUMBER_OF_CONCURRENT_WRITERS: Length = 64;
+
+/// Maximum value of `acquired_index` that is still safe to be incremented.
+pub const MAX_LINEAR_BUFFER_CAPACITY_BYTES: Length =
+    Length::MAX - MAX_NUMBER_OF_CONCURRENT_WRITERS * (MAX_ACQUIRE_LENGTH_BYTES + LENGTH_OFFSET_BYTES);
+
+/// Max size of a DLT v1 message excluding the header.
+pub const MAX_PAYLOAD_SIZE: Length = 65500;
+
+/// Type identifier of entries carrying a type registration.
+pub const REGISTER_TYPE_TOKEN: TypeIdentifier = TypeIdentifier::MAX;
+
+/// Marks a linear buffer that uses the memory of the client ring buffer instead of a shared-memory pool block.
+pub const NO_POOL_BLOCK_INDEX: u32 = u32::MAX;
+
+/// Layout of `score::cpp::span<Byte>`.
+/// Only `size` is evaluated by Datarouter, `data` is an address in the writer address space.
+#[repr(C)]
+pub struct Span {
+    pub data: *mut u8,
+    pub size: u64,
+}
+
+/// Layout of `LinearControlBlock`.
+#[repr(C)]
+pub struct LinearControlBlock {
+    pub data: Span,
+    pub acquired_index: AtomicU64,
+    pub written_index: AtomicU64,
+    pub number_of_writers: AtomicU64,
+}
+
+/// Layout of `AlternatingControlBlock`.
+#[repr(C)]
+pub struct AlternatingControlBlock {
+    pub control_block_even: LinearControlBlock,
+    pub control_block_odd: LinearControlBlock,
+    /// Odd value selects `control_block_odd` for writing, even value selects `control_block_even`.
+    pub switch_count_points_active_for_writing: AtomicU32,
+}
+
+/// Layout of `SharedData`, placed at the beginning of the shared-memory file.
+#[repr(C)]
+pub struct SharedData {
+    pub control_block: AlternatingControlBlock,
+    pub linear_buffer_1_offset: Length,
+    pub linear_buffer_2_offset: Length,
+    pub number_of_drops_buffer_full: AtomicU64,
+    pub size_of_drops_buffer_full: AtomicU64,
+    pub number_of_drops_invalid_size: AtomicU64,
+    pub number_of_drops_type_registration_failed: AtomicU64,
+    pub writer_detached: AtomicBool,
+    pub producer_pid: i32,
+    pub blob_arena: Span,
+    pub blob_arena_offset: Length,
+    pub blob_slot_size: Length,
+    pub pool_block_index_even: AtomicU32,
+    pub pool_block_index_odd: AtomicU32,
+}
+
+/// Layout of `BufferEntryHeader`, prepended in front of each entry in the ring buffer.
+#[repr(C)]
+#[derive(Clone, Copy, Debug, PartialEq, Eq)]
+pub struct BufferEntryHeader {
+    /// Nanoseconds of the steady clock.
+    pub time_stamp: i64,
+    pub type_identifier: TypeIdentifier,
+}
+
+/// Layout of `ReadAcquireResult`.
+#[repr(C)]
+#[derive(Clone, Copy, Debug, PartialEq, Eq)]
+pub struct ReadAcquireResult {
+    pub acquired_buffer: u32,
+    /// Number of additional pool blocks the client asks Datarouter to grant.
+    pub requested_pool_blocks: u8,
+    /// Bit per slot of the pool blocks the client hands back.
+    pub returned_pool_blocks: u8,
+}
+
+// Verify configuration at compile time.
+// Expected sizes are cross-checked against C++ in conformance tests.
+#[cfg(target_pointer_width = "64")]
+const _: () = {
+    assert!(size_of::<LinearControlBlock>() == 40);
+    assert!(size_of::<AlternatingControlBlock>() == 88);
+    assert!(size_of::<SharedData>() == 184);
+    assert!(size_of::<BufferEntryHeader>() == 16);
+    assert!(size_of::<ReadAcquireResult>() == 8);
+};
+
+#[cfg(not(target_pointer_width = "64"))]
+compile_error!("Unknown configuration, unable to check layout");
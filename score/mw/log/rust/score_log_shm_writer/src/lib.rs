@@ -0,0 +1,35 @@
+// *******************************************************************************
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// <https://www.apache.org/licenses/LICENSE-2.0>
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+//! Native Rust client side of the Datarouter shared-memory protocol.
+//!
+//! Writes into the same shared-memory layout as the C++ `SharedMemoryWriter` without linking `mw::log`.
+//! Serialization of log entries is up to the user: payloads are written as opaque bytes
+//! for the type identifiers returned by `SharedMemoryWriter::try_register_type()`.
+
+#![warn(missing_docs)]
+#![warn(clippy::std_instead_of_core)]
+#![warn(clippy::alloc_instead_of_core)]
+
+#[allow(missing_docs)]
+pub mod layout;
+mod message_client;
+mod shared_memory_writer;
+#[allow(missing_docs)]
+mod wait_free_writer;
+
+pub use crate::message_client::{
+    serialize_acquire_response, ConnectMessage, DatarouterClient, MessageIdentifier, MessageSender,
+    DATAROUTER_RECEIVER_IDENTIFIER, MAX_MESSAGE_SIZE,
+};
+pub use crate::shared_memory_writer::{LoggingClientFileName, SharedMemoryWriter};
@@ -0,0 +1,275 @@
+// *******************************************************************************
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// <https://www.apache.org/licenses/LICENSE-2.0>
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+//! Client side of the Datarouter connect/acquire exchange.
+//!
+//! Port of `DatarouterMessageClientImpl` message handling. Messages are defined in `data_router_messages.h`,
+//! constants in `message_passing_config.h`. Transport is provided by the user with `MessageSender`.
+
+use crate::layout::ReadAcquireResult;
+use crate::shared_memory_writer::{unlink, SharedMemoryWriter};
+use core::mem::size_of;
+use std::io::Result;
+use std::sync::Arc;
+
+/// Maximum message size in bytes (1 byte for message ID + 16 bytes for payload).
+pub const MAX_MESSAGE_SIZE: usize = 17;
+
+/// The Datarouter receiver endpoint identifier.
+pub const DATAROUTER_RECEIVER_IDENTIFIER: &str = "/logging.datarouter_recv";
+
+/// Start index of random part in the dynamic shared-memory file name.
+const RANDOM_FILENAME_START_INDEX: usize = 13;
+
+/// Layout of `DatarouterMessageIdentifier`.
+#[derive(Clone, Copy, Debug, PartialEq, Eq)]
+#[repr(u8)]
+pub enum MessageIdentifier {
+    /// Client announces its shared-memory file.
+    Connect = 0x00,
+    /// Datarouter requests switching the buffers.
+    AcquireRequest = 0x01,
+    /// Client replies with the buffer to be read.
+    AcquireResponse = 0x02,
+}
+
+/// Layout of `ConnectMessageFromClient`.
+#[derive(Clone, Copy, Debug, Default, PartialEq, Eq)]
+#[repr(C)]
+pub struct ConnectMessage {
+    /// Application identifier, zero padded.
+    pub app_id: [u8; 4],
+    /// User id of the client process.
+    pub uid: u32,
+    /// Selects dynamic shared-memory file name.
+    pub use_dynamic_identifier: bool,
+    /// Random part of the dynamic shared-memory file name.
+    pub random_part: [u8; 6],
+}
+
+impl ConnectMessage {
+    /// Serializes message prefixed with `MessageIdentifier::Connect`.
+    pub fn serialize(&self) -> [u8; size_of::<ConnectMessage>() + 1] {
+        let mut message = [0; _];
+        message[0] = MessageIdentifier::Connect as u8;
+        message[1..5].copy_from_slice(&self.app_id);
+        message[5..9].copy_from_slice(&self.uid.to_ne_bytes());
+        message[9] = u8::from(self.use_dynamic_identifier);
+        message[10..16].copy_from_slice(&self.random_part);
+        message
+    }
+}
+
+/// Serializes read acquire result prefixed with `MessageIdentifier::AcquireResponse`.
+pub fn serialize_acquire_response(result: &ReadAcquireResult) -> [u8; size_of::<ReadAcquireResult>() + 1] {
+    let mut message = [0; _];
+    message[0] = MessageIdentifier::AcquireResponse as u8;
+    message[1..5].copy_from_slice(&result.acquired_buffer.to_ne_bytes());
+    message[5] = result.requested_pool_blocks;
+    message[6] = result.returned_pool_blocks;
+    message
+}
+
+/// Transport sending messages to `DATAROUTER_RECEIVER_IDENTIFIER`.
+pub trait MessageSender {
+    /// Sends a single message, retries are up to the implementation.
+    fn send(&mut self, message: &[u8]) -> Result<()>;
+}
+
+/// Client side of the Datarouter protocol.
+///
+/// Usage:
+/// - create a receiver endpoint named `receiver_identifier()` and a sender to `DATAROUTER_RECEIVER_IDENTIFIER`,
+/// - call `connect()`,
+/// - call `on_acquire_request()` for each message received on the receiver endpoint.
+///
+/// The shared-memory file is unlinked on the first acquire request, on error and on drop.
+/// Datarouter keeps the mapping and logging continues.
+pub struct DatarouterClient<S: MessageSender> {
+    writer: Arc<SharedMemoryWriter>,
+    sender: S,
+    app_id: [u8; 4],
+    uid: u32,
+    use_dynamic_identifier: bool,
+    first_message_received: bool,
+    unlinked_shared_memory_file: bool,
+}
+
+impl<S: MessageSender> DatarouterClient<S> {
+    /// Creates client for the writer.
+    /// `use_dynamic_identifier` shall match the mode the writer was created with.
+    pub fn new(writer: Arc<SharedMemoryWriter>, sender: S, app_id: &str, use_dynamic_identifier: bool) -> Self {
+        let mut app_id_bytes = [0; 4];
+        let size = app_id.len().min(app_id_bytes.len());
+        app_id_bytes[..size].copy_from_slice(&app_id.as_bytes()[..size]);
+        Self {
+            writer,
+            sender,
+            app_id: app_id_bytes,
+            // SAFETY: parameter-less FFI call.
+            uid: unsafe { libc::getuid() },
+            use_dynamic_identifier,
+            first_message_received: false,
+            unlinked_shared_memory_file: false,
+        }
+    }
+
+    /// Name of the receiver endpoint Datarouter sends acquire requests to.
+    pub fn receiver_identifier(&self) -> String {
+        format!("/{}", self.writer.file_name().identifier)
+    }
+
+    /// Connect message announcing the shared-memory file.
+    pub fn connect_message(&self) -> ConnectMessage {
+        let mut message = ConnectMessage {
+            app_id: self.app_id,
+            uid: self.uid,
+            use_dynamic_identifier: self.use_dynamic_identifier,
+            random_part: [0; 6],
+        };
+        let file_name = self.writer.file_name().file_name.as_bytes();
+        if self.use_dynamic_identifier && file_name.len() > RANDOM_FILENAME_START_INDEX + message.random_part.len() + 1
+        {
+            message
+                .random_part
+                .copy_from_slice(&file_name[RANDOM_FILENAME_START_INDEX..][..6]);
+        }
+        message
+    }
+
+    /// Sends the connect message.
+    pub fn connect(&mut self) -> Result<()> {
+        let message = self.connect_message().serialize();
+        self.send(&message)
+    }
+
+    /// Handles acquire request from Datarouter and sends the response.
+    pub fn on_acquire_request(&mut self) -> Result<()> {
+        // The acquire request is the first message Datarouter sends to the client.
+        if !self.first_message_received {
+            self.first_message_received = true;
+            self.unlink_shared_memory_file();
+        }
+        let message = serialize_acquire_response(&self.writer.read_acquire());
+        self.send(&message)
+    }
+
+    fn send(&mut self, message: &[u8]) -> Result<()> {
+        let result = self.sender.send(message);
+        if result.is_err() {
+            // Datarouter is assumed to be gone, avoid leaking the file.
+            self.unlink_shared_memory_file();
+        }
+        result
+    }
+
+    fn unlink_shared_memory_file(&mut self) {
+        if self.unlinked_shared_memory_file {
+            return;
+        }
+        self.unlinked_shared_memory_file = true;
+        unlink(&self.writer.file_name().file_name);
+    }
+}
+
+impl<S: MessageSender> Drop for DatarouterClient<S> {
+    fn drop(&mut self) {
+        self.unlink_shared_memory_file();
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use std::io::Error;
+    use std::path::Path;
+
+    #[derive(Default)]
+    struct RecordingSender {
+        messages: Vec<Vec<u8>>,
+        fail: bool,
+    }
+
+    impl MessageSender for &mut RecordingSender {
+        fn send(&mut self, message: &[u8]) -> Result<()> {
+            if self.fail {
+                return Err(Error::other("send failed"));
+            }
+            self.messages.push(message.to_vec());
+            Ok(())
+        }
+    }
+
+    #[test]
+    fn test_connect_message_serialize() {
+        let message = ConnectMessage {
+            app_id: *b"APP\0",
+            uid: 0x01020304,
+            use_dynamic_identifier: true,
+            random_part: *b"abcdef",
+        };
+        let bytes = message.serialize();
+        assert_eq!(bytes.len(), MAX_MESSAGE_SIZE);
+        assert_eq!(bytes[0], MessageIdentifier::Connect as u8);
+        assert_eq!(&bytes[1..5], b"APP\0");
+        assert_eq!(&bytes[5..9], &0x01020304u32.to_ne_bytes());
+        assert_eq!(bytes[9], 1);
+        assert_eq!(&bytes[10..16], b"abcdef");
+    }
+
+    #[test]
+    fn test_acquire_request_exchange() {
+        let writer = Arc::new(SharedMemoryWriter::create(1024, true, "APP").expect("create failed"));
+        let file_name = writer.file_name().clone();
+        let mut sender = RecordingSender::default();
+        let mut client = DatarouterClient::new(writer, &mut sender, "APPLICATION", true);
+
+        assert_eq!(client.receiver_identifier(), format!("/{}", file_name.identifier));
+        let connect = client.connect_message();
+        assert_eq!(&connect.app_id, b"APPL");
+        assert_eq!(&connect.random_part, &file_name.identifier.as_bytes()["logging-".len()..]);
+
+        client.connect().expect("connect failed");
+        assert!(Path::new(&file_name.file_name).exists());
+        client.on_acquire_request().expect("acquire failed");
+        assert!(!Path::new(&file_name.file_name).exists());
+        client.on_acquire_request().expect("acquire failed");
+        drop(client);
+
+        assert_eq!(sender.messages.len(), 3);
+        let expected = |acquired_buffer: u32| {
+            serialize_acquire_response(&ReadAcquireResult {
+                acquired_buffer,
+                requested_pool_blocks: 0,
+                returned_pool_blocks: 0,
+            })
+            .to_vec()
+        };
+        assert_eq!(sender.messages[1], expected(1));
+        assert_eq!(sender.messages[2], expected(2));
+        assert_eq!(sender.messages[1][0], MessageIdentifier::AcquireResponse as u8);
+    }
+
+    #[test]
+    fn test_send_failure_unlinks_file() {
+        let writer = Arc::new(SharedMemoryWriter::create(1024, true, "APP").expect("create failed"));
+        let file_name = writer.file_name().file_name.clone();
+        let mut sender = RecordingSender {
+            fail: true,
+            ..Default::default()
+        };
+        let mut client = DatarouterClient::new(writer, &mut sender, "APP", true);
+        assert!(client.connect().is_err());
+        assert!(!Path::new(&file_name).exists());
+    }
+}
@@ -0,0 +1,425 @@
+// *******************************************************************************
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// <https://www.apache.org/licenses/LICENSE-2.0>
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+//! Port of `SharedMemoryWriter` and `WriterFactory`.
+
+use crate::layout::{
+    BufferEntryHeader, Length, ReadAcquireResult, SharedData, Span, TypeIdentifier, MAX_PAYLOAD_SIZE,
+    NO_POOL_BLOCK_INDEX, REGISTER_TYPE_TOKEN,
+};
+use crate::wait_free_writer::{acquire, release, switch};
+use core::mem::size_of;
+use core::ptr::{copy_nonoverlapping, null_mut, write_bytes};
+use core::slice::from_raw_parts_mut;
+use core::sync::atomic::{AtomicU16, AtomicU32, Ordering};
+use std::ffi::CString;
+use std::io::{Error, Result};
+
+/// Permissions of the shared-memory file, read-only for everyone, Datarouter maps it for reading.
+const FILE_MODE: libc::mode_t = libc::S_IRUSR | libc::S_IRGRP | libc::S_IROTH;
+
+/// Directory of shared-memory files.
+const FILE_DIRECTORY: &str = "/tmp/";
+
+/// Suffix of shared-memory files.
+const FILE_SUFFIX: &str = ".shmem";
+
+/// Steady clock timestamp in nanoseconds.
+fn now() -> i64 {
+    let mut time = libc::timespec { tv_sec: 0, tv_nsec: 0 };
+    // SAFETY: FFI call with valid pointer. `CLOCK_MONOTONIC` is always available.
+    unsafe { libc::clock_gettime(libc::CLOCK_MONOTONIC, &mut time) };
+    time.tv_sec * 1_000_000_000 + time.tv_nsec
+}
+
+/// Name and identifier of the shared-memory file.
+#[derive(Clone, Debug, PartialEq, Eq)]
+pub struct LoggingClientFileName {
+    /// Full path of the file.
+    pub file_name: String,
+    /// Identifier announced to Datarouter, file name without directory and suffix.
+    pub identifier: String,
+}
+
+impl LoggingClientFileName {
+    /// Deterministic file name, used if Datarouter doesn't use dynamic identifiers.
+    pub fn from_app_id(app_id: &str, uid: u32) -> Self {
+        let identifier = format!("logging.{app_id}.{uid}");
+        Self {
+            file_name: format!("{FILE_DIRECTORY}{identifier}{FILE_SUFFIX}"),
+            identifier,
+        }
+    }
+}
+
+/// Writes log entries into the shared-memory file read by Datarouter.
+///
+/// Before a type is traced with `alloc_and_write()` it shall be registered with `try_register_type()`.
+/// Blob arena and shared-memory pool are not supported, Datarouter treats them as disabled.
+pub struct SharedMemoryWriter {
+    address: *mut u8,
+    map_size: usize,
+    shared_data: *mut SharedData,
+    type_identifier: AtomicU16,
+    file_name: LoggingClientFileName,
+}
+
+// SAFETY: all accesses to shared memory are either atomic or on memory exclusively acquired by the wait-free writer.
+unsafe impl Send for SharedMemoryWriter {}
+
+// SAFETY: see `Send`. `read_acquire()` is documented to be called from a single thread.
+unsafe impl Sync for SharedMemoryWriter {}
+
+impl SharedMemoryWriter {
+    /// Creates the shared-memory file, maps it and places `SharedData` with two linear buffers
+    /// of `ring_buffer_size / 2` bytes each.
+    ///
+    /// `dynamic_mode` selects a random file name, otherwise the name is derived from `app_id` and user id.
+    pub fn create(ring_buffer_size: usize, dynamic_mode: bool, app_id: &str) -> Result<Self> {
+        let (file_descriptor, file_name) = if dynamic_mode {
+            create_dynamic_file()?
+        } else {
+            // SAFETY: parameter-less FFI call.
+            let uid = unsafe { libc::getuid() };
+            create_static_file(LoggingClientFileName::from_app_id(app_id, uid))?
+        };
+
+        let map_size = size_of::<SharedData>()
+            .checked_add(ring_buffer_size)
+            .ok_or_else(|| Error::from_raw_os_error(libc::EOVERFLOW))?;
+        let address = match map_file(file_descriptor, map_size) {
+            Ok(address) => address,
+            Err(error) => {
+                unlink(&file_name.file_name);
+                return Err(error);
+            },
+        };
+
+        // SAFETY: `address` is a fresh mapping of `map_size` bytes, aligned to page size.
+        unsafe { Ok(Self::from_raw_parts(address, map_size, ring_buffer_size, file_name)) }
+    }
+
+    /// Constructs `SharedData` in the provided memory.
+    ///
+    /// # Safety
+    ///
+    /// `address` must point to a writable mapping of `map_size` bytes, aligned for `SharedData`,
+    /// and `map_size` must be at least `size_of::<SharedData>() + ring_buffer_size`.
+    /// The mapping is unmapped on drop.
+    unsafe fn from_raw_parts(
+        address: *mut u8,
+        map_size: usize,
+        ring_buffer_size: usize,
+        file_name: LoggingClientFileName,
+    ) -> Self {
+        write_bytes(address, 0, size_of::<SharedData>());
+        let shared_data = address.cast::<SharedData>();
+        let half_buffer_size = ring_buffer_size / 2;
+        let linear_space = address.add(size_of::<SharedData>());
+
+        (*shared_data).producer_pid = libc::getpid();
+        (*shared_data).control_block.control_block_even.data = Span {
+            data: linear_space,
+            size: half_buffer_size as u64,
+        };
+        (*shared_data).control_block.control_block_odd.data = Span {
+            data: linear_space.add(half_buffer_size),
+            size: half_buffer_size as u64,
+        };
+        (*shared_data).linear_buffer_1_offset = size_of::<SharedData>() as Length;
+        (*shared_data).linear_buffer_2_offset = (size_of::<SharedData>() + half_buffer_size) as Length;
+        (*shared_data).blob_arena = Span {
+            data: null_mut(),
+            size: 0,
+        };
+        (*shared_data).pool_block_index_even = AtomicU32::new(NO_POOL_BLOCK_INDEX);
+        (*shared_data).pool_block_index_odd = AtomicU32::new(NO_POOL_BLOCK_INDEX);
+        // Make 0-indexed buffer reserved for reader and 1-indexed buffer available for writer.
+        (*shared_data).control_block.switch_count_points_active_for_writing = AtomicU32::new(1);
+
+        Self {
+            address,
+            map_size,
+            shared_data,
+            type_identifier: AtomicU16::new(0),
+            file_name,
+        }
+    }
+
+    fn shared_data(&self) -> &SharedData {
+        // SAFETY: constructed in `from_raw_parts` and valid until drop.
+        unsafe { &*self.shared_data }
+    }
+
+    /// Name and identifier of the shared-memory file.
+    pub fn file_name(&self) -> &LoggingClientFileName {
+        &self.file_name
+    }
+
+    /// Allocates space on buffer and writes the payload with `write_callback`.
+    /// Returns `false` if the entry was dropped.
+    ///
+    /// Thread-safe, lock-free and wait-free.
+    pub fn alloc_and_write<F: FnOnce(&mut [u8])>(
+        &self,
+        type_identifier: TypeIdentifier,
+        payload_size: Length,
+        write_callback: F,
+    ) -> bool {
+        if payload_size > MAX_PAYLOAD_SIZE {
+            self.shared_data()
+                .number_of_drops_invalid_size
+                .fetch_add(1, Ordering::SeqCst);
+            return false;
+        }
+        self.alloc_and_write_entry(now(), type_identifier, payload_size, write_callback)
+    }
+
+    /// A type shall be registered successfully before tracing.
+    /// Registration fails if there is no space left in the buffer, it shall be retried later.
+    /// Datarouter accepts multiple identifiers registered for the same type.
+    ///
+    /// Thread-safe, lock-free and wait-free.
+    pub fn try_register_type(&self, type_info: &[u8]) -> Option<TypeIdentifier> {
+        let identifier_size = size_of::<TypeIdentifier>();
+        let total_size = (identifier_size + type_info.len()) as Length;
+        if total_size > MAX_PAYLOAD_SIZE {
+            self.shared_data()
+                .number_of_drops_invalid_size
+                .fetch_add(1, Ordering::SeqCst);
+            return None;
+        }
+
+        let mut result = None;
+        self.alloc_and_write_entry(now(), REGISTER_TYPE_TOKEN, total_size, |payload| {
+            let type_identifier = self.type_identifier.fetch_add(1, Ordering::SeqCst);
+            payload[..identifier_size].copy_from_slice(&type_identifier.to_ne_bytes());
+            payload[identifier_size..].copy_from_slice(type_info);
+            result = Some(type_identifier);
+        });
+        result
+    }
+
+    fn alloc_and_write_entry<F: FnOnce(&mut [u8])>(
+        &self,
+        time_stamp: i64,
+        type_identifier: TypeIdentifier,
+        payload_size: Length,
+        write_callback: F,
+    ) -> bool {
+        let shared_data = self.shared_data();
+        let total_size = payload_size + size_of::<BufferEntryHeader>() as Length;
+        let Some(acquired) = acquire(&shared_data.control_block, total_size) else {
+            shared_data.number_of_drops_buffer_full.fetch_add(1, Ordering::SeqCst);
+            shared_data
+                .size_of_drops_buffer_full
+                .fetch_add(total_size, Ordering::SeqCst);
+            return false;
+        };
+
+        let header = BufferEntryHeader {
+            time_stamp,
+            type_identifier,
+        };
+        // SAFETY: `acquired` memory of `total_size` bytes is exclusively owned until released.
+        // Header is copied byte-wise as the entry is not aligned.
+        unsafe {
+            copy_nonoverlapping(
+                (&header as *const BufferEntryHeader).cast::<u8>(),
+                acquired.data,
+                size_of::<BufferEntryHeader>(),
+            );
+            let payload = from_raw_parts_mut(acquired.data.add(size_of::<BufferEntryHeader>()), payload_size as usize);
+            write_callback(payload);
+        }
+        release(&shared_data.control_block, &acquired);
+        true
+    }
+
+    /// Toggles the buffer active for writing and returns the buffer intended for reading once released by writers.
+    ///
+    /// Thread-safe only against `alloc_and_write()` and `try_register_type()`, shall not be called concurrently.
+    pub fn read_acquire(&self) -> ReadAcquireResult {
+        // Without pool support, no pool block is ever requested or held.
+        ReadAcquireResult {
+            acquired_buffer: switch(&self.shared_data().control_block),
+            requested_pool_blocks: 0,
+            returned_pool_blocks: 0,
+        }
+    }
+
+    /// Signals Datarouter to switch to detached mode.
+    pub fn detach_writer(&self) {
+        self.shared_data().writer_detached.store(true, Ordering::SeqCst);
+    }
+
+    /// Increments the counter of type registration failures.
+    pub fn increment_type_registration_failures(&self) {
+        self.shared_data()
+            .number_of_drops_type_registration_failed
+            .fetch_add(1, Ordering::SeqCst);
+    }
+
+    /// Number of entries dropped due to full buffer.
+    pub fn number_of_drops_buffer_full(&self) -> Length {
+        self.shared_data().number_of_drops_buffer_full.load(Ordering::SeqCst)
+    }
+}
+
+impl Drop for SharedMemoryWriter {
+    fn drop(&mut self) {
+        self.detach_writer();
+        // SAFETY: mapping created in `create()` and not used afterwards.
+        if unsafe { libc::munmap(self.address.cast(), self.map_size) } != 0 {
+            eprintln!("SharedMemoryWriter: failed to unmap: {}", Error::last_os_error());
+        }
+    }
+}
+
+/// Removes the file, errors are reported and otherwise ignored.
+pub(crate) fn unlink(file_name: &str) {
+    let Ok(path) = CString::new(file_name) else {
+        return;
+    };
+    // SAFETY: FFI call with valid null-terminated string.
+    if unsafe { libc::unlink(path.as_ptr()) } != 0 {
+        eprintln!("Unlinking of '{file_name}' failed: {}", Error::last_os_error());
+    }
+}
+
+fn create_static_file(file_name: LoggingClientFileName) -> Result<(libc::c_int, LoggingClientFileName)> {
+    let path = CString::new(file_name.file_name.as_str()).map_err(Error::other)?;
+    // Unlink an existing file instead of destroying its content, other processes may still use it.
+    // SAFETY: FFI calls with valid null-terminated string.
+    unsafe {
+        if libc::access(path.as_ptr(), libc::F_OK) == 0 {
+            eprintln!("Logging shared memory file: '{}' already exists", file_name.file_name);
+            unlink(&file_name.file_name);
+        }
+    }
+
+    let flags = libc::O_RDWR | libc::O_EXCL | libc::O_CLOEXEC | libc::O_CREAT;
+    // SAFETY: FFI call with valid null-terminated string.
+    let file_descriptor = unsafe { libc::open(path.as_ptr(), flags, FILE_MODE as libc::c_uint) };
+    if file_descriptor < 0 {
+        return Err(Error::last_os_error());
+    }
+    prepare_file(file_descriptor, &file_name)?;
+    Ok((file_descriptor, file_name))
+}
+
+fn create_dynamic_file() -> Result<(libc::c_int, LoggingClientFileName)> {
+    let mut template = format!("{FILE_DIRECTORY}logging-XXXXXX{FILE_SUFFIX}\0").into_bytes();
+    // SAFETY: FFI call with mutable null-terminated template.
+    let file_descriptor = unsafe { libc::mkstemps(template.as_mut_ptr().cast(), FILE_SUFFIX.len() as libc::c_int) };
+    if file_descriptor < 0 {
+        return Err(Error::last_os_error());
+    }
+    template.pop();
+    let file_name = String::from_utf8(template).map_err(Error::other)?;
+    let identifier = file_name[FILE_DIRECTORY.len()..file_name.len() - FILE_SUFFIX.len()].to_string();
+    let file_name = LoggingClientFileName { file_name, identifier };
+    prepare_file(file_descriptor, &file_name)?;
+    Ok((file_descriptor, file_name))
+}
+
+/// Applies permissions, size is applied on mapping.
+fn prepare_file(file_descriptor: libc::c_int, file_name: &LoggingClientFileName) -> Result<()> {
+    // SAFETY: FFI call with valid descriptor.
+    if unsafe { libc::fchmod(file_descriptor, FILE_MODE) } != 0 {
+        let error = Error::last_os_error();
+        // SAFETY: FFI call with valid descriptor.
+        unsafe { libc::close(file_descriptor) };
+        unlink(&file_name.file_name);
+        return Err(error);
+    }
+    Ok(())
+}
+
+/// Truncates the file to `map_size` and maps it, the descriptor is closed.
+fn map_file(file_descriptor: libc::c_int, map_size: usize) -> Result<*mut u8> {
+    // SAFETY: FFI calls with valid descriptor, the mapping stays valid after closing the descriptor.
+    unsafe {
+        if libc::ftruncate(file_descriptor, map_size as libc::off_t) != 0 {
+            let error = Error::last_os_error();
+            libc::close(file_descriptor);
+            return Err(error);
+        }
+        let address = libc::mmap(
+            null_mut(),
+            map_size,
+            libc::PROT_READ | libc::PROT_WRITE,
+            libc::MAP_SHARED,
+            file_descriptor,
+            0,
+        );
+        let error = Error::last_os_error();
+        libc::close(file_descriptor);
+        if address == libc::MAP_FAILED {
+            return Err(error);
+        }
+        Ok(address.cast())
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use core::sync::atomic::Ordering;
+
+    const RING_BUFFER_SIZE: usize = 1024;
+
+    #[test]
+    fn test_static_file_name() {
+        let file_name = LoggingClientFileName::from_app_id("APP", 1000);
+        assert_eq!(file_name.file_name, "/tmp/logging.APP.1000.shmem");
+        assert_eq!(file_name.identifier, "logging.APP.1000");
+    }
+
+    #[test]
+    fn test_create_dynamic() {
+        let writer = SharedMemoryWriter::create(RING_BUFFER_SIZE, true, "APP").expect("create failed");
+        let file_name = writer.file_name().clone();
+        assert!(file_name.file_name.starts_with("/tmp/logging-"));
+        assert_eq!(file_name.identifier.len(), "logging-XXXXXX".len());
+
+        let shared_data = writer.shared_data();
+        assert_eq!(shared_data.linear_buffer_1_offset, size_of::<SharedData>() as u64);
+        assert_eq!(
+            shared_data.linear_buffer_2_offset,
+            (size_of::<SharedData>() + RING_BUFFER_SIZE / 2) as u64
+        );
+        assert_eq!(shared_data.control_block.control_block_even.data.size, (RING_BUFFER_SIZE / 2) as u64);
+        assert_eq!(shared_data.pool_block_index_odd.load(Ordering::SeqCst), NO_POOL_BLOCK_INDEX);
+        drop(writer);
+        unlink(&file_name.file_name);
+    }
+
+    #[test]
+    fn test_register_and_write() {
+        let writer = SharedMemoryWriter::create(RING_BUFFER_SIZE, true, "APP").expect("create failed");
+        assert_eq!(writer.try_register_type(b"type"), Some(0));
+        assert_eq!(writer.try_register_type(b"type"), Some(1));
+        assert!(writer.alloc_and_write(0, 8, |payload| payload.fill(0xAB)));
+        assert!(!writer.alloc_and_write(0, MAX_PAYLOAD_SIZE + 1, |_| {}));
+        assert_eq!(writer.shared_data().number_of_drops_invalid_size.load(Ordering::SeqCst), 1);
+
+        while writer.alloc_and_write(0, 8, |_| {}) {}
+        assert_eq!(writer.number_of_drops_buffer_full(), 1);
+        assert_eq!(writer.read_acquire().acquired_buffer, 1);
+
+        let file_name = writer.file_name().file_name.clone();
+        drop(writer);
+        unlink(&file_name);
+    }
+}
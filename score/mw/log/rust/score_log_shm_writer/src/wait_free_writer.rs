@@ -0,0 +1,296 @@
+// *******************************************************************************
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// <https://www.apache.org/licenses/LICENSE-2.0>
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+//! Wait-free alternating writer.
+//!
+//! Port of `WaitFreeLinearWriter`, `WaitFreeAlternatingWriter` and `AlternatingReaderProxy::Switch()`.
+//! Atomic operations and memory orderings follow the C++ implementation one-to-one,
+//! C++ operations without explicit ordering are sequentially consistent.
+
+use crate::layout::{
+    AlternatingControlBlock, Length, LinearControlBlock, LENGTH_OFFSET_BYTES, MAX_ACQUIRE_LENGTH_BYTES,
+    MAX_LINEAR_BUFFER_CAPACITY_BYTES, MAX_NUMBER_OF_CONCURRENT_WRITERS,
+};
+use core::ptr::copy_nonoverlapping;
+use core::sync::atomic::{fence, Ordering};
+
+/// Selects one of linear control blocks.
+#[derive(Clone, Copy, Debug, PartialEq, Eq)]
+pub enum BlockId {
+    Even,
+    Odd,
+}
+
+impl BlockId {
+    /// Block selected by the switch count.
+    pub fn from_switch_count(count: u32) -> Self {
+        if count % 2 == 0 {
+            BlockId::Even
+        } else {
+            BlockId::Odd
+        }
+    }
+
+    pub fn opposite(self) -> Self {
+        match self {
+            BlockId::Even => BlockId::Odd,
+            BlockId::Odd => BlockId::Even,
+        }
+    }
+}
+
+/// Memory acquired for writing.
+/// It must be released with `release()` once written.
+pub struct AcquiredData {
+    pub block_id: BlockId,
+    pub data: *mut u8,
+    pub length: Length,
+}
+
+fn select(block_id: BlockId, control_block: &AlternatingControlBlock) -> &LinearControlBlock {
+    match block_id {
+        BlockId::Even => &control_block.control_block_even,
+        BlockId::Odd => &control_block.control_block_odd,
+    }
+}
+
+/// Returns true if `number_of_bytes` fit in a buffer of `buffer_size` at the `offset`.
+fn do_bytes_fit_in_remaining_capacity(buffer_size: Length, offset: Length, number_of_bytes: Length) -> bool {
+    offset <= buffer_size && number_of_bytes <= buffer_size - offset
+}
+
+/// Writes `value` at `offset` of the linear buffer.
+///
+/// # Safety
+///
+/// `offset + LENGTH_OFFSET_BYTES` must be within the buffer.
+unsafe fn write_length(control_block: &LinearControlBlock, offset: Length, value: Length) {
+    let bytes = value.to_ne_bytes();
+    copy_nonoverlapping(bytes.as_ptr(), control_block.data.data.add(offset as usize), bytes.len());
+}
+
+/// The atomic counter was already incremented, but the payload does not fit anymore.
+/// Write at least the length to signal a failed acquisition to the reader, if it fits.
+fn terminate_buffer(control_block: &LinearControlBlock, offset: Length, length: Length) {
+    if do_bytes_fit_in_remaining_capacity(control_block.data.size, offset, LENGTH_OFFSET_BYTES) {
+        // SAFETY: bounds checked above.
+        unsafe { write_length(control_block, offset, length) };
+    }
+    // `written_index` must be incremented even for failed acquisitions,
+    // reader checks `written_index == acquired_index` to determine all writers finished.
+    control_block
+        .written_index
+        .fetch_add(length + LENGTH_OFFSET_BYTES, Ordering::SeqCst);
+}
+
+fn check_and_get_acquire_offset(
+    control_block: &LinearControlBlock,
+    length: Length,
+    writer_concurrency: Length,
+) -> Option<Length> {
+    if writer_concurrency > MAX_NUMBER_OF_CONCURRENT_WRITERS || length > MAX_ACQUIRE_LENGTH_BYTES {
+        return None;
+    }
+
+    let total_acquired_length = length + LENGTH_OFFSET_BYTES;
+    // Check if it makes sense to increment the atomic counter, or if the buffer is already full.
+    let old_offset = control_block.acquired_index.load(Ordering::SeqCst);
+    if old_offset >= MAX_LINEAR_BUFFER_CAPACITY_BYTES
+        || !do_bytes_fit_in_remaining_capacity(control_block.data.size, old_offset, total_acquired_length)
+    {
+        return None;
+    }
+
+    let offset = control_block
+        .acquired_index
+        .fetch_add(total_acquired_length, Ordering::SeqCst);
+    if !do_bytes_fit_in_remaining_capacity(control_block.data.size, offset, total_acquired_length) {
+        // Someone was faster, buffer is full meanwhile.
+        terminate_buffer(control_block, offset, length);
+        return None;
+    }
+    Some(offset)
+}
+
+/// Acquires `length` bytes on a linear buffer.
+/// Returns pointer to the payload.
+fn linear_acquire(control_block: &LinearControlBlock, length: Length) -> Option<*mut u8> {
+    control_block.number_of_writers.fetch_add(1, Ordering::SeqCst);
+    let writer_concurrency = control_block.number_of_writers.load(Ordering::SeqCst);
+
+    let Some(offset) = check_and_get_acquire_offset(control_block, length, writer_concurrency) else {
+        control_block.number_of_writers.fetch_sub(1, Ordering::SeqCst);
+        return None;
+    };
+
+    // SAFETY: bounds checked in `check_and_get_acquire_offset`.
+    unsafe {
+        write_length(control_block, offset, length);
+        Some(control_block.data.data.add((offset + LENGTH_OFFSET_BYTES) as usize))
+    }
+}
+
+fn linear_release(control_block: &LinearControlBlock, length: Length) {
+    // Fence is needed to ensure non atomic data is seen as written before the index is updated.
+    fence(Ordering::Release);
+    control_block
+        .written_index
+        .fetch_add(length + LENGTH_OFFSET_BYTES, Ordering::SeqCst);
+    control_block.number_of_writers.fetch_sub(1, Ordering::SeqCst);
+}
+
+/// For a given loaded switch counter value, increases `number_of_writers` of the selected block.
+fn acquire_block(loaded_switch_count: u32, control_block: &AlternatingControlBlock) -> Option<BlockId> {
+    let candidate_block_id = BlockId::from_switch_count(loaded_switch_count);
+    let candidate_block = select(candidate_block_id, control_block);
+    // Mark the try to acquire given block. This blocks the reader from progressing.
+    candidate_block.number_of_writers.fetch_add(1, Ordering::Acquire);
+    let check_switch_count = control_block
+        .switch_count_points_active_for_writing
+        .load(Ordering::SeqCst);
+    let next_switch_count = loaded_switch_count.wrapping_add(1);
+
+    if check_switch_count == loaded_switch_count {
+        // Switch has not happened, block is acquired.
+        return Some(candidate_block_id);
+    }
+
+    if check_switch_count == next_switch_count {
+        // Switch happened before `number_of_writers` was incremented, candidate block is reserved by the reader.
+        // Acquire the other block before releasing the candidate to block progress of the reader.
+        let changed_block_id = candidate_block_id.opposite();
+        let changed_block = select(changed_block_id, control_block);
+        changed_block.number_of_writers.fetch_add(1, Ordering::Acquire);
+        let second_check_switch_count = control_block
+            .switch_count_points_active_for_writing
+            .load(Ordering::SeqCst);
+        candidate_block.number_of_writers.fetch_sub(1, Ordering::Release);
+        if second_check_switch_count != next_switch_count {
+            changed_block.number_of_writers.fetch_sub(1, Ordering::Release);
+            return None;
+        }
+        return Some(changed_block_id);
+    }
+
+    // Switch happened more than once, this shall not happen while a writer holds a block.
+    candidate_block.number_of_writers.fetch_sub(1, Ordering::Release);
+    None
+}
+
+/// Acquires `length` bytes on the block active for writing.
+/// Thread-safe, lock-free and wait-free.
+pub fn acquire(control_block: &AlternatingControlBlock, length: Length) -> Option<AcquiredData> {
+    let switch_count = control_block
+        .switch_count_points_active_for_writing
+        .load(Ordering::SeqCst);
+    let block_id = acquire_block(switch_count, control_block)?;
+    let linear_block = select(block_id, control_block);
+    let acquired = linear_acquire(linear_block, length).map(|data| AcquiredData {
+        block_id,
+        data,
+        length,
+    });
+    // Finish the selection, block is still acquired by the linear writer.
+    linear_block.number_of_writers.fetch_sub(1, Ordering::SeqCst);
+    acquired
+}
+
+/// Releases data acquired by `acquire()`.
+pub fn release(control_block: &AlternatingControlBlock, acquired_data: &AcquiredData) {
+    linear_release(select(acquired_data.block_id, control_block), acquired_data.length);
+}
+
+/// Toggles the block active for writing and returns the switch count of the block intended for reading.
+/// Shall not be called concurrently.
+pub fn switch(control_block: &AlternatingControlBlock) -> u32 {
+    let switch_count = control_block
+        .switch_count_points_active_for_writing
+        .load(Ordering::SeqCst);
+    let restarting_block = select(BlockId::from_switch_count(switch_count).opposite(), control_block);
+    // Reset counters for writing new data into restarting block.
+    restarting_block.acquired_index.swap(0, Ordering::SeqCst);
+    restarting_block.written_index.swap(0, Ordering::SeqCst);
+    // Switch the active buffer for future writers.
+    let saved_switch_count = control_block
+        .switch_count_points_active_for_writing
+        .fetch_add(1, Ordering::SeqCst);
+    fence(Ordering::Release);
+    saved_switch_count
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use crate::layout::Span;
+    use core::sync::atomic::{AtomicU32, AtomicU64};
+
+    fn linear_control_block(buffer: &mut [u8]) -> LinearControlBlock {
+        LinearControlBlock {
+            data: Span {
+                data: buffer.as_mut_ptr(),
+                size: buffer.len() as u64,
+            },
+            acquired_index: AtomicU64::new(0),
+            written_index: AtomicU64::new(0),
+            number_of_writers: AtomicU64::new(0),
+        }
+    }
+
+    #[test]
+    fn test_block_id_from_switch_count() {
+        assert_eq!(BlockId::from_switch_count(0), BlockId::Even);
+        assert_eq!(BlockId::from_switch_count(1), BlockId::Odd);
+        assert_eq!(BlockId::from_switch_count(u32::MAX), BlockId::Odd);
+        assert_eq!(BlockId::Even.opposite(), BlockId::Odd);
+    }
+
+    #[test]
+    fn test_acquire_release_switch() {
+        let mut even = [0u8; 64];
+        let mut odd = [0u8; 64];
+        let control_block = AlternatingControlBlock {
+            control_block_even: linear_control_block(&mut even),
+            control_block_odd: linear_control_block(&mut odd),
+            switch_count_points_active_for_writing: AtomicU32::new(1),
+        };
+
+        let acquired = acquire(&control_block, 16).expect("acquire failed");
+        assert_eq!(acquired.block_id, BlockId::Odd);
+        release(&control_block, &acquired);
+
+        let odd_block = &control_block.control_block_odd;
+        assert_eq!(odd_block.acquired_index.load(Ordering::SeqCst), 24);
+        assert_eq!(odd_block.written_index.load(Ordering::SeqCst), 24);
+        assert_eq!(odd_block.number_of_writers.load(Ordering::SeqCst), 0);
+
+        assert_eq!(switch(&control_block), 1);
+        assert_eq!(acquire(&control_block, 16).map(|a| a.block_id), Some(BlockId::Even));
+    }
+
+    #[test]
+    fn test_acquire_full_buffer_terminates() {
+        let mut even = [0u8; 32];
+        let mut odd = [0u8; 32];
+        let control_block = AlternatingControlBlock {
+            control_block_even: linear_control_block(&mut even),
+            control_block_odd: linear_control_block(&mut odd),
+            switch_count_points_active_for_writing: AtomicU32::new(1),
+        };
+
+        assert!(acquire(&control_block, 32).is_none());
+        let acquired = acquire(&control_block, 24).expect("acquire failed");
+        release(&control_block, &acquired);
+        assert!(acquire(&control_block, 1).is_none());
+        assert_eq!(control_block.control_block_odd.number_of_writers.load(Ordering::SeqCst), 0);
+    }
+}
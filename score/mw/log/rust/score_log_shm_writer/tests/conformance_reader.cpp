@@ -0,0 +1,142 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+// C++ side of conformance tests. Exposes the Datarouter `SharedMemoryReader` and message definitions to Rust.
+
+#include "score/mw/log/detail/data_router/data_router_messages.h"
+#include "score/mw/log/detail/data_router/shared_memory/reader_factory.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+
+using namespace score::mw::log::detail;
+
+extern "C" {
+/// @brief Callback receiving a type registration or a record.
+using ConformanceCallback = void (*)(void* context, uint16_t type_identifier, int64_t time_stamp, const char* data,
+                                     size_t size);
+
+/// @brief Sizes of shared-memory objects.
+struct ConformanceLayout {
+    size_t shared_data_size;
+    size_t shared_data_producer_pid_offset;
+    size_t shared_data_pool_block_index_odd_offset;
+    size_t buffer_entry_header_size;
+    size_t read_acquire_result_size;
+};
+
+/// @brief Get layout of shared-memory objects.
+/// @param layout Output.
+void conformance_layout(ConformanceLayout* layout) {
+    layout->shared_data_size = sizeof(SharedData);
+    layout->shared_data_producer_pid_offset = offsetof(SharedData, producer_pid);
+    layout->shared_data_pool_block_index_odd_offset = offsetof(SharedData, pool_block_index_odd);
+    layout->buffer_entry_header_size = sizeof(BufferEntryHeader);
+    layout->read_acquire_result_size = sizeof(ReadAcquireResult);
+}
+
+/// @brief Get current time of the clock used for `BufferEntryHeader`.
+/// @return Time since epoch in clock ticks.
+int64_t conformance_now() {
+    return static_cast<int64_t>(TimePoint::clock::now().time_since_epoch().count());
+}
+
+/// @brief Create reader the same way Datarouter does.
+/// @param file_descriptor Descriptor of the shared-memory file.
+/// @param expected_pid    Pid of the writer process.
+/// @return Reader, `nullptr` if rejected.
+ISharedMemoryReader* conformance_reader_create(int32_t file_descriptor, pid_t expected_pid) {
+    auto factory = ReaderFactory::Default(score::cpp::pmr::get_default_resource());
+    return factory->Create(file_descriptor, expected_pid).release();
+}
+
+/// @brief Destroy reader.
+/// @param reader Reader.
+void conformance_reader_destroy(ISharedMemoryReader* reader) { delete reader; }
+
+/// @brief Check if all writers released the acquired buffer.
+/// @param reader          Reader.
+/// @param acquired_buffer Value of `ReadAcquireResult` sent by the client.
+/// @return `true` if released.
+bool conformance_reader_is_released(ISharedMemoryReader* reader, uint32_t acquired_buffer) {
+    return reader->IsBlockReleasedByWriters(acquired_buffer);
+}
+
+/// @brief Read acquired buffer, or the remaining data if writer is detached.
+/// @param reader          Reader.
+/// @param acquired_buffer Value of `ReadAcquireResult` sent by the client.
+/// @param detached        Read in detached mode, `acquired_buffer` is ignored.
+/// @param context         Passed to callbacks.
+/// @param on_type         Called for each type registration.
+/// @param on_record       Called for each record.
+/// @return Number of bytes read, -1 if reading failed.
+int64_t conformance_reader_read(ISharedMemoryReader* reader, uint32_t acquired_buffer, bool detached, void* context,
+                                ConformanceCallback on_type, ConformanceCallback on_record) {
+    const TypeRegistrationCallback type_callback = [context, on_type](const TypeRegistration& registration) noexcept {
+        on_type(context, registration.type_id, 0, registration.registration_data.data(),
+                static_cast<size_t>(registration.registration_data.size()));
+    };
+    const NewRecordCallback record_callback = [context, on_record](const SharedMemoryRecord& record) noexcept {
+        on_record(context, record.header.type_identifier,
+                  static_cast<int64_t>(record.header.time_stamp.time_since_epoch().count()), record.payload.data(),
+                  static_cast<size_t>(record.payload.size()));
+    };
+
+    std::optional<Length> result{};
+    if (detached) {
+        result = reader->ReadDetached(type_callback, record_callback);
+    } else {
+        if (!reader->NotifyAcquisitionSetReader(ReadAcquireResult{acquired_buffer}).has_value()) {
+            return -1;
+        }
+        result = reader->Read(type_callback, record_callback);
+    }
+    return result.has_value() ? static_cast<int64_t>(result.value()) : -1;
+}
+
+/// @brief Get number of records dropped due to full buffer.
+/// @param reader Reader.
+/// @return Number of drops.
+uint64_t conformance_reader_drops_buffer_full(ISharedMemoryReader* reader) {
+    return reader->GetNumberOfDropsWithBufferFull();
+}
+
+/// @brief Serialize connect message the same way C++ clients do.
+/// @param app_id                 Application identifier.
+/// @param app_id_size            Application identifier size.
+/// @param uid                    User id.
+/// @param use_dynamic_identifier Dynamic identifier flag.
+/// @param random_part            6 characters of random part.
+/// @param output                 Output buffer of `output_size` bytes.
+/// @param output_size            Output buffer size.
+/// @return Number of serialized bytes, 0 if output is too small.
+size_t conformance_serialize_connect(const char* app_id, size_t app_id_size, uint32_t uid,
+                                     bool use_dynamic_identifier, const char* random_part, uint8_t* output,
+                                     size_t output_size) {
+    std::array<std::string::value_type, 6> random{};
+    std::memcpy(random.data(), random_part, random.size());
+    const ConnectMessageFromClient message{
+        LoggingIdentifier{std::string_view{app_id, app_id_size}}, static_cast<uid_t>(uid), use_dynamic_identifier,
+        random};
+    const auto serialized = SerializeMessage(DatarouterMessageIdentifier::kConnect, message);
+    if (serialized.size() > output_size) {
+        return 0;
+    }
+    std::memcpy(output, serialized.data(), serialized.size());
+    return serialized.size();
+}
+}
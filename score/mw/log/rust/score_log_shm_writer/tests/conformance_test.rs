@@ -0,0 +1,339 @@
+// *******************************************************************************
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// <https://www.apache.org/licenses/LICENSE-2.0>
+//
+// SPDX-License-Identifier: Apache-2.0
+// *******************************************************************************
+
+//! Conformance of the Rust writer against the C++ `SharedMemoryReader` used by Datarouter.
+
+use core::ffi::{c_char, c_void};
+use core::mem::{offset_of, size_of};
+use core::slice::from_raw_parts;
+use score_log_shm_writer::layout::{BufferEntryHeader, ReadAcquireResult, SharedData};
+use score_log_shm_writer::{ConnectMessage, SharedMemoryWriter};
+use std::ffi::CString;
+use std::sync::atomic::{AtomicBool, Ordering};
+use std::sync::Arc;
+use std::thread;
+
+#[repr(C)]
+#[derive(Default)]
+struct ConformanceLayout {
+    shared_data_size: usize,
+    shared_data_producer_pid_offset: usize,
+    shared_data_pool_block_index_odd_offset: usize,
+    buffer_entry_header_size: usize,
+    read_acquire_result_size: usize,
+}
+
+#[repr(C)]
+struct Reader {
+    _private: [u8; 0],
+}
+
+type ConformanceCallback =
+    extern "C" fn(context: *mut c_void, type_identifier: u16, time_stamp: i64, data: *const c_char, size: usize);
+
+unsafe extern "C" {
+    fn conformance_layout(layout: *mut ConformanceLayout);
+    fn conformance_now() -> i64;
+    fn conformance_reader_create(file_descriptor: i32, expected_pid: i32) -> *mut Reader;
+    fn conformance_reader_destroy(reader: *mut Reader);
+    fn conformance_reader_is_released(reader: *mut Reader, acquired_buffer: u32) -> bool;
+    fn conformance_reader_read(
+        reader: *mut Reader,
+        acquired_buffer: u32,
+        detached: bool,
+        context: *mut c_void,
+        on_type: ConformanceCallback,
+        on_record: ConformanceCallback,
+    ) -> i64;
+    fn conformance_reader_drops_buffer_full(reader: *mut Reader) -> u64;
+    fn conformance_serialize_connect(
+        app_id: *const c_char,
+        app_id_size: usize,
+        uid: u32,
+        use_dynamic_identifier: bool,
+        random_part: *const c_char,
+        output: *mut u8,
+        output_size: usize,
+    ) -> usize;
+}
+
+#[derive(Debug, Default)]
+struct ReadEntries {
+    types: Vec<(u16, Vec<u8>)>,
+    records: Vec<(u16, i64, Vec<u8>)>,
+}
+
+extern "C" fn on_type(context: *mut c_void, type_identifier: u16, _time_stamp: i64, data: *const c_char, size: usize) {
+    // SAFETY: context is `ReadEntries` provided by `read()`, data is valid for the callback duration.
+    unsafe {
+        let entries = &mut *context.cast::<ReadEntries>();
+        entries
+            .types
+            .push((type_identifier, from_raw_parts(data.cast::<u8>(), size).to_vec()));
+    }
+}
+
+extern "C" fn on_record(context: *mut c_void, type_identifier: u16, time_stamp: i64, data: *const c_char, size: usize) {
+    // SAFETY: context is `ReadEntries` provided by `read()`, data is valid for the callback duration.
+    unsafe {
+        let entries = &mut *context.cast::<ReadEntries>();
+        entries
+            .records
+            .push((type_identifier, time_stamp, from_raw_parts(data.cast::<u8>(), size).to_vec()));
+    }
+}
+
+/// Datarouter side of a connection, maps the file created by the Rust writer.
+struct DatarouterReader {
+    reader: *mut Reader,
+}
+
+impl DatarouterReader {
+    fn open(writer: &SharedMemoryWriter) -> Self {
+        let path = CString::new(writer.file_name().file_name.as_str()).unwrap();
+        // SAFETY: FFI calls with valid arguments, descriptor is closed after mapping.
+        unsafe {
+            let file_descriptor = libc::open(path.as_ptr(), libc::O_RDONLY);
+            assert!(file_descriptor >= 0, "failed to open shared-memory file");
+            let reader = conformance_reader_create(file_descriptor, libc::getpid());
+            libc::close(file_descriptor);
+            assert!(!reader.is_null(), "reader rejected shared-memory file");
+            Self { reader }
+        }
+    }
+
+    fn read(&self, acquired: ReadAcquireResult) -> Option<ReadEntries> {
+        let mut entries = ReadEntries::default();
+        // SAFETY: FFI call, reader is valid and `entries` outlives the call.
+        let result = unsafe {
+            conformance_reader_read(
+                self.reader,
+                acquired.acquired_buffer,
+                false,
+                (&mut entries as *mut ReadEntries).cast(),
+                on_type,
+                on_record,
+            )
+        };
+        (result >= 0).then_some(entries)
+    }
+
+    fn read_detached(&self) -> ReadEntries {
+        let mut entries = ReadEntries::default();
+        // SAFETY: FFI call, reader is valid and `entries` outlives the call.
+        unsafe {
+            conformance_reader_read(
+                self.reader,
+                0,
+                true,
+                (&mut entries as *mut ReadEntries).cast(),
+                on_type,
+                on_record,
+            )
+        };
+        entries
+    }
+
+    fn is_released(&self, acquired: ReadAcquireResult) -> bool {
+        // SAFETY: FFI call, reader is valid.
+        unsafe { conformance_reader_is_released(self.reader, acquired.acquired_buffer) }
+    }
+
+    fn drops_buffer_full(&self) -> u64 {
+        // SAFETY: FFI call, reader is valid.
+        unsafe { conformance_reader_drops_buffer_full(self.reader) }
+    }
+}
+
+impl Drop for DatarouterReader {
+    fn drop(&mut self) {
+        // SAFETY: FFI call, reader is valid and not used afterwards.
+        unsafe { conformance_reader_destroy(self.reader) };
+    }
+}
+
+fn create_writer(ring_buffer_size: usize) -> SharedMemoryWriter {
+    SharedMemoryWriter::create(ring_buffer_size, true, "CONF").expect("failed to create writer")
+}
+
+fn remove_file(writer: &SharedMemoryWriter) {
+    let _ = std::fs::remove_file(&writer.file_name().file_name);
+}
+
+#[test]
+fn test_layout_matches_cpp() {
+    let mut layout = ConformanceLayout::default();
+    // SAFETY: FFI call with valid pointer.
+    unsafe { conformance_layout(&mut layout) };
+
+    assert_eq!(layout.shared_data_size, size_of::<SharedData>());
+    assert_eq!(layout.shared_data_producer_pid_offset, offset_of!(SharedData, producer_pid));
+    assert_eq!(
+        layout.shared_data_pool_block_index_odd_offset,
+        offset_of!(SharedData, pool_block_index_odd)
+    );
+    assert_eq!(layout.buffer_entry_header_size, size_of::<BufferEntryHeader>());
+    assert_eq!(layout.read_acquire_result_size, size_of::<ReadAcquireResult>());
+}
+
+#[test]
+fn test_connect_message_matches_cpp() {
+    let message = ConnectMessage {
+        app_id: *b"APP\0",
+        uid: 1234,
+        use_dynamic_identifier: true,
+        random_part: *b"Ab1Cd2",
+    };
+    let mut expected = [0u8; 32];
+    // SAFETY: FFI call with valid buffers.
+    let size = unsafe {
+        conformance_serialize_connect(
+            b"APP".as_ptr().cast(),
+            3,
+            message.uid,
+            message.use_dynamic_identifier,
+            message.random_part.as_ptr().cast(),
+            expected.as_mut_ptr(),
+            expected.len(),
+        )
+    };
+    assert_eq!(message.serialize().as_slice(), &expected[..size]);
+}
+
+#[test]
+fn test_reader_reads_types_and_records() {
+    let writer = create_writer(4096);
+    let reader = DatarouterReader::open(&writer);
+    remove_file(&writer);
+
+    // SAFETY: parameter-less FFI call.
+    let before = unsafe { conformance_now() };
+    let type_identifier = writer.try_register_type(b"log_entry").expect("registration failed");
+    assert!(writer.alloc_and_write(type_identifier, 5, |payload| payload.copy_from_slice(b"hello")));
+    assert!(writer.alloc_and_write(type_identifier, 0, |_| {}));
+    // SAFETY: parameter-less FFI call.
+    let after = unsafe { conformance_now() };
+
+    let acquired = writer.read_acquire();
+    assert!(reader.is_released(acquired));
+    let entries = reader.read(acquired).expect("read failed");
+
+    assert_eq!(entries.types, vec![(type_identifier, b"log_entry".to_vec())]);
+    assert_eq!(entries.records.len(), 2);
+    assert_eq!(entries.records[0].0, type_identifier);
+    assert_eq!(entries.records[0].2, b"hello".to_vec());
+    assert!(entries.records[1].2.is_empty());
+    for (_, time_stamp, _) in &entries.records {
+        assert!(before <= *time_stamp && *time_stamp <= after);
+    }
+}
+
+#[test]
+fn test_reader_alternates_buffers_and_counts_drops() {
+    let writer = create_writer(1024);
+    let reader = DatarouterReader::open(&writer);
+    remove_file(&writer);
+
+    for cycle in 0u8..4 {
+        let mut written = 0;
+        while writer.alloc_and_write(1, 16, |payload| payload.fill(cycle)) {
+            written += 1;
+        }
+        let entries = reader.read(writer.read_acquire()).expect("read failed");
+        assert_eq!(entries.records.len(), written);
+        assert!(entries.records.iter().all(|(_, _, payload)| payload == &vec![cycle; 16]));
+    }
+    assert_eq!(reader.drops_buffer_full(), 4);
+}
+
+#[test]
+fn test_reader_reads_concurrent_writers() {
+    const NUMBER_OF_THREADS: usize = 4;
+    const RECORDS_PER_THREAD: u64 = 10_000;
+
+    let writer = Arc::new(create_writer(64 * 1024));
+    let reader = DatarouterReader::open(&writer);
+    remove_file(&writer);
+    let finished = Arc::new(AtomicBool::new(false));
+
+    let threads: Vec<_> = (0..NUMBER_OF_THREADS)
+        .map(|thread_index| {
+            let writer = Arc::clone(&writer);
+            thread::spawn(move || {
+                let mut written = 0u64;
+                for value in 0..RECORDS_PER_THREAD {
+                    let payload = (thread_index as u64) << 32 | value;
+                    if writer.alloc_and_write(1, 8, |data| data.copy_from_slice(&payload.to_ne_bytes())) {
+                        written += 1;
+                    }
+                }
+                written
+            })
+        })
+        .collect();
+
+    let mut read = 0u64;
+    let mut last_value = [None::<u64>; NUMBER_OF_THREADS];
+    let mut check = |entries: ReadEntries| {
+        for (_, _, payload) in entries.records {
+            let payload = u64::from_ne_bytes(payload.try_into().expect("unexpected payload size"));
+            let thread_index = (payload >> 32) as usize;
+            let value = payload & u64::from(u32::MAX);
+            // Records of a single thread keep their order.
+            assert!(last_value[thread_index].is_none_or(|last| last < value));
+            last_value[thread_index] = Some(value);
+            read += 1;
+        }
+    };
+
+    let finisher = {
+        let finished = Arc::clone(&finished);
+        thread::spawn(move || {
+            let written: u64 = threads.into_iter().map(|thread| thread.join().unwrap()).sum();
+            finished.store(true, Ordering::SeqCst);
+            written
+        })
+    };
+
+    loop {
+        let done = finished.load(Ordering::SeqCst);
+        let acquired = writer.read_acquire();
+        while !reader.is_released(acquired) {
+            thread::yield_now();
+        }
+        check(reader.read(acquired).expect("read failed"));
+        if done {
+            break;
+        }
+    }
+    let written = finisher.join().unwrap();
+    // Last acquire after writers finished leaves the other buffer empty.
+    check(reader.read(writer.read_acquire()).expect("read failed"));
+    assert_eq!(read, written);
+}
+
+#[test]
+fn test_reader_reads_remaining_data_after_detach() {
+    let writer = create_writer(1024);
+    let reader = DatarouterReader::open(&writer);
+    remove_file(&writer);
+
+    let acquired = writer.read_acquire();
+    assert!(reader.read(acquired).expect("read failed").records.is_empty());
+    assert!(writer.alloc_and_write(2, 3, |payload| payload.copy_from_slice(b"bye")));
+    drop(writer);
+
+    let entries = reader.read_detached();
+    assert_eq!(entries.records.len(), 1);
+    assert_eq!(entries.records[0].2, b"bye".to_vec());
+}